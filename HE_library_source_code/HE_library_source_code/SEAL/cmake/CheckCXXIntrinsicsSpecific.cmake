@@ -50,6 +50,22 @@ if(SEAL_USE_INTRIN)
             }"
             SEAL___BUILTIN_CLZLL_FOUND
         )
+
+        # Check for AVX-512 IFMA; the instructions are enabled per function and selected at runtime, so only
+        # compilation is checked
+        check_cxx_source_compiles("
+            #include <immintrin.h>
+            __attribute__((target(\"avx512f,avx512ifma\")))
+            void madd52(unsigned long long *a) {
+                __m512i b = _mm512_loadu_si512(a);
+                _mm512_storeu_si512(a, _mm512_madd52lo_epu64(b, b, b));
+            }
+            int main() {
+                __builtin_cpu_init();
+                return __builtin_cpu_supports(\"avx512ifma\") ? 0 : 1;
+            }"
+            SEAL_AVX512IFMA_FOUND
+        )
     endif()
 
     # Check for _addcarry_u64
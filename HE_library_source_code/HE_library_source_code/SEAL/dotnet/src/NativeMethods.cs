@@ -399,6 +399,39 @@ namespace Microsoft.Research.SEAL
         [DllImport(sealc, PreserveSig = false)]
         internal static extern void Evaluator_ContextUsingKeyswitching(IntPtr thisptr, out bool usingKeySwitching);
 
+        [DllImport(sealc, PreserveSig = false)]
+        internal static extern void Evaluator_GetLevelManagement(IntPtr thisptr, out byte mode);
+
+        [DllImport(sealc, PreserveSig = false)]
+        internal static extern void Evaluator_SetLevelManagement(IntPtr thisptr, byte mode);
+
+        [DllImport(sealc, PreserveSig = false)]
+        internal static extern void Evaluator_EstimateNoiseBudget(IntPtr thisptr, IntPtr encrypted, out int noiseBudget);
+
+        [DllImport(sealc, PreserveSig = false)]
+        internal static extern void Evaluator_MultiplyAsync(IntPtr thisptr, IntPtr encrypted1, IntPtr encrypted2, IntPtr destination, IntPtr pool, AsyncCallback callback, IntPtr userData);
+
+        [DllImport(sealc, PreserveSig = false)]
+        internal static extern void Evaluator_RelinearizeAsync(IntPtr thisptr, IntPtr encrypted, IntPtr relinKeys, IntPtr destination, IntPtr pool, AsyncCallback callback, IntPtr userData);
+
+        [DllImport(sealc, PreserveSig = false)]
+        internal static extern void Evaluator_RotateRowsAsync(IntPtr thisptr, IntPtr encrypted, int steps, IntPtr galoisKeys, IntPtr destination, IntPtr pool, AsyncCallback callback, IntPtr userData);
+
+        [DllImport(sealc, PreserveSig = false)]
+        internal static extern void Evaluator_RotateVectorAsync(IntPtr thisptr, IntPtr encrypted, int steps, IntPtr galoisKeys, IntPtr destination, IntPtr pool, AsyncCallback callback, IntPtr userData);
+
+        [DllImport(sealc, PreserveSig = false)]
+        internal static extern void Evaluator_MultiplyBatch(IntPtr thisptr, ulong count, IntPtr[] encrypteds1, IntPtr[] encrypteds2, IntPtr[] destinations, IntPtr pool);
+
+        [DllImport(sealc, PreserveSig = false)]
+        internal static extern void Evaluator_RelinearizeBatch(IntPtr thisptr, ulong count, IntPtr[] encrypteds, IntPtr relinKeys, IntPtr[] destinations, IntPtr pool);
+
+        [DllImport(sealc, PreserveSig = false)]
+        internal static extern void Evaluator_RotateRowsBatch(IntPtr thisptr, ulong count, IntPtr[] encrypteds, int steps, IntPtr galoisKeys, IntPtr[] destinations, IntPtr pool);
+
+        [DllImport(sealc, PreserveSig = false)]
+        internal static extern void Evaluator_RotateVectorBatch(IntPtr thisptr, ulong count, IntPtr[] encrypteds, int steps, IntPtr galoisKeys, IntPtr[] destinations, IntPtr pool);
+
 #endregion
 
 #region Ciphertext methods
@@ -490,6 +523,12 @@ namespace Microsoft.Research.SEAL
         [DllImport(sealc, PreserveSig = false)]
         internal static extern void Ciphertext_SetCorrectionFactor(IntPtr thisptr, ulong correctionFactor);
 
+        [DllImport(sealc, PreserveSig = false)]
+        internal static extern void Ciphertext_NoiseEstimate(IntPtr thisptr, out double noiseEstimate);
+
+        [DllImport(sealc, PreserveSig = false)]
+        internal static extern void Ciphertext_SetNoiseEstimate(IntPtr thisptr, double noiseEstimate);
+
         [DllImport(sealc, PreserveSig = false)]
         internal static extern void Ciphertext_Release(IntPtr thisptr);
 
@@ -719,6 +758,13 @@ namespace Microsoft.Research.SEAL
         [DllImport(sealc, PreserveSig = false)]
         internal static extern void KeyGenerator_ContextUsingKeyswitching(IntPtr thisptr, out bool result);
 
+        // relinKeys and galoisKeys point to unmanaged memory that receives the handle before the callback is invoked
+        [DllImport(sealc, PreserveSig = false)]
+        internal static extern void KeyGenerator_CreateRelinKeysAsync(IntPtr thisptr, bool save_seed, IntPtr relinKeys, AsyncCallback callback, IntPtr userData);
+
+        [DllImport(sealc, PreserveSig = false)]
+        internal static extern void KeyGenerator_CreateGaloisKeysFromStepsAsync(IntPtr thisptr, ulong count, int[] steps, bool save_seed, IntPtr galoisKeys, AsyncCallback callback, IntPtr userData);
+
 #endregion
 
 #region RelinKeys methods
@@ -909,6 +955,12 @@ namespace Microsoft.Research.SEAL
         [DllImport(sealc, PreserveSig = false)]
         internal static extern void Encryptor_Destroy(IntPtr thisptr);
 
+        [DllImport(sealc, PreserveSig = false)]
+        internal static extern void Encryptor_EncryptAsync(IntPtr thisptr, IntPtr plaintext, IntPtr destination, IntPtr poolHandle, AsyncCallback callback, IntPtr userData);
+
+        [DllImport(sealc, PreserveSig = false)]
+        internal static extern void Encryptor_EncryptBatch(IntPtr thisptr, ulong count, IntPtr[] plaintexts, IntPtr[] destinations, IntPtr poolHandle);
+
 #endregion
 
 #region Decryptor methods
@@ -1031,6 +1083,26 @@ namespace Microsoft.Research.SEAL
         [DllImport(sealc, PreserveSig = false)]
         internal static extern void Serialization_IsValidHeader(byte[] headerptr, ulong size, out bool result);
 
+#endregion
+
+#region AsyncWorker methods
+
+        /// <summary>
+        /// Completion callback of asynchronous native functions. The delegate must be kept alive until it has been
+        /// invoked, which happens on a native worker thread.
+        /// </summary>
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        internal delegate void AsyncCallback(int result, IntPtr userData);
+
+        [DllImport(sealc, PreserveSig = false)]
+        internal static extern void AsyncWorker_GetThreadCount(out ulong threadCount);
+
+        [DllImport(sealc, PreserveSig = false)]
+        internal static extern void AsyncWorker_SetThreadCount(ulong threadCount);
+
+        [DllImport(sealc, PreserveSig = false)]
+        internal static extern void AsyncWorker_WaitIdle();
+
 #endregion
 
         public static class Errors
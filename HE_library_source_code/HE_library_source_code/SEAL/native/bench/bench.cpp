@@ -53,7 +53,8 @@ namespace sealbench
         // 2. BFV
         // 3. BGV
         // 4. CKKS
-        // 5. Util
+        // 5. Circuits
+        // 6. Util
         int n = static_cast<int>(parms.first);
         int log_q = static_cast<int>(
             bm_env_map.find(parms_ckks)->second->context().key_context_data()->total_coeff_modulus_bit_count());
@@ -142,13 +143,77 @@ namespace sealbench
         {
             SEAL_BENCHMARK_REGISTER(CKKS, n, log_q, EvaluateRelinInplace, bm_ckks_relin_inplace, bm_env_ckks);
             SEAL_BENCHMARK_REGISTER(CKKS, n, log_q, EvaluateRotate, bm_ckks_rotate, bm_env_ckks);
+
+            // Paterson-Stockmeyer evaluation of a degree d polynomial needs ceil(log2(d + 1)) + 1 levels; keep one more
+            // so that the result, at a scale close to the primes, does not end up at the last level
+            size_t ckks_levels = bm_env_ckks->context().first_context_data()->chain_index();
+            if (ckks_levels >= 6)
+            {
+                SEAL_BENCHMARK_REGISTER(
+                    CKKS, n, log_q, EvaluatePolynomialDeg15, bm_ckks_evaluate_polynomial, bm_env_ckks, 15);
+                SEAL_BENCHMARK_REGISTER(
+                    CKKS, n, log_q, EvaluateChebyshevDeg15, bm_ckks_evaluate_chebyshev_series, bm_env_ckks, 15);
+            }
+            if (ckks_levels >= 7)
+            {
+                SEAL_BENCHMARK_REGISTER(
+                    CKKS, n, log_q, EvaluatePolynomialDeg31, bm_ckks_evaluate_polynomial, bm_env_ckks, 31);
+                SEAL_BENCHMARK_REGISTER(
+                    CKKS, n, log_q, EvaluateChebyshevDeg31, bm_ckks_evaluate_chebyshev_series, bm_env_ckks, 31);
+            }
+            if (ckks_levels >= 8)
+            {
+                SEAL_BENCHMARK_REGISTER(
+                    CKKS, n, log_q, EvaluatePolynomialDeg63, bm_ckks_evaluate_polynomial, bm_env_ckks, 63);
+                SEAL_BENCHMARK_REGISTER(
+                    CKKS, n, log_q, EvaluateChebyshevDeg63, bm_ckks_evaluate_chebyshev_series, bm_env_ckks, 63);
+            }
+            if (ckks_levels >= 9)
+            {
+                SEAL_BENCHMARK_REGISTER(
+                    CKKS, n, log_q, EvaluatePolynomialDeg127, bm_ckks_evaluate_polynomial, bm_env_ckks, 127);
+                SEAL_BENCHMARK_REGISTER(
+                    CKKS, n, log_q, EvaluateChebyshevDeg127, bm_ckks_evaluate_chebyshev_series, bm_env_ckks, 127);
+            }
         }
+
+        // Circuits of several primitives; the CKKS product tree of 8 inputs rescales three times
+        if (bm_env_bfv->context().using_keyswitching())
+        {
+            SEAL_BENCHMARK_REGISTER(BFV, n, log_q, CircuitMulAdd, bm_circuit_mul_add, bm_env_bfv);
+            SEAL_BENCHMARK_REGISTER(BFV, n, log_q, CircuitProductTree8, bm_circuit_product_tree, bm_env_bfv, 8);
+            SEAL_BENCHMARK_REGISTER(BFV, n, log_q, CircuitInnerProduct8, bm_circuit_inner_product, bm_env_bfv, 8);
+            SEAL_BENCHMARK_REGISTER(BFV, n, log_q, CircuitMatVec16, bm_circuit_matvec, bm_env_bfv, 16);
+            SEAL_BENCHMARK_REGISTER(BFV, n, log_q, CircuitChain100, bm_circuit_chain, bm_env_bfv, 100, false);
+            SEAL_BENCHMARK_REGISTER(BFV, n, log_q, CircuitChain100Arena, bm_circuit_chain, bm_env_bfv, 100, true);
+        }
+        SEAL_BENCHMARK_REGISTER(BFV, n, log_q, CircuitSerializeRoundTrip, bm_circuit_serialize_round_trip, bm_env_bfv);
+        if (bm_env_ckks->context().using_keyswitching())
+        {
+            size_t ckks_levels = bm_env_ckks->context().first_context_data()->chain_index();
+            SEAL_BENCHMARK_REGISTER(CKKS, n, log_q, CircuitMulAdd, bm_circuit_mul_add, bm_env_ckks);
+            if (ckks_levels >= 3)
+            {
+                SEAL_BENCHMARK_REGISTER(CKKS, n, log_q, CircuitProductTree8, bm_circuit_product_tree, bm_env_ckks, 8);
+            }
+            SEAL_BENCHMARK_REGISTER(CKKS, n, log_q, CircuitInnerProduct8, bm_circuit_inner_product, bm_env_ckks, 8);
+            SEAL_BENCHMARK_REGISTER(CKKS, n, log_q, CircuitMatVec16, bm_circuit_matvec, bm_env_ckks, 16);
+        }
+        SEAL_BENCHMARK_REGISTER(
+            CKKS, n, log_q, CircuitSerializeRoundTrip, bm_circuit_serialize_round_trip, bm_env_ckks);
+
         SEAL_BENCHMARK_REGISTER(UTIL, n, log_q, NTTForward, bm_util_ntt_forward, bm_env_bfv);
         SEAL_BENCHMARK_REGISTER(UTIL, n, log_q, NTTInverse, bm_util_ntt_inverse, bm_env_bfv);
         SEAL_BENCHMARK_REGISTER(UTIL, n, 0, NTTForwardLowLevel, bm_util_ntt_forward_low_level, bm_env_bfv);
         SEAL_BENCHMARK_REGISTER(UTIL, n, 0, NTTInverseLowLevel, bm_util_ntt_inverse_low_level, bm_env_bfv);
         SEAL_BENCHMARK_REGISTER(UTIL, n, 0, NTTForwardLowLevelLazy, bm_util_ntt_forward_low_level_lazy, bm_env_bfv);
         SEAL_BENCHMARK_REGISTER(UTIL, n, 0, NTTInverseLowLevelLazy, bm_util_ntt_inverse_low_level_lazy, bm_env_bfv);
+        if (bm_env_ckks->context().using_keyswitching())
+        {
+            SEAL_BENCHMARK_REGISTER(
+                UTIL, n, log_q, KeySwitchInnerProduct, bm_util_key_switch_inner_product, bm_env_ckks);
+            SEAL_BENCHMARK_REGISTER(UTIL, n, log_q, KeySwitchNTT, bm_util_key_switch_ntt, bm_env_ckks);
+        }
     }
 
 } // namespace sealbench
@@ -213,6 +278,10 @@ int main(int argc, char **argv)
         sealbench::register_bm_family(i, bm_env_map);
     }
 
+    // Bootstrapping uses its own parameters, which are set up on its first run. It takes seconds, so it runs only
+    // once per repetition.
+    RegisterBenchmark("n=65536 / CKKS / Bootstrap", bm_ckks_bootstrap)->Unit(benchmark::kMillisecond)->Iterations(1);
+
     RunSpecifiedBenchmarks();
 
     // After running all benchmark cases, we print again the total memory consumption by SEAL memory pool.
@@ -356,6 +356,21 @@ namespace sealbench
     void bm_util_ntt_forward_low_level_lazy(benchmark::State &state, std::shared_ptr<BMEnv> bm_env);
     void bm_util_ntt_inverse_low_level_lazy(benchmark::State &state, std::shared_ptr<BMEnv> bm_env);
 
+    // Key switching benchmark cases
+    void bm_util_key_switch_inner_product(benchmark::State &state, std::shared_ptr<BMEnv> bm_env);
+    void bm_util_key_switch_ntt(benchmark::State &state, std::shared_ptr<BMEnv> bm_env);
+
+    // Bootstrapping benchmark cases
+    void bm_ckks_bootstrap(benchmark::State &state);
+
+    // Circuit benchmark cases (BFV and CKKS)
+    void bm_circuit_mul_add(benchmark::State &state, std::shared_ptr<BMEnv> bm_env);
+    void bm_circuit_product_tree(benchmark::State &state, std::shared_ptr<BMEnv> bm_env, std::size_t count);
+    void bm_circuit_inner_product(benchmark::State &state, std::shared_ptr<BMEnv> bm_env, std::size_t count);
+    void bm_circuit_matvec(benchmark::State &state, std::shared_ptr<BMEnv> bm_env, std::size_t diagonal_count);
+    void bm_circuit_chain(benchmark::State &state, std::shared_ptr<BMEnv> bm_env, std::size_t op_count, bool use_arena);
+    void bm_circuit_serialize_round_trip(benchmark::State &state, std::shared_ptr<BMEnv> bm_env);
+
     // KeyGen benchmark cases
     void bm_keygen_secret(benchmark::State &state, std::shared_ptr<BMEnv> bm_env);
     void bm_keygen_public(benchmark::State &state, std::shared_ptr<BMEnv> bm_env);
@@ -425,4 +440,7 @@ namespace sealbench
     void bm_ckks_rescale_inplace(benchmark::State &state, std::shared_ptr<BMEnv> bm_env);
     void bm_ckks_relin_inplace(benchmark::State &state, std::shared_ptr<BMEnv> bm_env);
     void bm_ckks_rotate(benchmark::State &state, std::shared_ptr<BMEnv> bm_env);
+    void bm_ckks_evaluate_polynomial(benchmark::State &state, std::shared_ptr<BMEnv> bm_env, std::size_t degree);
+    void bm_ckks_evaluate_chebyshev_series(
+        benchmark::State &state, std::shared_ptr<BMEnv> bm_env, std::size_t degree);
 } // namespace sealbench
@@ -0,0 +1,229 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "seal/seal.h"
+#include "bench.h"
+#include <sstream>
+
+using namespace benchmark;
+using namespace sealbench;
+using namespace seal;
+using namespace std;
+
+/**
+This file defines benchmarks for small circuits that combine several HE primitives, as they appear in applications: a
+product followed by an addition, a product tree, an inner product of ciphertext vectors, a banded matrix-vector product,
+a long chain of operations with and without an arena memory pool, and a serialization round trip. Unlike the benchmarks
+of single primitives, they include the temporaries, relinearizations and rescalings that a pipeline needs. Inputs are
+uniformly random ciphertexts and plaintexts, which is enough for measuring performance.
+*/
+
+namespace sealbench
+{
+    namespace
+    {
+        // Creates count uniformly random ciphertexts at the highest level
+        vector<Ciphertext> random_cts(shared_ptr<BMEnv> bm_env, size_t count)
+        {
+            vector<Ciphertext> result(count);
+            for (auto &ct : result)
+            {
+                ct.resize(bm_env->context(), size_t(2));
+                if (bm_env->parms().scheme() == scheme_type::ckks)
+                {
+                    bm_env->randomize_ct_ckks(ct);
+                    ct.scale() = bm_env->safe_scale();
+                }
+                else
+                {
+                    bm_env->randomize_ct_bfv(ct);
+                }
+            }
+            return result;
+        }
+
+        // Creates count uniformly random plaintexts to multiply with ciphertexts at the highest level
+        vector<Plaintext> random_pts(shared_ptr<BMEnv> bm_env, size_t count)
+        {
+            vector<Plaintext> result(count);
+            for (auto &pt : result)
+            {
+                if (bm_env->parms().scheme() == scheme_type::ckks)
+                {
+                    bm_env->randomize_pt_ckks(pt);
+                    pt.scale() = bm_env->safe_scale();
+                }
+                else
+                {
+                    bm_env->randomize_pt_bfv(pt);
+                }
+            }
+            return result;
+        }
+
+        // Relinearizes a product and, in CKKS, rescales it
+        void finish_product(shared_ptr<BMEnv> bm_env, Ciphertext &ct)
+        {
+            bm_env->evaluator()->relinearize_inplace(ct, bm_env->rlk());
+            if (bm_env->parms().scheme() == scheme_type::ckks)
+            {
+                bm_env->evaluator()->rescale_to_next_inplace(ct);
+            }
+        }
+    } // namespace
+
+    void bm_circuit_mul_add(State &state, shared_ptr<BMEnv> bm_env)
+    {
+        // ct[0] * ct[1] + ct[2]; in CKKS the addend is brought to the level and scale of the product
+        vector<Ciphertext> ct = random_cts(bm_env, 3);
+        Ciphertext addend = ct[2];
+        if (bm_env->parms().scheme() == scheme_type::ckks)
+        {
+            bm_env->evaluator()->mod_switch_to_next_inplace(addend);
+        }
+        Ciphertext result;
+        for (auto _ : state)
+        {
+            bm_env->evaluator()->multiply(ct[0], ct[1], result);
+            finish_product(bm_env, result);
+            addend.scale() = result.scale();
+            bm_env->evaluator()->add_inplace(result, addend);
+        }
+    }
+
+    void bm_circuit_product_tree(State &state, shared_ptr<BMEnv> bm_env, size_t count)
+    {
+        // Multiply count ciphertexts pairwise in a balanced tree of depth log2(count)
+        vector<Ciphertext> ct = random_cts(bm_env, count);
+        vector<Ciphertext> level;
+        for (auto _ : state)
+        {
+            level = ct;
+            while (level.size() > 1)
+            {
+                for (size_t i = 0; i < level.size() / 2; i++)
+                {
+                    bm_env->evaluator()->multiply(level[2 * i], level[2 * i + 1], level[i]);
+                    finish_product(bm_env, level[i]);
+                }
+                level.resize(level.size() / 2);
+            }
+        }
+    }
+
+    void bm_circuit_inner_product(State &state, shared_ptr<BMEnv> bm_env, size_t count)
+    {
+        // Sum of count slot-wise products, relinearized (and rescaled) only once
+        vector<Ciphertext> ct1 = random_cts(bm_env, count);
+        vector<Ciphertext> ct2 = random_cts(bm_env, count);
+        Ciphertext product;
+        Ciphertext result;
+        for (auto _ : state)
+        {
+            bm_env->evaluator()->multiply(ct1[0], ct2[0], result);
+            for (size_t i = 1; i < count; i++)
+            {
+                bm_env->evaluator()->multiply(ct1[i], ct2[i], product);
+                bm_env->evaluator()->add_inplace(result, product);
+            }
+            finish_product(bm_env, result);
+        }
+    }
+
+    void bm_circuit_matvec(State &state, shared_ptr<BMEnv> bm_env, size_t diagonal_count)
+    {
+        // Product of a banded matrix with diagonal_count nonzero diagonals and an encrypted vector, with the
+        // diagonal method: the vector is rotated by one slot at a time and multiplied with the plaintext diagonals
+        vector<Ciphertext> ct = random_cts(bm_env, 1);
+        vector<Plaintext> diagonals = random_pts(bm_env, diagonal_count);
+        bool is_ckks = bm_env->parms().scheme() == scheme_type::ckks;
+        Ciphertext rotated;
+        Ciphertext product;
+        Ciphertext result;
+        for (auto _ : state)
+        {
+            rotated = ct[0];
+            bm_env->evaluator()->multiply_plain(rotated, diagonals[0], result);
+            for (size_t i = 1; i < diagonal_count; i++)
+            {
+                if (is_ckks)
+                {
+                    bm_env->evaluator()->rotate_vector_inplace(rotated, 1, bm_env->glk());
+                }
+                else
+                {
+                    bm_env->evaluator()->rotate_rows_inplace(rotated, 1, bm_env->glk());
+                }
+                bm_env->evaluator()->multiply_plain(rotated, diagonals[i], product);
+                bm_env->evaluator()->add_inplace(result, product);
+            }
+            if (is_ckks)
+            {
+                bm_env->evaluator()->rescale_to_next_inplace(result);
+            }
+        }
+    }
+
+    void bm_circuit_chain(State &state, shared_ptr<BMEnv> bm_env, size_t op_count, bool use_arena)
+    {
+        // A request of op_count operations cycling through addition, multiplication with relinearization, and
+        // rotation, each writing a new ciphertext that lives until the end of the request. With use_arena, the
+        // ciphertexts and all scratch memory come from an arena that is reset after each request.
+        vector<Ciphertext> ct = random_cts(bm_env, 2);
+        MemoryPoolHandle pool = use_arena ? MemoryPoolHandle::Arena() : seal::MemoryManager::GetPool();
+        vector<Ciphertext> temps;
+        temps.reserve(op_count);
+        for (auto _ : state)
+        {
+            {
+                unique_ptr<MMProfGuard> guard;
+                if (use_arena)
+                {
+                    guard = make_unique<MMProfGuard>(make_unique<MMProfFixed>(pool));
+                }
+                const Ciphertext *a = &ct[0];
+                const Ciphertext *b = &ct[1];
+                for (size_t i = 0; i < op_count; i++)
+                {
+                    temps.emplace_back(pool);
+                    switch (i % 3)
+                    {
+                    case 0:
+                        bm_env->evaluator()->add(*a, *b, temps.back());
+                        break;
+                    case 1:
+                        bm_env->evaluator()->multiply(*a, *b, temps.back(), pool);
+                        bm_env->evaluator()->relinearize_inplace(temps.back(), bm_env->rlk(), pool);
+                        break;
+                    default:
+                        bm_env->evaluator()->rotate_rows(*a, 1, bm_env->glk(), temps.back(), pool);
+                        break;
+                    }
+                    b = a;
+                    a = &temps.back();
+                }
+                temps.clear();
+            }
+            if (use_arena)
+            {
+                pool.reset();
+            }
+        }
+        state.counters["pool_bytes"] = static_cast<double>(pool.alloc_byte_count());
+    }
+
+    void bm_circuit_serialize_round_trip(State &state, shared_ptr<BMEnv> bm_env)
+    {
+        // Save a ciphertext with the default compression mode and load it back
+        vector<Ciphertext> ct = random_cts(bm_env, 1);
+        Ciphertext loaded;
+        streamoff byte_count = 0;
+        for (auto _ : state)
+        {
+            stringstream stream;
+            byte_count = ct[0].save(stream);
+            loaded.load(bm_env->context(), stream);
+        }
+        state.counters["bytes"] = static_cast<double>(byte_count);
+    }
+} // namespace sealbench
@@ -266,4 +266,50 @@ namespace sealbench
             bm_env->evaluator()->rotate_vector(ct[0], 1, bm_env->glk(), ct[2]);
         }
     }
+
+    void bm_ckks_evaluate_polynomial(State &state, shared_ptr<BMEnv> bm_env, size_t degree)
+    {
+        vector<Ciphertext> &ct = bm_env->ct();
+        vector<double> coeffs(degree + 1);
+        for (size_t i = 0; i <= degree; i++)
+        {
+            coeffs[i] = 1.0 / static_cast<double>(i + 1);
+        }
+
+        // Use a scale close to the primes so that scales are stable across rescaling
+        double scale = static_cast<double>(
+            bm_env->context().first_context_data()->parms().coeff_modulus().back().value());
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            bm_env->randomize_ct_ckks(ct[0]);
+            ct[0].scale() = scale;
+
+            state.ResumeTiming();
+            bm_env->evaluator()->evaluate_polynomial(ct[0], coeffs, bm_env->rlk(), ct[2]);
+        }
+    }
+
+    void bm_ckks_evaluate_chebyshev_series(State &state, shared_ptr<BMEnv> bm_env, size_t degree)
+    {
+        vector<Ciphertext> &ct = bm_env->ct();
+        vector<double> coeffs(degree + 1);
+        for (size_t i = 0; i <= degree; i++)
+        {
+            coeffs[i] = 1.0 / static_cast<double>(i + 1);
+        }
+
+        // Use a scale close to the primes so that scales are stable across rescaling
+        double scale = static_cast<double>(
+            bm_env->context().first_context_data()->parms().coeff_modulus().back().value());
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            bm_env->randomize_ct_ckks(ct[0]);
+            ct[0].scale() = scale;
+
+            state.ResumeTiming();
+            bm_env->evaluator()->evaluate_chebyshev_series(ct[0], coeffs, -1.0, 1.0, bm_env->rlk(), ct[2]);
+        }
+    }
 } // namespace sealbench
@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "seal/seal.h"
+#include "seal/util/lazyaccumulator.h"
+#include "seal/util/ntt.h"
+#include "bench.h"
+
+using namespace benchmark;
+using namespace sealbench;
+using namespace seal;
+using namespace std;
+
+/**
+This file defines benchmarks for the parts of key switching at the first level: the inner product of the decomposed
+ciphertext with the key switching keys, and the NTTs of the decomposed ciphertext. Together they are the bulk of the
+cost of relinearization and rotation.
+*/
+
+namespace sealbench
+{
+    void bm_util_key_switch_inner_product(State &state, shared_ptr<BMEnv> bm_env)
+    {
+        auto &key_context_data = *bm_env->context().key_context_data();
+        auto &key_modulus = key_context_data.parms().coeff_modulus();
+        auto &key_vector = bm_env->rlk().data()[0];
+        size_t coeff_count = key_context_data.parms().poly_modulus_degree();
+        size_t rns_modulus_size = key_modulus.size();
+        size_t key_component_count = key_vector[0].data().size();
+
+        // A random polynomial in the extended basis stands in for each digit of the decomposed ciphertext
+        vector<uint64_t> operand(coeff_count * rns_modulus_size);
+        for (size_t i = 0; i < rns_modulus_size; i++)
+        {
+            bm_env->randomize_array_mod(operand.data() + i * coeff_count, coeff_count, key_modulus[i]);
+        }
+        vector<uint64_t> result(coeff_count);
+        MemoryPoolHandle pool = seal::MemoryManager::GetPool();
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < rns_modulus_size; i++)
+            {
+                for (size_t k = 0; k < key_component_count; k++)
+                {
+                    util::LazyProductAccumulator accumulator(coeff_count, key_modulus[i], pool);
+                    for (auto &key : key_vector)
+                    {
+                        accumulator.multiply_accumulate(
+                            operand.data() + i * coeff_count, key.data().data(k) + i * coeff_count);
+                    }
+                    accumulator.reduce(result.data());
+                }
+            }
+        }
+    }
+
+    void bm_util_key_switch_ntt(State &state, shared_ptr<BMEnv> bm_env)
+    {
+        auto &key_context_data = *bm_env->context().key_context_data();
+        auto &key_modulus = key_context_data.parms().coeff_modulus();
+        auto key_ntt_tables = key_context_data.small_ntt_tables();
+        size_t coeff_count = key_context_data.parms().poly_modulus_degree();
+        size_t rns_modulus_size = key_modulus.size();
+        size_t digit_count = bm_env->rlk().data()[0].size();
+
+        // Every digit is copied before its NTT, as in key switching
+        vector<uint64_t> digit(coeff_count * rns_modulus_size);
+        vector<uint64_t> operand(coeff_count * rns_modulus_size);
+        for (size_t i = 0; i < rns_modulus_size; i++)
+        {
+            bm_env->randomize_array_mod(digit.data() + i * coeff_count, coeff_count, key_modulus[i]);
+        }
+        for (auto _ : state)
+        {
+            for (size_t j = 0; j < digit_count; j++)
+            {
+                copy(digit.begin(), digit.end(), operand.begin());
+                for (size_t i = 0; i < rns_modulus_size; i++)
+                {
+                    util::ntt_negacyclic_harvey_lazy(operand.data() + i * coeff_count, key_ntt_tables[i]);
+                }
+            }
+        }
+    }
+} // namespace sealbench
@@ -22,19 +22,25 @@ void added_bfv(string num1, string num2, string num3)
     print_example_banner("SEAL: BFV Scheme - Multiplication and Addition of three inputs");
 
 
-    EncryptionParameters parms(scheme_type::bfv);
-    size_t poly_modulus_degree = 16384;
-
-    parms.set_poly_modulus_degree(poly_modulus_degree);
-    parms.set_poly_modulus_degree(poly_modulus_degree);
-    parms.set_coeff_modulus(CoeffModulus::BFVDefault(poly_modulus_degree));
-    parms.set_plain_modulus(PlainModulus::Batching(poly_modulus_degree, 20));
+    /*
+    The circuit below multiplies three inputs, i.e., it has multiplicative depth 2. Instead of hardcoding
+    the parameters, let ParameterSelector choose the smallest ones that fit the circuit.
+    */
+    CircuitRequirements requirements;
+    requirements.scheme = scheme_type::bfv;
+    requirements.multiplicative_depth = 2;
+    requirements.plain_modulus_bit_count = 20;
+    ParameterSelector selector;
+    ParameterSelection selection = selector.select(requirements);
+    EncryptionParameters parms = selection.parms;
     SEALContext context(parms);
 
     /*
     Print the parameters that we have chosen.
     */
     print_parameters(context);
+    cout << "Predicted multiplication time: " << selection.latency[he_op_type::multiply] / 1000 << "ms" << endl;
+    cout << "Predicted relinearization time: " << selection.latency[he_op_type::relinearize] / 1000 << "ms" << endl;
 
     /*****
     *** Key Generation process 
@@ -0,0 +1,550 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "seal/bootstrapper.h"
+#include "seal/ckks.h"
+#include "seal/util/common.h"
+#include "seal/util/galois.h"
+#include "seal/util/numth.h"
+#include "seal/util/polyeval.h"
+#include "seal/util/uintcore.h"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdlib>
+#include <map>
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+using namespace seal::util;
+
+namespace seal
+{
+    namespace
+    {
+        // Maps a rotation offset to the diagonal of a linear transform on the slots
+        using Diagonals = map<int, vector<complex<double>>>;
+
+        /**
+        Builds the factors of the CKKS decoding matrix and its inverse. Slot j of a CKKS plaintext holds the value of
+        the plaintext polynomial at zeta^(3^j) for a primitive (2 * poly_modulus_degree)-th root of unity zeta. Let
+        w be the vector with entries m_i + sqrt(-1) * m_(i + n) for the coefficients m_i of the polynomial and
+        n = poly_modulus_degree / 2. Then the slots are obtained from w in bit-reversed order by the butterfly layers
+        of a special FFT: one layer for every block size 4, 8, ..., n, each with diagonals at offsets 0 and plus or
+        minus half the block size, and a first layer acting on pairs of slots. Since 3^j is 3 modulo 4 for odd j,
+        the odd slots see the conjugate of w, so the first layer is not linear over the complex numbers; it is given
+        by separate matrices for the real and imaginary parts of its input. Linear transforms are represented by
+        their diagonals, where diagonal k multiplies the input rotated left by k.
+        */
+        class EncodingMatrixFactors
+        {
+        public:
+            EncodingMatrixFactors(size_t slot_count) : slot_count_(slot_count), rot_group_(slot_count)
+            {
+                // The same generator as in util::GaloisTool
+                uint64_t m = static_cast<uint64_t>(slot_count) << 2;
+                uint64_t pos = 1;
+                for (size_t j = 0; j < slot_count; j++)
+                {
+                    rot_group_[j] = pos;
+                    pos = (pos * 3) & (m - 1);
+                }
+            }
+
+            // Reduces a rotation offset to (-slot_count / 2, slot_count / 2]
+            SEAL_NODISCARD int reduce_offset(long offset) const
+            {
+                long n = static_cast<long>(slot_count_);
+                long result = ((offset % n) + n) % n;
+                return static_cast<int>(result > n / 2 ? result - n : result);
+            }
+
+            SEAL_NODISCARD Diagonals identity() const
+            {
+                Diagonals result;
+                result[0].assign(slot_count_, complex<double>(1.0));
+                return result;
+            }
+
+            // Returns the diagonals of outer * inner
+            SEAL_NODISCARD Diagonals compose(const Diagonals &outer, const Diagonals &inner) const
+            {
+                Diagonals result;
+                for (auto &a : outer)
+                {
+                    for (auto &b : inner)
+                    {
+                        auto &diagonal = result[reduce_offset(static_cast<long>(a.first) + b.first)];
+                        if (diagonal.empty())
+                        {
+                            diagonal.assign(slot_count_, complex<double>(0.0));
+                        }
+                        for (size_t i = 0; i < slot_count_; i++)
+                        {
+                            diagonal[i] += a.second[i] * b.second[(i + offset_index(a.first)) % slot_count_];
+                        }
+                    }
+                }
+                return result;
+            }
+
+            // Returns the diagonals of the layer of the decoding matrix for the given block size
+            SEAL_NODISCARD Diagonals decode_layer(size_t block_size) const
+            {
+                size_t half = block_size >> 1;
+                Diagonals result = empty_layer(half);
+                for (size_t i = 0; i < slot_count_; i += block_size)
+                {
+                    for (size_t j = 0; j < half; j++)
+                    {
+                        complex<double> root = root_of_unity(rot_group_[j], block_size << 2);
+                        result[0][i + j] = 1.0;
+                        result[reduce_offset(static_cast<long>(half))][i + j] += root;
+                        result[reduce_offset(-static_cast<long>(half))][i + j + half] += 1.0;
+                        result[0][i + j + half] = -root;
+                    }
+                }
+                return result;
+            }
+
+            // Returns the diagonals of the inverse of decode_layer(block_size)
+            SEAL_NODISCARD Diagonals encode_layer(size_t block_size) const
+            {
+                size_t half = block_size >> 1;
+                size_t order = block_size << 2;
+                Diagonals result = empty_layer(half);
+                for (size_t i = 0; i < slot_count_; i += block_size)
+                {
+                    for (size_t j = 0; j < half; j++)
+                    {
+                        complex<double> root = root_of_unity(order - (rot_group_[j] & (order - 1)), order);
+                        result[0][i + j] = 0.5;
+                        result[reduce_offset(static_cast<long>(half))][i + j] += 0.5;
+                        result[reduce_offset(-static_cast<long>(half))][i + j + half] += 0.5 * root;
+                        result[0][i + j + half] = -0.5 * root;
+                    }
+                }
+                return result;
+            }
+
+            /**
+            Returns the diagonals of the first layer of the decoding matrix applied to the real and to the imaginary
+            part of its input. For input v the layer computes s_p = v_p + c * v_(p + 1) and
+            s_(p + 1) = conj(v_p) + sqrt(-1) * c * conj(v_(p + 1)) for even p, where c = exp(pi * sqrt(-1) / 4).
+            */
+            SEAL_NODISCARD pair<Diagonals, Diagonals> decode_first_layer() const
+            {
+                const complex<double> c = root_of_unity(1, 8);
+                const complex<double> i_unit(0.0, 1.0);
+                Diagonals real_part = empty_layer(1);
+                Diagonals imag_part = empty_layer(1);
+                for (size_t p = 0; p < slot_count_; p += 2)
+                {
+                    real_part[0][p] += 1.0;
+                    real_part[reduce_offset(1)][p] += c;
+                    real_part[reduce_offset(-1)][p + 1] += 1.0;
+                    real_part[0][p + 1] += i_unit * c;
+                    imag_part[0][p] += i_unit;
+                    imag_part[reduce_offset(1)][p] += i_unit * c;
+                    imag_part[reduce_offset(-1)][p + 1] += -i_unit;
+                    imag_part[0][p + 1] += c;
+                }
+                return make_pair(move(real_part), move(imag_part));
+            }
+
+            /**
+            Returns the diagonals of the inverse of decode_first_layer as maps applied to its input s and to the
+            complex conjugate of s: v_p = (s_p + conj(s_(p + 1))) / 2 and
+            v_(p + 1) = conj(c) * (s_p - conj(s_(p + 1))) / 2 for even p.
+            */
+            SEAL_NODISCARD pair<Diagonals, Diagonals> encode_last_layer() const
+            {
+                const complex<double> c_conj = conj(root_of_unity(1, 8));
+                Diagonals direct = empty_layer(1);
+                Diagonals conjugated = empty_layer(1);
+                for (size_t p = 0; p < slot_count_; p += 2)
+                {
+                    direct[0][p] += 0.5;
+                    direct[reduce_offset(-1)][p + 1] += 0.5 * c_conj;
+                    conjugated[reduce_offset(1)][p] += 0.5;
+                    conjugated[0][p + 1] += -0.5 * c_conj;
+                }
+                return make_pair(move(direct), move(conjugated));
+            }
+
+            SEAL_NODISCARD vector<complex<double>> rotate(const vector<complex<double>> &values, int offset) const
+            {
+                vector<complex<double>> result(slot_count_);
+                size_t shift = offset_index(offset);
+                for (size_t i = 0; i < slot_count_; i++)
+                {
+                    result[i] = values[(i + shift) % slot_count_];
+                }
+                return result;
+            }
+
+        private:
+            SEAL_NODISCARD size_t offset_index(int offset) const
+            {
+                long n = static_cast<long>(slot_count_);
+                return static_cast<size_t>(((static_cast<long>(offset) % n) + n) % n);
+            }
+
+            SEAL_NODISCARD Diagonals empty_layer(size_t half) const
+            {
+                Diagonals result;
+                for (long offset : { 0L, static_cast<long>(half), -static_cast<long>(half) })
+                {
+                    result[reduce_offset(offset)].assign(slot_count_, complex<double>(0.0));
+                }
+                return result;
+            }
+
+            SEAL_NODISCARD static complex<double> root_of_unity(uint64_t power, uint64_t order)
+            {
+                return polar(1.0, 2.0 * pi_ * static_cast<double>(power) / static_cast<double>(order));
+            }
+
+            static constexpr double pi_ = 3.1415926535897932384626433832795028842;
+
+            size_t slot_count_;
+
+            vector<uint64_t> rot_group_;
+        };
+
+        void scale_diagonals(Diagonals &diagonals, double factor)
+        {
+            for (auto &diagonal : diagonals)
+            {
+                for (auto &value : diagonal.second)
+                {
+                    value *= factor;
+                }
+            }
+        }
+
+        Diagonals conjugate_diagonals(Diagonals diagonals)
+        {
+            for (auto &diagonal : diagonals)
+            {
+                for (auto &value : diagonal.second)
+                {
+                    value = conj(value);
+                }
+            }
+            return diagonals;
+        }
+
+        // Splits count layers into group_count groups of consecutive layers, with larger groups first
+        vector<size_t> group_sizes(size_t count, size_t group_count)
+        {
+            vector<size_t> result(group_count, count / group_count);
+            for (size_t i = 0; i < count % group_count; i++)
+            {
+                result[i]++;
+            }
+            return result;
+        }
+
+        /**
+        Precomputes a level of a linear transform with the given diagonals for every input. An offset t * step is
+        written as (giant * baby_step_count + baby) * step, and every diagonal is rotated right by the giant part of
+        its offset, so that the rotation can be applied to the sum of all products of the giant step.
+        */
+        CKKSBootstrapper::LinearTransform make_linear_transform(
+            const vector<Diagonals> &inputs, const EncodingMatrixFactors &factors, const CKKSEncoder &encoder,
+            const SEALContext::ContextData &context_data, double scale, vector<int> &rotation_steps,
+            MemoryPoolHandle pool)
+        {
+            CKKSBootstrapper::LinearTransform result;
+            result.parms_id = context_data.parms_id();
+            result.input_count = inputs.size();
+
+            // All offsets are multiples of the smallest stride of the merged layers
+            int step = 0;
+            vector<int> offsets;
+            for (auto &input : inputs)
+            {
+                for (auto &diagonal : input)
+                {
+                    auto magnitude = static_cast<uint64_t>(abs(diagonal.first));
+                    if (magnitude)
+                    {
+                        step = step ? static_cast<int>(gcd(static_cast<uint64_t>(step), magnitude))
+                                    : static_cast<int>(magnitude);
+                    }
+                    offsets.push_back(diagonal.first);
+                }
+            }
+            result.step = step ? step : 1;
+            sort(offsets.begin(), offsets.end());
+            offsets.erase(unique(offsets.begin(), offsets.end()), offsets.end());
+
+            int baby_step_count = 1;
+            while (static_cast<size_t>(baby_step_count) * static_cast<size_t>(baby_step_count) < offsets.size())
+            {
+                baby_step_count <<= 1;
+            }
+            result.baby_step_count = baby_step_count;
+
+            map<int, CKKSBootstrapper::LinearTransform::GiantStep> giant_steps;
+            vector<bool> baby_used(static_cast<size_t>(baby_step_count), false);
+            for (size_t input = 0; input < inputs.size(); input++)
+            {
+                for (auto &diagonal : inputs[input])
+                {
+                    int t = diagonal.first / result.step;
+                    int giant = (t >= 0 ? t : t - baby_step_count + 1) / baby_step_count;
+                    int baby = t - giant * baby_step_count;
+                    int giant_offset = giant * baby_step_count * result.step;
+
+                    CKKSBootstrapper::LinearTransform::Diagonal entry;
+                    entry.input = input;
+                    entry.baby = baby;
+                    encoder.encode(
+                        factors.rotate(diagonal.second, factors.reduce_offset(-giant_offset)), context_data.parms_id(),
+                        scale, entry.plain, pool);
+                    if (entry.plain.is_zero())
+                    {
+                        continue;
+                    }
+
+                    auto &giant_step = giant_steps[giant];
+                    giant_step.rotation = factors.reduce_offset(giant_offset);
+                    giant_step.diagonals.push_back(move(entry));
+                    baby_used[static_cast<size_t>(baby)] = true;
+                }
+            }
+
+            for (int baby = 1; baby < baby_step_count; baby++)
+            {
+                if (baby_used[static_cast<size_t>(baby)])
+                {
+                    rotation_steps.push_back(factors.reduce_offset(static_cast<long>(baby) * result.step));
+                }
+            }
+            for (auto &giant_step : giant_steps)
+            {
+                if (giant_step.second.rotation)
+                {
+                    rotation_steps.push_back(giant_step.second.rotation);
+                }
+                result.giant_steps.push_back(move(giant_step.second));
+            }
+            return result;
+        }
+    } // namespace
+
+    CKKSBootstrapper::CKKSBootstrapper(
+        const SEALContext &context, const CKKSBootstrappingParameters &parms, MemoryPoolHandle pool)
+        : parms_(parms)
+    {
+        // Verify parameters
+        if (!context.parameters_set())
+        {
+            throw invalid_argument("encryption parameters are not set correctly");
+        }
+        auto first_context_data_ptr = context.first_context_data();
+        if (first_context_data_ptr->parms().scheme() != scheme_type::ckks)
+        {
+            throw invalid_argument("unsupported scheme");
+        }
+        if (!context.using_keyswitching())
+        {
+            throw invalid_argument("keyswitching is not supported by the context");
+        }
+        if (!pool)
+        {
+            throw invalid_argument("pool is uninitialized");
+        }
+
+        size_t coeff_count = first_context_data_ptr->parms().poly_modulus_degree();
+        size_t slot_count = coeff_count >> 1;
+        size_t layer_count = static_cast<size_t>(get_power_of_two(static_cast<uint64_t>(slot_count)));
+        if (!parms_.coeff_to_slot_level_count || parms_.coeff_to_slot_level_count > layer_count ||
+            !parms_.slot_to_coeff_level_count || parms_.slot_to_coeff_level_count > layer_count)
+        {
+            throw invalid_argument("invalid level count for the linear transforms");
+        }
+        if (!parms_.eval_mod_degree)
+        {
+            throw invalid_argument("eval_mod_degree must be positive");
+        }
+
+        // Coefficients of c_0 + c_1 * s divided by q_0 have variance (h + 1) / 12 for a secret with h non-zero
+        // coefficients, which is about 2 * coeff_count / 3 for the uniform ternary distribution.
+        if (!parms_.overflow_bound)
+        {
+            double deviation = sqrt((2.0 * static_cast<double>(coeff_count) / 3.0 + 1.0) / 12.0);
+            parms_.overflow_bound = static_cast<size_t>(ceil(8.0 * deviation));
+        }
+
+        // After CoeffToSlot the slots hold x / bound with x = m / q_0 + I. The sine of 2 * pi * x is computed as the
+        // cosine of 2 * pi * (x - 1/4) by evaluating the cosine of a 2^r times smaller angle and doubling the angle
+        // r times. The Chebyshev interpolant of cos(omega * y) converges once the degree exceeds omega, so r is
+        // chosen such that omega is at most a quarter of the degree.
+        const double pi = 3.1415926535897932384626433832795028842;
+        double bound = static_cast<double>(parms_.overflow_bound) + 1.0;
+        double omega = 2.0 * pi * bound;
+        double phase = pi / 2.0;
+        while (omega > static_cast<double>(parms_.eval_mod_degree + 1) / 4.0)
+        {
+            omega /= 2.0;
+            phase /= 2.0;
+            double_angle_count_++;
+        }
+        eval_mod_coeffs_ = chebyshev_coefficients(
+            [omega, phase](double y) { return cos(omega * y - phase); }, -1.0, 1.0, parms_.eval_mod_degree);
+        vector<double> series(eval_mod_coeffs_);
+        while (series.size() > 2 && series.back() == 0.0)
+        {
+            series.pop_back();
+        }
+        auto series_depth = static_cast<size_t>(-paterson_stockmeyer_max_level(
+            series, select_paterson_stockmeyer_params(series.size() - 1), true, true, 0));
+
+        // Index the modulus switching chain by level
+        size_t top_level = first_context_data_ptr->chain_index();
+        vector<shared_ptr<const SEALContext::ContextData>> context_data_by_level(top_level + 1);
+        for (auto context_data_ptr = first_context_data_ptr; context_data_ptr;
+             context_data_ptr = context_data_ptr->next_context_data())
+        {
+            context_data_by_level[context_data_ptr->chain_index()] = context_data_ptr;
+        }
+
+        size_t coeff_to_slot_levels = parms_.coeff_to_slot_level_count;
+        size_t slot_to_coeff_levels = parms_.slot_to_coeff_level_count;
+        size_t eval_mod_levels = series_depth + double_angle_count_;
+        depth_ = coeff_to_slot_levels + eval_mod_levels + slot_to_coeff_levels;
+        if (depth_ > top_level)
+        {
+            throw invalid_argument("coeff_modulus has too few primes for bootstrapping");
+        }
+        parms_id_ = context_data_by_level[top_level - depth_]->parms_id();
+
+        // The raised ciphertext is kept at the scale of the first prime consumed, and the double-angle iterations
+        // square it and divide it by one prime each
+        auto prime_at = [&](size_t level) {
+            return static_cast<double>(context_data_by_level[level]->parms().coeff_modulus().back().value());
+        };
+        scale_ = prime_at(top_level);
+        eval_mod_scale_ = scale_;
+        size_t level = top_level - coeff_to_slot_levels - series_depth;
+        for (size_t i = 0; i < double_angle_count_; i++, level--)
+        {
+            eval_mod_scale_ *= eval_mod_scale_;
+            eval_mod_scale_ = eval_mod_scale_ / prime_at(level);
+        }
+
+        CKKSEncoder encoder(context);
+        EncodingMatrixFactors factors(slot_count);
+        vector<int> rotation_steps;
+        double q0 = static_cast<double>(context_data_by_level[0]->parms().coeff_modulus()[0].value());
+
+        // CoeffToSlot maps the slots of the raised ciphertext, which encode (m + q_0 * I) / scale, to half of the
+        // packed coefficients divided by q_0 * bound, applying the encoding layers for the block sizes n, ..., 4 and
+        // finally the inverse of the first decoding layer. The constant factor is spread evenly over all levels.
+        {
+            vector<size_t> sizes = group_sizes(layer_count, coeff_to_slot_levels);
+            double factor = pow(scale_ / (2.0 * q0 * bound), 1.0 / static_cast<double>(coeff_to_slot_levels));
+            size_t block_size = slot_count;
+            for (size_t group = 0; group < coeff_to_slot_levels; group++)
+            {
+                Diagonals product = factors.identity();
+                vector<Diagonals> inputs;
+                for (size_t i = 0; i < sizes[group]; i++, block_size >>= 1)
+                {
+                    if (block_size > 2)
+                    {
+                        product = factors.compose(factors.encode_layer(block_size), product);
+                    }
+                    else
+                    {
+                        auto last_layer = factors.encode_last_layer();
+                        inputs.push_back(factors.compose(last_layer.first, product));
+                        inputs.push_back(factors.compose(last_layer.second, conjugate_diagonals(product)));
+                    }
+                }
+                if (inputs.empty())
+                {
+                    inputs.push_back(move(product));
+                }
+                for (auto &input : inputs)
+                {
+                    scale_diagonals(input, factor);
+                }
+                size_t group_level = top_level - group;
+                coeff_to_slot_.push_back(make_linear_transform(
+                    inputs, factors, encoder, *context_data_by_level[group_level], prime_at(group_level),
+                    rotation_steps, pool));
+            }
+        }
+
+        // SlotToCoeff maps the real and imaginary parts, which hold (2 * pi / q_0) * m after EvalMod, back to the
+        // slots encoding m / scale. The last level also corrects the scale of EvalMod so that the result has
+        // exactly the scale of the raised ciphertext.
+        {
+            vector<size_t> sizes = group_sizes(layer_count, slot_to_coeff_levels);
+            double factor = pow(q0 / (2.0 * pi * scale_), 1.0 / static_cast<double>(slot_to_coeff_levels));
+            size_t block_size = 2;
+            size_t first_level = top_level - coeff_to_slot_levels - eval_mod_levels;
+            for (size_t group = 0; group < slot_to_coeff_levels; group++)
+            {
+                Diagonals product = factors.identity();
+                bool has_first_layer = false;
+                for (size_t i = 0; i < sizes[group]; i++, block_size <<= 1)
+                {
+                    if (block_size > 2)
+                    {
+                        product = factors.compose(factors.decode_layer(block_size), product);
+                    }
+                    else
+                    {
+                        has_first_layer = true;
+                    }
+                }
+                vector<Diagonals> inputs;
+                if (has_first_layer)
+                {
+                    auto first_layer = factors.decode_first_layer();
+                    // The imaginary part arrives multiplied by X^(N/2), which is sqrt(-1) on the even slots and
+                    // -sqrt(-1) on the odd slots, and EvalMod preserves the resulting signs as it is odd
+                    Diagonals signs;
+                    signs[0].resize(slot_count);
+                    for (size_t i = 0; i < slot_count; i++)
+                    {
+                        signs[0][i] = (i & 1) ? 1.0 : -1.0;
+                    }
+                    inputs.push_back(factors.compose(product, first_layer.first));
+                    inputs.push_back(factors.compose(product, factors.compose(first_layer.second, signs)));
+                }
+                else
+                {
+                    inputs.push_back(move(product));
+                }
+                for (auto &input : inputs)
+                {
+                    scale_diagonals(input, factor);
+                }
+                size_t group_level = first_level - group;
+                double plain_scale = prime_at(group_level);
+                if (group + 1 == slot_to_coeff_levels)
+                {
+                    plain_scale = plain_scale * scale_ / eval_mod_scale_;
+                }
+                slot_to_coeff_.push_back(make_linear_transform(
+                    inputs, factors, encoder, *context_data_by_level[group_level], plain_scale, rotation_steps, pool));
+            }
+        }
+
+        // Rotation keys for all linear transforms and the key for complex conjugation
+        auto galois_tool = context.key_context_data()->galois_tool();
+        rotation_steps.push_back(0);
+        sort(rotation_steps.begin(), rotation_steps.end());
+        rotation_steps.erase(unique(rotation_steps.begin(), rotation_steps.end()), rotation_steps.end());
+        galois_elts_ = galois_tool->get_elts_from_steps(rotation_steps);
+        sort(galois_elts_.begin(), galois_elts_.end());
+        galois_elts_.erase(unique(galois_elts_.begin(), galois_elts_.end()), galois_elts_.end());
+    }
+} // namespace seal
@@ -0,0 +1,241 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+#include "seal/context.h"
+#include "seal/encryptionparams.h"
+#include "seal/memorymanager.h"
+#include "seal/plaintext.h"
+#include "seal/util/defines.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace seal
+{
+    /**
+    Describes how CKKSBootstrapper refreshes ciphertexts. Together with the coefficient modulus these parameters
+    determine the number of levels bootstrapping consumes, its latency, and its precision.
+    */
+    struct CKKSBootstrappingParameters
+    {
+        /**
+        The number of levels consumed by the homomorphic encoding, which moves the coefficients of the plaintext into
+        the slots. The transform factors into log2(poly_modulus_degree / 2) sparse layers that are merged into this
+        many levels: fewer levels make every level denser and need more rotations.
+        */
+        std::size_t coeff_to_slot_level_count = 3;
+
+        /**
+        The number of levels consumed by the homomorphic decoding, which moves the slots back into the coefficients.
+        */
+        std::size_t slot_to_coeff_level_count = 3;
+
+        /**
+        A bound on the absolute value of the coefficients of the polynomial I in c_0 + c_1 * s = m + q_0 * I, where
+        q_0 is the modulus of the last level. Zero selects a bound of eight standard deviations for the uniform
+        ternary secret key distribution of SEAL.
+        */
+        std::size_t overflow_bound = 0;
+
+        /**
+        The degree of the Chebyshev interpolant of the cosine from which the modular reduction is computed. The
+        number of double-angle iterations is chosen so that the interpolant converges at this degree.
+        */
+        std::size_t eval_mod_degree = 63;
+    };
+
+    /**
+    Precomputes the data for bootstrapping CKKS ciphertexts with Evaluator::bootstrap. Bootstrapping refreshes a
+    ciphertext at any level into a ciphertext encrypting approximately the same values at a higher level, so that
+    computations of unbounded depth can be performed. It consists of four steps:
+
+    1. ModRaise: the ciphertext is switched to the last level and its coefficients, reduced modulo q_0, are
+    interpreted modulo the full coefficient modulus. This yields an encryption of m + q_0 * I for an integer
+    polynomial I with small coefficients.
+    2. CoeffToSlot: a homomorphic linear transform moves the real coefficients of the plaintext into the real and
+    imaginary parts of the slots, which are then separated with complex conjugation.
+    3. EvalMod: the reduction modulo q_0 is approximated by q_0 / (2 * pi) * sin(2 * pi * x / q_0), computed from a
+    Chebyshev interpolant of a cosine and repeated double-angle formulas.
+    4. SlotToCoeff: the inverse linear transform moves the slots back into the coefficients.
+
+    The linear transforms use the factorization of the CKKS encoding matrix into butterfly layers as in the FFT.
+    Consecutive layers are merged into one level each, and every level is evaluated with the baby-step giant-step
+    algorithm. Their plaintext diagonals are precomputed at the levels where they are applied.
+
+    For the result to be accurate the values must be small relative to q_0 / scale, so q_0 should have about ten
+    bits more than the scale of the bootstrapped ciphertexts. The primes consumed by bootstrapping should all have
+    the same size, as the ciphertexts are kept at the scale of the first of them during bootstrapping. Their size
+    determines the precision: CoeffToSlot starts from values of magnitude about overflow_bound * q_0 / scale, so
+    every bit added to these primes gains about two bits of precision. Bootstrapping always uses all
+    poly_modulus_degree / 2 slots, and bootstrapped ciphertexts are depth() levels below the first data level.
+
+    @par Thread Safety
+    CKKSBootstrapper is immutable after construction and can be used concurrently by several threads.
+    */
+    class CKKSBootstrapper
+    {
+    public:
+        /**
+        One level of a homomorphic linear transform. Every input ciphertext is rotated by baby * step for the baby
+        steps 0, ..., baby_step_count - 1, the rotated inputs are multiplied by plaintext diagonals and summed for
+        every giant step, and the sums are rotated by their giant rotation and added up. The result is rescaled.
+        */
+        struct LinearTransform
+        {
+            /**
+            A plaintext diagonal, multiplied with the given input rotated by baby * step.
+            */
+            struct Diagonal
+            {
+                std::size_t input = 0;
+
+                int baby = 0;
+
+                Plaintext plain;
+            };
+
+            /**
+            The diagonals of one giant step, whose sum is rotated by rotation.
+            */
+            struct GiantStep
+            {
+                int rotation = 0;
+
+                std::vector<Diagonal> diagonals;
+            };
+
+            parms_id_type parms_id = parms_id_zero;
+
+            std::size_t input_count = 1;
+
+            int step = 1;
+
+            int baby_step_count = 1;
+
+            std::vector<GiantStep> giant_steps;
+        };
+
+        /**
+        Precomputes the bootstrapping data for the given context.
+
+        @param[in] context The SEALContext
+        @param[in] parms The bootstrapping parameters
+        @param[in] pool The MemoryPoolHandle pointing to a valid memory pool
+        @throws std::invalid_argument if the encryption parameters are not valid
+        @throws std::invalid_argument if scheme is not scheme_type::ckks or keyswitching is not supported
+        @throws std::invalid_argument if the level counts of the linear transforms are zero or larger than
+        log2(poly_modulus_degree / 2)
+        @throws std::invalid_argument if eval_mod_degree is zero
+        @throws std::invalid_argument if the coefficient modulus has too few primes for bootstrapping
+        @throws std::invalid_argument if pool is uninitialized
+        */
+        CKKSBootstrapper(
+            const SEALContext &context, const CKKSBootstrappingParameters &parms = CKKSBootstrappingParameters(),
+            MemoryPoolHandle pool = MemoryManager::GetPool());
+
+        /**
+        Returns the Galois elements of the Galois keys needed by Evaluator::bootstrap, which can be passed to
+        KeyGenerator::create_galois_keys.
+        */
+        SEAL_NODISCARD inline const std::vector<std::uint32_t> &galois_elts() const noexcept
+        {
+            return galois_elts_;
+        }
+
+        /**
+        Returns the number of levels consumed by bootstrapping, counted from the first data level.
+        */
+        SEAL_NODISCARD inline std::size_t depth() const noexcept
+        {
+            return depth_;
+        }
+
+        /**
+        Returns the parms_id of bootstrapped ciphertexts.
+        */
+        SEAL_NODISCARD inline const parms_id_type &parms_id() const noexcept
+        {
+            return parms_id_;
+        }
+
+        /**
+        Returns the parameters with the overflow bound resolved.
+        */
+        SEAL_NODISCARD inline const CKKSBootstrappingParameters &parameters() const noexcept
+        {
+            return parms_;
+        }
+
+        /**
+        Returns the number of double-angle iterations of EvalMod.
+        */
+        SEAL_NODISCARD inline std::size_t double_angle_count() const noexcept
+        {
+            return double_angle_count_;
+        }
+
+        /**
+        Returns the scale of the ciphertext after ModRaise, which is kept by CoeffToSlot and the Chebyshev series.
+        */
+        SEAL_NODISCARD inline double scale() const noexcept
+        {
+            return scale_;
+        }
+
+        /**
+        Returns the scale of the ciphertexts after EvalMod.
+        */
+        SEAL_NODISCARD inline double eval_mod_scale() const noexcept
+        {
+            return eval_mod_scale_;
+        }
+
+        /**
+        Returns the levels of CoeffToSlot. The last level has two inputs, the ciphertext and its complex conjugate.
+        */
+        SEAL_NODISCARD inline const std::vector<LinearTransform> &coeff_to_slot() const noexcept
+        {
+            return coeff_to_slot_;
+        }
+
+        /**
+        Returns the Chebyshev coefficients of the cosine on [-1, 1] from which EvalMod starts.
+        */
+        SEAL_NODISCARD inline const std::vector<double> &eval_mod_coeffs() const noexcept
+        {
+            return eval_mod_coeffs_;
+        }
+
+        /**
+        Returns the levels of SlotToCoeff. The first level has two inputs, the real part and the imaginary part
+        with the signs of the even slots flipped.
+        */
+        SEAL_NODISCARD inline const std::vector<LinearTransform> &slot_to_coeff() const noexcept
+        {
+            return slot_to_coeff_;
+        }
+
+    private:
+        CKKSBootstrappingParameters parms_;
+
+        parms_id_type parms_id_ = parms_id_zero;
+
+        std::size_t depth_ = 0;
+
+        std::size_t double_angle_count_ = 0;
+
+        double scale_ = 0.0;
+
+        double eval_mod_scale_ = 0.0;
+
+        std::vector<LinearTransform> coeff_to_slot_;
+
+        std::vector<double> eval_mod_coeffs_;
+
+        std::vector<LinearTransform> slot_to_coeff_;
+
+        std::vector<std::uint32_t> galois_elts_;
+    };
+} // namespace seal
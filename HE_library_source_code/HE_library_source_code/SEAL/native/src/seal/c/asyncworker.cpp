@@ -0,0 +1,251 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+// STD
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+// SEALNet
+#include "seal/c/asyncworker.h"
+#include "seal/c/utilities.h"
+
+using namespace std;
+using namespace seal::c;
+
+namespace
+{
+    /**
+    A simple FIFO thread pool shared by all asynchronous and batch functions. Worker threads are started lazily on
+    first use.
+    */
+    class AsyncWorkerPool
+    {
+    public:
+        static AsyncWorkerPool &Instance()
+        {
+            static AsyncWorkerPool pool;
+            return pool;
+        }
+
+        ~AsyncWorkerPool()
+        {
+            StopWorkers();
+        }
+
+        void Submit(function<void()> job)
+        {
+            {
+                lock_guard<mutex> lock(mutex_);
+                if (workers_.empty())
+                {
+                    StartWorkers(thread_count_);
+                }
+                jobs_.push_back(move(job));
+            }
+            job_available_.notify_one();
+        }
+
+        size_t GetThreadCount()
+        {
+            lock_guard<mutex> lock(mutex_);
+            return thread_count_;
+        }
+
+        void SetThreadCount(size_t thread_count)
+        {
+            // Let the current workers drain the queue before replacing them
+            StopWorkers(&thread_count);
+        }
+
+        void WaitIdle()
+        {
+            unique_lock<mutex> lock(mutex_);
+            idle_.wait(lock, [this] { return jobs_.empty() && active_count_ == 0; });
+        }
+
+        static bool OnWorkerThread()
+        {
+            return on_worker_thread_;
+        }
+
+    private:
+        AsyncWorkerPool() : thread_count_(max<size_t>(thread::hardware_concurrency(), 1))
+        {}
+
+        // Must be called with mutex_ held
+        void StartWorkers(size_t thread_count)
+        {
+            for (size_t i = 0; i < thread_count; i++)
+            {
+                workers_.emplace_back([this, generation = generation_] { WorkerLoop(generation); });
+            }
+        }
+
+        // Workers started afterwards belong to a new generation, so a Submit racing with the join cannot revive the
+        // workers being stopped; it starts new ones with the new thread count instead.
+        void StopWorkers(const size_t *new_thread_count = nullptr)
+        {
+            vector<thread> workers;
+            {
+                lock_guard<mutex> lock(mutex_);
+                if (new_thread_count)
+                {
+                    thread_count_ = *new_thread_count;
+                }
+                generation_++;
+                workers.swap(workers_);
+            }
+            job_available_.notify_all();
+            for (auto &worker : workers)
+            {
+                worker.join();
+            }
+        }
+
+        void WorkerLoop(uint64_t generation)
+        {
+            on_worker_thread_ = true;
+            unique_lock<mutex> lock(mutex_);
+            while (true)
+            {
+                job_available_.wait(lock, [&] { return generation_ != generation || !jobs_.empty(); });
+                if (jobs_.empty())
+                {
+                    // This generation is stopped and there is nothing left to do
+                    return;
+                }
+
+                function<void()> job = move(jobs_.front());
+                jobs_.pop_front();
+                active_count_++;
+                lock.unlock();
+                job();
+                lock.lock();
+                active_count_--;
+                if (jobs_.empty() && active_count_ == 0)
+                {
+                    idle_.notify_all();
+                }
+            }
+        }
+
+        mutex mutex_;
+
+        condition_variable job_available_;
+
+        condition_variable idle_;
+
+        deque<function<void()>> jobs_;
+
+        vector<thread> workers_;
+
+        size_t thread_count_;
+
+        size_t active_count_ = 0;
+
+        uint64_t generation_ = 0;
+
+        static thread_local bool on_worker_thread_;
+    };
+
+    thread_local bool AsyncWorkerPool::on_worker_thread_ = false;
+} // namespace
+
+void seal::c::EnqueueAsync(function<HRESULT()> task, SEAL_C_ASYNC_CALLBACK callback, void *user_data)
+{
+    AsyncWorkerPool::Instance().Submit([task = move(task), callback, user_data] {
+        HRESULT result = task();
+        if (nullptr != callback)
+        {
+            callback(result, user_data);
+        }
+    });
+}
+
+HRESULT seal::c::RunBatchTasks(uint64_t count, const function<HRESULT(uint64_t)> &task)
+{
+    vector<HRESULT> results(static_cast<size_t>(count), S_OK);
+
+    // Running nested batches on the pool could deadlock, so a batch started from a worker runs sequentially
+    if (count == 1 || AsyncWorkerPool::OnWorkerThread())
+    {
+        for (uint64_t i = 0; i < count; i++)
+        {
+            results[static_cast<size_t>(i)] = task(i);
+        }
+    }
+    else
+    {
+        mutex done_mutex;
+        condition_variable done;
+        uint64_t remaining = count;
+        uint64_t submitted = 0;
+        HRESULT submit_result = CallAndCatch([&] {
+            for (; submitted < count; submitted++)
+            {
+                AsyncWorkerPool::Instance().Submit([&, i = submitted] {
+                    results[static_cast<size_t>(i)] = task(i);
+                    lock_guard<mutex> lock(done_mutex);
+                    if (--remaining == 0)
+                    {
+                        done.notify_one();
+                    }
+                });
+            }
+        });
+
+        // The jobs already submitted refer to the state on this stack, so wait for them even if submission failed
+        {
+            unique_lock<mutex> lock(done_mutex);
+            remaining -= count - submitted;
+            done.wait(lock, [&] { return remaining == 0; });
+        }
+        if (submit_result != S_OK)
+        {
+            return submit_result;
+        }
+    }
+
+    // HRESULT is a long, so FAILED does not detect errors where long has 64 bits
+    auto failure = find_if(results.begin(), results.end(), [](HRESULT result) { return result != S_OK; });
+    return failure == results.end() ? S_OK : *failure;
+}
+
+SEAL_C_FUNC AsyncWorker_GetThreadCount(uint64_t *thread_count)
+{
+    IfNullRet(thread_count, E_POINTER);
+
+    *thread_count = static_cast<uint64_t>(AsyncWorkerPool::Instance().GetThreadCount());
+    return S_OK;
+}
+
+SEAL_C_FUNC AsyncWorker_SetThreadCount(uint64_t thread_count)
+{
+    if (thread_count == 0)
+    {
+        return E_INVALIDARG;
+    }
+    if (AsyncWorkerPool::OnWorkerThread())
+    {
+        // A worker cannot join itself
+        return COR_E_INVALIDOPERATION;
+    }
+
+    AsyncWorkerPool::Instance().SetThreadCount(static_cast<size_t>(thread_count));
+    return S_OK;
+}
+
+SEAL_C_FUNC AsyncWorker_WaitIdle()
+{
+    if (AsyncWorkerPool::OnWorkerThread())
+    {
+        // A worker waiting for the pool to become idle would wait for itself
+        return COR_E_INVALIDOPERATION;
+    }
+
+    AsyncWorkerPool::Instance().WaitIdle();
+    return S_OK;
+}
@@ -0,0 +1,29 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+//
+// This API is provided as a simple interface for Microsoft SEAL library
+// that can be PInvoked by .Net code.
+//
+// Functions with the Async suffix validate their arguments, enqueue the
+// operation onto an internal worker pool, and return immediately. When
+// they return S_OK the callback is invoked exactly once, on a worker
+// thread, with the result of the operation. All objects passed to an
+// asynchronous function must stay alive and must not be modified until
+// the callback has been invoked. Functions with the Batch suffix process
+// arrays of handles in parallel on the same worker pool and return when
+// all of them are done.
+//
+///////////////////////////////////////////////////////////////////////////
+
+#include "seal/c/defines.h"
+#include <stdint.h>
+
+SEAL_C_FUNC AsyncWorker_GetThreadCount(uint64_t *thread_count);
+
+SEAL_C_FUNC AsyncWorker_SetThreadCount(uint64_t thread_count);
+
+SEAL_C_FUNC AsyncWorker_WaitIdle();
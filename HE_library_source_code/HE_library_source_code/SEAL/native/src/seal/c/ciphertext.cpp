@@ -439,6 +439,25 @@ SEAL_C_FUNC Ciphertext_SetCorrectionFactor(void *thisptr, uint64_t correction_fa
     return S_OK;
 }
 
+SEAL_C_FUNC Ciphertext_NoiseEstimate(void *thisptr, double *noise_estimate)
+{
+    Ciphertext *cipher = FromVoid<Ciphertext>(thisptr);
+    IfNullRet(cipher, E_POINTER);
+    IfNullRet(noise_estimate, E_POINTER);
+
+    *noise_estimate = cipher->noise_estimate();
+    return S_OK;
+}
+
+SEAL_C_FUNC Ciphertext_SetNoiseEstimate(void *thisptr, double noise_estimate)
+{
+    Ciphertext *cipher = FromVoid<Ciphertext>(thisptr);
+    IfNullRet(cipher, E_POINTER);
+
+    cipher->noise_estimate() = noise_estimate;
+    return S_OK;
+}
+
 SEAL_C_FUNC Ciphertext_Release(void *thisptr)
 {
     Ciphertext *cipher = FromVoid<Ciphertext>(thisptr);
@@ -71,6 +71,10 @@ SEAL_C_FUNC Ciphertext_CorrectionFactor(void *thisptr, uint64_t *correction_fact
 
 SEAL_C_FUNC Ciphertext_SetCorrectionFactor(void *thisptr, uint64_t correction_factor);
 
+SEAL_C_FUNC Ciphertext_NoiseEstimate(void *thisptr, double *noise_estimate);
+
+SEAL_C_FUNC Ciphertext_SetNoiseEstimate(void *thisptr, double noise_estimate);
+
 SEAL_C_FUNC Ciphertext_Release(void *thisptr);
 
 SEAL_C_FUNC Ciphertext_IsTransparent(void *thisptr, bool *result);
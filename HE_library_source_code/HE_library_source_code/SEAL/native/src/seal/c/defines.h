@@ -60,3 +60,6 @@ static_assert(false, "Require architecture == x64");
 #endif // _MSC_VER
 
 #define SEAL_C_FUNC SEAL_C_DECOR HRESULT SEAL_C_CALL
+
+// Completion callback of asynchronous functions; receives the result of the operation and the user data pointer
+typedef void(SEAL_C_CALL *SEAL_C_ASYNC_CALLBACK)(HRESULT result, void *user_data);
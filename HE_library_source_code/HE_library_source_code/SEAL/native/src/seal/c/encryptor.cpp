@@ -266,3 +266,41 @@ SEAL_C_FUNC Encryptor_Destroy(void *thisptr)
     delete encryptor;
     return S_OK;
 }
+
+SEAL_C_FUNC Encryptor_EncryptAsync(
+    void *thisptr, void *plaintext, void *destination, void *pool_handle, SEAL_C_ASYNC_CALLBACK callback,
+    void *user_data)
+{
+    Encryptor *encryptor = FromVoid<Encryptor>(thisptr);
+    IfNullRet(encryptor, E_POINTER);
+    Plaintext *plain = FromVoid<Plaintext>(plaintext);
+    IfNullRet(plain, E_POINTER);
+    Ciphertext *cipher = FromVoid<Ciphertext>(destination);
+    IfNullRet(cipher, E_POINTER);
+    unique_ptr<MemoryPoolHandle> pool = MemHandleFromVoid(pool_handle);
+
+    MemoryPoolHandle pool_copy = *pool;
+    return SubmitAsync(
+        [=] { return CallAndCatch([&] { encryptor->encrypt(*plain, *cipher, pool_copy); }); }, callback, user_data);
+}
+
+SEAL_C_FUNC Encryptor_EncryptBatch(
+    void *thisptr, uint64_t count, void **plaintexts, void **destinations, void *pool_handle)
+{
+    Encryptor *encryptor = FromVoid<Encryptor>(thisptr);
+    IfNullRet(encryptor, E_POINTER);
+    IfNullRet(plaintexts, E_POINTER);
+    IfNullRet(destinations, E_POINTER);
+    unique_ptr<MemoryPoolHandle> pool = MemHandleFromVoid(pool_handle);
+
+    Plaintext **plains = reinterpret_cast<Plaintext **>(plaintexts);
+    Ciphertext **ciphers = reinterpret_cast<Ciphertext **>(destinations);
+    for (uint64_t i = 0; i < count; i++)
+    {
+        IfNullRet(plains[i], E_POINTER);
+        IfNullRet(ciphers[i], E_POINTER);
+    }
+
+    return RunBatch(
+        count, [&](uint64_t i) { return CallAndCatch([&] { encryptor->encrypt(*plains[i], *ciphers[i], *pool); }); });
+}
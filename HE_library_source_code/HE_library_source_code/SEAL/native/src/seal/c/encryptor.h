@@ -34,3 +34,10 @@ SEAL_C_FUNC Encryptor_EncryptZeroSymmetric1(
 SEAL_C_FUNC Encryptor_EncryptZeroSymmetric2(void *thisptr, bool save_seed, void *destination, void *pool_handle);
 
 SEAL_C_FUNC Encryptor_Destroy(void *thisptr);
+
+SEAL_C_FUNC Encryptor_EncryptAsync(
+    void *thisptr, void *plaintext, void *destination, void *pool_handle, SEAL_C_ASYNC_CALLBACK callback,
+    void *user_data);
+
+SEAL_C_FUNC Encryptor_EncryptBatch(
+    void *thisptr, uint64_t count, void **plaintexts, void **destinations, void *pool_handle);
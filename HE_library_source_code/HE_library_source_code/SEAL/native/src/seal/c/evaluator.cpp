@@ -811,3 +811,246 @@ SEAL_C_FUNC Evaluator_ContextUsingKeyswitching(void *thisptr, bool *using_keyswi
     *using_keyswitching = ph::using_keyswitching(*eval);
     return S_OK;
 }
+
+SEAL_C_FUNC Evaluator_GetLevelManagement(void *thisptr, uint8_t *mode)
+{
+    Evaluator *eval = FromVoid<Evaluator>(thisptr);
+    IfNullRet(eval, E_POINTER);
+    IfNullRet(mode, E_POINTER);
+
+    *mode = static_cast<uint8_t>(eval->level_management());
+    return S_OK;
+}
+
+SEAL_C_FUNC Evaluator_SetLevelManagement(void *thisptr, uint8_t mode)
+{
+    Evaluator *eval = FromVoid<Evaluator>(thisptr);
+    IfNullRet(eval, E_POINTER);
+
+    try
+    {
+        eval->set_level_management(static_cast<level_management_mode>(mode));
+        return S_OK;
+    }
+    catch (const invalid_argument &)
+    {
+        return E_INVALIDARG;
+    }
+}
+
+SEAL_C_FUNC Evaluator_EstimateNoiseBudget(void *thisptr, void *encrypted, int *noise_budget)
+{
+    Evaluator *eval = FromVoid<Evaluator>(thisptr);
+    IfNullRet(eval, E_POINTER);
+    Ciphertext *encryptedptr = FromVoid<Ciphertext>(encrypted);
+    IfNullRet(encryptedptr, E_POINTER);
+    IfNullRet(noise_budget, E_POINTER);
+
+    try
+    {
+        *noise_budget = eval->estimate_noise_budget(*encryptedptr);
+        return S_OK;
+    }
+    catch (const invalid_argument &)
+    {
+        return E_INVALIDARG;
+    }
+    catch (const logic_error &)
+    {
+        return COR_E_INVALIDOPERATION;
+    }
+}
+
+SEAL_C_FUNC Evaluator_MultiplyAsync(
+    void *thisptr, void *encrypted1, void *encrypted2, void *destination, void *pool, SEAL_C_ASYNC_CALLBACK callback,
+    void *user_data)
+{
+    Evaluator *eval = FromVoid<Evaluator>(thisptr);
+    IfNullRet(eval, E_POINTER);
+    Ciphertext *encrypted1_ptr = FromVoid<Ciphertext>(encrypted1);
+    IfNullRet(encrypted1_ptr, E_POINTER);
+    Ciphertext *encrypted2_ptr = FromVoid<Ciphertext>(encrypted2);
+    IfNullRet(encrypted2_ptr, E_POINTER);
+    Ciphertext *destination_ptr = FromVoid<Ciphertext>(destination);
+    IfNullRet(destination_ptr, E_POINTER);
+    unique_ptr<MemoryPoolHandle> pool_ptr = MemHandleFromVoid(pool);
+
+    MemoryPoolHandle pool_handle = *pool_ptr;
+    return SubmitAsync(
+        [=] {
+            return CallAndCatch(
+                [&] { eval->multiply(*encrypted1_ptr, *encrypted2_ptr, *destination_ptr, pool_handle); });
+        },
+        callback, user_data);
+}
+
+SEAL_C_FUNC Evaluator_RelinearizeAsync(
+    void *thisptr, void *encrypted, void *relin_keys, void *destination, void *pool, SEAL_C_ASYNC_CALLBACK callback,
+    void *user_data)
+{
+    Evaluator *eval = FromVoid<Evaluator>(thisptr);
+    IfNullRet(eval, E_POINTER);
+    Ciphertext *encrypted_ptr = FromVoid<Ciphertext>(encrypted);
+    IfNullRet(encrypted_ptr, E_POINTER);
+    RelinKeys *relin_keys_ptr = FromVoid<RelinKeys>(relin_keys);
+    IfNullRet(relin_keys_ptr, E_POINTER);
+    Ciphertext *destination_ptr = FromVoid<Ciphertext>(destination);
+    IfNullRet(destination_ptr, E_POINTER);
+    unique_ptr<MemoryPoolHandle> pool_ptr = MemHandleFromVoid(pool);
+
+    MemoryPoolHandle pool_handle = *pool_ptr;
+    return SubmitAsync(
+        [=] {
+            return CallAndCatch(
+                [&] { eval->relinearize(*encrypted_ptr, *relin_keys_ptr, *destination_ptr, pool_handle); });
+        },
+        callback, user_data);
+}
+
+SEAL_C_FUNC Evaluator_RotateRowsAsync(
+    void *thisptr, void *encrypted, int steps, void *galois_keys, void *destination, void *pool,
+    SEAL_C_ASYNC_CALLBACK callback, void *user_data)
+{
+    Evaluator *eval = FromVoid<Evaluator>(thisptr);
+    IfNullRet(eval, E_POINTER);
+    Ciphertext *encrypted_ptr = FromVoid<Ciphertext>(encrypted);
+    IfNullRet(encrypted_ptr, E_POINTER);
+    GaloisKeys *galois_keys_ptr = FromVoid<GaloisKeys>(galois_keys);
+    IfNullRet(galois_keys_ptr, E_POINTER);
+    Ciphertext *destination_ptr = FromVoid<Ciphertext>(destination);
+    IfNullRet(destination_ptr, E_POINTER);
+    unique_ptr<MemoryPoolHandle> pool_ptr = MemHandleFromVoid(pool);
+
+    MemoryPoolHandle pool_handle = *pool_ptr;
+    return SubmitAsync(
+        [=] {
+            return CallAndCatch(
+                [&] { eval->rotate_rows(*encrypted_ptr, steps, *galois_keys_ptr, *destination_ptr, pool_handle); });
+        },
+        callback, user_data);
+}
+
+SEAL_C_FUNC Evaluator_RotateVectorAsync(
+    void *thisptr, void *encrypted, int steps, void *galois_keys, void *destination, void *pool,
+    SEAL_C_ASYNC_CALLBACK callback, void *user_data)
+{
+    Evaluator *eval = FromVoid<Evaluator>(thisptr);
+    IfNullRet(eval, E_POINTER);
+    Ciphertext *encrypted_ptr = FromVoid<Ciphertext>(encrypted);
+    IfNullRet(encrypted_ptr, E_POINTER);
+    GaloisKeys *galois_keys_ptr = FromVoid<GaloisKeys>(galois_keys);
+    IfNullRet(galois_keys_ptr, E_POINTER);
+    Ciphertext *destination_ptr = FromVoid<Ciphertext>(destination);
+    IfNullRet(destination_ptr, E_POINTER);
+    unique_ptr<MemoryPoolHandle> pool_ptr = MemHandleFromVoid(pool);
+
+    MemoryPoolHandle pool_handle = *pool_ptr;
+    return SubmitAsync(
+        [=] {
+            return CallAndCatch(
+                [&] { eval->rotate_vector(*encrypted_ptr, steps, *galois_keys_ptr, *destination_ptr, pool_handle); });
+        },
+        callback, user_data);
+}
+
+SEAL_C_FUNC Evaluator_MultiplyBatch(
+    void *thisptr, uint64_t count, void **encrypteds1, void **encrypteds2, void **destinations, void *pool)
+{
+    Evaluator *eval = FromVoid<Evaluator>(thisptr);
+    IfNullRet(eval, E_POINTER);
+    IfNullRet(encrypteds1, E_POINTER);
+    IfNullRet(encrypteds2, E_POINTER);
+    IfNullRet(destinations, E_POINTER);
+    unique_ptr<MemoryPoolHandle> pool_ptr = MemHandleFromVoid(pool);
+
+    Ciphertext **encrypteds1_ptr = reinterpret_cast<Ciphertext **>(encrypteds1);
+    Ciphertext **encrypteds2_ptr = reinterpret_cast<Ciphertext **>(encrypteds2);
+    Ciphertext **destinations_ptr = reinterpret_cast<Ciphertext **>(destinations);
+    for (uint64_t i = 0; i < count; i++)
+    {
+        IfNullRet(encrypteds1_ptr[i], E_POINTER);
+        IfNullRet(encrypteds2_ptr[i], E_POINTER);
+        IfNullRet(destinations_ptr[i], E_POINTER);
+    }
+
+    return RunBatch(count, [&](uint64_t i) {
+        return CallAndCatch(
+            [&] { eval->multiply(*encrypteds1_ptr[i], *encrypteds2_ptr[i], *destinations_ptr[i], *pool_ptr); });
+    });
+}
+
+SEAL_C_FUNC Evaluator_RelinearizeBatch(
+    void *thisptr, uint64_t count, void **encrypteds, void *relin_keys, void **destinations, void *pool)
+{
+    Evaluator *eval = FromVoid<Evaluator>(thisptr);
+    IfNullRet(eval, E_POINTER);
+    IfNullRet(encrypteds, E_POINTER);
+    RelinKeys *relin_keys_ptr = FromVoid<RelinKeys>(relin_keys);
+    IfNullRet(relin_keys_ptr, E_POINTER);
+    IfNullRet(destinations, E_POINTER);
+    unique_ptr<MemoryPoolHandle> pool_ptr = MemHandleFromVoid(pool);
+
+    Ciphertext **encrypteds_ptr = reinterpret_cast<Ciphertext **>(encrypteds);
+    Ciphertext **destinations_ptr = reinterpret_cast<Ciphertext **>(destinations);
+    for (uint64_t i = 0; i < count; i++)
+    {
+        IfNullRet(encrypteds_ptr[i], E_POINTER);
+        IfNullRet(destinations_ptr[i], E_POINTER);
+    }
+
+    return RunBatch(count, [&](uint64_t i) {
+        return CallAndCatch(
+            [&] { eval->relinearize(*encrypteds_ptr[i], *relin_keys_ptr, *destinations_ptr[i], *pool_ptr); });
+    });
+}
+
+SEAL_C_FUNC Evaluator_RotateRowsBatch(
+    void *thisptr, uint64_t count, void **encrypteds, int steps, void *galois_keys, void **destinations, void *pool)
+{
+    Evaluator *eval = FromVoid<Evaluator>(thisptr);
+    IfNullRet(eval, E_POINTER);
+    IfNullRet(encrypteds, E_POINTER);
+    GaloisKeys *galois_keys_ptr = FromVoid<GaloisKeys>(galois_keys);
+    IfNullRet(galois_keys_ptr, E_POINTER);
+    IfNullRet(destinations, E_POINTER);
+    unique_ptr<MemoryPoolHandle> pool_ptr = MemHandleFromVoid(pool);
+
+    Ciphertext **encrypteds_ptr = reinterpret_cast<Ciphertext **>(encrypteds);
+    Ciphertext **destinations_ptr = reinterpret_cast<Ciphertext **>(destinations);
+    for (uint64_t i = 0; i < count; i++)
+    {
+        IfNullRet(encrypteds_ptr[i], E_POINTER);
+        IfNullRet(destinations_ptr[i], E_POINTER);
+    }
+
+    return RunBatch(count, [&](uint64_t i) {
+        return CallAndCatch(
+            [&] { eval->rotate_rows(*encrypteds_ptr[i], steps, *galois_keys_ptr, *destinations_ptr[i], *pool_ptr); });
+    });
+}
+
+SEAL_C_FUNC Evaluator_RotateVectorBatch(
+    void *thisptr, uint64_t count, void **encrypteds, int steps, void *galois_keys, void **destinations, void *pool)
+{
+    Evaluator *eval = FromVoid<Evaluator>(thisptr);
+    IfNullRet(eval, E_POINTER);
+    IfNullRet(encrypteds, E_POINTER);
+    GaloisKeys *galois_keys_ptr = FromVoid<GaloisKeys>(galois_keys);
+    IfNullRet(galois_keys_ptr, E_POINTER);
+    IfNullRet(destinations, E_POINTER);
+    unique_ptr<MemoryPoolHandle> pool_ptr = MemHandleFromVoid(pool);
+
+    Ciphertext **encrypteds_ptr = reinterpret_cast<Ciphertext **>(encrypteds);
+    Ciphertext **destinations_ptr = reinterpret_cast<Ciphertext **>(destinations);
+    for (uint64_t i = 0; i < count; i++)
+    {
+        IfNullRet(encrypteds_ptr[i], E_POINTER);
+        IfNullRet(destinations_ptr[i], E_POINTER);
+    }
+
+    return RunBatch(count, [&](uint64_t i) {
+        return CallAndCatch([&] {
+            eval->rotate_vector(*encrypteds_ptr[i], steps, *galois_keys_ptr, *destinations_ptr[i], *pool_ptr);
+        });
+    });
+}
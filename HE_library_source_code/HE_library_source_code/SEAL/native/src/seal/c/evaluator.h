@@ -81,3 +81,37 @@ SEAL_C_FUNC Evaluator_ComplexConjugate(
     void *thisptr, void *encrypted, void *galois_keys, void *destination, void *pool);
 
 SEAL_C_FUNC Evaluator_ContextUsingKeyswitching(void *thisptr, bool *using_keyswitching);
+
+SEAL_C_FUNC Evaluator_GetLevelManagement(void *thisptr, uint8_t *mode);
+
+SEAL_C_FUNC Evaluator_SetLevelManagement(void *thisptr, uint8_t mode);
+
+SEAL_C_FUNC Evaluator_EstimateNoiseBudget(void *thisptr, void *encrypted, int *noise_budget);
+
+SEAL_C_FUNC Evaluator_MultiplyAsync(
+    void *thisptr, void *encrypted1, void *encrypted2, void *destination, void *pool, SEAL_C_ASYNC_CALLBACK callback,
+    void *user_data);
+
+SEAL_C_FUNC Evaluator_RelinearizeAsync(
+    void *thisptr, void *encrypted, void *relin_keys, void *destination, void *pool, SEAL_C_ASYNC_CALLBACK callback,
+    void *user_data);
+
+SEAL_C_FUNC Evaluator_RotateRowsAsync(
+    void *thisptr, void *encrypted, int steps, void *galois_keys, void *destination, void *pool,
+    SEAL_C_ASYNC_CALLBACK callback, void *user_data);
+
+SEAL_C_FUNC Evaluator_RotateVectorAsync(
+    void *thisptr, void *encrypted, int steps, void *galois_keys, void *destination, void *pool,
+    SEAL_C_ASYNC_CALLBACK callback, void *user_data);
+
+SEAL_C_FUNC Evaluator_MultiplyBatch(
+    void *thisptr, uint64_t count, void **encrypteds1, void **encrypteds2, void **destinations, void *pool);
+
+SEAL_C_FUNC Evaluator_RelinearizeBatch(
+    void *thisptr, uint64_t count, void **encrypteds, void *relin_keys, void **destinations, void *pool);
+
+SEAL_C_FUNC Evaluator_RotateRowsBatch(
+    void *thisptr, uint64_t count, void **encrypteds, int steps, void *galois_keys, void **destinations, void *pool);
+
+SEAL_C_FUNC Evaluator_RotateVectorBatch(
+    void *thisptr, uint64_t count, void **encrypteds, int steps, void *galois_keys, void **destinations, void *pool);
@@ -227,3 +227,40 @@ SEAL_C_FUNC KeyGenerator_ContextUsingKeyswitching(void *thisptr, bool *using_key
     *using_keyswitching = ph::using_keyswitching(*keygen);
     return S_OK;
 }
+
+SEAL_C_FUNC KeyGenerator_CreateRelinKeysAsync(
+    void *thisptr, bool save_seed, void **relin_keys, SEAL_C_ASYNC_CALLBACK callback, void *user_data)
+{
+    KeyGenerator *keygen = FromVoid<KeyGenerator>(thisptr);
+    IfNullRet(keygen, E_POINTER);
+    IfNullRet(relin_keys, E_POINTER);
+
+    return SubmitAsync(
+        [=] {
+            return CallAndCatch([&] { *relin_keys = new RelinKeys(ph::create_relin_keys(keygen, save_seed)); });
+        },
+        callback, user_data);
+}
+
+SEAL_C_FUNC KeyGenerator_CreateGaloisKeysFromStepsAsync(
+    void *thisptr, uint64_t count, int *steps, bool save_seed, void **galois_keys, SEAL_C_ASYNC_CALLBACK callback,
+    void *user_data)
+{
+    KeyGenerator *keygen = FromVoid<KeyGenerator>(thisptr);
+    IfNullRet(keygen, E_POINTER);
+    IfNullRet(steps, E_POINTER);
+    IfNullRet(galois_keys, E_POINTER);
+
+    // Copy the steps so that the caller may release them immediately
+    vector<int> steps_vec;
+    copy_n(steps, count, back_inserter(steps_vec));
+
+    return SubmitAsync(
+        [=, steps_vec = move(steps_vec)] {
+            return CallAndCatch([&] {
+                vector<uint32_t> galois_elts_vec = ph::galois_tool(keygen)->get_elts_from_steps(steps_vec);
+                *galois_keys = new GaloisKeys(ph::create_galois_keys(keygen, galois_elts_vec, save_seed));
+            });
+        },
+        callback, user_data);
+}
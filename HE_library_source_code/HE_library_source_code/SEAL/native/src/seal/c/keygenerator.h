@@ -34,3 +34,10 @@ SEAL_C_FUNC KeyGenerator_CreatePublicKey(void *thisptr, bool save_seed, void **p
 SEAL_C_FUNC KeyGenerator_SecretKey(void *thisptr, void **secret_key);
 
 SEAL_C_FUNC KeyGenerator_ContextUsingKeyswitching(void *thisptr, bool *using_keyswitching);
+
+SEAL_C_FUNC KeyGenerator_CreateRelinKeysAsync(
+    void *thisptr, bool save_seed, void **relin_keys, SEAL_C_ASYNC_CALLBACK callback, void *user_data);
+
+SEAL_C_FUNC KeyGenerator_CreateGaloisKeysFromStepsAsync(
+    void *thisptr, uint64_t count, int *steps, bool save_seed, void **galois_keys, SEAL_C_ASYNC_CALLBACK callback,
+    void *user_data);
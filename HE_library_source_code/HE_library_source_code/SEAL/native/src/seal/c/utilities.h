@@ -5,9 +5,13 @@
 
 // STD
 #include <algorithm>
+#include <functional>
 #include <memory>
+#include <new>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 // SEALNet
@@ -79,5 +83,68 @@ namespace seal
         Convert const char * to char* with null terminator
         */
         HRESULT ToStringHelper2(const char *str, char *outstr, uint64_t *length);
+
+        /**
+        Call a function and translate the exceptions it throws to HRESULT values in the same way as the synchronous
+        functions do. Exceptions must not escape from worker threads, so any other exception is caught as well.
+        */
+        template <class F>
+        inline HRESULT CallAndCatch(F &&func)
+        {
+            try
+            {
+                func();
+                return S_OK;
+            }
+            catch (const std::invalid_argument &)
+            {
+                return E_INVALIDARG;
+            }
+            catch (const std::logic_error &)
+            {
+                return COR_E_INVALIDOPERATION;
+            }
+            catch (const std::bad_alloc &)
+            {
+                return E_OUTOFMEMORY;
+            }
+            catch (...)
+            {
+                return E_UNEXPECTED;
+            }
+        }
+
+        /**
+        Enqueue a task onto the internal worker pool. The callback, if not null, is invoked on the worker thread with
+        the result of the task and user_data. Throws if the task cannot be enqueued.
+        */
+        void EnqueueAsync(std::function<HRESULT()> task, SEAL_C_ASYNC_CALLBACK callback, void *user_data);
+
+        /**
+        Enqueue a task onto the internal worker pool as EnqueueAsync does. Returns the HRESULT of a failure to enqueue
+        the task, in which case the callback is never invoked.
+        */
+        template <class F>
+        inline HRESULT SubmitAsync(F &&task, SEAL_C_ASYNC_CALLBACK callback, void *user_data)
+        {
+            return CallAndCatch(
+                [&] { EnqueueAsync(std::function<HRESULT()>(std::forward<F>(task)), callback, user_data); });
+        }
+
+        /**
+        Run task(0), ..., task(count - 1) in parallel on the internal worker pool and wait for all of them to finish.
+        Returns S_OK if all tasks succeed and otherwise the result of the failing task with the lowest index. If the
+        tasks cannot all be enqueued, waits for the ones that were and returns the HRESULT of the failure.
+        */
+        HRESULT RunBatchTasks(uint64_t count, const std::function<HRESULT(uint64_t)> &task);
+
+        /**
+        Run a batch as RunBatchTasks does. The task is passed by reference, so wrapping it does not allocate.
+        */
+        template <class F>
+        inline HRESULT RunBatch(uint64_t count, const F &task)
+        {
+            return RunBatchTasks(count, std::cref(task));
+        }
     } // namespace c
 } // namespace seal
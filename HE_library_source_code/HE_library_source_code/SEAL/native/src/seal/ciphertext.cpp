@@ -26,6 +26,7 @@ namespace seal
         is_ntt_form_ = assign.is_ntt_form_;
         scale_ = assign.scale_;
         correction_factor_ = assign.correction_factor_;
+        noise_estimate_ = assign.noise_estimate_;
 
         // Then resize
         resize_internal(assign.size_, assign.poly_modulus_degree_, assign.coeff_modulus_size_);
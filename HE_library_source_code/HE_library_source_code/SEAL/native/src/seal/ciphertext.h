@@ -282,6 +282,7 @@ namespace seal
             coeff_modulus_size_ = 0;
             scale_ = 1.0;
             correction_factor_ = 1;
+            noise_estimate_ = 0.0;
             data_.release();
         }
 
@@ -668,6 +669,27 @@ namespace seal
             return correction_factor_;
         }
 
+        /**
+        Returns a reference to the noise estimate. This is the estimated bit length of the noise in a BFV or BGV
+        ciphertext, maintained heuristically by Encryptor and Evaluator without using the secret key. A value of zero
+        means that no estimate is available, e.g., for CKKS ciphertexts or ciphertexts loaded from a stream, since the
+        noise estimate is not serialized.
+
+        @see Evaluator::estimate_noise_budget for converting the noise estimate into a noise budget.
+        */
+        SEAL_NODISCARD inline double &noise_estimate() noexcept
+        {
+            return noise_estimate_;
+        }
+
+        /**
+        Returns a constant reference to the noise estimate.
+        */
+        SEAL_NODISCARD inline const double &noise_estimate() const noexcept
+        {
+            return noise_estimate_;
+        }
+
         /**
         Returns the currently used MemoryPoolHandle.
         */
@@ -712,6 +734,8 @@ namespace seal
 
         std::uint64_t correction_factor_ = 1;
 
+        double noise_estimate_ = 0.0;
+
         DynArray<ct_coeff_type> data_;
     };
 } // namespace seal
@@ -11,6 +11,7 @@
 #include "seal/util/dwthandler.h"
 #include "seal/util/uintarithsmallmod.h"
 #include "seal/util/uintcore.h"
+#include <algorithm>
 #include <cmath>
 #include <complex>
 #include <limits>
@@ -432,6 +433,96 @@ namespace seal
             decode_internal(plain, destination.data(), std::move(pool));
         }
 #endif
+        /**
+        Encodes up to N double-precision floating-point real numbers into a plaintext polynomial by packing them into
+        both the real and the imaginary parts of the N/2 slots: values[i] becomes the real part and
+        values[N/2 + i] the imaginary part of slot i. This doubles the number of real values per ciphertext compared
+        to encode. Computations that are linear over the reals act on both halves at once, and
+        Evaluator::separate_packed_real splits an encrypted result into two ciphertexts holding the halves in the
+        real parts of their slots. Zeros are appended if values has fewer than N elements. Dynamic memory allocations
+        in the process are allocated from the memory pool pointed to by the given MemoryPoolHandle.
+
+        @param[in] values The vector of double-precision floating-point numbers to encode
+        @param[in] parms_id parms_id determining the encryption parameters to be used by the result plaintext
+        @param[in] scale Scaling parameter defining encoding precision
+        @param[out] destination The plaintext polynomial to overwrite with the result
+        @param[in] pool The MemoryPoolHandle pointing to a valid memory pool
+        @throws std::invalid_argument if values has more than N elements
+        @throws std::invalid_argument if parms_id is not valid for the encryption parameters
+        @throws std::invalid_argument if scale is not strictly positive
+        @throws std::invalid_argument if encoding is too large for the encryption parameters
+        @throws std::invalid_argument if pool is uninitialized
+        */
+        inline void encode_packed_real(
+            const std::vector<double> &values, parms_id_type parms_id, double scale, Plaintext &destination,
+            MemoryPoolHandle pool = MemoryManager::GetPool()) const
+        {
+            if (values.size() > 2 * slots_)
+            {
+                throw std::invalid_argument("values has invalid size");
+            }
+            std::vector<std::complex<double>> packed(std::min(values.size(), slots_));
+            for (std::size_t i = 0; i < values.size(); i++)
+            {
+                if (i < slots_)
+                {
+                    packed[i].real(values[i]);
+                }
+                else
+                {
+                    packed[i - slots_].imag(values[i]);
+                }
+            }
+            encode_internal(packed.data(), packed.size(), parms_id, scale, destination, std::move(pool));
+        }
+
+        /**
+        Encodes up to N double-precision floating-point real numbers into a plaintext polynomial by packing them into
+        both the real and the imaginary parts of the N/2 slots, as described for the overload taking parms_id. The
+        encryption parameters used are the top level parameters for the given context. Dynamic memory allocations in
+        the process are allocated from the memory pool pointed to by the given MemoryPoolHandle.
+
+        @param[in] values The vector of double-precision floating-point numbers to encode
+        @param[in] scale Scaling parameter defining encoding precision
+        @param[out] destination The plaintext polynomial to overwrite with the result
+        @param[in] pool The MemoryPoolHandle pointing to a valid memory pool
+        @throws std::invalid_argument if values has more than N elements
+        @throws std::invalid_argument if scale is not strictly positive
+        @throws std::invalid_argument if encoding is too large for the encryption parameters
+        @throws std::invalid_argument if pool is uninitialized
+        */
+        inline void encode_packed_real(
+            const std::vector<double> &values, double scale, Plaintext &destination,
+            MemoryPoolHandle pool = MemoryManager::GetPool()) const
+        {
+            encode_packed_real(values, context_.first_parms_id(), scale, destination, std::move(pool));
+        }
+
+        /**
+        Decodes a plaintext polynomial encoded with encode_packed_real into N double-precision floating-point real
+        numbers: the real parts of the slots followed by their imaginary parts. Dynamic memory allocations in the
+        process are allocated from the memory pool pointed to by the given MemoryPoolHandle.
+
+        @param[in] plain The plaintext to decode
+        @param[out] destination The vector to be overwritten with the values
+        @param[in] pool The MemoryPoolHandle pointing to a valid memory pool
+        @throws std::invalid_argument if plain is not in NTT form or is invalid for the encryption parameters
+        @throws std::invalid_argument if pool is uninitialized
+        */
+        inline void decode_packed_real(
+            const Plaintext &plain, std::vector<double> &destination,
+            MemoryPoolHandle pool = MemoryManager::GetPool()) const
+        {
+            std::vector<std::complex<double>> packed(slots_);
+            decode_internal(plain, packed.data(), std::move(pool));
+            destination.resize(2 * slots_);
+            for (std::size_t i = 0; i < slots_; i++)
+            {
+                destination[i] = packed[i].real();
+                destination[slots_ + i] = packed[i].imag();
+            }
+        }
+
         /**
         Returns the number of complex numbers encoded.
         */
@@ -0,0 +1,331 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "seal/compactciphertext.h"
+#include "seal/valcheck.h"
+#include "seal/util/common.h"
+#include <utility>
+
+using namespace std;
+using namespace seal::util;
+
+namespace seal
+{
+    namespace
+    {
+        bool is_metadata_valid(const CompactCiphertext &in, const SEALContext &context)
+        {
+            // Verify parameters
+            if (!context.parameters_set())
+            {
+                return false;
+            }
+
+            // Compact ciphertexts are at data levels
+            auto context_data_ptr = context.get_context_data(in.parms_id());
+            if (!context_data_ptr || context_data_ptr->chain_index() > context.first_context_data()->chain_index())
+            {
+                return false;
+            }
+
+            auto &parms = context_data_ptr->parms();
+            auto &coeff_modulus = parms.coeff_modulus();
+            if (in.poly_modulus_degree() != parms.poly_modulus_degree() ||
+                in.coeff_modulus_size() != coeff_modulus.size())
+            {
+                return false;
+            }
+            if (in.size() < SEAL_CIPHERTEXT_SIZE_MIN || in.size() > SEAL_CIPHERTEXT_SIZE_MAX)
+            {
+                return false;
+            }
+
+            // Truncation is only supported for a single prime in coefficient representation
+            if (in.truncated_bit_count() < 0 ||
+                (in.truncated_bit_count() > 0 &&
+                 (in.is_ntt_form() || coeff_modulus.size() != 1 ||
+                  in.truncated_bit_count() >= coeff_modulus[0].bit_count())))
+            {
+                return false;
+            }
+
+            // Check the scale and correction factor as for Ciphertext
+            double scale = in.scale();
+            uint64_t correction_factor = in.correction_factor();
+            switch (parms.scheme())
+            {
+            case scheme_type::bfv:
+                return scale == 1.0 && correction_factor == 1;
+
+            case scheme_type::ckks:
+                return scale != 0.0 && correction_factor == 1;
+
+            case scheme_type::bgv:
+                return scale == 1.0 && correction_factor != 0 && correction_factor < parms.plain_modulus().value();
+
+            default:
+                return false;
+            }
+        }
+
+        // Returns the number of 64-bit words holding the packed coefficients
+        size_t packed_uint64_count(const CompactCiphertext &in, const SEALContext &context)
+        {
+            auto &coeff_modulus = context.get_context_data(in.parms_id())->parms().coeff_modulus();
+            size_t bit_count = 0;
+            for (auto &mod : coeff_modulus)
+            {
+                bit_count = add_safe(bit_count, static_cast<size_t>(mod.bit_count() - in.truncated_bit_count()));
+            }
+            bit_count = mul_safe(bit_count, in.size(), in.poly_modulus_degree());
+            return divide_round_up(bit_count, static_cast<size_t>(bits_per_uint64));
+        }
+    } // namespace
+
+    void CompactCiphertext::pack(const SEALContext &context, const Ciphertext &encrypted, int truncated_bit_count)
+    {
+        // Verify parameters
+        if (!is_valid_for(encrypted, context))
+        {
+            throw invalid_argument("encrypted is not valid for encryption parameters");
+        }
+        if (encrypted.size() < SEAL_CIPHERTEXT_SIZE_MIN)
+        {
+            throw invalid_argument("encrypted is empty");
+        }
+        auto &coeff_modulus = context.get_context_data(encrypted.parms_id())->parms().coeff_modulus();
+        if (truncated_bit_count < 0 ||
+            (truncated_bit_count > 0 &&
+             (encrypted.is_ntt_form() || coeff_modulus.size() != 1 ||
+              truncated_bit_count >= coeff_modulus[0].bit_count())))
+        {
+            throw invalid_argument("truncated_bit_count is invalid for encrypted");
+        }
+
+        CompactCiphertext new_data(data_.pool());
+        new_data.parms_id_ = encrypted.parms_id();
+        new_data.is_ntt_form_ = encrypted.is_ntt_form();
+        new_data.size_ = encrypted.size();
+        new_data.poly_modulus_degree_ = encrypted.poly_modulus_degree();
+        new_data.coeff_modulus_size_ = encrypted.coeff_modulus_size();
+        new_data.scale_ = encrypted.scale();
+        new_data.correction_factor_ = encrypted.correction_factor();
+        new_data.truncated_bit_count_ = truncated_bit_count;
+        new_data.data_.resize(packed_uint64_count(new_data, context));
+
+        uint64_t *packed = new_data.data_.begin();
+        size_t bit_index = 0;
+        for (size_t j = 0; j < encrypted.size(); j++)
+        {
+            for (size_t i = 0; i < coeff_modulus.size(); i++)
+            {
+                uint64_t modulus = coeff_modulus[i].value();
+                int bit_count = coeff_modulus[i].bit_count() - truncated_bit_count;
+                const uint64_t *coeffs = encrypted.data(j) + i * encrypted.poly_modulus_degree();
+                for (size_t k = 0; k < encrypted.poly_modulus_degree(); k++)
+                {
+                    // Round to the nearest multiple of 2^truncated_bit_count; values that round up to the modulus
+                    // wrap around to zero
+                    uint64_t value = coeffs[k];
+                    if (truncated_bit_count)
+                    {
+                        value = (value + (uint64_t(1) << (truncated_bit_count - 1))) >> truncated_bit_count;
+                        if ((value << truncated_bit_count) >= modulus)
+                        {
+                            value = 0;
+                        }
+                    }
+
+                    size_t word = bit_index / bits_per_uint64;
+                    int shift = static_cast<int>(bit_index % bits_per_uint64);
+                    packed[word] |= value << shift;
+                    if (shift + bit_count > bits_per_uint64)
+                    {
+                        packed[word + 1] |= value >> (bits_per_uint64 - shift);
+                    }
+                    bit_index += static_cast<size_t>(bit_count);
+                }
+            }
+        }
+
+        swap(*this, new_data);
+    }
+
+    void CompactCiphertext::unpack(const SEALContext &context, Ciphertext &destination) const
+    {
+        // Verify parameters
+        if (!is_metadata_valid(*this, context) || data_.size() != packed_uint64_count(*this, context))
+        {
+            throw invalid_argument("compact ciphertext is not valid for encryption parameters");
+        }
+        auto &coeff_modulus = context.get_context_data(parms_id_)->parms().coeff_modulus();
+
+        Ciphertext new_data(destination.pool());
+        new_data.resize(context, parms_id_, size_);
+        new_data.is_ntt_form() = is_ntt_form_;
+        new_data.scale() = scale_;
+        new_data.correction_factor() = correction_factor_;
+
+        const uint64_t *packed = data_.cbegin();
+        size_t bit_index = 0;
+        for (size_t j = 0; j < size_; j++)
+        {
+            for (size_t i = 0; i < coeff_modulus.size(); i++)
+            {
+                uint64_t modulus = coeff_modulus[i].value();
+                int bit_count = coeff_modulus[i].bit_count() - truncated_bit_count_;
+                uint64_t mask = (uint64_t(1) << bit_count) - 1;
+                uint64_t *coeffs = new_data.data(j) + i * poly_modulus_degree_;
+                for (size_t k = 0; k < poly_modulus_degree_; k++)
+                {
+                    size_t word = bit_index / bits_per_uint64;
+                    int shift = static_cast<int>(bit_index % bits_per_uint64);
+                    uint64_t value = packed[word] >> shift;
+                    if (shift + bit_count > bits_per_uint64)
+                    {
+                        value |= packed[word + 1] << (bits_per_uint64 - shift);
+                    }
+                    value = (value & mask) << truncated_bit_count_;
+                    if (value >= modulus)
+                    {
+                        throw logic_error("compact ciphertext data is invalid");
+                    }
+                    coeffs[k] = value;
+                    bit_index += static_cast<size_t>(bit_count);
+                }
+            }
+        }
+
+        swap(destination, new_data);
+    }
+
+    streamoff CompactCiphertext::save_size(compr_mode_type compr_mode) const
+    {
+        size_t members_size = Serialization::ComprSizeEstimate(
+            add_safe(
+                sizeof(parms_id_type), // parms_id_
+                sizeof(seal_byte), // is_ntt_form_
+                sizeof(uint64_t), // size_
+                sizeof(uint64_t), // poly_modulus_degree_
+                sizeof(uint64_t), // coeff_modulus_size_
+                sizeof(double), // scale_
+                sizeof(uint64_t), // correction_factor_
+                sizeof(uint64_t), // truncated_bit_count_
+                safe_cast<size_t>(data_.save_size(compr_mode_type::none))), // data_
+            compr_mode);
+
+        return safe_cast<streamoff>(add_safe(sizeof(Serialization::SEALHeader), members_size));
+    }
+
+    void CompactCiphertext::save_members(ostream &stream) const
+    {
+        auto old_except_mask = stream.exceptions();
+        try
+        {
+            // Throw exceptions on std::ios_base::badbit and std::ios_base::failbit
+            stream.exceptions(ios_base::badbit | ios_base::failbit);
+
+            stream.write(reinterpret_cast<const char *>(&parms_id_), sizeof(parms_id_type));
+            seal_byte is_ntt_form_byte = static_cast<seal_byte>(is_ntt_form_);
+            stream.write(reinterpret_cast<const char *>(&is_ntt_form_byte), sizeof(seal_byte));
+            uint64_t size64 = safe_cast<uint64_t>(size_);
+            stream.write(reinterpret_cast<const char *>(&size64), sizeof(uint64_t));
+            uint64_t poly_modulus_degree64 = safe_cast<uint64_t>(poly_modulus_degree_);
+            stream.write(reinterpret_cast<const char *>(&poly_modulus_degree64), sizeof(uint64_t));
+            uint64_t coeff_modulus_size64 = safe_cast<uint64_t>(coeff_modulus_size_);
+            stream.write(reinterpret_cast<const char *>(&coeff_modulus_size64), sizeof(uint64_t));
+            stream.write(reinterpret_cast<const char *>(&scale_), sizeof(double));
+            stream.write(reinterpret_cast<const char *>(&correction_factor_), sizeof(uint64_t));
+            uint64_t truncated_bit_count64 = safe_cast<uint64_t>(truncated_bit_count_);
+            stream.write(reinterpret_cast<const char *>(&truncated_bit_count64), sizeof(uint64_t));
+
+            // Save the DynArray
+            data_.save(stream, compr_mode_type::none);
+        }
+        catch (const ios_base::failure &)
+        {
+            stream.exceptions(old_except_mask);
+            throw runtime_error("I/O error");
+        }
+        catch (...)
+        {
+            stream.exceptions(old_except_mask);
+            throw;
+        }
+        stream.exceptions(old_except_mask);
+    }
+
+    void CompactCiphertext::load_members(
+        const SEALContext &context, istream &stream, SEAL_MAYBE_UNUSED SEALVersion version)
+    {
+        // Verify parameters
+        if (!context.parameters_set())
+        {
+            throw invalid_argument("encryption parameters are not set correctly");
+        }
+
+        CompactCiphertext new_data(data_.pool());
+
+        auto old_except_mask = stream.exceptions();
+        try
+        {
+            // Throw exceptions on std::ios_base::badbit and std::ios_base::failbit
+            stream.exceptions(ios_base::badbit | ios_base::failbit);
+
+            parms_id_type parms_id{};
+            stream.read(reinterpret_cast<char *>(&parms_id), sizeof(parms_id_type));
+            seal_byte is_ntt_form_byte;
+            stream.read(reinterpret_cast<char *>(&is_ntt_form_byte), sizeof(seal_byte));
+            uint64_t size64 = 0;
+            stream.read(reinterpret_cast<char *>(&size64), sizeof(uint64_t));
+            uint64_t poly_modulus_degree64 = 0;
+            stream.read(reinterpret_cast<char *>(&poly_modulus_degree64), sizeof(uint64_t));
+            uint64_t coeff_modulus_size64 = 0;
+            stream.read(reinterpret_cast<char *>(&coeff_modulus_size64), sizeof(uint64_t));
+            double scale = 0;
+            stream.read(reinterpret_cast<char *>(&scale), sizeof(double));
+            uint64_t correction_factor = 1;
+            stream.read(reinterpret_cast<char *>(&correction_factor), sizeof(uint64_t));
+            uint64_t truncated_bit_count64 = 0;
+            stream.read(reinterpret_cast<char *>(&truncated_bit_count64), sizeof(uint64_t));
+
+            // Set values already at this point for the metadata validity check
+            new_data.parms_id_ = parms_id;
+            new_data.is_ntt_form_ = (is_ntt_form_byte == seal_byte{}) ? false : true;
+            new_data.size_ = safe_cast<size_t>(size64);
+            new_data.poly_modulus_degree_ = safe_cast<size_t>(poly_modulus_degree64);
+            new_data.coeff_modulus_size_ = safe_cast<size_t>(coeff_modulus_size64);
+            new_data.scale_ = scale;
+            new_data.correction_factor_ = correction_factor;
+            new_data.truncated_bit_count_ = safe_cast<int>(truncated_bit_count64);
+
+            // Checking the validity of loaded metadata
+            if (!is_metadata_valid(new_data, context))
+            {
+                throw logic_error("compact ciphertext data is invalid");
+            }
+
+            // Load the data, bounding its size to prevent a malformed DynArray from causing arbitrarily large
+            // memory allocations
+            auto total_uint64_count = packed_uint64_count(new_data, context);
+            new_data.data_.load(stream, total_uint64_count);
+            if (new_data.data_.size() != total_uint64_count)
+            {
+                throw logic_error("compact ciphertext data is invalid");
+            }
+        }
+        catch (const ios_base::failure &)
+        {
+            stream.exceptions(old_except_mask);
+            throw runtime_error("I/O error");
+        }
+        catch (...)
+        {
+            stream.exceptions(old_except_mask);
+            throw;
+        }
+        stream.exceptions(old_except_mask);
+
+        swap(*this, new_data);
+    }
+} // namespace seal
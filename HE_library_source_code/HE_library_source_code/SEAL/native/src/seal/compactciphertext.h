@@ -0,0 +1,290 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+#include "seal/ciphertext.h"
+#include "seal/context.h"
+#include "seal/dynarray.h"
+#include "seal/memorymanager.h"
+#include "seal/serialization.h"
+#include "seal/version.h"
+#include "seal/util/defines.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+
+namespace seal
+{
+    /**
+    Class to store a ciphertext in a compact form for transport to the owner of the secret key. Every coefficient
+    modulo a prime q_i of the coefficient modulus is stored with exactly bit_count(q_i) bits instead of in a 64-bit
+    word. For BFV ciphertexts at a level with a single prime, the lowest truncated_bit_count bits of every
+    coefficient can additionally be rounded away, which adds to the noise but shrinks the ciphertext further.
+
+    A compact ciphertext supports no homomorphic operations. It is typically created with
+    Evaluator::prepare_for_transport, which first switches the ciphertext to the lowest level that still decrypts
+    correctly, and is decrypted directly with Decryptor::decrypt or converted back into a Ciphertext with unpack.
+
+    @par Thread Safety
+    In general, reading from a compact ciphertext is thread-safe as long as no other thread is concurrently
+    mutating it.
+
+    @see Ciphertext for the class that stores ciphertexts.
+    */
+    class CompactCiphertext
+    {
+    public:
+        /**
+        Constructs an empty compact ciphertext allocating no memory.
+
+        @param[in] pool The MemoryPoolHandle pointing to a valid memory pool
+        @throws std::invalid_argument if pool is uninitialized
+        */
+        CompactCiphertext(MemoryPoolHandle pool = MemoryManager::GetPool()) : data_(std::move(pool))
+        {}
+
+        /**
+        Creates a new compact ciphertext by copying a given one.
+
+        @param[in] copy The compact ciphertext to copy from
+        */
+        CompactCiphertext(const CompactCiphertext &copy) = default;
+
+        /**
+        Creates a new compact ciphertext by moving a given one.
+
+        @param[in] source The compact ciphertext to move from
+        */
+        CompactCiphertext(CompactCiphertext &&source) = default;
+
+        /**
+        Copies a given compact ciphertext to the current one.
+
+        @param[in] assign The compact ciphertext to copy from
+        */
+        CompactCiphertext &operator=(const CompactCiphertext &assign) = default;
+
+        /**
+        Moves a given compact ciphertext to the current one.
+
+        @param[in] assign The compact ciphertext to move from
+        */
+        CompactCiphertext &operator=(CompactCiphertext &&assign) = default;
+
+        /**
+        Packs a ciphertext into the current compact ciphertext, rounding every coefficient to a multiple of
+        2^truncated_bit_count. The noise estimate of the ciphertext is not kept.
+
+        @param[in] context The SEALContext
+        @param[in] encrypted The ciphertext to pack
+        @param[in] truncated_bit_count The number of low-order bits to round away
+        @throws std::invalid_argument if encrypted is not valid for the encryption parameters
+        @throws std::invalid_argument if truncated_bit_count is negative, or if it is positive and encrypted is in
+        NTT form, has more than one prime, or truncated_bit_count is not smaller than the bit count of the prime
+        */
+        void pack(const SEALContext &context, const Ciphertext &encrypted, int truncated_bit_count = 0);
+
+        /**
+        Unpacks the current compact ciphertext into a ciphertext.
+
+        @param[in] context The SEALContext
+        @param[out] destination The ciphertext to overwrite with the unpacked ciphertext
+        @throws std::invalid_argument if the current compact ciphertext is not valid for the encryption parameters
+        @throws std::logic_error if the packed data is invalid
+        */
+        void unpack(const SEALContext &context, Ciphertext &destination) const;
+
+        /**
+        Returns a reference to parms_id of the packed ciphertext.
+        */
+        SEAL_NODISCARD inline const parms_id_type &parms_id() const noexcept
+        {
+            return parms_id_;
+        }
+
+        /**
+        Returns whether the packed ciphertext is in NTT form.
+        */
+        SEAL_NODISCARD inline bool is_ntt_form() const noexcept
+        {
+            return is_ntt_form_;
+        }
+
+        /**
+        Returns the size of the packed ciphertext.
+        */
+        SEAL_NODISCARD inline std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        /**
+        Returns the degree of the polynomial modulus of the parameters of the packed ciphertext.
+        */
+        SEAL_NODISCARD inline std::size_t poly_modulus_degree() const noexcept
+        {
+            return poly_modulus_degree_;
+        }
+
+        /**
+        Returns the number of primes in the coefficient modulus of the parameters of the packed ciphertext.
+        */
+        SEAL_NODISCARD inline std::size_t coeff_modulus_size() const noexcept
+        {
+            return coeff_modulus_size_;
+        }
+
+        /**
+        Returns the scale of the packed ciphertext.
+        */
+        SEAL_NODISCARD inline double scale() const noexcept
+        {
+            return scale_;
+        }
+
+        /**
+        Returns the correction factor of the packed ciphertext.
+        */
+        SEAL_NODISCARD inline std::uint64_t correction_factor() const noexcept
+        {
+            return correction_factor_;
+        }
+
+        /**
+        Returns the number of low-order bits rounded away from every coefficient.
+        */
+        SEAL_NODISCARD inline int truncated_bit_count() const noexcept
+        {
+            return truncated_bit_count_;
+        }
+
+        /**
+        Returns a constant reference to the packed coefficient data.
+        */
+        SEAL_NODISCARD inline const DynArray<std::uint64_t> &data() const noexcept
+        {
+            return data_;
+        }
+
+        /**
+        Returns the currently used MemoryPoolHandle.
+        */
+        SEAL_NODISCARD inline MemoryPoolHandle pool() const noexcept
+        {
+            return data_.pool();
+        }
+
+        /**
+        Returns an upper bound on the size of the compact ciphertext, as if it was written to an output stream.
+
+        @param[in] compr_mode The compression mode
+        @throws std::invalid_argument if the compression mode is not supported
+        @throws std::logic_error if the size does not fit in the return type
+        */
+        SEAL_NODISCARD std::streamoff save_size(compr_mode_type compr_mode = Serialization::compr_mode_default) const;
+
+        /**
+        Saves the compact ciphertext to an output stream. The output is in binary format and not human-readable.
+        The output stream must have the "binary" flag set.
+
+        @param[out] stream The stream to save the compact ciphertext to
+        @param[in] compr_mode The desired compression mode
+        @throws std::invalid_argument if the compression mode is not supported
+        @throws std::logic_error if the data to be saved is invalid, or if compression failed
+        @throws std::runtime_error if I/O operations failed
+        */
+        inline std::streamoff save(
+            std::ostream &stream, compr_mode_type compr_mode = Serialization::compr_mode_default) const
+        {
+            using namespace std::placeholders;
+            return Serialization::Save(
+                std::bind(&CompactCiphertext::save_members, this, _1), save_size(compr_mode_type::none), stream,
+                compr_mode, false);
+        }
+
+        /**
+        Loads a compact ciphertext from an input stream overwriting the current compact ciphertext. The metadata
+        is verified to be valid for the given SEALContext; the coefficients are verified by unpack.
+
+        @param[in] context The SEALContext
+        @param[in] stream The stream to load the compact ciphertext from
+        @throws std::invalid_argument if the encryption parameters are not valid
+        @throws std::logic_error if the data cannot be loaded by this version of Microsoft SEAL, if the loaded data
+        is invalid, or if decompression failed
+        @throws std::runtime_error if I/O operations failed
+        */
+        inline std::streamoff load(const SEALContext &context, std::istream &stream)
+        {
+            using namespace std::placeholders;
+            return Serialization::Load(
+                std::bind(&CompactCiphertext::load_members, this, context, _1, _2), stream, false);
+        }
+
+        /**
+        Saves the compact ciphertext to a given memory location. The output is in binary format and is not
+        human-readable.
+
+        @param[out] out The memory location to write the compact ciphertext to
+        @param[in] size The number of bytes available in the given memory location
+        @param[in] compr_mode The desired compression mode
+        @throws std::invalid_argument if out is null or if size is too small to contain a SEALHeader, or if the
+        compression mode is not supported
+        @throws std::logic_error if the data to be saved is invalid, or if compression failed
+        @throws std::runtime_error if I/O operations failed
+        */
+        inline std::streamoff save(
+            seal_byte *out, std::size_t size, compr_mode_type compr_mode = Serialization::compr_mode_default) const
+        {
+            using namespace std::placeholders;
+            return Serialization::Save(
+                std::bind(&CompactCiphertext::save_members, this, _1), save_size(compr_mode_type::none), out, size,
+                compr_mode, false);
+        }
+
+        /**
+        Loads a compact ciphertext from a given memory location overwriting the current compact ciphertext. The
+        metadata is verified to be valid for the given SEALContext; the coefficients are verified by unpack.
+
+        @param[in] context The SEALContext
+        @param[in] in The memory location to load the compact ciphertext from
+        @param[in] size The number of bytes available in the given memory location
+        @throws std::invalid_argument if the encryption parameters are not valid
+        @throws std::invalid_argument if in is null or if size is too small to contain a SEALHeader
+        @throws std::logic_error if the data cannot be loaded by this version of Microsoft SEAL, if the loaded data
+        is invalid, or if decompression failed
+        @throws std::runtime_error if I/O operations failed
+        */
+        inline std::streamoff load(const SEALContext &context, const seal_byte *in, std::size_t size)
+        {
+            using namespace std::placeholders;
+            return Serialization::Load(
+                std::bind(&CompactCiphertext::load_members, this, context, _1, _2), in, size, false);
+        }
+
+    private:
+        void save_members(std::ostream &stream) const;
+
+        void load_members(const SEALContext &context, std::istream &stream, SEALVersion version);
+
+        parms_id_type parms_id_ = parms_id_zero;
+
+        bool is_ntt_form_ = false;
+
+        std::size_t size_ = 0;
+
+        std::size_t poly_modulus_degree_ = 0;
+
+        std::size_t coeff_modulus_size_ = 0;
+
+        double scale_ = 1.0;
+
+        std::uint64_t correction_factor_ = 1;
+
+        int truncated_bit_count_ = 0;
+
+        DynArray<std::uint64_t> data_;
+    };
+} // namespace seal
@@ -419,12 +419,12 @@ namespace seal
         return context_data;
     }
 
-    parms_id_type SEALContext::create_next_context_data(const parms_id_type &prev_parms_id)
+    parms_id_type SEALContext::create_next_context_data(const parms_id_type &prev_parms_id, size_t drop_count)
     {
-        // Create the next set of parameters by removing last modulus
+        // Create the next set of parameters by removing last drop_count moduli
         auto next_parms = context_data_map_.at(prev_parms_id)->parms_;
         auto next_coeff_modulus = next_parms.coeff_modulus();
-        next_coeff_modulus.pop_back();
+        next_coeff_modulus.resize(next_coeff_modulus.size() - drop_count);
         next_parms.set_coeff_modulus(next_coeff_modulus);
         auto next_parms_id = next_parms.parms_id();
 
@@ -475,15 +475,20 @@ namespace seal
 
         // Then create first_parms_id_ if the parameters are valid and there is
         // more than one modulus in coeff_modulus. This is equivalent to expanding
-        // the chain by one step. Otherwise, we set first_parms_id_ to equal
+        // the chain by one step, or by dropping all special primes when hybrid key
+        // switching is used. Otherwise, we set first_parms_id_ to equal
         // key_parms_id_.
-        if (!context_data_map_.at(key_parms_id_)->qualifiers_.parameters_set() || parms.coeff_modulus().size() == 1)
+        size_t coeff_modulus_size = parms.coeff_modulus().size();
+        size_t special_prime_count = parms.key_switching_digit_count()
+                                         ? divide_round_up(coeff_modulus_size, parms.key_switching_digit_count() + 1)
+                                         : size_t(1);
+        if (!context_data_map_.at(key_parms_id_)->qualifiers_.parameters_set() || coeff_modulus_size == 1)
         {
             first_parms_id_ = key_parms_id_;
         }
         else
         {
-            auto next_parms_id = create_next_context_data(key_parms_id_);
+            auto next_parms_id = create_next_context_data(key_parms_id_, special_prime_count);
             first_parms_id_ = (next_parms_id == parms_id_zero) ? key_parms_id_ : next_parms_id;
         }
 
@@ -492,6 +497,7 @@ namespace seal
 
         // Check if keyswitching is available
         using_keyswitching_ = (first_parms_id_ != key_parms_id_);
+        special_prime_count_ = using_keyswitching_ ? special_prime_count : 0;
 
         // If modulus switching chain is to be created, compute the remaining parameter sets as long as they are valid
         // to use (i.e., parameters_set() == true).
@@ -510,6 +516,23 @@ namespace seal
             }
         }
 
+        // Create the pre-computations for hybrid key switching at every data level
+        if (special_prime_count_ > 1)
+        {
+            auto &key_modulus = parms.coeff_modulus();
+            RNSBase special_base(vector<Modulus>(key_modulus.end() - special_prime_count_, key_modulus.end()), pool_);
+
+            auto data_context_data_ptr = context_data_map_.at(first_parms_id_);
+            while (data_context_data_ptr)
+            {
+                auto &data_parms = data_context_data_ptr->parms();
+                const_pointer_cast<ContextData>(data_context_data_ptr)->key_switch_tool_ = allocate<KeySwitchTool>(
+                    pool_, data_parms.poly_modulus_degree(), RNSBase(data_parms.coeff_modulus(), pool_), special_base,
+                    special_prime_count_, data_parms.plain_modulus(), pool_);
+                data_context_data_ptr = data_context_data_ptr->next_context_data_;
+            }
+        }
+
         // Set the chain_index for each context_data
         size_t parms_count = context_data_map_.size();
         auto context_data_ptr = context_data_map_.at(key_parms_id_);
@@ -343,6 +343,16 @@ namespace seal
                 return galois_tool_.get();
             }
 
+            /**
+            Returns a constant pointer to the KeySwitchTool. This is nullptr unless the
+            encryption parameters use hybrid key switching and the current parameters
+            are used for data.
+            */
+            SEAL_NODISCARD inline const util::KeySwitchTool *key_switch_tool() const noexcept
+            {
+                return key_switch_tool_.get();
+            }
+
             /**
             Return a pointer to BFV "Delta", i.e. coefficient modulus divided by
             plaintext modulus.
@@ -457,6 +467,8 @@ namespace seal
 
             util::Pointer<util::GaloisTool> galois_tool_;
 
+            util::Pointer<util::KeySwitchTool> key_switch_tool_;
+
             util::Pointer<std::uint64_t> total_coeff_modulus_;
 
             int total_coeff_modulus_bit_count_ = 0;
@@ -632,6 +644,18 @@ namespace seal
             return using_keyswitching_;
         }
 
+        /**
+        Returns the number of special primes, i.e., the number of primes at the end
+        of the coefficient modulus that are used only by keys. This is one unless
+        the key switching digit count is set in the encryption parameters (see
+        EncryptionParameters::set_key_switching_digit_count), and zero if
+        keyswitching is not supported.
+        */
+        SEAL_NODISCARD inline std::size_t special_prime_count() const noexcept
+        {
+            return special_prime_count_;
+        }
+
     private:
         /**
         Creates an instance of SEALContext, and performs several pre-computations
@@ -650,12 +674,12 @@ namespace seal
         ContextData validate(EncryptionParameters parms);
 
         /**
-        Create the next context_data by dropping the last element from coeff_modulus.
-        If the new encryption parameters are not valid, returns parms_id_zero.
-        Otherwise, returns the parms_id of the next parameter and appends the next
-        context_data to the chain.
+        Create the next context_data by dropping the last drop_count elements from
+        coeff_modulus. If the new encryption parameters are not valid, returns
+        parms_id_zero. Otherwise, returns the parms_id of the next parameter and
+        appends the next context_data to the chain.
         */
-        parms_id_type create_next_context_data(const parms_id_type &prev_parms);
+        parms_id_type create_next_context_data(const parms_id_type &prev_parms, std::size_t drop_count = 1);
 
         MemoryPoolHandle pool_;
 
@@ -676,5 +700,10 @@ namespace seal
         Is keyswitching supported by the encryption parameters?
         */
         bool using_keyswitching_;
+
+        /**
+        How many primes are dropped from the key level to the first data level?
+        */
+        std::size_t special_prime_count_ = 0;
     };
 } // namespace seal
@@ -111,6 +111,13 @@ namespace seal
         }
     }
 
+    void Decryptor::decrypt(const CompactCiphertext &encrypted, Plaintext &destination)
+    {
+        Ciphertext unpacked(pool_);
+        encrypted.unpack(context_, unpacked);
+        decrypt(unpacked, destination);
+    }
+
     void Decryptor::bfv_decrypt(const Ciphertext &encrypted, Plaintext &destination, MemoryPoolHandle pool)
     {
         if (encrypted.is_ntt_form())
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "seal/ciphertext.h"
+#include "seal/compactciphertext.h"
 #include "seal/context.h"
 #include "seal/encryptionparams.h"
 #include "seal/memorymanager.h"
@@ -73,6 +74,20 @@ namespace seal
         */
         void decrypt(const Ciphertext &encrypted, Plaintext &destination);
 
+        /*
+        Decrypts a CompactCiphertext, e.g., as returned by Evaluator::prepare_for_transport, and stores the result in
+        the destination parameter.
+
+        @param[in] encrypted The compact ciphertext to decrypt
+        @param[out] destination The plaintext to overwrite with the decrypted
+        ciphertext
+        @throws std::invalid_argument if encrypted is not valid for the encryption
+        parameters
+        @throws std::invalid_argument if encrypted is not in the default NTT form
+        @throws std::logic_error if the packed data of encrypted is invalid
+        */
+        void decrypt(const CompactCiphertext &encrypted, Plaintext &destination);
+
         /*
         Computes the invariant noise budget (in bits) of a ciphertext. The
         invariant noise budget measures the amount of room there is for the noise
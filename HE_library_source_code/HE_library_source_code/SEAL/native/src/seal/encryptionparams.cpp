@@ -25,6 +25,10 @@ namespace seal
             uint8_t scheme = static_cast<uint8_t>(scheme_);
 
             stream.write(reinterpret_cast<const char *>(&scheme), sizeof(uint8_t));
+            // The key switching digit count is stored in the upper half of the coeff_modulus size so that
+            // parameters that do not set it are saved exactly as before
+            coeff_modulus_size64 |= static_cast<uint64_t>(key_switching_digit_count_) << 32;
+
             stream.write(reinterpret_cast<const char *>(&poly_modulus_degree64), sizeof(uint64_t));
             stream.write(reinterpret_cast<const char *>(&coeff_modulus_size64), sizeof(uint64_t));
             for (const auto &mod : coeff_modulus_)
@@ -77,6 +81,14 @@ namespace seal
             uint64_t coeff_modulus_size64 = 0;
             stream.read(reinterpret_cast<char *>(&coeff_modulus_size64), sizeof(uint64_t));
 
+            // The upper half holds the key switching digit count
+            uint64_t key_switching_digit_count64 = coeff_modulus_size64 >> 32;
+            coeff_modulus_size64 &= 0xFFFFFFFFULL;
+            if (key_switching_digit_count64 > SEAL_COEFF_MOD_COUNT_MAX)
+            {
+                throw logic_error("key_switching_digit_count is invalid");
+            }
+
             // Only check for upper bound; lower bound is zero for scheme_type::none
             if (coeff_modulus_size64 > SEAL_COEFF_MOD_COUNT_MAX)
             {
@@ -102,6 +114,7 @@ namespace seal
             // Only BFV and BGV uses plain_modulus; set_plain_modulus checks that for
             // other schemes it is zero
             parms.set_plain_modulus(plain_modulus);
+            parms.set_key_switching_digit_count(safe_cast<size_t>(key_switching_digit_count64));
 
             // Set the loaded parameters
             swap(*this, parms);
@@ -128,7 +141,8 @@ namespace seal
         size_t total_uint64_count = add_safe(
             size_t(1), // scheme
             size_t(1), // poly_modulus_degree
-            coeff_modulus_size, plain_modulus_.uint64_count());
+            coeff_modulus_size, plain_modulus_.uint64_count(),
+            size_t(key_switching_digit_count_ ? 1 : 0));
 
         auto param_data(allocate_uint(total_uint64_count, pool_));
         uint64_t *param_data_ptr = param_data.get();
@@ -147,6 +161,12 @@ namespace seal
         set_uint(plain_modulus_.data(), plain_modulus_.uint64_count(), param_data_ptr);
         param_data_ptr += plain_modulus_.uint64_count();
 
+        // Write the key switching digit count only if set so that the default parms_id is unchanged
+        if (key_switching_digit_count_)
+        {
+            *param_data_ptr++ = static_cast<uint64_t>(key_switching_digit_count_);
+        }
+
         HashFunction::hash(param_data.get(), total_uint64_count, parms_id_);
 
         // Did we somehow manage to get a zero block as result? This is reserved for
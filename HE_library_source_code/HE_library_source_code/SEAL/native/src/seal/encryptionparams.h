@@ -253,6 +253,47 @@ namespace seal
             set_plain_modulus(Modulus(plain_modulus));
         }
 
+        /**
+        Sets the number of digits (often called dnum) that ciphertexts are decomposed
+        into in key switching, i.e., in relinearization and rotations. By default,
+        and when set to zero, the last prime in the coefficient modulus is the only
+        special prime and key switching decomposes ciphertexts into one digit per
+        remaining prime.
+
+        Otherwise hybrid key switching is used: the last alpha primes in the
+        coefficient modulus are special primes, where alpha is the smallest number
+        such that the remaining primes can be grouped into at most dnum digits of
+        alpha consecutive primes each, i.e., alpha = ceil(k / (dnum + 1)) for a
+        coefficient modulus of k primes. Key switching keys then consist of one
+        ciphertext per digit instead of one per prime, and key switching performs
+        fewer NTTs. For the noise growth of key switching to be small, the product
+        of the special primes should be at least as large as the product of the
+        primes in any digit. For example, a coefficient modulus of 12 primes with
+        dnum set to 3 has 3 special primes and 9 remaining primes in 3 digits.
+
+        @param[in] key_switching_digit_count The number of digits (dnum)
+        @throws std::logic_error if a valid scheme is not set and
+        key_switching_digit_count is non-zero
+        @throws std::invalid_argument if key_switching_digit_count is larger than
+        SEAL_COEFF_MOD_COUNT_MAX
+        */
+        inline void set_key_switching_digit_count(std::size_t key_switching_digit_count)
+        {
+            if (scheme_ == scheme_type::none && key_switching_digit_count)
+            {
+                throw std::logic_error("key_switching_digit_count is not supported for this scheme");
+            }
+            if (key_switching_digit_count > SEAL_COEFF_MOD_COUNT_MAX)
+            {
+                throw std::invalid_argument("key_switching_digit_count is invalid");
+            }
+
+            key_switching_digit_count_ = key_switching_digit_count;
+
+            // Re-compute the parms_id
+            compute_parms_id();
+        }
+
         /**
         Sets the random number generator factory to use for encryption. By default,
         the random generator is set to UniformRandomGeneratorFactory::default_factory().
@@ -298,6 +339,15 @@ namespace seal
             return plain_modulus_;
         }
 
+        /**
+        Returns the number of digits in key switching, or zero if key switching uses
+        a single special prime.
+        */
+        SEAL_NODISCARD inline std::size_t key_switching_digit_count() const noexcept
+        {
+            return key_switching_digit_count_;
+        }
+
         /**
         Returns a pointer to the random number generator factory to use for encryption.
         */
@@ -501,6 +551,8 @@ namespace seal
 
         Modulus plain_modulus_{};
 
+        std::size_t key_switching_digit_count_ = 0;
+
         parms_id_type parms_id_ = parms_id_zero;
     };
 } // namespace seal
@@ -6,6 +6,7 @@
 #include "seal/randomtostd.h"
 #include "seal/util/common.h"
 #include "seal/util/iterator.h"
+#include "seal/util/noiseestimate.h"
 #include "seal/util/polyarithsmallmod.h"
 #include "seal/util/rlwe.h"
 #include "seal/util/scalingvariant.h"
@@ -134,9 +135,30 @@ namespace seal
                 Ciphertext temp(pool);
                 util::encrypt_zero_asymmetric(public_key_, context_, prev_parms_id, is_ntt_form, temp);
 
-                // Modulus switching
+                // Modulus switching; with hybrid key switching all special primes are dropped at once
+                auto key_switch_tool = context_data.key_switch_tool();
+                bool drop_special_primes = key_switch_tool && (parms_id == context_.first_parms_id());
+                auto q_ntt_tables = iter(prev_context_data.small_ntt_tables());
+                auto p_ntt_tables = iter(prev_context_data.small_ntt_tables() + coeff_modulus_size);
                 SEAL_ITERATE(iter(temp, destination), temp.size(), [&](auto I) {
-                    if (parms.scheme() == scheme_type::ckks)
+                    if (drop_special_primes)
+                    {
+                        if (parms.scheme() == scheme_type::ckks)
+                        {
+                            key_switch_tool->divide_and_round_p_ntt_inplace(
+                                get<0>(I), q_ntt_tables, p_ntt_tables, pool);
+                        }
+                        else if (parms.scheme() == scheme_type::bfv)
+                        {
+                            key_switch_tool->divide_and_round_p_inplace(get<0>(I), pool);
+                        }
+                        else if (parms.scheme() == scheme_type::bgv)
+                        {
+                            key_switch_tool->mod_t_and_divide_p_ntt_inplace(
+                                get<0>(I), q_ntt_tables, p_ntt_tables, pool);
+                        }
+                    }
+                    else if (parms.scheme() == scheme_type::ckks)
                     {
                         rns_tool->divide_and_round_q_last_ntt_inplace(
                             get<0>(I), prev_context_data.small_ntt_tables(), pool);
@@ -171,6 +193,9 @@ namespace seal
             // Does not require modulus switching
             util::encrypt_zero_symmetric(secret_key_, context_, parms_id, is_ntt_form, save_seed, destination);
         }
+
+        // Start tracking the noise heuristically
+        destination.noise_estimate() = estimate_fresh_noise(context_data, is_asymmetric);
     }
 
     void Encryptor::encrypt_internal(
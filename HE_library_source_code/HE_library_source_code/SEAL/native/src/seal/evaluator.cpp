@@ -2,16 +2,24 @@
 // Licensed under the MIT license.
 
 #include "seal/evaluator.h"
+#include "seal/ckks.h"
 #include "seal/util/common.h"
 #include "seal/util/galois.h"
+#include "seal/util/lazyaccumulator.h"
+#include "seal/util/noiseestimate.h"
+#include "seal/util/ntt.h"
 #include "seal/util/numth.h"
 #include "seal/util/polyarithsmallmod.h"
 #include "seal/util/polycore.h"
+#include "seal/util/polyeval.h"
+#include "seal/util/profiling.h"
 #include "seal/util/scalingvariant.h"
 #include "seal/util/uintarith.h"
 #include <algorithm>
 #include <cmath>
 #include <functional>
+#include <limits>
+#include <map>
 
 using namespace std;
 using namespace seal::util;
@@ -116,6 +124,424 @@ namespace seal
             }
             return make_tuple(multiply_uint_mod(e1, factor1, plain_modulus), e1, e2);
         }
+
+        /**
+        Evaluates a polynomial on a ciphertext with the Paterson-Stockmeyer algorithm. The coefficient type T is double
+        for CKKS and std::uint64_t (reduced modulo the plaintext modulus) for BFV and BGV. The basis consists of either
+        powers or Chebyshev polynomials of the variable. In CKKS and BGV every product is followed by a rescaling or
+        modulus switching, and every partial result is computed directly at a prescribed level (and in CKKS at a
+        prescribed scale, by folding the scale correction into the scalar multiplications), so that partial results
+        can be added without any realignment.
+        */
+        template <typename T>
+        class PatersonStockmeyerEvaluator
+        {
+        public:
+            PatersonStockmeyerEvaluator(
+                const Evaluator &evaluator, const SEALContext &context, const RelinKeys &relin_keys, bool chebyshev,
+                MemoryPoolHandle pool)
+                : evaluator_(evaluator), context_(context), relin_keys_(relin_keys), chebyshev_(chebyshev),
+                  pool_(move(pool))
+            {
+                auto context_data_ptr = context_.first_context_data();
+                is_ckks_ = context_data_ptr->parms().scheme() == scheme_type::ckks;
+                uses_levels_ = context_data_ptr->parms().scheme() != scheme_type::bfv;
+                if (is_ckks_)
+                {
+                    encoder_ = make_unique<CKKSEncoder>(context_);
+                }
+
+                // Index the modulus switching chain by level
+                context_data_by_level_.resize(context_data_ptr->chain_index() + 1);
+                while (context_data_ptr)
+                {
+                    context_data_by_level_[context_data_ptr->chain_index()] = context_data_ptr;
+                    context_data_ptr = context_data_ptr->next_context_data();
+                }
+            }
+
+            /**
+            Evaluates the polynomial at alpha * x + beta. The affine change of variable is only supported for CKKS and
+            consumes one level unless it is the identity.
+            */
+            void evaluate(const Ciphertext &x, vector<T> coeffs, double alpha, double beta, Ciphertext &destination)
+            {
+                size_t degree = coeffs.size() - 1;
+                ps_params_ = select_paterson_stockmeyer_params(degree);
+
+                bool has_affine_map = alpha != 1.0 || beta != 0.0;
+                long variable_level = static_cast<long>(level(x)) - (has_affine_map ? 1 : 0);
+                double target_scale = x.scale();
+
+                // Find the level of the result before doing any expensive work
+                long target_level = 0;
+                if (uses_levels_)
+                {
+                    target_level = max_level(coeffs, variable_level);
+                    if (variable_level < 0 || target_level < 0)
+                    {
+                        throw invalid_argument("encrypted is at too low a level for the degree of the polynomial");
+                    }
+                }
+
+                basis_.clear();
+                if (has_affine_map)
+                {
+                    basis_[1] = linear_combination(
+                        { { &x, static_cast<T>(alpha) } }, static_cast<T>(beta), static_cast<size_t>(variable_level),
+                        target_scale);
+                }
+                else
+                {
+                    basis_[1] = x;
+                }
+                compute_basis(degree);
+
+                destination = evaluate_recursive(coeffs, static_cast<size_t>(target_level), target_scale);
+            }
+
+        private:
+            SEAL_NODISCARD size_t level(const Ciphertext &encrypted) const
+            {
+                return context_.get_context_data(encrypted.parms_id())->chain_index();
+            }
+
+            // Level of the i-th basis element when every multiplication consumes one level
+            SEAL_NODISCARD long basis_level(size_t index, long variable_level) const
+            {
+                return variable_level - get_significant_bit_count(static_cast<uint64_t>(index - 1));
+            }
+
+            SEAL_NODISCARD size_t largest_giant_step(size_t degree) const
+            {
+                size_t giant = ps_params_.baby_steps;
+                while (giant * 2 <= degree)
+                {
+                    giant *= 2;
+                }
+                return giant;
+            }
+
+            // Returns the highest level at which the polynomial can be evaluated; the result may be negative.
+            SEAL_NODISCARD long max_level(const vector<T> &coeffs, long variable_level) const
+            {
+                return paterson_stockmeyer_max_level(coeffs, ps_params_, chebyshev_, is_ckks_, variable_level);
+            }
+
+            void compute_basis(size_t degree)
+            {
+                size_t baby_count = min(ps_params_.baby_steps - 1, degree);
+                for (size_t i = 2; i <= baby_count; i++)
+                {
+                    compute_basis_element(i);
+                }
+                for (size_t j = 0; j < ps_params_.giant_steps; j++)
+                {
+                    compute_basis_element(ps_params_.baby_steps << j);
+                }
+            }
+
+            void compute_basis_element(size_t index)
+            {
+                // Split index = m + n where m is the largest power of two less than index
+                size_t m = size_t(1) << (get_significant_bit_count(static_cast<uint64_t>(index - 1)) - 1);
+                size_t n = index - m;
+                Ciphertext result = multiply(basis_.at(m), basis_.at(n));
+                if (chebyshev_)
+                {
+                    // T_{m + n} = 2 * T_m * T_n - T_{m - n}
+                    evaluator_.add_inplace(result, result);
+                    if (m == n)
+                    {
+                        Plaintext one(pool_);
+                        encoder_->encode(1.0, result.parms_id(), result.scale(), one, pool_);
+                        evaluator_.sub_plain_inplace(result, one, pool_);
+                    }
+                    else
+                    {
+                        const Ciphertext &difference = basis_.at(m - n);
+                        if (level(difference) == level(result) && are_close(difference.scale(), result.scale()))
+                        {
+                            evaluator_.sub_inplace(result, difference);
+                        }
+                        else
+                        {
+                            evaluator_.sub_inplace(
+                                result, linear_combination({ { &difference, T(1) } }, T(0), level(result),
+                                                           result.scale()));
+                        }
+                    }
+                }
+                basis_[index] = move(result);
+            }
+
+            // Multiplies two ciphertexts at the lower of their levels, then relinearizes and drops one level
+            SEAL_NODISCARD Ciphertext multiply(const Ciphertext &encrypted1, const Ciphertext &encrypted2)
+            {
+                size_t input_level = min(level(encrypted1), level(encrypted2));
+                Ciphertext result = encrypted1;
+                if (&encrypted1 == &encrypted2)
+                {
+                    evaluator_.square_inplace(result, pool_);
+                }
+                else if (level(encrypted1) > level(encrypted2))
+                {
+                    evaluator_.mod_switch_to_inplace(result, encrypted2.parms_id(), pool_);
+                    evaluator_.multiply_inplace(result, encrypted2, pool_);
+                }
+                else if (level(encrypted1) < level(encrypted2))
+                {
+                    Ciphertext temp = encrypted2;
+                    evaluator_.mod_switch_to_inplace(temp, encrypted1.parms_id(), pool_);
+                    evaluator_.multiply_inplace(result, temp, pool_);
+                }
+                else
+                {
+                    evaluator_.multiply_inplace(result, encrypted2, pool_);
+                }
+                evaluator_.relinearize_inplace(result, relin_keys_, pool_);
+
+                // With eager level management the product has already been switched down
+                if (uses_levels_ && level(result) == input_level)
+                {
+                    if (is_ckks_)
+                    {
+                        evaluator_.rescale_to_next_inplace(result, pool_);
+                    }
+                    else
+                    {
+                        evaluator_.mod_switch_to_next_inplace(result, pool_);
+                    }
+                }
+                return result;
+            }
+
+            void encode_constant(T value, parms_id_type parms_id, double scale, Plaintext &destination) const
+            {
+                if (is_ckks_)
+                {
+                    double real_value = static_cast<double>(value);
+
+                    // A non-zero coefficient must not round to zero, as the product would be transparent
+                    if (fabs(real_value * scale) < 1.0)
+                    {
+                        real_value = copysign(1.0 / scale, real_value);
+                    }
+                    encoder_->encode(real_value, parms_id, scale, destination, pool_);
+                }
+                else
+                {
+                    destination.resize(1);
+                    destination[0] = static_cast<uint64_t>(value);
+                }
+            }
+
+            /**
+            Computes sum_i c_i * encrypted_i + constant at the given level. In CKKS the result has exactly the given
+            scale; every term is computed at the next higher level with a scalar that absorbs the scale difference,
+            followed by a single rescaling.
+            */
+            SEAL_NODISCARD Ciphertext linear_combination(
+                const vector<pair<const Ciphertext *, T>> &terms, T constant, size_t target_level, double target_scale)
+            {
+                Ciphertext result(pool_);
+                bool initialized = false;
+                parms_id_type parms_id = parms_id_zero;
+                double sum_scale = 1.0;
+                if (is_ckks_)
+                {
+                    auto &context_data = *context_data_by_level_[target_level + 1];
+                    parms_id = context_data.parms_id();
+                    sum_scale =
+                        target_scale * static_cast<double>(context_data.parms().coeff_modulus().back().value());
+                }
+                else if (uses_levels_)
+                {
+                    parms_id = context_data_by_level_[target_level]->parms_id();
+                }
+
+                Plaintext plain(pool_);
+                for (auto &term : terms)
+                {
+                    if (term.second == T(0))
+                    {
+                        continue;
+                    }
+
+                    Ciphertext temp = *term.first;
+                    if (is_ckks_)
+                    {
+                        evaluator_.mod_switch_to_inplace(temp, parms_id, pool_);
+                        encode_constant(term.second, parms_id, sum_scale / temp.scale(), plain);
+                        evaluator_.multiply_plain_inplace(temp, plain, pool_);
+                        temp.scale() = sum_scale;
+                    }
+                    else
+                    {
+                        if (uses_levels_)
+                        {
+                            evaluator_.mod_switch_to_inplace(temp, parms_id, pool_);
+                        }
+                        encode_constant(term.second, parms_id, 1.0, plain);
+                        evaluator_.multiply_plain_inplace(temp, plain, pool_);
+                    }
+
+                    if (initialized)
+                    {
+                        evaluator_.add_inplace(result, temp);
+                    }
+                    else
+                    {
+                        result = move(temp);
+                        initialized = true;
+                    }
+                }
+                if (!initialized)
+                {
+                    throw logic_error("linear combination has no terms");
+                }
+
+                if (constant != T(0))
+                {
+                    encode_constant(constant, parms_id, sum_scale, plain);
+                    evaluator_.add_plain_inplace(result, plain, pool_);
+                }
+                if (is_ckks_)
+                {
+                    evaluator_.rescale_to_next_inplace(result, pool_);
+                    result.scale() = target_scale;
+                }
+                return result;
+            }
+
+            SEAL_NODISCARD Ciphertext evaluate_recursive(
+                const vector<T> &coeffs, size_t target_level, double target_scale)
+            {
+                size_t degree = coeffs.size() - 1;
+                if (degree < ps_params_.baby_steps)
+                {
+                    vector<pair<const Ciphertext *, T>> terms;
+                    for (size_t i = 1; i <= degree; i++)
+                    {
+                        terms.emplace_back(&basis_.at(i), coeffs[i]);
+                    }
+                    return linear_combination(terms, coeffs[0], target_level, target_scale);
+                }
+
+                // Write the polynomial as quotient * giant + remainder
+                size_t giant = largest_giant_step(degree);
+                const Ciphertext &giant_element = basis_.at(giant);
+                vector<T> quotient;
+                vector<T> remainder;
+                divide_series(coeffs, giant, chebyshev_, quotient, remainder);
+
+                Ciphertext result(pool_);
+                if (quotient.size() == 1)
+                {
+                    result = linear_combination({ { &giant_element, quotient[0] } }, T(0), target_level, target_scale);
+                }
+                else
+                {
+                    // Choose the scale of the quotient so that the product rescales exactly to target_scale
+                    double quotient_scale = 1.0;
+                    if (is_ckks_)
+                    {
+                        auto &context_data = *context_data_by_level_[target_level + 1];
+                        quotient_scale = target_scale *
+                                         static_cast<double>(context_data.parms().coeff_modulus().back().value()) /
+                                         giant_element.scale();
+                    }
+                    Ciphertext quotient_result = evaluate_recursive(quotient, target_level + 1, quotient_scale);
+                    result = multiply(quotient_result, giant_element);
+                    if (is_ckks_)
+                    {
+                        result.scale() = target_scale;
+                    }
+                }
+
+                if (remainder.size() > 1)
+                {
+                    evaluator_.add_inplace(result, evaluate_recursive(remainder, target_level, target_scale));
+                }
+                else if (remainder[0] != T(0))
+                {
+                    Plaintext plain(pool_);
+                    encode_constant(remainder[0], result.parms_id(), result.scale(), plain);
+                    evaluator_.add_plain_inplace(result, plain, pool_);
+                }
+                return result;
+            }
+
+            const Evaluator &evaluator_;
+
+            const SEALContext &context_;
+
+            const RelinKeys &relin_keys_;
+
+            bool chebyshev_;
+
+            MemoryPoolHandle pool_;
+
+            bool is_ckks_ = false;
+
+            bool uses_levels_ = false;
+
+            unique_ptr<CKKSEncoder> encoder_;
+
+            vector<shared_ptr<const SEALContext::ContextData>> context_data_by_level_;
+
+            PatersonStockmeyerParams ps_params_;
+
+            map<size_t, Ciphertext> basis_;
+        };
+
+        // Writes the sum of the given signed powers of X, where -k stands for -X^k, as a CKKS plaintext in NTT form
+        void set_monomial_sum_plain(
+            const SEALContext::ContextData &context_data, const vector<long> &terms, double scale,
+            Plaintext &destination)
+        {
+            auto &coeff_modulus = context_data.parms().coeff_modulus();
+            size_t coeff_count = context_data.parms().poly_modulus_degree();
+            size_t coeff_modulus_size = coeff_modulus.size();
+            destination.parms_id() = parms_id_zero;
+            destination.resize(coeff_count * coeff_modulus_size);
+            destination.set_zero();
+            for (size_t i = 0; i < coeff_modulus_size; i++)
+            {
+                for (long term : terms)
+                {
+                    auto &coeff = destination[i * coeff_count + static_cast<size_t>(abs(term))];
+                    coeff = term < 0 ? add_uint_mod(coeff, coeff_modulus[i].value() - 1, coeff_modulus[i])
+                                     : add_uint_mod(coeff, 1, coeff_modulus[i]);
+                }
+            }
+            ntt_negacyclic_harvey(
+                RNSIter(destination.data(), coeff_count), coeff_modulus_size, iter(context_data.small_ntt_tables()));
+            destination.parms_id() = context_data.parms_id();
+            destination.scale() = scale;
+        }
+
+        // Reduces a signed integer modulo modulus
+        SEAL_NODISCARD inline uint64_t reduce_signed(int64_t value, const Modulus &modulus)
+        {
+            uint64_t magnitude = value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+            magnitude = barrett_reduce_64(magnitude, modulus);
+            return value < 0 ? negate_uint_mod(magnitude, modulus) : magnitude;
+        }
+
+        // Returns the integer the message is multiplied with: in BFV and BGV the representative of value modulo the
+        // plaintext modulus that is smallest in absolute value, which keeps the noise growth smallest
+        SEAL_NODISCARD int64_t reduce_message_scalar(const EncryptionParameters &parms, int64_t value)
+        {
+            if (parms.scheme() == scheme_type::ckks)
+            {
+                return value;
+            }
+            auto &plain_modulus = parms.plain_modulus();
+            uint64_t reduced = reduce_signed(value, plain_modulus);
+            return reduced > (plain_modulus.value() >> 1) ? -static_cast<int64_t>(plain_modulus.value() - reduced)
+                                                          : static_cast<int64_t>(reduced);
+        }
     } // namespace
 
     Evaluator::Evaluator(const SEALContext &context) : context_(context)
@@ -163,6 +589,14 @@ namespace seal
         {
             throw invalid_argument("encrypted2 is not valid for encryption parameters");
         }
+
+        // Align levels if level management is enabled
+        Ciphertext encrypted2_aligned;
+        if (align_levels(encrypted1, encrypted2, encrypted2_aligned, MemoryManager::GetPool()))
+        {
+            add_inplace(encrypted1, encrypted2_aligned);
+            return;
+        }
         if (encrypted1.parms_id() != encrypted2.parms_id())
         {
             throw invalid_argument("encrypted1 and encrypted2 parameter mismatch");
@@ -211,6 +645,10 @@ namespace seal
             // Set new correction factor
             encrypted1.correction_factor() = get<0>(factors);
             encrypted2_copy.correction_factor() = get<0>(factors);
+            encrypted1.noise_estimate() =
+                estimate_multiply_scalar_noise(encrypted1.noise_estimate(), get<1>(factors), plain_modulus);
+            encrypted2_copy.noise_estimate() =
+                estimate_multiply_scalar_noise(encrypted2.noise_estimate(), get<2>(factors), plain_modulus);
 
             add_inplace(encrypted1, encrypted2_copy);
         }
@@ -228,6 +666,7 @@ namespace seal
                     encrypted2.data(min_count), encrypted2_size - encrypted1_size, coeff_count, coeff_modulus_size,
                     encrypted1.data(encrypted1_size));
             }
+            encrypted1.noise_estimate() = estimate_add_noise(encrypted1.noise_estimate(), encrypted2.noise_estimate());
         }
 
 #ifdef SEAL_THROW_ON_TRANSPARENT_CIPHERTEXT
@@ -271,6 +710,14 @@ namespace seal
         {
             throw invalid_argument("encrypted2 is not valid for encryption parameters");
         }
+
+        // Align levels if level management is enabled
+        Ciphertext encrypted2_aligned;
+        if (align_levels(encrypted1, encrypted2, encrypted2_aligned, MemoryManager::GetPool()))
+        {
+            sub_inplace(encrypted1, encrypted2_aligned);
+            return;
+        }
         if (encrypted1.parms_id() != encrypted2.parms_id())
         {
             throw invalid_argument("encrypted1 and encrypted2 parameter mismatch");
@@ -320,6 +767,10 @@ namespace seal
             // Set new correction factor
             encrypted1.correction_factor() = get<0>(factors);
             encrypted2_copy.correction_factor() = get<0>(factors);
+            encrypted1.noise_estimate() =
+                estimate_multiply_scalar_noise(encrypted1.noise_estimate(), get<1>(factors), plain_modulus);
+            encrypted2_copy.noise_estimate() =
+                estimate_multiply_scalar_noise(encrypted2.noise_estimate(), get<2>(factors), plain_modulus);
 
             sub_inplace(encrypted1, encrypted2_copy);
         }
@@ -338,6 +789,7 @@ namespace seal
                     iter(encrypted2) + min_count, encrypted2_size - min_count, coeff_modulus,
                     iter(encrypted1) + min_count);
             }
+            encrypted1.noise_estimate() = estimate_add_noise(encrypted1.noise_estimate(), encrypted2.noise_estimate());
         }
 
 #ifdef SEAL_THROW_ON_TRANSPARENT_CIPHERTEXT
@@ -360,11 +812,23 @@ namespace seal
         {
             throw invalid_argument("encrypted2 is not valid for encryption parameters");
         }
+
+        // Align levels if level management is enabled
+        Ciphertext encrypted2_aligned;
+        if (align_levels(encrypted1, encrypted2, encrypted2_aligned, pool))
+        {
+            multiply_inplace(encrypted1, encrypted2_aligned, move(pool));
+            return;
+        }
         if (encrypted1.parms_id() != encrypted2.parms_id())
         {
             throw invalid_argument("encrypted1 and encrypted2 parameter mismatch");
         }
 
+        double noise_estimate = estimate_multiply_noise(
+            *context_.get_context_data(encrypted1.parms_id()), encrypted1.noise_estimate(), encrypted1.size(),
+            encrypted2.noise_estimate(), encrypted2.size());
+
         auto context_data_ptr = context_.first_context_data();
         switch (context_data_ptr->parms().scheme())
         {
@@ -383,6 +847,7 @@ namespace seal
         default:
             throw invalid_argument("unsupported scheme");
         }
+        encrypted1.noise_estimate() = noise_estimate;
 #ifdef SEAL_THROW_ON_TRANSPARENT_CIPHERTEXT
         // Transparent ciphertext output is not allowed.
         if (encrypted1.is_transparent())
@@ -390,6 +855,93 @@ namespace seal
             throw logic_error("result ciphertext is transparent");
         }
 #endif
+        if (level_management_ == level_management_mode::eager)
+        {
+            eager_switch_to_next(encrypted1, move(pool));
+        }
+    }
+
+    bool Evaluator::align_levels(
+        Ciphertext &encrypted1, const Ciphertext &encrypted2, Ciphertext &aligned, MemoryPoolHandle pool) const
+    {
+        if (level_management_ == level_management_mode::manual || encrypted1.parms_id() == encrypted2.parms_id())
+        {
+            return false;
+        }
+
+        auto context_data1_ptr = context_.get_context_data(encrypted1.parms_id());
+        auto context_data2_ptr = context_.get_context_data(encrypted2.parms_id());
+        if (!context_data1_ptr || !context_data2_ptr)
+        {
+            // Let the caller report invalid parameters
+            return false;
+        }
+
+        // Never switch the operand at the lower level, and never modify encrypted2
+        if (context_data1_ptr->chain_index() > context_data2_ptr->chain_index())
+        {
+            mod_switch_to_inplace(encrypted1, encrypted2.parms_id(), move(pool));
+            return false;
+        }
+        aligned = encrypted2;
+        mod_switch_to_inplace(aligned, encrypted1.parms_id(), move(pool));
+        return true;
+    }
+
+    void Evaluator::eager_switch_to_next(Ciphertext &encrypted, MemoryPoolHandle pool) const
+    {
+        auto &context_data = *context_.get_context_data(encrypted.parms_id());
+        if (!context_data.next_context_data())
+        {
+            // Already at the last level
+            return;
+        }
+
+        switch (context_data.parms().scheme())
+        {
+        case scheme_type::bgv:
+            mod_switch_to_next_inplace(encrypted, pool);
+            break;
+
+        case scheme_type::ckks:
+            rescale_to_next_inplace(encrypted, move(pool));
+            return;
+
+        default:
+            // Modulus switching in BFV is only a matter of performance; switch only if the noise estimate allows
+            break;
+        }
+
+        // Keep switching down while this costs less than one bit of estimated noise budget
+        while (encrypted.noise_estimate() > 0)
+        {
+            auto &current_context_data = *context_.get_context_data(encrypted.parms_id());
+            if (!current_context_data.next_context_data())
+            {
+                break;
+            }
+            double switched_noise =
+                estimate_mod_switch_noise(current_context_data, encrypted.noise_estimate(), encrypted.size());
+            double dropped_bits =
+                log2(static_cast<double>(current_context_data.parms().coeff_modulus().back().value()));
+            if (dropped_bits - (encrypted.noise_estimate() - switched_noise) >= 1.0)
+            {
+                break;
+            }
+            mod_switch_to_next_inplace(encrypted, pool);
+        }
+    }
+
+    int Evaluator::estimate_noise_budget(const Ciphertext &encrypted) const
+    {
+        // Verify parameters.
+        if (!is_metadata_valid_for(encrypted, context_))
+        {
+            throw invalid_argument("encrypted is not valid for encryption parameters");
+        }
+
+        return util::estimate_noise_budget(
+            *context_.get_context_data(encrypted.parms_id()), encrypted.noise_estimate());
     }
 
     void Evaluator::bfv_multiply(Ciphertext &encrypted1, const Ciphertext &encrypted2, MemoryPoolHandle pool) const
@@ -848,24 +1400,29 @@ namespace seal
             throw invalid_argument("encrypted is not valid for encryption parameters");
         }
 
+        double noise_estimate = estimate_multiply_noise(
+            *context_.get_context_data(encrypted.parms_id()), encrypted.noise_estimate(), encrypted.size(),
+            encrypted.noise_estimate(), encrypted.size());
+
         auto context_data_ptr = context_.first_context_data();
         switch (context_data_ptr->parms().scheme())
         {
         case scheme_type::bfv:
-            bfv_square(encrypted, move(pool));
+            bfv_square(encrypted, pool);
             break;
 
         case scheme_type::ckks:
-            ckks_square(encrypted, move(pool));
+            ckks_square(encrypted, pool);
             break;
 
         case scheme_type::bgv:
-            bgv_square(encrypted, move(pool));
+            bgv_square(encrypted, pool);
             break;
 
         default:
             throw invalid_argument("unsupported scheme");
         }
+        encrypted.noise_estimate() = noise_estimate;
 #ifdef SEAL_THROW_ON_TRANSPARENT_CIPHERTEXT
         // Transparent ciphertext output is not allowed.
         if (encrypted.is_transparent())
@@ -873,6 +1430,10 @@ namespace seal
             throw logic_error("result ciphertext is transparent");
         }
 #endif
+        if (level_management_ == level_management_mode::eager)
+        {
+            eager_switch_to_next(encrypted, move(pool));
+        }
     }
 
     void Evaluator::bfv_square(Ciphertext &encrypted, MemoryPoolHandle pool) const
@@ -1265,6 +1826,8 @@ namespace seal
 
         // Set other attributes
         destination.is_ntt_form() = encrypted.is_ntt_form();
+        destination.noise_estimate() =
+            estimate_mod_switch_noise(context_data, encrypted_copy.noise_estimate(), encrypted_size);
         if (next_parms.scheme() == scheme_type::ckks)
         {
             // Change the scale when using CKKS
@@ -1279,8 +1842,9 @@ namespace seal
         }
     }
 
-    void Evaluator::mod_switch_drop_to_next(
-        const Ciphertext &encrypted, Ciphertext &destination, MemoryPoolHandle pool) const
+    void Evaluator::mod_switch_drop_to(
+        const Ciphertext &encrypted, Ciphertext &destination,
+        const SEALContext::ContextData &target_context_data) const
     {
         // Assuming at this point encrypted is already validated.
         auto context_data_ptr = context_.get_context_data(encrypted.parms_id());
@@ -1290,93 +1854,79 @@ namespace seal
         }
 
         // Extract encryption parameters.
-        auto &next_context_data = *context_data_ptr->next_context_data();
-        auto &next_parms = next_context_data.parms();
+        auto &target_parms = target_context_data.parms();
 
-        if (!is_scale_within_bounds(encrypted.scale(), next_context_data))
+        if (!is_scale_within_bounds(encrypted.scale(), target_context_data))
         {
             throw invalid_argument("scale out of bounds");
         }
 
-        // q_1,...,q_{k-1}
-        size_t next_coeff_modulus_size = next_parms.coeff_modulus().size();
-        size_t coeff_count = next_parms.poly_modulus_degree();
+        // q_1,...,q_j
+        size_t coeff_modulus_size = encrypted.coeff_modulus_size();
+        size_t target_coeff_modulus_size = target_parms.coeff_modulus().size();
+        size_t coeff_count = target_parms.poly_modulus_degree();
         size_t encrypted_size = encrypted.size();
 
         // Size check
-        if (!product_fits_in(encrypted_size, coeff_count, next_coeff_modulus_size))
+        if (!product_fits_in(encrypted_size, coeff_count, coeff_modulus_size))
         {
             throw logic_error("invalid parameters");
         }
 
-        auto drop_modulus_and_copy = [&](ConstPolyIter in_iter, PolyIter out_iter) {
-            SEAL_ITERATE(iter(in_iter, out_iter), encrypted_size, [&](auto I) {
-                SEAL_ITERATE(
-                    iter(I), next_coeff_modulus_size, [&](auto J) { set_uint(get<0>(J), coeff_count, get<1>(J)); });
-            });
-        };
-
+        size_t target_poly_uint64_count = target_coeff_modulus_size * coeff_count;
         if (&encrypted == &destination)
         {
-            // Switching in-place so need temporary space
-            SEAL_ALLOCATE_GET_POLY_ITER(temp, encrypted_size, coeff_count, next_coeff_modulus_size, pool);
-
-            // Copy data over to temp; only copy the RNS components relevant after modulus drop
-            drop_modulus_and_copy(encrypted, temp);
-
-            // Resize destination before writing
-            destination.resize(context_, next_context_data.parms_id(), encrypted_size);
-
-            // Copy data to destination
-            set_poly_array(temp, encrypted_size, coeff_count, next_coeff_modulus_size, destination.data());
-            // TODO: avoid copying and temporary space allocation
+            // Dropping primes only moves the remaining RNS components of every polynomial next to each other. The
+            // first polynomial stays in place and the others move towards the front, so the data can be compacted
+            // without temporary space; resizing to a smaller size keeps the allocation.
+            SEAL_ITERATE(iter(size_t(1)), encrypted_size - 1, [&](auto I) {
+                const uint64_t *source = destination.data(I);
+                copy(source, source + target_poly_uint64_count, destination.data() + I * target_poly_uint64_count);
+            });
+            destination.resize(context_, target_context_data.parms_id(), encrypted_size);
         }
         else
         {
             // Resize destination before writing
-            destination.resize(context_, next_context_data.parms_id(), encrypted_size);
+            destination.resize(context_, target_context_data.parms_id(), encrypted_size);
 
             // Copy data over to destination; only copy the RNS components relevant after modulus drop
-            drop_modulus_and_copy(encrypted, destination);
+            SEAL_ITERATE(iter(size_t(0)), encrypted_size, [&](auto I) {
+                set_uint(encrypted.data(I), target_poly_uint64_count, destination.data(I));
+            });
         }
         destination.is_ntt_form() = true;
         destination.scale() = encrypted.scale();
         destination.correction_factor() = encrypted.correction_factor();
+        destination.noise_estimate() = encrypted.noise_estimate();
     }
 
-    void Evaluator::mod_switch_drop_to_next(Plaintext &plain) const
+    void Evaluator::mod_switch_drop_to(Plaintext &plain, const SEALContext::ContextData &target_context_data) const
     {
         // Assuming at this point plain is already validated.
-        auto context_data_ptr = context_.get_context_data(plain.parms_id());
         if (!plain.is_ntt_form())
         {
             throw invalid_argument("plain is not in NTT form");
         }
-        if (!context_data_ptr->next_context_data())
-        {
-            throw invalid_argument("end of modulus switching chain reached");
-        }
-
-        // Extract encryption parameters.
-        auto &next_context_data = *context_data_ptr->next_context_data();
-        auto &next_parms = context_data_ptr->next_context_data()->parms();
 
-        if (!is_scale_within_bounds(plain.scale(), next_context_data))
+        if (!is_scale_within_bounds(plain.scale(), target_context_data))
         {
             throw invalid_argument("scale out of bounds");
         }
 
-        // q_1,...,q_{k-1}
-        auto &next_coeff_modulus = next_parms.coeff_modulus();
-        size_t next_coeff_modulus_size = next_coeff_modulus.size();
-        size_t coeff_count = next_parms.poly_modulus_degree();
+        // q_1,...,q_j
+        auto &target_parms = target_context_data.parms();
+        size_t target_coeff_modulus_size = target_parms.coeff_modulus().size();
+        size_t coeff_count = target_parms.poly_modulus_degree();
 
         // Compute destination size first for exception safety
-        auto dest_size = mul_safe(next_coeff_modulus_size, coeff_count);
+        auto dest_size = mul_safe(target_coeff_modulus_size, coeff_count);
 
+        // The RNS components of a plaintext are contiguous, so dropping primes is a truncation that keeps the
+        // allocation
         plain.parms_id() = parms_id_zero;
         plain.resize(dest_size);
-        plain.parms_id() = next_context_data.parms_id();
+        plain.parms_id() = target_context_data.parms_id();
     }
 
     void Evaluator::mod_switch_to_next(
@@ -1407,7 +1957,7 @@ namespace seal
 
         case scheme_type::ckks:
             // Modulus switching without scaling
-            mod_switch_drop_to_next(encrypted, destination, move(pool));
+            mod_switch_drop_to(encrypted, destination, *context_data_ptr->next_context_data());
             break;
 
         case scheme_type::bgv:
@@ -1444,6 +1994,33 @@ namespace seal
             throw invalid_argument("cannot switch to higher level modulus");
         }
 
+        if (encrypted.parms_id() == parms_id)
+        {
+            return;
+        }
+
+        // In CKKS all primes are dropped at once
+        if (context_data_ptr->parms().scheme() == scheme_type::ckks)
+        {
+            if (!is_metadata_valid_for(encrypted, context_) || !is_buffer_valid(encrypted))
+            {
+                throw invalid_argument("encrypted is not valid for encryption parameters");
+            }
+            if (!pool)
+            {
+                throw invalid_argument("pool is uninitialized");
+            }
+            mod_switch_drop_to(encrypted, encrypted, *target_context_data_ptr);
+#ifdef SEAL_THROW_ON_TRANSPARENT_CIPHERTEXT
+            // Transparent ciphertext output is not allowed.
+            if (encrypted.is_transparent())
+            {
+                throw logic_error("result ciphertext is transparent");
+            }
+#endif
+            return;
+        }
+
         while (encrypted.parms_id() != parms_id)
         {
             mod_switch_to_next_inplace(encrypted, pool);
@@ -1472,12 +2049,82 @@ namespace seal
             throw invalid_argument("cannot switch to higher level modulus");
         }
 
-        while (plain.parms_id() != parms_id)
+        if (plain.parms_id() != parms_id)
         {
-            mod_switch_to_next_inplace(plain);
+            mod_switch_drop_to(plain, *target_context_data_ptr);
         }
     }
 
+    void Evaluator::prepare_for_transport(
+        const Ciphertext &encrypted, CompactCiphertext &destination, int min_noise_budget, bool truncate,
+        MemoryPoolHandle pool) const
+    {
+        // Verify parameters.
+        if (!is_metadata_valid_for(encrypted, context_) || !is_buffer_valid(encrypted))
+        {
+            throw invalid_argument("encrypted is not valid for encryption parameters");
+        }
+        if (min_noise_budget < 0)
+        {
+            throw invalid_argument("min_noise_budget cannot be negative");
+        }
+        if (!pool)
+        {
+            throw invalid_argument("pool is uninitialized");
+        }
+
+        auto scheme = context_.first_context_data()->parms().scheme();
+        if (scheme != scheme_type::bfv && scheme != scheme_type::bgv)
+        {
+            throw logic_error("unsupported scheme");
+        }
+        if (encrypted.is_ntt_form() != (scheme == scheme_type::bgv))
+        {
+            throw invalid_argument("encrypted is not in the default NTT form");
+        }
+
+        Ciphertext switched(encrypted, pool);
+        int truncated_bit_count = 0;
+        if (switched.noise_estimate() > 0)
+        {
+            // Switch down as long as the estimated noise budget at the next level is large enough
+            while (true)
+            {
+                auto &context_data = *context_.get_context_data(switched.parms_id());
+                auto next_context_data_ptr = context_data.next_context_data();
+                if (!next_context_data_ptr)
+                {
+                    break;
+                }
+                double switched_noise =
+                    estimate_mod_switch_noise(context_data, switched.noise_estimate(), switched.size());
+                if (util::estimate_noise_budget(*next_context_data_ptr, switched_noise) < min_noise_budget)
+                {
+                    break;
+                }
+                mod_switch_to_next_inplace(switched, pool);
+            }
+
+            // Rounding away low-order bits adds noise that BFV tolerates, whereas in BGV the low-order bits carry the
+            // message. Only a single prime can be truncated directly in RNS representation.
+            auto &context_data = *context_.get_context_data(switched.parms_id());
+            auto &coeff_modulus = context_data.parms().coeff_modulus();
+            if (truncate && scheme == scheme_type::bfv && coeff_modulus.size() == 1)
+            {
+                while (truncated_bit_count + 1 < coeff_modulus[0].bit_count() &&
+                       util::estimate_noise_budget(
+                           context_data, estimate_truncation_noise(
+                                             context_data, switched.noise_estimate(), switched.size(),
+                                             truncated_bit_count + 1)) >= min_noise_budget)
+                {
+                    truncated_bit_count++;
+                }
+            }
+        }
+
+        destination.pack(context_, switched, truncated_bit_count);
+    }
+
     void Evaluator::rescale_to_next(const Ciphertext &encrypted, Ciphertext &destination, MemoryPoolHandle pool) const
     {
         // Verify parameters.
@@ -1590,7 +2237,7 @@ namespace seal
             throw invalid_argument("pool is uninitialized");
         }
 
-        mod_switch_drop_to_next(encrypted, encrypted, std::move(pool));
+        mod_switch_drop_to(encrypted, encrypted, *context_data_ptr->next_context_data());
 #ifdef SEAL_THROW_ON_TRANSPARENT_CIPHERTEXT
         // Transparent ciphertext output is not allowed.
         if (encrypted.is_transparent())
@@ -1618,10 +2265,28 @@ namespace seal
             throw invalid_argument("cannot switch to higher level modulus");
         }
 
-        while (encrypted.parms_id() != parms_id)
+        if (encrypted.parms_id() == parms_id)
+        {
+            return;
+        }
+        if (!is_metadata_valid_for(encrypted, context_) || !is_buffer_valid(encrypted))
+        {
+            throw invalid_argument("encrypted is not valid for encryption parameters");
+        }
+        if (!pool)
         {
-            mod_reduce_to_next_inplace(encrypted, pool);
+            throw invalid_argument("pool is uninitialized");
         }
+
+        // All primes are dropped at once
+        mod_switch_drop_to(encrypted, encrypted, *target_context_data_ptr);
+#ifdef SEAL_THROW_ON_TRANSPARENT_CIPHERTEXT
+        // Transparent ciphertext output is not allowed.
+        if (encrypted.is_transparent())
+        {
+            throw logic_error("result ciphertext is transparent");
+        }
+#endif
     }
 
     void Evaluator::multiply_many(
@@ -1734,6 +2399,434 @@ namespace seal
         multiply_many(exp_vector, relin_keys, encrypted, move(pool));
     }
 
+    void Evaluator::evaluate_polynomial(
+        const Ciphertext &encrypted, const vector<double> &coeffs, const RelinKeys &relin_keys,
+        Ciphertext &destination, MemoryPoolHandle pool) const
+    {
+        // Verify parameters.
+        if (!is_metadata_valid_for(encrypted, context_) || !is_buffer_valid(encrypted))
+        {
+            throw invalid_argument("encrypted is not valid for encryption parameters");
+        }
+        if (context_.key_context_data()->parms().scheme() != scheme_type::ckks)
+        {
+            throw logic_error("unsupported scheme");
+        }
+        if (!encrypted.is_ntt_form())
+        {
+            throw invalid_argument("encrypted must be in NTT form");
+        }
+        if (!pool)
+        {
+            throw invalid_argument("pool is uninitialized");
+        }
+
+        vector<double> poly(coeffs);
+        while (!poly.empty() && poly.back() == 0.0)
+        {
+            poly.pop_back();
+        }
+        if (poly.size() < 2)
+        {
+            throw invalid_argument("polynomial degree must be at least one");
+        }
+
+        // Compute into a temporary in case destination aliases encrypted
+        Ciphertext result(pool);
+        PatersonStockmeyerEvaluator<double> ps_evaluator(*this, context_, relin_keys, false, pool);
+        ps_evaluator.evaluate(encrypted, move(poly), 1.0, 0.0, result);
+        destination = move(result);
+#ifdef SEAL_THROW_ON_TRANSPARENT_CIPHERTEXT
+        // Transparent ciphertext output is not allowed.
+        if (destination.is_transparent())
+        {
+            throw logic_error("result ciphertext is transparent");
+        }
+#endif
+    }
+
+    void Evaluator::evaluate_polynomial(
+        const Ciphertext &encrypted, const vector<uint64_t> &coeffs, const RelinKeys &relin_keys,
+        Ciphertext &destination, MemoryPoolHandle pool) const
+    {
+        // Verify parameters.
+        if (!is_metadata_valid_for(encrypted, context_) || !is_buffer_valid(encrypted))
+        {
+            throw invalid_argument("encrypted is not valid for encryption parameters");
+        }
+        auto &context_data = *context_.get_context_data(encrypted.parms_id());
+        auto &parms = context_data.parms();
+        scheme_type scheme = parms.scheme();
+        if (scheme != scheme_type::bfv && scheme != scheme_type::bgv)
+        {
+            throw logic_error("unsupported scheme");
+        }
+        if (scheme == scheme_type::bfv && encrypted.is_ntt_form())
+        {
+            throw invalid_argument("BFV encrypted cannot be in NTT form");
+        }
+        if (scheme == scheme_type::bgv && !encrypted.is_ntt_form())
+        {
+            throw invalid_argument("BGV encrypted must be in NTT form");
+        }
+        if (!pool)
+        {
+            throw invalid_argument("pool is uninitialized");
+        }
+
+        // Reduce the coefficients modulo the plaintext modulus
+        auto &plain_modulus = parms.plain_modulus();
+        vector<uint64_t> poly(coeffs.size());
+        transform(coeffs.begin(), coeffs.end(), poly.begin(), [&](uint64_t coeff) {
+            return barrett_reduce_64(coeff, plain_modulus);
+        });
+        while (!poly.empty() && poly.back() == 0)
+        {
+            poly.pop_back();
+        }
+        if (poly.size() < 2)
+        {
+            throw invalid_argument("polynomial degree must be at least one");
+        }
+
+        // Compute into a temporary in case destination aliases encrypted
+        Ciphertext result(pool);
+        PatersonStockmeyerEvaluator<uint64_t> ps_evaluator(*this, context_, relin_keys, false, pool);
+        ps_evaluator.evaluate(encrypted, move(poly), 1.0, 0.0, result);
+        destination = move(result);
+#ifdef SEAL_THROW_ON_TRANSPARENT_CIPHERTEXT
+        // Transparent ciphertext output is not allowed.
+        if (destination.is_transparent())
+        {
+            throw logic_error("result ciphertext is transparent");
+        }
+#endif
+    }
+
+    void Evaluator::evaluate_chebyshev_series(
+        const Ciphertext &encrypted, const vector<double> &coeffs, double lower_bound, double upper_bound,
+        const RelinKeys &relin_keys, Ciphertext &destination, MemoryPoolHandle pool) const
+    {
+        // Verify parameters.
+        if (!is_metadata_valid_for(encrypted, context_) || !is_buffer_valid(encrypted))
+        {
+            throw invalid_argument("encrypted is not valid for encryption parameters");
+        }
+        if (context_.key_context_data()->parms().scheme() != scheme_type::ckks)
+        {
+            throw logic_error("unsupported scheme");
+        }
+        if (!encrypted.is_ntt_form())
+        {
+            throw invalid_argument("encrypted must be in NTT form");
+        }
+        if (!(lower_bound < upper_bound) || !isfinite(upper_bound - lower_bound))
+        {
+            throw invalid_argument("lower_bound must be less than upper_bound");
+        }
+        if (!pool)
+        {
+            throw invalid_argument("pool is uninitialized");
+        }
+
+        vector<double> series(coeffs);
+        while (!series.empty() && series.back() == 0.0)
+        {
+            series.pop_back();
+        }
+        if (series.size() < 2)
+        {
+            throw invalid_argument("series degree must be at least one");
+        }
+
+        // Map [lower_bound, upper_bound] to [-1, 1]
+        double alpha = 2.0 / (upper_bound - lower_bound);
+        double beta = -(upper_bound + lower_bound) / (upper_bound - lower_bound);
+
+        // Compute into a temporary in case destination aliases encrypted
+        Ciphertext result(pool);
+        PatersonStockmeyerEvaluator<double> ps_evaluator(*this, context_, relin_keys, true, pool);
+        ps_evaluator.evaluate(encrypted, move(series), alpha, beta, result);
+        destination = move(result);
+#ifdef SEAL_THROW_ON_TRANSPARENT_CIPHERTEXT
+        // Transparent ciphertext output is not allowed.
+        if (destination.is_transparent())
+        {
+            throw logic_error("result ciphertext is transparent");
+        }
+#endif
+    }
+
+    void Evaluator::separate_packed_real(
+        const Ciphertext &encrypted, const GaloisKeys &galois_keys, Ciphertext &destination_real,
+        Ciphertext &destination_imag, MemoryPoolHandle pool) const
+    {
+        // Verify parameters.
+        if (!is_metadata_valid_for(encrypted, context_) || !is_buffer_valid(encrypted))
+        {
+            throw invalid_argument("encrypted is not valid for encryption parameters");
+        }
+        if (context_.key_context_data()->parms().scheme() != scheme_type::ckks)
+        {
+            throw logic_error("unsupported scheme");
+        }
+        if (&destination_real == &destination_imag)
+        {
+            throw invalid_argument("destination_real and destination_imag cannot be the same");
+        }
+        if (!pool)
+        {
+            throw invalid_argument("pool is uninitialized");
+        }
+        auto &context_data = *context_.get_context_data(encrypted.parms_id());
+        size_t coeff_count = context_data.parms().poly_modulus_degree();
+        if (coeff_count < 4)
+        {
+            throw invalid_argument("poly_modulus_degree is too small");
+        }
+
+        // With z = x + sqrt(-1) * y in every slot, z + conj(z) = 2 * x and z - conj(z) = 2 * sqrt(-1) * y
+        Ciphertext conjugated(pool);
+        complex_conjugate(encrypted, galois_keys, conjugated, pool);
+        Ciphertext imag_part(pool);
+        sub(encrypted, conjugated, imag_part);
+        add(encrypted, conjugated, destination_real);
+        destination_real.scale() *= 2.0;
+
+        // The polynomial -(X^(N/4) + X^(3N/4)) is -sqrt(-2) in every slot, so multiplying by it at scale one gives
+        // 2 * sqrt(2) * y without consuming a level
+        Plaintext factor(pool);
+        set_monomial_sum_plain(
+            context_data, { -static_cast<long>(coeff_count >> 2), -static_cast<long>(3 * (coeff_count >> 2)) }, 1.0,
+            factor);
+        multiply_plain_inplace(imag_part, factor, pool);
+        imag_part.scale() *= 2.0 * sqrt(2.0);
+        destination_imag = move(imag_part);
+#ifdef SEAL_THROW_ON_TRANSPARENT_CIPHERTEXT
+        // Transparent ciphertext output is not allowed.
+        if (destination_real.is_transparent() || destination_imag.is_transparent())
+        {
+            throw logic_error("result ciphertext is transparent");
+        }
+#endif
+    }
+
+    void Evaluator::bootstrap_inplace(
+        Ciphertext &encrypted, const CKKSBootstrapper &bootstrapper, const RelinKeys &relin_keys,
+        const GaloisKeys &galois_keys, MemoryPoolHandle pool) const
+    {
+        // Verify parameters.
+        if (!is_metadata_valid_for(encrypted, context_) || !is_buffer_valid(encrypted))
+        {
+            throw invalid_argument("encrypted is not valid for encryption parameters");
+        }
+        if (context_.key_context_data()->parms().scheme() != scheme_type::ckks)
+        {
+            throw logic_error("unsupported scheme");
+        }
+        if (!context_.using_keyswitching())
+        {
+            throw logic_error("keyswitching is not supported by the context");
+        }
+        if (bootstrapper.coeff_to_slot().empty() ||
+            bootstrapper.coeff_to_slot()[0].parms_id != context_.first_parms_id())
+        {
+            throw invalid_argument("bootstrapper is not valid for encryption parameters");
+        }
+        if (!encrypted.is_ntt_form())
+        {
+            throw invalid_argument("encrypted must be in NTT form");
+        }
+        if (encrypted.size() > 2)
+        {
+            throw invalid_argument("encrypted size must be 2");
+        }
+        if (!pool)
+        {
+            throw invalid_argument("pool is uninitialized");
+        }
+
+        double scale = encrypted.scale();
+        mod_raise_inplace(encrypted, bootstrapper.scale(), pool);
+
+        // CoeffToSlot; the last level takes the complex conjugate as second input
+        auto &coeff_to_slot = bootstrapper.coeff_to_slot();
+        Ciphertext conjugated(pool);
+        Ciphertext transformed(pool);
+        for (auto &transform : coeff_to_slot)
+        {
+            vector<const Ciphertext *> inputs{ &encrypted };
+            if (transform.input_count > 1)
+            {
+                complex_conjugate(encrypted, galois_keys, conjugated, pool);
+                inputs.push_back(&conjugated);
+            }
+            apply_linear_transform(inputs, transform, galois_keys, transformed, pool);
+            swap(encrypted, transformed);
+        }
+
+        // Separate the real and imaginary parts. Multiplying by X^(N/2) at scale one turns the imaginary part into
+        // a real value without consuming a level; it flips the signs of the even slots, which SlotToCoeff undoes.
+        complex_conjugate(encrypted, galois_keys, conjugated, pool);
+        Ciphertext real_part(pool);
+        Ciphertext imag_part(pool);
+        add(encrypted, conjugated, real_part);
+        sub(encrypted, conjugated, imag_part);
+        multiply_monomial_inplace(
+            imag_part, 1, context_.get_context_data(imag_part.parms_id())->parms().poly_modulus_degree() >> 1, pool);
+
+        // EvalMod: a Chebyshev interpolant of a cosine followed by double-angle iterations
+        CKKSEncoder encoder(context_);
+        Plaintext one(pool);
+        for (auto part : { &real_part, &imag_part })
+        {
+            evaluate_chebyshev_series(*part, bootstrapper.eval_mod_coeffs(), -1.0, 1.0, relin_keys, *part, pool);
+            for (size_t i = 0; i < bootstrapper.double_angle_count(); i++)
+            {
+                auto parms_id = part->parms_id();
+                square_inplace(*part, pool);
+                relinearize_inplace(*part, relin_keys, pool);
+                if (part->parms_id() == parms_id)
+                {
+                    rescale_to_next_inplace(*part, pool);
+                }
+                add_inplace(*part, *part);
+                encoder.encode(1.0, part->parms_id(), part->scale(), one, pool);
+                sub_plain_inplace(*part, one, pool);
+            }
+        }
+        if (real_part.parms_id() != bootstrapper.slot_to_coeff()[0].parms_id)
+        {
+            throw logic_error("EvalMod consumed an unexpected number of levels");
+        }
+
+        // SlotToCoeff; the first level takes the real and imaginary parts
+        auto &slot_to_coeff = bootstrapper.slot_to_coeff();
+        apply_linear_transform({ &real_part, &imag_part }, slot_to_coeff[0], galois_keys, encrypted, pool);
+        for (size_t i = 1; i < slot_to_coeff.size(); i++)
+        {
+            apply_linear_transform({ &encrypted }, slot_to_coeff[i], galois_keys, transformed, pool);
+            swap(encrypted, transformed);
+        }
+
+        // The plaintext polynomial is now approximately that of the input, so the input scale applies
+        encrypted.scale() = scale;
+#ifdef SEAL_THROW_ON_TRANSPARENT_CIPHERTEXT
+        // Transparent ciphertext output is not allowed.
+        if (encrypted.is_transparent())
+        {
+            throw logic_error("result ciphertext is transparent");
+        }
+#endif
+    }
+
+    void Evaluator::mod_raise_inplace(Ciphertext &encrypted, double scale, MemoryPoolHandle pool) const
+    {
+        // Only the last prime q_0 is kept, and its coefficients are lifted to the whole coefficient modulus
+        mod_switch_to_inplace(encrypted, context_.last_parms_id(), pool);
+        auto &last_context_data = *context_.last_context_data();
+        auto &first_context_data = *context_.first_context_data();
+        auto &coeff_modulus = first_context_data.parms().coeff_modulus();
+        size_t coeff_count = first_context_data.parms().poly_modulus_degree();
+        size_t coeff_modulus_size = coeff_modulus.size();
+        size_t encrypted_size = encrypted.size();
+        auto &q0 = last_context_data.parms().coeff_modulus()[0];
+        uint64_t half_q0 = q0.value() >> 1;
+
+        inverse_ntt_negacyclic_harvey(PolyIter(encrypted), encrypted_size, iter(last_context_data.small_ntt_tables()));
+
+        // Use the representative of the coefficients in (-q_0 / 2, q_0 / 2] to keep the overflow small
+        Ciphertext raised(pool);
+        raised.resize(context_, first_context_data.parms_id(), encrypted_size);
+        for (size_t j = 0; j < encrypted_size; j++)
+        {
+            const uint64_t *source = encrypted.data(j);
+            for (size_t i = 0; i < coeff_modulus_size; i++)
+            {
+                uint64_t *target = raised.data(j) + i * coeff_count;
+                for (size_t k = 0; k < coeff_count; k++)
+                {
+                    target[k] = source[k] > half_q0
+                                    ? negate_uint_mod(barrett_reduce_64(q0.value() - source[k], coeff_modulus[i]),
+                                                      coeff_modulus[i])
+                                    : barrett_reduce_64(source[k], coeff_modulus[i]);
+                }
+            }
+        }
+        ntt_negacyclic_harvey(PolyIter(raised), encrypted_size, iter(first_context_data.small_ntt_tables()));
+
+        raised.is_ntt_form() = true;
+        raised.scale() = scale;
+        encrypted = move(raised);
+    }
+
+    void Evaluator::apply_linear_transform(
+        const vector<const Ciphertext *> &inputs, const CKKSBootstrapper::LinearTransform &transform,
+        const GaloisKeys &galois_keys, Ciphertext &destination, MemoryPoolHandle pool) const
+    {
+        auto &context_data = *context_.get_context_data(transform.parms_id);
+        long slot_count = static_cast<long>(context_data.parms().poly_modulus_degree() >> 1);
+        auto baby_step_rotation = [&](int baby) {
+            long steps = (static_cast<long>(baby) * transform.step) % slot_count;
+            return static_cast<int>(steps > slot_count / 2 ? steps - slot_count : steps);
+        };
+
+        // Baby-step rotations of every input are computed once and shared by all giant steps
+        vector<vector<Ciphertext>> rotated(inputs.size());
+        for (size_t input = 0; input < inputs.size(); input++)
+        {
+            if (inputs[input]->parms_id() != transform.parms_id)
+            {
+                throw logic_error("input of linear transform is at an unexpected level");
+            }
+            rotated[input].resize(safe_cast<size_t>(transform.baby_step_count));
+        }
+        for (auto &giant_step : transform.giant_steps)
+        {
+            for (auto &diagonal : giant_step.diagonals)
+            {
+                auto &target = rotated[diagonal.input][safe_cast<size_t>(diagonal.baby)];
+                if (!target.size())
+                {
+                    rotate_vector(
+                        *inputs[diagonal.input], baby_step_rotation(diagonal.baby), galois_keys, target, pool);
+                }
+            }
+        }
+
+        Ciphertext result(pool);
+        Ciphertext giant_sum(pool);
+        Ciphertext product(pool);
+        for (auto &giant_step : transform.giant_steps)
+        {
+            giant_sum.release();
+            for (auto &diagonal : giant_step.diagonals)
+            {
+                auto &operand = rotated[diagonal.input][safe_cast<size_t>(diagonal.baby)];
+                multiply_plain(operand, diagonal.plain, product, pool);
+                if (giant_sum.size())
+                {
+                    add_inplace(giant_sum, product);
+                }
+                else
+                {
+                    swap(giant_sum, product);
+                }
+            }
+            rotate_vector_inplace(giant_sum, giant_step.rotation, galois_keys, pool);
+            if (result.size())
+            {
+                add_inplace(result, giant_sum);
+            }
+            else
+            {
+                swap(result, giant_sum);
+            }
+        }
+        rescale_to_next_inplace(result, pool);
+        destination = move(result);
+    }
+
     void Evaluator::add_plain_inplace(Ciphertext &encrypted, const Plaintext &plain, MemoryPoolHandle pool) const
     {
         // Verify parameters.
@@ -1833,6 +2926,7 @@ namespace seal
         default:
             throw invalid_argument("unsupported scheme");
         }
+        encrypted.noise_estimate() = estimate_add_plain_noise(context_data, encrypted.noise_estimate());
 #ifdef SEAL_THROW_ON_TRANSPARENT_CIPHERTEXT
         // Transparent ciphertext output is not allowed.
         if (encrypted.is_transparent())
@@ -1941,6 +3035,7 @@ namespace seal
         default:
             throw invalid_argument("unsupported scheme");
         }
+        encrypted.noise_estimate() = estimate_add_plain_noise(context_data, encrypted.noise_estimate());
 #ifdef SEAL_THROW_ON_TRANSPARENT_CIPHERTEXT
         // Transparent ciphertext output is not allowed.
         if (encrypted.is_transparent())
@@ -1966,6 +3061,9 @@ namespace seal
             throw invalid_argument("pool is uninitialized");
         }
 
+        double noise_estimate = estimate_multiply_plain_noise(
+            *context_.get_context_data(encrypted.parms_id()), encrypted.noise_estimate(), plain);
+
         if (encrypted.is_ntt_form() && plain.is_ntt_form())
         {
             multiply_plain_ntt(encrypted, plain);
@@ -1986,6 +3084,7 @@ namespace seal
             multiply_plain_ntt(encrypted, plain);
             transform_from_ntt_inplace(encrypted);
         }
+        encrypted.noise_estimate() = noise_estimate;
 
 #ifdef SEAL_THROW_ON_TRANSPARENT_CIPHERTEXT
         // Transparent ciphertext output is not allowed.
@@ -2171,6 +3270,166 @@ namespace seal
         }
     }
 
+    void Evaluator::multiply_scalar_inplace(Ciphertext &encrypted, int64_t scalar) const
+    {
+        // Verify parameters.
+        if (!is_metadata_valid_for(encrypted, context_) || !is_buffer_valid(encrypted))
+        {
+            throw invalid_argument("encrypted is not valid for encryption parameters");
+        }
+
+        // Extract encryption parameters.
+        auto &context_data = *context_.get_context_data(encrypted.parms_id());
+        auto &parms = context_data.parms();
+        auto &coeff_modulus = parms.coeff_modulus();
+        size_t coeff_count = parms.poly_modulus_degree();
+        size_t coeff_modulus_size = coeff_modulus.size();
+        size_t encrypted_size = encrypted.size();
+
+        int64_t message_scalar = reduce_message_scalar(parms, scalar);
+        if (!message_scalar)
+        {
+            throw invalid_argument("scalar is zero");
+        }
+
+        // The same scalar multiplies normal and NTT form, so the form of encrypted does not matter
+        if (message_scalar != 1)
+        {
+            for (size_t i = 0; i < coeff_modulus_size; i++)
+            {
+                MultiplyUIntModOperand operand;
+                operand.set(reduce_signed(message_scalar, coeff_modulus[i]), coeff_modulus[i]);
+                SEAL_ITERATE(iter(encrypted), encrypted_size, [&](auto I) {
+                    multiply_poly_scalar_coeffmod(I[i], coeff_count, operand, coeff_modulus[i], I[i]);
+                });
+            }
+        }
+
+        if (parms.scheme() != scheme_type::ckks)
+        {
+            encrypted.noise_estimate() = estimate_multiply_scalar_noise(
+                encrypted.noise_estimate(), reduce_signed(message_scalar, parms.plain_modulus()),
+                parms.plain_modulus());
+        }
+#ifdef SEAL_THROW_ON_TRANSPARENT_CIPHERTEXT
+        // Transparent ciphertext output is not allowed.
+        if (encrypted.is_transparent())
+        {
+            throw logic_error("result ciphertext is transparent");
+        }
+#endif
+    }
+
+    void Evaluator::multiply_monomial_inplace(
+        Ciphertext &encrypted, int64_t coeff, size_t exponent, MemoryPoolHandle pool) const
+    {
+        // Verify parameters.
+        if (!is_metadata_valid_for(encrypted, context_) || !is_buffer_valid(encrypted))
+        {
+            throw invalid_argument("encrypted is not valid for encryption parameters");
+        }
+        if (!pool)
+        {
+            throw invalid_argument("pool is uninitialized");
+        }
+
+        // Extract encryption parameters.
+        auto &context_data = *context_.get_context_data(encrypted.parms_id());
+        auto &parms = context_data.parms();
+        auto &coeff_modulus = parms.coeff_modulus();
+        size_t coeff_count = parms.poly_modulus_degree();
+        size_t coeff_modulus_size = coeff_modulus.size();
+        size_t encrypted_size = encrypted.size();
+        auto ntt_tables = context_data.small_ntt_tables();
+
+        int64_t message_coeff = reduce_message_scalar(parms, coeff);
+        if (!message_coeff)
+        {
+            throw invalid_argument("coeff is zero");
+        }
+
+        // Since X^N = -1, X^exponent for exponent in [N, 2N) is -X^(exponent - N)
+        exponent &= (coeff_count << 1) - 1;
+        bool negate = exponent >= coeff_count;
+        size_t shift = negate ? exponent - coeff_count : exponent;
+
+        if (!shift)
+        {
+            // A constant monomial multiplies normal and NTT form alike
+            for (size_t i = 0; i < coeff_modulus_size; i++)
+            {
+                uint64_t scalar = reduce_signed(message_coeff, coeff_modulus[i]);
+                scalar = negate ? negate_uint_mod(scalar, coeff_modulus[i]) : scalar;
+                SEAL_ITERATE(iter(encrypted), encrypted_size, [&](auto I) {
+                    multiply_poly_scalar_coeffmod(I[i], coeff_count, scalar, coeff_modulus[i], I[i]);
+                });
+            }
+        }
+        else if (!encrypted.is_ntt_form())
+        {
+            for (size_t i = 0; i < coeff_modulus_size; i++)
+            {
+                uint64_t mono_coeff = reduce_signed(message_coeff, coeff_modulus[i]);
+                mono_coeff = negate ? negate_uint_mod(mono_coeff, coeff_modulus[i]) : mono_coeff;
+                SEAL_ITERATE(iter(encrypted), encrypted_size, [&](auto I) {
+                    negacyclic_multiply_poly_mono_coeffmod(
+                        I[i], coeff_count, mono_coeff, shift, coeff_modulus[i], I[i], pool);
+                });
+            }
+        }
+        else
+        {
+            // The NTT value at index j is the evaluation at psi^(2 * bitrev(j) + 1) for the primitive 2N-th root psi
+            // of the NTT tables, so X^exponent is the power psi^((2 * bitrev(j) + 1) * exponent mod 2N). The tables
+            // hold psi^k for k < N at index bitrev(k), and psi^(k + N) = -psi^k; negating an operand w < q with Shoup
+            // quotient u gives q - w with quotient ~u, since w * 2^64 / q is not an integer for 0 < w < q.
+            int coeff_count_power = ntt_tables[0].coeff_count_power();
+            size_t power_mask = (coeff_count << 1) - 1;
+            auto roots = allocate<MultiplyUIntModOperand>(coeff_count, pool);
+            for (size_t i = 0; i < coeff_modulus_size; i++)
+            {
+                auto &modulus = coeff_modulus[i];
+                for (size_t j = 0; j < coeff_count; j++)
+                {
+                    size_t power = ((2 * reverse_bits(j, coeff_count_power) + 1) * exponent) & power_mask;
+                    bool negate_power = power >= coeff_count;
+                    roots[j] = ntt_tables[i].get_from_root_powers(
+                        reverse_bits(negate_power ? power - coeff_count : power, coeff_count_power));
+                    if (negate_power)
+                    {
+                        roots[j].operand = modulus.value() - roots[j].operand;
+                        roots[j].quotient = ~roots[j].quotient;
+                    }
+                }
+
+                uint64_t scalar = reduce_signed(message_coeff, modulus);
+                SEAL_ITERATE(iter(encrypted), encrypted_size, [&](auto I) {
+                    SEAL_ITERATE(iter(I[i], roots.get()), coeff_count, [&](auto J) {
+                        get<0>(J) = multiply_uint_mod(get<0>(J), get<1>(J), modulus);
+                    });
+                    if (message_coeff != 1)
+                    {
+                        multiply_poly_scalar_coeffmod(I[i], coeff_count, scalar, modulus, I[i]);
+                    }
+                });
+            }
+        }
+
+        if (parms.scheme() != scheme_type::ckks)
+        {
+            encrypted.noise_estimate() = estimate_multiply_scalar_noise(
+                encrypted.noise_estimate(), reduce_signed(message_coeff, parms.plain_modulus()),
+                parms.plain_modulus());
+        }
+#ifdef SEAL_THROW_ON_TRANSPARENT_CIPHERTEXT
+        // Transparent ciphertext output is not allowed.
+        if (encrypted.is_transparent())
+        {
+            throw logic_error("result ciphertext is transparent");
+        }
+#endif
+    }
+
     void Evaluator::transform_to_ntt_inplace(Plaintext &plain, parms_id_type parms_id, MemoryPoolHandle pool) const
     {
         // Verify parameters.
@@ -2524,6 +3783,7 @@ namespace seal
         Ciphertext &encrypted, ConstRNSIter target_iter, const KSwitchKeys &kswitch_keys, size_t kswitch_keys_index,
         MemoryPoolHandle pool) const
     {
+        SEAL_PROFILE_SCOPE(profile_event_type::switch_key);
         auto parms_id = encrypted.parms_id();
         auto &context_data = *context_.get_context_data(parms_id);
         auto &parms = context_data.parms();
@@ -2600,6 +3860,14 @@ namespace seal
             }
         }
 
+        // Hybrid key switching decomposes target_iter into digits of several primes
+        if (context_data.key_switch_tool())
+        {
+            switch_key_hybrid_inplace(encrypted, target_iter, key_vector, pool);
+            encrypted.noise_estimate() = estimate_key_switch_noise(context_, context_data, encrypted.noise_estimate());
+            return;
+        }
+
         // Create a copy of target_iter
         SEAL_ALLOCATE_GET_RNS_ITER(t_target, coeff_count, decomp_modulus_size, pool);
         set_uint(target_iter, decomp_modulus_size * coeff_count, t_target);
@@ -2616,15 +3884,13 @@ namespace seal
         SEAL_ITERATE(iter(size_t(0)), rns_modulus_size, [&](auto I) {
             size_t key_index = (I == decomp_modulus_size ? key_modulus_size - 1 : I);
 
-            // Product of two numbers is up to 60 + 60 = 120 bits, so we can sum up to 256 of them without reduction.
-            size_t lazy_reduction_summand_bound = size_t(SEAL_MULTIPLY_ACCUMULATE_USER_MOD_MAX);
-            size_t lazy_reduction_counter = lazy_reduction_summand_bound;
-
-            // Allocate memory for a lazy accumulator (128-bit coefficients)
-            auto t_poly_lazy(allocate_zero_poly_array(key_component_count, coeff_count, 2, pool));
-
-            // Semantic misuse of PolyIter; this is really pointing to the data for a single RNS factor
-            PolyIter accumulator_iter(t_poly_lazy.get(), 2, coeff_count);
+            // Lazy accumulators for the products with each key component
+            vector<LazyProductAccumulator> accumulators;
+            accumulators.reserve(key_component_count);
+            for (size_t k = 0; k < key_component_count; k++)
+            {
+                accumulators.emplace_back(coeff_count, key_modulus[key_index], pool);
+            }
 
             // Multiply with keys and perform lazy reduction on product's coefficients
             SEAL_ITERATE(iter(size_t(0)), decomp_modulus_size, [&](auto J) {
@@ -2655,56 +3921,17 @@ namespace seal
                 }
 
                 // Multiply with keys and modular accumulate products in a lazy fashion
-                SEAL_ITERATE(iter(key_vector[J].data(), accumulator_iter), key_component_count, [&](auto K) {
-                    if (!lazy_reduction_counter)
-                    {
-                        SEAL_ITERATE(iter(t_operand, get<0>(K)[key_index], get<1>(K)), coeff_count, [&](auto L) {
-                            unsigned long long qword[2]{ 0, 0 };
-                            multiply_uint64(get<0>(L), get<1>(L), qword);
-
-                            // Accumulate product of t_operand and t_key_acc to t_poly_lazy and reduce
-                            add_uint128(qword, get<2>(L).ptr(), qword);
-                            get<2>(L)[0] = barrett_reduce_128(qword, key_modulus[key_index]);
-                            get<2>(L)[1] = 0;
-                        });
-                    }
-                    else
-                    {
-                        // Same as above but no reduction
-                        SEAL_ITERATE(iter(t_operand, get<0>(K)[key_index], get<1>(K)), coeff_count, [&](auto L) {
-                            unsigned long long qword[2]{ 0, 0 };
-                            multiply_uint64(get<0>(L), get<1>(L), qword);
-                            add_uint128(qword, get<2>(L).ptr(), qword);
-                            get<2>(L)[0] = qword[0];
-                            get<2>(L)[1] = qword[1];
-                        });
-                    }
+                SEAL_ITERATE(iter(key_vector[J].data(), size_t(0)), key_component_count, [&](auto K) {
+                    accumulators[get<1>(K)].multiply_accumulate(t_operand, get<0>(K)[key_index]);
                 });
-
-                if (!--lazy_reduction_counter)
-                {
-                    lazy_reduction_counter = lazy_reduction_summand_bound;
-                }
             });
 
             // PolyIter pointing to the destination t_poly_prod, shifted to the appropriate modulus
             PolyIter t_poly_prod_iter(t_poly_prod.get() + (I * coeff_count), coeff_count, rns_modulus_size);
 
             // Final modular reduction
-            SEAL_ITERATE(iter(accumulator_iter, t_poly_prod_iter), key_component_count, [&](auto K) {
-                if (lazy_reduction_counter == lazy_reduction_summand_bound)
-                {
-                    SEAL_ITERATE(iter(get<0>(K), *get<1>(K)), coeff_count, [&](auto L) {
-                        get<1>(L) = static_cast<uint64_t>(*get<0>(L));
-                    });
-                }
-                else
-                {
-                    // Same as above except need to still do reduction
-                    SEAL_ITERATE(iter(get<0>(K), *get<1>(K)), coeff_count, [&](auto L) {
-                        get<1>(L) = barrett_reduce_128(get<0>(L).ptr(), key_modulus[key_index]);
-                    });
-                }
+            SEAL_ITERATE(iter(t_poly_prod_iter, size_t(0)), key_component_count, [&](auto K) {
+                accumulators[get<1>(K)].reduce(*get<0>(K));
             });
         });
         // Accumulated products are now stored in t_poly_prod
@@ -2817,5 +4044,113 @@ namespace seal
                 });
             }
         });
+
+        encrypted.noise_estimate() = estimate_key_switch_noise(context_, context_data, encrypted.noise_estimate());
+    }
+
+    void Evaluator::switch_key_hybrid_inplace(
+        Ciphertext &encrypted, ConstRNSIter target_iter, const vector<PublicKey> &key_vector,
+        MemoryPoolHandle pool) const
+    {
+        auto &context_data = *context_.get_context_data(encrypted.parms_id());
+        auto &parms = context_data.parms();
+        auto &coeff_modulus = parms.coeff_modulus();
+        auto &key_context_data = *context_.key_context_data();
+        auto &key_modulus = key_context_data.parms().coeff_modulus();
+        auto key_switch_tool = context_data.key_switch_tool();
+        auto scheme = parms.scheme();
+
+        // Extract encryption parameters. The extended basis consists of the primes of the current level followed by
+        // the special primes.
+        size_t coeff_count = parms.poly_modulus_degree();
+        size_t decomp_modulus_size = coeff_modulus.size();
+        size_t key_modulus_size = key_modulus.size();
+        size_t special_prime_count = context_.special_prime_count();
+        size_t rns_modulus_size = decomp_modulus_size + special_prime_count;
+        size_t digit_size = key_switch_tool->digit_size();
+        size_t digit_count = key_switch_tool->digit_count();
+        size_t key_component_count = key_vector[0].data().size();
+        auto key_ntt_tables = iter(key_context_data.small_ntt_tables());
+        auto special_ntt_tables = key_ntt_tables + (key_modulus_size - special_prime_count);
+        auto key_index = [&](size_t index) {
+            return index < decomp_modulus_size ? index : index + key_modulus_size - rns_modulus_size;
+        };
+
+        // Size check
+        if (!product_fits_in(coeff_count, rns_modulus_size, key_component_count, size_t(2)))
+        {
+            throw logic_error("invalid parameters");
+        }
+
+        // Create a copy of target_iter; in CKKS or BGV, t_target is in NTT form so switch back to normal form
+        SEAL_ALLOCATE_GET_RNS_ITER(t_target, coeff_count, decomp_modulus_size, pool);
+        set_uint(target_iter, decomp_modulus_size * coeff_count, t_target);
+        if (scheme == scheme_type::ckks || scheme == scheme_type::bgv)
+        {
+            inverse_ntt_negacyclic_harvey(t_target, decomp_modulus_size, key_ntt_tables);
+        }
+
+        // Lazy accumulators for the products with each key component and prime
+        vector<LazyProductAccumulator> accumulators;
+        accumulators.reserve(key_component_count * rns_modulus_size);
+        for (size_t k = 0; k < key_component_count; k++)
+        {
+            for (size_t i = 0; i < rns_modulus_size; i++)
+            {
+                accumulators.emplace_back(coeff_count, key_modulus[key_index(i)], pool);
+            }
+        }
+        SEAL_ALLOCATE_GET_RNS_ITER(t_extended, coeff_count, rns_modulus_size, pool);
+
+        SEAL_ITERATE(iter(size_t(0)), digit_count, [&](auto J) {
+            // Extend the digit to all primes and convert to NTT form
+            key_switch_tool->extend_digit(t_target, J, t_extended, pool);
+            size_t digit_begin = J * digit_size;
+            size_t digit_end = min(digit_begin + digit_size, decomp_modulus_size);
+            SEAL_ITERATE(iter(t_extended, size_t(0)), rns_modulus_size, [&](auto I) {
+                // RNS-NTT form exists in input
+                if ((scheme == scheme_type::ckks || scheme == scheme_type::bgv) && get<1>(I) >= digit_begin &&
+                    get<1>(I) < digit_end)
+                {
+                    set_uint(target_iter[get<1>(I)], coeff_count, get<0>(I));
+                }
+                else
+                {
+                    ntt_negacyclic_harvey(get<0>(I), key_ntt_tables[key_index(get<1>(I))]);
+                }
+            });
+
+            // Multiply with keys and accumulate products
+            SEAL_ITERATE(iter(key_vector[J].data(), size_t(0)), key_component_count, [&](auto K) {
+                SEAL_ITERATE(iter(t_extended, size_t(0)), rns_modulus_size, [&](auto I) {
+                    accumulators[get<1>(K) * rns_modulus_size + get<1>(I)].multiply_accumulate(
+                        get<0>(I), get<0>(K)[key_index(get<1>(I))]);
+                });
+            });
+        });
+
+        // Reduce the accumulated products and divide them by the product of the special primes
+        SEAL_ALLOCATE_GET_POLY_ITER(t_poly_prod, key_component_count, coeff_count, rns_modulus_size, pool);
+        SEAL_ITERATE(iter(encrypted, t_poly_prod, size_t(0)), key_component_count, [&](auto K) {
+            SEAL_ITERATE(iter(get<1>(K), size_t(0)), rns_modulus_size, [&](auto I) {
+                accumulators[get<2>(K) * rns_modulus_size + get<1>(I)].reduce(get<0>(I));
+            });
+
+            if (scheme == scheme_type::bfv)
+            {
+                inverse_ntt_negacyclic_harvey(get<1>(K), decomp_modulus_size, key_ntt_tables);
+                inverse_ntt_negacyclic_harvey(get<1>(K) + decomp_modulus_size, special_prime_count, special_ntt_tables);
+                key_switch_tool->divide_and_round_p_inplace(get<1>(K), pool);
+            }
+            else if (scheme == scheme_type::ckks)
+            {
+                key_switch_tool->divide_and_round_p_ntt_inplace(get<1>(K), key_ntt_tables, special_ntt_tables, pool);
+            }
+            else if (scheme == scheme_type::bgv)
+            {
+                key_switch_tool->mod_t_and_divide_p_ntt_inplace(get<1>(K), key_ntt_tables, special_ntt_tables, pool);
+            }
+            add_poly_coeffmod(get<1>(K), get<0>(K), decomp_modulus_size, coeff_modulus, get<0>(K));
+        });
     }
 } // namespace seal
@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include "seal/bootstrapper.h"
 #include "seal/ciphertext.h"
+#include "seal/compactciphertext.h"
 #include "seal/context.h"
 #include "seal/galoiskeys.h"
 #include "seal/memorymanager.h"
@@ -19,6 +21,24 @@
 
 namespace seal
 {
+    /**
+    Describes how Evaluator manages the levels (modulus switching chain positions) of ciphertexts.
+    */
+    enum class level_management_mode : std::uint8_t
+    {
+        // Operands must be at the same level and levels change only through explicit calls
+        manual = 0x0,
+
+        // Binary operations on ciphertexts at different levels first switch the operand at the higher level down
+        align = 0x1,
+
+        // As align; in addition, products of ciphertexts are switched to the next level right away, i.e., modulus
+        // switched in BGV and rescaled in CKKS, so that subsequent operations (including relinearization) touch
+        // fewer RNS limbs. BFV and BGV products are switched further down as long as their noise estimate shows
+        // that this costs less than one bit of noise budget.
+        eager = 0x2
+    };
+
     /**
     Provides operations on ciphertexts. Due to the properties of the encryption scheme, the arithmetic operations pass
     through the encryption layer to the underlying plaintext, changing it according to the type of the operation. Since
@@ -57,6 +77,23 @@ namespace seal
     e.g. one plaintext input is used in several plain multiplication, and transforming it several times would not make
     sense.
 
+    @par Level Management
+    By default (level_management_mode::manual) binary operations require their operands to be at the same level, and
+    ciphertexts only move down the modulus switching chain through explicit calls to mod_switch_to_next,
+    rescale_to_next, etc. With level_management_mode::align, operands at different levels are automatically aligned by
+    switching the one at the higher level down. With level_management_mode::eager, in BGV every product of ciphertexts
+    is additionally modulus switched to the next level as soon as it is computed, which keeps noise near its floor and
+    makes every later operation touch fewer RNS limbs; in CKKS every product of ciphertexts is rescaled right away.
+    Automatic switching never goes past the last level. In CKKS the scales of operands are not adjusted, so scales must
+    still match in additions. In BFV, align works the same way and eager only switches down based on the noise estimate.
+
+    @par Noise Estimation
+    For BFV and BGV, Encryptor and Evaluator keep a heuristic estimate of the noise in every ciphertext (see
+    Ciphertext::noise_estimate) without using the secret key. The function estimate_noise_budget turns this into an
+    estimate of the invariant noise budget, which is meant to be a conservative (lower) estimate of the value reported
+    by Decryptor::invariant_noise_budget. In eager level management mode the estimate is used to switch BFV and BGV
+    ciphertexts to lower levels whenever this costs less than one bit of noise budget.
+
     @par NTT form
     When using the BFV/BGV scheme (scheme_type::bfv/bgv), all plaintexts and ciphertexts should remain by default in the
     usual coefficient representation, i.e., not in NTT form. When using the CKKS scheme (scheme_type::ckks), all
@@ -82,6 +119,42 @@ namespace seal
         */
         Evaluator(const SEALContext &context);
 
+        /**
+        Sets the level management mode of this Evaluator. Changing the mode while other threads are using the
+        Evaluator is not thread-safe.
+
+        @param[in] mode The new level management mode
+        @throws std::invalid_argument if mode is not a valid level_management_mode
+        */
+        inline void set_level_management(level_management_mode mode)
+        {
+            if (mode != level_management_mode::manual && mode != level_management_mode::align &&
+                mode != level_management_mode::eager)
+            {
+                throw std::invalid_argument("unsupported level_management_mode");
+            }
+            level_management_ = mode;
+        }
+
+        /**
+        Returns the level management mode of this Evaluator.
+        */
+        SEAL_NODISCARD inline level_management_mode level_management() const noexcept
+        {
+            return level_management_;
+        }
+
+        /**
+        Returns an estimate of the invariant noise budget of a BFV or BGV ciphertext computed from its noise estimate.
+        Unlike Decryptor::invariant_noise_budget, this does not require the secret key and costs no polynomial
+        arithmetic. The result is heuristic and meant to be a lower bound for the actual noise budget.
+
+        @param[in] encrypted The ciphertext
+        @throws std::invalid_argument if encrypted is not valid for the encryption parameters
+        @throws std::logic_error if the scheme is not BFV or BGV, or if encrypted has no noise estimate
+        */
+        SEAL_NODISCARD int estimate_noise_budget(const Ciphertext &encrypted) const;
+
         /**
         Negates a ciphertext.
 
@@ -112,7 +185,8 @@ namespace seal
         @param[in] encrypted2 The second ciphertext to add
         @throws std::invalid_argument if encrypted1 or encrypted2 is not valid for the encryption parameters
         @throws std::invalid_argument if encrypted1 and encrypted2 are in different NTT forms
-        @throws std::invalid_argument if encrypted1 and encrypted2 are at different level or scale
+        @throws std::invalid_argument if encrypted1 and encrypted2 are at different level (and level management is
+        manual) or scale
         @throws std::logic_error if result ciphertext is transparent
         */
         void add_inplace(Ciphertext &encrypted1, const Ciphertext &encrypted2) const;
@@ -126,7 +200,8 @@ namespace seal
         @param[out] destination The ciphertext to overwrite with the addition result
         @throws std::invalid_argument if encrypted1 or encrypted2 is not valid for the encryption parameters
         @throws std::invalid_argument if encrypted1 and encrypted2 are in different NTT forms
-        @throws std::invalid_argument if encrypted1 and encrypted2 are at different level or scale
+        @throws std::invalid_argument if encrypted1 and encrypted2 are at different level (and level management is
+        manual) or scale
         @throws std::logic_error if result ciphertext is transparent
         */
         inline void add(const Ciphertext &encrypted1, const Ciphertext &encrypted2, Ciphertext &destination) const
@@ -151,7 +226,8 @@ namespace seal
         @throws std::invalid_argument if encrypteds are not valid for the encryption
         parameters
         @throws std::invalid_argument if encrypteds are in different NTT forms
-        @throws std::invalid_argument if encrypteds are at different level or scale
+        @throws std::invalid_argument if encrypteds are at different level (and level management is
+        manual) or scale
         @throws std::invalid_argument if destination is one of encrypteds
         @throws std::logic_error if result ciphertext is transparent
         */
@@ -165,7 +241,8 @@ namespace seal
         @param[in] encrypted2 The ciphertext to subtract
         @throws std::invalid_argument if encrypted1 or encrypted2 is not valid for the encryption parameters
         @throws std::invalid_argument if encrypted1 and encrypted2 are in different NTT forms
-        @throws std::invalid_argument if encrypted1 and encrypted2 are at different level or scale
+        @throws std::invalid_argument if encrypted1 and encrypted2 are at different level (and level management is
+        manual) or scale
         @throws std::logic_error if result ciphertext is transparent
         */
         void sub_inplace(Ciphertext &encrypted1, const Ciphertext &encrypted2) const;
@@ -179,7 +256,8 @@ namespace seal
         @param[out] destination The ciphertext to overwrite with the subtraction result
         @throws std::invalid_argument if encrypted1 or encrypted2 is not valid for the encryption parameters
         @throws std::invalid_argument if encrypted1 and encrypted2 are in different NTT forms
-        @throws std::invalid_argument if encrypted1 and encrypted2 are at different level or scale
+        @throws std::invalid_argument if encrypted1 and encrypted2 are at different level (and level management is
+        manual) or scale
         @throws std::logic_error if result ciphertext is transparent
         */
         inline void sub(const Ciphertext &encrypted1, const Ciphertext &encrypted2, Ciphertext &destination) const
@@ -206,7 +284,8 @@ namespace seal
         @param[in] pool The MemoryPoolHandle pointing to a valid memory pool
         @throws std::invalid_argument if encrypted1 or encrypted2 is not valid for the encryption parameters
         @throws std::invalid_argument if encrypted1 or encrypted2 is not in the default NTT form
-        @throws std::invalid_argument if encrypted1 and encrypted2 are at different level
+        @throws std::invalid_argument if encrypted1 and encrypted2 are at different level and level management is
+        manual
         @throws std::invalid_argument if the output scale is too large for the encryption parameters
         @throws std::invalid_argument if pool is uninitialized
         @throws std::logic_error if result ciphertext is transparent
@@ -225,7 +304,8 @@ namespace seal
         @param[out] destination The ciphertext to overwrite with the multiplication result
         @param[in] pool The MemoryPoolHandle pointing to a valid memory pool
         @throws std::invalid_argument if encrypted1 or encrypted2 is not valid for the encryption parameters
-        @throws std::invalid_argument if encrypted1 and encrypted2 are at different level
+        @throws std::invalid_argument if encrypted1 and encrypted2 are at different level and level management is
+        manual
         @throws std::invalid_argument if encrypted1 or encrypted2 is not in the default NTT form
         @throws std::invalid_argument if the output scale is too large for the encryption parameters
         @throws std::invalid_argument if pool is uninitialized
@@ -430,7 +510,12 @@ namespace seal
             {
                 throw std::invalid_argument("plain is not valid for encryption parameters");
             }
-            mod_switch_drop_to_next(plain);
+            auto next_context_data_ptr = context_.get_context_data(plain.parms_id())->next_context_data();
+            if (!next_context_data_ptr)
+            {
+                throw std::invalid_argument("end of modulus switching chain reached");
+            }
+            mod_switch_drop_to(plain, *next_context_data_ptr);
         }
 
         /**
@@ -487,6 +572,29 @@ namespace seal
             mod_switch_to_inplace(destination, parms_id);
         }
 
+        /**
+        Prepares a BFV or BGV ciphertext for transport to the owner of the secret key by shrinking it as much as its
+        noise allows. The ciphertext is modulus switched down to the lowest level at which its estimated noise budget
+        (see estimate_noise_budget) is still at least min_noise_budget. If truncate is set and a BFV ciphertext ends up
+        at a level with a single prime, the largest number of low-order coefficient bits that keeps this budget is
+        additionally rounded away. The result is stored bit-packed in destination, which can be serialized and
+        decrypted with Decryptor::decrypt. Ciphertexts without a noise estimate are only packed.
+
+        @param[in] encrypted The ciphertext to prepare
+        @param[out] destination The compact ciphertext to overwrite with the result
+        @param[in] min_noise_budget The estimated noise budget in bits to keep
+        @param[in] truncate Whether to round away low-order coefficient bits
+        @param[in] pool The MemoryPoolHandle pointing to a valid memory pool
+        @throws std::logic_error if the scheme is not BFV or BGV
+        @throws std::invalid_argument if encrypted is not valid for the encryption parameters
+        @throws std::invalid_argument if encrypted is not in the default NTT form
+        @throws std::invalid_argument if min_noise_budget is negative
+        @throws std::invalid_argument if pool is uninitialized
+        */
+        void prepare_for_transport(
+            const Ciphertext &encrypted, CompactCiphertext &destination, int min_noise_budget = 1, bool truncate = true,
+            MemoryPoolHandle pool = MemoryManager::GetPool()) const;
+
         /**
         Given a ciphertext encrypted modulo q_1...q_k, this function switches the modulus down to q_1...q_{k-1}, scales
         the message down accordingly, and stores the result in the destination parameter. Dynamic memory allocations in
@@ -850,6 +958,83 @@ namespace seal
             multiply_plain_inplace(destination, plain, std::move(pool));
         }
 
+        /**
+        Multiplies a ciphertext with an integer constant. In BFV and BGV the message is multiplied with the constant
+        modulo the plaintext modulus; in CKKS every slot is multiplied with the constant and the scale is unchanged.
+        Unlike multiply_plain_inplace with a constant plaintext, this needs no encoding and no NTT; each RNS component
+        is multiplied with the constant reduced modulo its prime.
+
+        @param[in] encrypted The ciphertext to multiply
+        @param[in] scalar The constant to multiply with
+        @throws std::invalid_argument if encrypted is not valid for the encryption parameters
+        @throws std::invalid_argument if scalar is zero, or in BFV and BGV a multiple of the plaintext modulus
+        @throws std::logic_error if result ciphertext is transparent
+        */
+        void multiply_scalar_inplace(Ciphertext &encrypted, std::int64_t scalar) const;
+
+        /**
+        Multiplies a ciphertext with an integer constant and stores the result in the destination parameter. In BFV
+        and BGV the message is multiplied with the constant modulo the plaintext modulus; in CKKS every slot is
+        multiplied with the constant and the scale is unchanged.
+
+        @param[in] encrypted The ciphertext to multiply
+        @param[in] scalar The constant to multiply with
+        @param[out] destination The ciphertext to overwrite with the multiplication result
+        @throws std::invalid_argument if encrypted is not valid for the encryption parameters
+        @throws std::invalid_argument if scalar is zero, or in BFV and BGV a multiple of the plaintext modulus
+        @throws std::logic_error if result ciphertext is transparent
+        */
+        inline void multiply_scalar(const Ciphertext &encrypted, std::int64_t scalar, Ciphertext &destination) const
+        {
+            destination = encrypted;
+            multiply_scalar_inplace(destination, scalar);
+        }
+
+        /**
+        Multiplies a ciphertext with the monomial coeff * x^exponent, i.e., with the plaintext polynomial that has a
+        single nonzero coefficient. Since x^N = -1 for the polynomial modulus degree N, the exponent is taken modulo
+        2N. Unlike multiply_plain_inplace, this needs no plaintext and no NTT: a ciphertext in normal form is
+        negacyclically shifted, and a ciphertext in NTT form is multiplied pointwise with the powers of the NTT roots
+        that represent the monomial. In CKKS the scale is unchanged. Dynamic memory allocations in the process are
+        allocated from the memory pool pointed to by the given MemoryPoolHandle.
+
+        @param[in] encrypted The ciphertext to multiply
+        @param[in] coeff The coefficient of the monomial
+        @param[in] exponent The exponent of the monomial
+        @param[in] pool The MemoryPoolHandle pointing to a valid memory pool
+        @throws std::invalid_argument if encrypted is not valid for the encryption parameters
+        @throws std::invalid_argument if coeff is zero, or in BFV and BGV a multiple of the plaintext modulus
+        @throws std::invalid_argument if pool is uninitialized
+        @throws std::logic_error if result ciphertext is transparent
+        */
+        void multiply_monomial_inplace(
+            Ciphertext &encrypted, std::int64_t coeff, std::size_t exponent,
+            MemoryPoolHandle pool = MemoryManager::GetPool()) const;
+
+        /**
+        Multiplies a ciphertext with the monomial coeff * x^exponent and stores the result in the destination
+        parameter. Since x^N = -1 for the polynomial modulus degree N, the exponent is taken modulo 2N. In CKKS the
+        scale is unchanged. Dynamic memory allocations in the process are allocated from the memory pool pointed to by
+        the given MemoryPoolHandle.
+
+        @param[in] encrypted The ciphertext to multiply
+        @param[in] coeff The coefficient of the monomial
+        @param[in] exponent The exponent of the monomial
+        @param[out] destination The ciphertext to overwrite with the multiplication result
+        @param[in] pool The MemoryPoolHandle pointing to a valid memory pool
+        @throws std::invalid_argument if encrypted is not valid for the encryption parameters
+        @throws std::invalid_argument if coeff is zero, or in BFV and BGV a multiple of the plaintext modulus
+        @throws std::invalid_argument if pool is uninitialized
+        @throws std::logic_error if result ciphertext is transparent
+        */
+        inline void multiply_monomial(
+            const Ciphertext &encrypted, std::int64_t coeff, std::size_t exponent, Ciphertext &destination,
+            MemoryPoolHandle pool = MemoryManager::GetPool()) const
+        {
+            destination = encrypted;
+            multiply_monomial_inplace(destination, coeff, exponent, std::move(pool));
+        }
+
         /**
         Transforms a plaintext to NTT domain. This functions applies the Number Theoretic Transform to a plaintext by
         first embedding integers modulo the plaintext modulus to integers modulo the coefficient modulus and then
@@ -1292,6 +1477,183 @@ namespace seal
             complex_conjugate_inplace(destination, galois_keys, std::move(pool));
         }
 
+        /**
+        Separates a CKKS ciphertext encrypting real values packed into the real and imaginary parts of the slots, as
+        produced by CKKSEncoder::encode_packed_real. The real parts of the slots of encrypted are written to the slots
+        of destination_real and the imaginary parts to the slots of destination_imag, both as real values. The
+        separation uses one complex conjugation and consumes no level; instead of rescaling, the scale of
+        destination_real is twice and the scale of destination_imag is 2 * sqrt(2) times the scale of encrypted.
+        Dynamic memory allocations in the process are allocated from the memory pool pointed to by the given
+        MemoryPoolHandle.
+
+        @param[in] encrypted The ciphertext to separate
+        @param[in] galois_keys The Galois keys, which must contain the key for complex conjugation
+        @param[out] destination_real The ciphertext to overwrite with the real parts
+        @param[out] destination_imag The ciphertext to overwrite with the imaginary parts
+        @param[in] pool The MemoryPoolHandle pointing to a valid memory pool
+        @throws std::logic_error if scheme is not scheme_type::ckks
+        @throws std::invalid_argument if encrypted or galois_keys is not valid for the encryption parameters
+        @throws std::invalid_argument if destination_real and destination_imag are the same ciphertext
+        @throws std::invalid_argument if poly_modulus_degree is less than 4
+        @throws std::invalid_argument if encrypted has size larger than 2
+        @throws std::invalid_argument if the Galois key for complex conjugation is not present
+        @throws std::invalid_argument if pool is uninitialized
+        @throws std::logic_error if keyswitching is not supported by the context
+        @throws std::logic_error if result ciphertext is transparent
+        */
+        void separate_packed_real(
+            const Ciphertext &encrypted, const GaloisKeys &galois_keys, Ciphertext &destination_real,
+            Ciphertext &destination_imag, MemoryPoolHandle pool = MemoryManager::GetPool()) const;
+
+        /**
+        Evaluates a polynomial with real coefficients on a CKKS ciphertext. Given coefficients c_0, ..., c_d, this
+        function computes c_0 + c_1 * x + ... + c_d * x^d, where x is the plaintext encrypted in encrypted, and stores
+        the result in the destination parameter. The evaluation uses the Paterson-Stockmeyer algorithm, which needs
+        O(sqrt(d)) non-scalar multiplications and consumes close to the optimal ceil(log2(d + 1)) levels. Rescaling
+        and level alignment of intermediate results are performed automatically, and the result has the same scale as
+        encrypted. For best precision the scale of encrypted should be close to the primes in the coefficient modulus.
+        Dynamic memory allocations in the process are allocated from the memory pool pointed to by the given
+        MemoryPoolHandle.
+
+        @param[in] encrypted The ciphertext to evaluate the polynomial on
+        @param[in] coeffs The coefficients of the polynomial in increasing order of degree
+        @param[in] relin_keys The relinearization keys
+        @param[out] destination The ciphertext to overwrite with the result
+        @param[in] pool The MemoryPoolHandle pointing to a valid memory pool
+        @throws std::logic_error if scheme is not scheme_type::ckks
+        @throws std::invalid_argument if encrypted or relin_keys is not valid for the encryption parameters
+        @throws std::invalid_argument if encrypted is not in the default NTT form
+        @throws std::invalid_argument if the polynomial has degree less than one
+        @throws std::invalid_argument if encrypted is at too low a level for the degree of the polynomial
+        @throws std::invalid_argument if pool is uninitialized
+        @throws std::logic_error if keyswitching is not supported by the context
+        @throws std::logic_error if result ciphertext is transparent
+        */
+        void evaluate_polynomial(
+            const Ciphertext &encrypted, const std::vector<double> &coeffs, const RelinKeys &relin_keys,
+            Ciphertext &destination, MemoryPoolHandle pool = MemoryManager::GetPool()) const;
+
+        /**
+        Evaluates a polynomial with coefficients modulo the plaintext modulus on a BFV or BGV ciphertext. Given
+        coefficients c_0, ..., c_d, this function computes c_0 + c_1 * x + ... + c_d * x^d, where x is the plaintext
+        encrypted in encrypted, and stores the result in the destination parameter. When batching is used the
+        polynomial is applied to every slot. The evaluation uses the Paterson-Stockmeyer algorithm, which needs
+        O(sqrt(d)) non-scalar multiplications and has multiplicative depth ceil(log2(d + 1)). Relinearization is
+        performed automatically after every multiplication; in BGV every multiplication is also followed by modulus
+        switching, so the result is at a lower level than encrypted. Dynamic memory allocations in the process are
+        allocated from the memory pool pointed to by the given MemoryPoolHandle.
+
+        @param[in] encrypted The ciphertext to evaluate the polynomial on
+        @param[in] coeffs The coefficients of the polynomial in increasing order of degree
+        @param[in] relin_keys The relinearization keys
+        @param[out] destination The ciphertext to overwrite with the result
+        @param[in] pool The MemoryPoolHandle pointing to a valid memory pool
+        @throws std::logic_error if scheme is not scheme_type::bfv or scheme_type::bgv
+        @throws std::invalid_argument if encrypted or relin_keys is not valid for the encryption parameters
+        @throws std::invalid_argument if encrypted is not in the default NTT form
+        @throws std::invalid_argument if the polynomial has degree less than one
+        @throws std::invalid_argument if scheme is scheme_type::bgv and encrypted is at too low a level for the
+        degree of the polynomial
+        @throws std::invalid_argument if pool is uninitialized
+        @throws std::logic_error if keyswitching is not supported by the context
+        @throws std::logic_error if result ciphertext is transparent
+        */
+        void evaluate_polynomial(
+            const Ciphertext &encrypted, const std::vector<std::uint64_t> &coeffs, const RelinKeys &relin_keys,
+            Ciphertext &destination, MemoryPoolHandle pool = MemoryManager::GetPool()) const;
+
+        /**
+        Evaluates a Chebyshev series on a CKKS ciphertext. Given coefficients c_0, ..., c_d, this function computes
+        c_0 * T_0(y) + ... + c_d * T_d(y), where T_i are the Chebyshev polynomials of the first kind and
+        y = (2 * x - lower_bound - upper_bound) / (upper_bound - lower_bound) maps the interval [lower_bound,
+        upper_bound] containing the encrypted values x to [-1, 1]. Chebyshev interpolants are numerically much better
+        behaved than power series for approximating functions such as sigmoid or sign; see util::chebyshev_coefficients
+        for computing the coefficients. The evaluation uses the Paterson-Stockmeyer algorithm with automatic rescaling
+        and level alignment, and the result has the same scale as encrypted. Unless the interval is [-1, 1], the change
+        of variable consumes one additional level. Dynamic memory allocations in the process are allocated from the
+        memory pool pointed to by the given MemoryPoolHandle.
+
+        @param[in] encrypted The ciphertext to evaluate the series on
+        @param[in] coeffs The Chebyshev coefficients in increasing order of degree
+        @param[in] lower_bound The lower end of the approximation interval
+        @param[in] upper_bound The upper end of the approximation interval
+        @param[in] relin_keys The relinearization keys
+        @param[out] destination The ciphertext to overwrite with the result
+        @param[in] pool The MemoryPoolHandle pointing to a valid memory pool
+        @throws std::logic_error if scheme is not scheme_type::ckks
+        @throws std::invalid_argument if encrypted or relin_keys is not valid for the encryption parameters
+        @throws std::invalid_argument if encrypted is not in the default NTT form
+        @throws std::invalid_argument if lower_bound is not less than upper_bound
+        @throws std::invalid_argument if the series has degree less than one
+        @throws std::invalid_argument if encrypted is at too low a level for the degree of the series
+        @throws std::invalid_argument if pool is uninitialized
+        @throws std::logic_error if keyswitching is not supported by the context
+        @throws std::logic_error if result ciphertext is transparent
+        */
+        void evaluate_chebyshev_series(
+            const Ciphertext &encrypted, const std::vector<double> &coeffs, double lower_bound, double upper_bound,
+            const RelinKeys &relin_keys, Ciphertext &destination,
+            MemoryPoolHandle pool = MemoryManager::GetPool()) const;
+
+        /**
+        Bootstraps a CKKS ciphertext. This function refreshes a ciphertext at any level into a ciphertext at the
+        level given by bootstrapper.parms_id() that encrypts approximately the same values with the same scale, so
+        that further multiplications can be performed. The values must be small compared to q_0 / scale, where q_0
+        is the first prime in the coefficient modulus; see CKKSBootstrapper for choosing the parameters. The Galois
+        keys must contain the elements in bootstrapper.galois_elts(). Dynamic memory allocations in the process are
+        allocated from the memory pool pointed to by the given MemoryPoolHandle.
+
+        @param[in] encrypted The ciphertext to bootstrap
+        @param[in] bootstrapper The bootstrapping precomputation
+        @param[in] relin_keys The relinearization keys
+        @param[in] galois_keys The Galois keys
+        @param[in] pool The MemoryPoolHandle pointing to a valid memory pool
+        @throws std::logic_error if scheme is not scheme_type::ckks
+        @throws std::invalid_argument if encrypted, relin_keys, or galois_keys is not valid for the encryption
+        parameters
+        @throws std::invalid_argument if bootstrapper was not created for the encryption parameters
+        @throws std::invalid_argument if encrypted is not in NTT form or has size larger than 2
+        @throws std::invalid_argument if necessary Galois keys are not present
+        @throws std::invalid_argument if pool is uninitialized
+        @throws std::logic_error if keyswitching is not supported by the context
+        @throws std::logic_error if result ciphertext is transparent
+        */
+        void bootstrap_inplace(
+            Ciphertext &encrypted, const CKKSBootstrapper &bootstrapper, const RelinKeys &relin_keys,
+            const GaloisKeys &galois_keys, MemoryPoolHandle pool = MemoryManager::GetPool()) const;
+
+        /**
+        Bootstraps a CKKS ciphertext and stores the result in the destination parameter. This function refreshes a
+        ciphertext at any level into a ciphertext at the level given by bootstrapper.parms_id() that encrypts
+        approximately the same values with the same scale. The Galois keys must contain the elements in
+        bootstrapper.galois_elts(). Dynamic memory allocations in the process are allocated from the memory pool
+        pointed to by the given MemoryPoolHandle.
+
+        @param[in] encrypted The ciphertext to bootstrap
+        @param[in] bootstrapper The bootstrapping precomputation
+        @param[in] relin_keys The relinearization keys
+        @param[in] galois_keys The Galois keys
+        @param[out] destination The ciphertext to overwrite with the bootstrapped result
+        @param[in] pool The MemoryPoolHandle pointing to a valid memory pool
+        @throws std::logic_error if scheme is not scheme_type::ckks
+        @throws std::invalid_argument if encrypted, relin_keys, or galois_keys is not valid for the encryption
+        parameters
+        @throws std::invalid_argument if bootstrapper was not created for the encryption parameters
+        @throws std::invalid_argument if encrypted is not in NTT form or has size larger than 2
+        @throws std::invalid_argument if necessary Galois keys are not present
+        @throws std::invalid_argument if pool is uninitialized
+        @throws std::logic_error if keyswitching is not supported by the context
+        @throws std::logic_error if result ciphertext is transparent
+        */
+        inline void bootstrap(
+            const Ciphertext &encrypted, const CKKSBootstrapper &bootstrapper, const RelinKeys &relin_keys,
+            const GaloisKeys &galois_keys, Ciphertext &destination,
+            MemoryPoolHandle pool = MemoryManager::GetPool()) const
+        {
+            destination = encrypted;
+            bootstrap_inplace(destination, bootstrapper, relin_keys, galois_keys, std::move(pool));
+        }
+
         /**
         Enables access to private members of seal::Evaluator for SEAL_C.
         */
@@ -1325,13 +1687,21 @@ namespace seal
         void mod_switch_scale_to_next(
             const Ciphertext &encrypted, Ciphertext &destination, MemoryPoolHandle pool) const;
 
-        void mod_switch_drop_to_next(const Ciphertext &encrypted, Ciphertext &destination, MemoryPoolHandle pool) const;
+        void mod_switch_drop_to(
+            const Ciphertext &encrypted, Ciphertext &destination,
+            const SEALContext::ContextData &target_context_data) const;
 
-        void mod_switch_drop_to_next(Plaintext &plain) const;
+        void mod_switch_drop_to(Plaintext &plain, const SEALContext::ContextData &target_context_data) const;
 
         void rotate_internal(
             Ciphertext &encrypted, int steps, const GaloisKeys &galois_keys, MemoryPoolHandle pool) const;
 
+        void mod_raise_inplace(Ciphertext &encrypted, double scale, MemoryPoolHandle pool) const;
+
+        void apply_linear_transform(
+            const std::vector<const Ciphertext *> &inputs, const CKKSBootstrapper::LinearTransform &transform,
+            const GaloisKeys &galois_keys, Ciphertext &destination, MemoryPoolHandle pool) const;
+
         inline void conjugate_internal(
             Ciphertext &encrypted, const GaloisKeys &galois_keys, MemoryPoolHandle pool) const
         {
@@ -1359,10 +1729,23 @@ namespace seal
             Ciphertext &encrypted, util::ConstRNSIter target_iter, const KSwitchKeys &kswitch_keys,
             std::size_t key_index, MemoryPoolHandle pool = MemoryManager::GetPool()) const;
 
+        void switch_key_hybrid_inplace(
+            Ciphertext &encrypted, util::ConstRNSIter target_iter, const std::vector<PublicKey> &key_vector,
+            MemoryPoolHandle pool) const;
+
         void multiply_plain_normal(Ciphertext &encrypted, const Plaintext &plain, MemoryPoolHandle pool) const;
 
         void multiply_plain_ntt(Ciphertext &encrypted_ntt, const Plaintext &plain_ntt) const;
 
+        // Returns true if encrypted2 was copied to aligned and switched down to the level of encrypted1; encrypted1 may
+        // be switched down in place instead, in which case false is returned.
+        bool align_levels(
+            Ciphertext &encrypted1, const Ciphertext &encrypted2, Ciphertext &aligned, MemoryPoolHandle pool) const;
+
+        void eager_switch_to_next(Ciphertext &encrypted, MemoryPoolHandle pool) const;
+
         SEALContext context_;
+
+        level_management_mode level_management_ = level_management_mode::manual;
     };
 } // namespace seal
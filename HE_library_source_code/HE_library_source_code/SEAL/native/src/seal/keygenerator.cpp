@@ -310,6 +310,7 @@ namespace seal
         auto &key_context_data = *context_.key_context_data();
         auto &key_parms = key_context_data.parms();
         auto &key_modulus = key_parms.coeff_modulus();
+        size_t key_modulus_size = key_modulus.size();
 
         // Size check
         if (!product_fits_in(coeff_count, decomp_mod_count))
@@ -317,6 +318,38 @@ namespace seal
             throw logic_error("invalid parameters");
         }
 
+        // With hybrid key switching there is one key per digit of special_prime_count consecutive primes
+        size_t special_prime_count = context_.special_prime_count();
+        if (special_prime_count > 1)
+        {
+            size_t digit_count = divide_round_up(decomp_mod_count, special_prime_count);
+            destination.resize(digit_count);
+
+            SEAL_ITERATE(iter(destination, size_t(0)), digit_count, [&](auto I) {
+                encrypt_zero_symmetric(
+                    secret_key_, context_, key_context_data.parms_id(), true, save_seed, get<0>(I).data());
+
+                // Add the product of the special primes times new_key modulo the primes of the digit
+                size_t digit_begin = get<1>(I) * special_prime_count;
+                size_t digit_end = min(digit_begin + special_prime_count, decomp_mod_count);
+                SEAL_ALLOCATE_GET_COEFF_ITER(temp, coeff_count, pool_);
+                for (size_t i = digit_begin; i < digit_end; i++)
+                {
+                    uint64_t factor = 1;
+                    for (size_t j = decomp_mod_count; j < key_modulus_size; j++)
+                    {
+                        factor = multiply_uint_mod(
+                            factor, barrett_reduce_64(key_modulus[j].value(), key_modulus[i]), key_modulus[i]);
+                    }
+                    multiply_poly_scalar_coeffmod(new_key[i], coeff_count, factor, key_modulus[i], temp);
+
+                    CoeffIter destination_iter = (*iter(get<0>(I).data()))[i];
+                    add_poly_coeffmod(destination_iter, temp, coeff_count, key_modulus[i], destination_iter);
+                }
+            });
+            return;
+        }
+
         // KSwitchKeys data allocated from pool given by MemoryManager::GetPool.
         destination.resize(decomp_mod_count);
 
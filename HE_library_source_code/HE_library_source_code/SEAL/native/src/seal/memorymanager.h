@@ -162,6 +162,45 @@ namespace seal
             return MemoryPoolHandle(std::make_shared<util::MemoryPoolMT>(clear_on_destruction));
         }
 
+        /**
+        Returns a MemoryPoolHandle pointing to a new arena memory pool for short-lived data, such as the
+        temporaries of one request. New allocations are carved from large chunks with a bump pointer, and released
+        allocations are reused by later allocations of the same size without any locking, so once the chunks have
+        grown to the working set of a request, allocations no longer reach the system allocator. The memory is
+        given back for reuse only by reset, typically at the end of each request. To make the internal scratch
+        allocations of Microsoft SEAL use the arena as well, install it with MMProfGuard and MMProfFixed, or pass
+        it explicitly to the functions taking a MemoryPoolHandle.
+
+        An arena memory pool is not thread-safe; it must only be used by one thread at a time.
+
+        @param[in] chunk_byte_count The byte size of the chunks requested from the system allocator; allocations
+        larger than this get a chunk of their own
+        @param[in] clear_on_destruction Indicates whether the memory pool data
+        should be cleared when destroyed. This can be important when memory pools
+        are used to store private data.
+        @throws std::invalid_argument if chunk_byte_count is zero or too large
+        */
+        SEAL_NODISCARD inline static MemoryPoolHandle Arena(
+            std::size_t chunk_byte_count = util::MemoryPoolArena::default_chunk_byte_count,
+            bool clear_on_destruction = false)
+        {
+            return MemoryPoolHandle(std::make_shared<util::MemoryPoolArena>(chunk_byte_count, clear_on_destruction));
+        }
+
+        /**
+        Makes all memory of an arena memory pool (see Arena) available for new allocations, without giving it back
+        to the system. All objects allocated from the pool, e.g., Ciphertext and Plaintext objects created with
+        this MemoryPoolHandle, must have been destroyed or have released their data.
+
+        @throws std::logic_error if the MemoryPoolHandle is uninitialized
+        @throws std::logic_error if the memory pool is not an arena memory pool
+        @throws std::logic_error if memory allocated from the memory pool is still in use
+        */
+        inline void reset() const
+        {
+            static_cast<util::MemoryPool &>(*this).reset();
+        }
+
         /**
         Returns a reference to the internal memory pool that the MemoryPoolHandle
         points to. This function is mainly for internal use.
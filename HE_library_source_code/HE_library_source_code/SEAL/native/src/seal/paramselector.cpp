@@ -0,0 +1,624 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "seal/paramselector.h"
+#include "seal/util/common.h"
+#include "seal/util/noiseestimate.h"
+#include "seal/util/uintcore.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace seal::util;
+
+namespace seal
+{
+    namespace
+    {
+        // Reference calibration: log of the latency in microseconds per unit cost, fitted to sealbench with the
+        // default BFV coefficient moduli for poly_modulus_degree from 1024 to 32768 (x86-64, Release build, no HEXL).
+        // Rows are BFV, CKKS, and BGV; columns follow he_op_type.
+        constexpr double reference_log_constants[3][8]{
+            { -4.159, -5.128, -4.900, -4.631, -2.727, -5.710, -5.711, -6.748 },
+            { -3.900, -7.134, -5.155, -6.903, -6.216, -5.653, -5.778, -5.423 },
+            { -3.751, -5.690, -5.013, -5.566, -6.218, -5.476, -5.535, -4.879 }
+        };
+
+        // Heuristic bound on the bit count of the CKKS error in the slots after a computation of given depth, relative
+        // to the scale. Encoding, key switching, and rescaling add errors of standard deviation about
+        // sqrt(poly_modulus_degree) to the coefficients, decoding amplifies them by about sqrt(poly_modulus_degree),
+        // and every multiplication at most doubles the relative error of inputs in [-1, 1].
+        int ckks_error_bit_count(size_t poly_modulus_degree, size_t depth)
+        {
+            return get_power_of_two(static_cast<uint64_t>(poly_modulus_degree)) + static_cast<int>(depth) + 7;
+        }
+
+        size_t scheme_index(scheme_type scheme)
+        {
+            switch (scheme)
+            {
+            case scheme_type::bfv:
+                return 0;
+
+            case scheme_type::ckks:
+                return 1;
+
+            case scheme_type::bgv:
+                return 2;
+
+            default:
+                throw invalid_argument("unsupported scheme");
+            }
+        }
+
+        // Maps a sealbench benchmark name to an operation; returns false if the benchmark is not modeled
+        bool parse_benchmark_op(const string &name, he_op_type &op)
+        {
+            if (name == "EncryptPublic")
+            {
+                op = he_op_type::encrypt;
+            }
+            else if (name == "Decrypt")
+            {
+                op = he_op_type::decrypt;
+            }
+            else if (name == "EvaluateAddCt")
+            {
+                op = he_op_type::add;
+            }
+            else if (name == "EvaluateMulPt")
+            {
+                op = he_op_type::multiply_plain;
+            }
+            else if (name == "EvaluateMulCt")
+            {
+                op = he_op_type::multiply;
+            }
+            else if (name == "EvaluateRelinInplace")
+            {
+                op = he_op_type::relinearize;
+            }
+            else if (name == "EvaluateRotateRows" || name == "EvaluateRotate")
+            {
+                op = he_op_type::rotate;
+            }
+            else if (name == "EvaluateModSwitchInplace" || name == "EvaluateRescaleInplace")
+            {
+                op = he_op_type::mod_switch;
+            }
+            else
+            {
+                return false;
+            }
+            return true;
+        }
+
+        // Splits a line of CSV into fields, removing quotes
+        vector<string> split_csv_line(const string &line)
+        {
+            vector<string> fields(1);
+            bool quoted = false;
+            for (char c : line)
+            {
+                if (c == '"')
+                {
+                    quoted = !quoted;
+                }
+                else if (c == ',' && !quoted)
+                {
+                    fields.emplace_back();
+                }
+                else if (c != '\r')
+                {
+                    fields.back().push_back(c);
+                }
+            }
+            return fields;
+        }
+
+        // Returns the number of primes at the first level of the parameters that sealbench uses for the given
+        // degree and total coefficient modulus bit count
+        size_t benchmark_coeff_modulus_size(size_t poly_modulus_degree, int log_q)
+        {
+            try
+            {
+                auto default_modulus = CoeffModulus::BFVDefault(poly_modulus_degree);
+                int total_bit_count = accumulate(
+                    default_modulus.cbegin(), default_modulus.cend(), 0,
+                    [](int sum, const Modulus &mod) { return sum + mod.bit_count(); });
+                if (total_bit_count == log_q)
+                {
+                    return max<size_t>(default_modulus.size() - 1, 1);
+                }
+            }
+            catch (const invalid_argument &)
+            {
+                // Custom parameters; fall through to the estimate below
+            }
+
+            // Assume primes of 50 bits and one special prime
+            size_t prime_count = static_cast<size_t>((log_q + 49) / 50);
+            return max<size_t>(prime_count, 2) - 1;
+        }
+
+        /*
+        Creates encryption parameters with given data prime sizes and a special prime as large as the largest of
+        them. Returns nullptr if the total size exceeds max_bit_count, if there are not enough suitable primes, or if
+        the parameters are invalid.
+        */
+        shared_ptr<SEALContext> create_context(
+            scheme_type scheme, size_t poly_modulus_degree, vector<int> bit_sizes, const Modulus &plain_modulus,
+            int max_bit_count, sec_level_type sec_level)
+        {
+            int special_bit_count = *max_element(bit_sizes.cbegin(), bit_sizes.cend());
+            bit_sizes.push_back(special_bit_count);
+            if (accumulate(bit_sizes.cbegin(), bit_sizes.cend(), 0) > max_bit_count)
+            {
+                return nullptr;
+            }
+
+            EncryptionParameters parms(scheme);
+            parms.set_poly_modulus_degree(poly_modulus_degree);
+            try
+            {
+                parms.set_coeff_modulus(CoeffModulus::Create(poly_modulus_degree, bit_sizes));
+            }
+            catch (const logic_error &)
+            {
+                return nullptr;
+            }
+            if (scheme != scheme_type::ckks)
+            {
+                parms.set_plain_modulus(plain_modulus);
+            }
+
+            auto context = make_shared<SEALContext>(parms, true, sec_level);
+            return context->parameters_set() ? context : nullptr;
+        }
+
+        /*
+        Simulates a chain of multiplications with the noise estimator, each followed by relinearization and, for
+        BGV, by switching to the next level. Returns the noise estimate at the end and sets context_data to the level
+        of the result.
+        */
+        double simulate_noise(
+            const SEALContext &context, size_t depth, shared_ptr<const SEALContext::ContextData> &context_data)
+        {
+            context_data = context.first_context_data();
+            double noise = estimate_fresh_noise(*context_data, true);
+            for (size_t i = 0; i < depth; i++)
+            {
+                noise = estimate_multiply_noise(*context_data, noise, 2, noise, 2);
+                noise = estimate_key_switch_noise(context, *context_data, noise);
+                if (context_data->parms().scheme() == scheme_type::bgv)
+                {
+                    noise = estimate_mod_switch_noise(*context_data, noise, 2);
+                    context_data = context_data->next_context_data();
+                }
+            }
+            return noise;
+        }
+
+        // Splits a bit count into as few primes of at most SEAL_USER_MOD_BIT_COUNT_MAX bits as possible
+        vector<int> split_bit_count(int bit_count)
+        {
+            int prime_count = (bit_count + SEAL_USER_MOD_BIT_COUNT_MAX - 1) / SEAL_USER_MOD_BIT_COUNT_MAX;
+            vector<int> bit_sizes(static_cast<size_t>(prime_count), bit_count / prime_count);
+            for (int i = 0; i < bit_count % prime_count; i++)
+            {
+                bit_sizes[static_cast<size_t>(i)]++;
+            }
+            return bit_sizes;
+        }
+
+        // Returns the bit count that decryption needs for a given noise estimate
+        int needed_bit_count(double noise, const Modulus &plain_modulus)
+        {
+            return static_cast<int>(ceil(noise + log2(static_cast<double>(plain_modulus.value())) + 2.0));
+        }
+
+        /*
+        Finds the smallest coefficient modulus of the form layout(bit_count) for which the estimated noise budget at
+        the end of the computation is positive, where bit_count is the size of the primes left at the end of the
+        computation. The noise is first estimated with the modulus layout(probe_bit_count), which is assumed to be the
+        largest one allowed. Since the noise depends only weakly on the size of the modulus, this estimate gives the
+        needed size up to a few bits. Returns nullptr if no such modulus exists.
+        */
+        shared_ptr<SEALContext> fit_noise(
+            const CircuitRequirements &requirements, size_t poly_modulus_degree, const Modulus &plain_modulus,
+            int max_bit_count, const function<vector<int>(int)> &layout, int probe_bit_count)
+        {
+            auto probe_context = create_context(
+                requirements.scheme, poly_modulus_degree, layout(probe_bit_count), plain_modulus, max_bit_count,
+                requirements.sec_level);
+            if (!probe_context)
+            {
+                return nullptr;
+            }
+
+            shared_ptr<const SEALContext::ContextData> context_data;
+            double noise = simulate_noise(*probe_context, requirements.multiplicative_depth, context_data);
+            if (estimate_noise_budget(*context_data, noise) <= 0)
+            {
+                return nullptr;
+            }
+
+            for (int bit_count = max(needed_bit_count(noise, plain_modulus), requirements.plain_modulus_bit_count + 2);
+                 bit_count < probe_bit_count; bit_count++)
+            {
+                auto context = create_context(
+                    requirements.scheme, poly_modulus_degree, layout(bit_count), plain_modulus, max_bit_count,
+                    requirements.sec_level);
+                if (context)
+                {
+                    noise = simulate_noise(*context, requirements.multiplicative_depth, context_data);
+                    if (estimate_noise_budget(*context_data, noise) > 0)
+                    {
+                        return context;
+                    }
+                }
+            }
+            return probe_context;
+        }
+
+        shared_ptr<SEALContext> select_bfv_bgv(
+            const CircuitRequirements &requirements, size_t poly_modulus_degree, int max_bit_count)
+        {
+            Modulus plain_modulus;
+            try
+            {
+                plain_modulus = PlainModulus::Batching(poly_modulus_degree, requirements.plain_modulus_bit_count);
+            }
+            catch (const logic_error &)
+            {
+                return nullptr;
+            }
+
+            // Returns the total size of a coefficient modulus including a special prime as large as the largest
+            // data prime
+            auto total_bit_count = [](const vector<int> &bit_sizes) {
+                return accumulate(bit_sizes.cbegin(), bit_sizes.cend(), 0) +
+                       *max_element(bit_sizes.cbegin(), bit_sizes.cend());
+            };
+
+            if (requirements.scheme == scheme_type::bfv || requirements.multiplicative_depth == 0)
+            {
+                // All data primes remain until the end
+                int probe_bit_count = max_bit_count;
+                while (probe_bit_count > 0 && total_bit_count(split_bit_count(probe_bit_count)) > max_bit_count)
+                {
+                    probe_bit_count--;
+                }
+                if (probe_bit_count <= requirements.plain_modulus_bit_count)
+                {
+                    return nullptr;
+                }
+                return fit_noise(
+                    requirements, poly_modulus_degree, plain_modulus, max_bit_count, split_bit_count,
+                    probe_bit_count);
+            }
+
+            // For BGV, every level drops a prime of level_bit_count bits and only the first prime remains at the end.
+            // Larger levels absorb more of the noise growth of multiplications and need a smaller first prime, so
+            // find the level size that minimizes the total size.
+            size_t depth = requirements.multiplicative_depth;
+            int best_level_bit_count = 0;
+            int best_total_bit_count = max_bit_count + 1;
+            int best_probe_bit_count = 0;
+            for (int level_bit_count = requirements.plain_modulus_bit_count + 2;
+                 level_bit_count <= SEAL_USER_MOD_BIT_COUNT_MAX; level_bit_count++)
+            {
+                int level_total_bit_count = mul_safe(level_bit_count, static_cast<int>(depth) + 1);
+                if (level_total_bit_count >= best_total_bit_count)
+                {
+                    break;
+                }
+
+                // Probe with the largest first prime that fits
+                int probe_bit_count =
+                    min(SEAL_USER_MOD_BIT_COUNT_MAX, (max_bit_count - level_bit_count * static_cast<int>(depth)) / 2);
+                if (probe_bit_count <= requirements.plain_modulus_bit_count)
+                {
+                    break;
+                }
+
+                vector<int> bit_sizes(depth + 1, level_bit_count);
+                bit_sizes[0] = probe_bit_count;
+                auto context = create_context(
+                    scheme_type::bgv, poly_modulus_degree, bit_sizes, plain_modulus, max_bit_count,
+                    requirements.sec_level);
+                if (!context)
+                {
+                    continue;
+                }
+
+                shared_ptr<const SEALContext::ContextData> context_data;
+                double noise = simulate_noise(*context, depth, context_data);
+                bit_sizes[0] = needed_bit_count(noise, plain_modulus);
+                if (bit_sizes[0] > probe_bit_count)
+                {
+                    continue;
+                }
+                if (total_bit_count(bit_sizes) < best_total_bit_count)
+                {
+                    best_level_bit_count = level_bit_count;
+                    best_total_bit_count = total_bit_count(bit_sizes);
+                    best_probe_bit_count = probe_bit_count;
+                }
+            }
+            if (!best_level_bit_count)
+            {
+                return nullptr;
+            }
+
+            auto layout = [&](int bit_count) {
+                vector<int> bit_sizes(depth + 1, best_level_bit_count);
+                bit_sizes[0] = bit_count;
+                return bit_sizes;
+            };
+            return fit_noise(
+                requirements, poly_modulus_degree, plain_modulus, max_bit_count, layout, best_probe_bit_count);
+        }
+
+        shared_ptr<SEALContext> select_ckks(
+            const CircuitRequirements &requirements, size_t poly_modulus_degree, int max_bit_count, double &scale)
+        {
+            int scale_bit_count = requirements.precision_bit_count +
+                                  ckks_error_bit_count(poly_modulus_degree, requirements.multiplicative_depth);
+            int first_bit_count = scale_bit_count + requirements.integer_bit_count;
+            if (first_bit_count > SEAL_USER_MOD_BIT_COUNT_MAX)
+            {
+                return nullptr;
+            }
+
+            vector<int> bit_sizes(requirements.multiplicative_depth + 1, scale_bit_count);
+            bit_sizes[0] = first_bit_count;
+            auto context = create_context(
+                scheme_type::ckks, poly_modulus_degree, bit_sizes, Modulus(), max_bit_count, requirements.sec_level);
+            scale = pow(2.0, scale_bit_count);
+            return context;
+        }
+    } // namespace
+
+    LatencyModel::LatencyModel()
+    {
+        for (size_t i = 0; i < scheme_count_; i++)
+        {
+            copy_n(reference_log_constants[i], op_count_, log_constants_[i].begin());
+        }
+    }
+
+    double LatencyModel::cost(he_op_type op, size_t poly_modulus_degree, size_t coeff_modulus_size)
+    {
+        double n = static_cast<double>(poly_modulus_degree);
+        double l = static_cast<double>(coeff_modulus_size);
+        switch (op)
+        {
+        case he_op_type::add:
+            return n * l;
+
+        case he_op_type::relinearize:
+            /* fall through */
+
+        case he_op_type::rotate:
+            return n * log2(n) * l * (l + 1);
+
+        default:
+            return n * log2(n) * l;
+        }
+    }
+
+    void LatencyModel::add_measurement(
+        scheme_type scheme, he_op_type op, size_t poly_modulus_degree, size_t coeff_modulus_size, double microseconds)
+    {
+        size_t index = scheme_index(scheme);
+        size_t op_index = static_cast<size_t>(op);
+        if (op_index >= op_count_)
+        {
+            throw invalid_argument("invalid operation");
+        }
+        if (!poly_modulus_degree || !coeff_modulus_size || !(microseconds > 0))
+        {
+            throw invalid_argument("invalid measurement");
+        }
+
+        log_ratio_sums_[index][op_index] += log(microseconds / cost(op, poly_modulus_degree, coeff_modulus_size));
+        measurement_counts_[index][op_index]++;
+        log_constants_[index][op_index] =
+            log_ratio_sums_[index][op_index] / static_cast<double>(measurement_counts_[index][op_index]);
+    }
+
+    size_t LatencyModel::load_benchmark_csv(istream &stream)
+    {
+        size_t count = 0;
+        string line;
+        while (getline(stream, line))
+        {
+            // Benchmark results start with a quoted name like "n=8192 / log(q)=218 / BFV / EvaluateMulCt/..."
+            if (line.compare(0, 3, "\"n=") != 0)
+            {
+                continue;
+            }
+
+            auto fields = split_csv_line(line);
+            if (fields.size() < 5)
+            {
+                throw invalid_argument("malformed benchmark result");
+            }
+
+            vector<string> name_parts;
+            istringstream name_stream(fields[0]);
+            for (string part; getline(name_stream, part, '/');)
+            {
+                part.erase(0, part.find_first_not_of(' '));
+                part.erase(part.find_last_not_of(' ') + 1);
+                name_parts.push_back(part);
+            }
+            if (name_parts.size() < 4 || name_parts[0].compare(0, 2, "n=") != 0 ||
+                name_parts[1].compare(0, 7, "log(q)=") != 0)
+            {
+                throw invalid_argument("malformed benchmark result");
+            }
+
+            scheme_type scheme;
+            if (name_parts[2] == "BFV")
+            {
+                scheme = scheme_type::bfv;
+            }
+            else if (name_parts[2] == "CKKS")
+            {
+                scheme = scheme_type::ckks;
+            }
+            else if (name_parts[2] == "BGV")
+            {
+                scheme = scheme_type::bgv;
+            }
+            else
+            {
+                continue;
+            }
+
+            he_op_type op;
+            if (!parse_benchmark_op(name_parts[3], op))
+            {
+                continue;
+            }
+
+            size_t poly_modulus_degree = 0;
+            int log_q = 0;
+            double time = 0;
+            try
+            {
+                poly_modulus_degree = static_cast<size_t>(stoull(name_parts[0].substr(2)));
+                log_q = stoi(name_parts[1].substr(7));
+                time = stod(fields[2]);
+            }
+            catch (const logic_error &)
+            {
+                throw invalid_argument("malformed benchmark result");
+            }
+
+            const string &unit = fields[4];
+            if (unit == "ns")
+            {
+                time /= 1000.0;
+            }
+            else if (unit == "ms")
+            {
+                time *= 1000.0;
+            }
+            else if (unit == "s")
+            {
+                time *= 1000000.0;
+            }
+            else if (unit != "us")
+            {
+                throw invalid_argument("malformed benchmark result");
+            }
+
+            add_measurement(
+                scheme, op, poly_modulus_degree, benchmark_coeff_modulus_size(poly_modulus_degree, log_q), time);
+            count++;
+        }
+        return count;
+    }
+
+    double LatencyModel::predict(
+        scheme_type scheme, he_op_type op, size_t poly_modulus_degree, size_t coeff_modulus_size) const
+    {
+        size_t index = scheme_index(scheme);
+        size_t op_index = static_cast<size_t>(op);
+        if (op_index >= op_count_)
+        {
+            throw invalid_argument("invalid operation");
+        }
+        if (!poly_modulus_degree || !coeff_modulus_size)
+        {
+            throw invalid_argument("invalid parameters");
+        }
+
+        return exp(log_constants_[index][op_index]) * cost(op, poly_modulus_degree, coeff_modulus_size);
+    }
+
+    ParameterSelection ParameterSelector::select(const CircuitRequirements &requirements) const
+    {
+        if (requirements.sec_level == sec_level_type::none)
+        {
+            throw invalid_argument("sec_level must be tc128, tc192, or tc256");
+        }
+        switch (requirements.scheme)
+        {
+        case scheme_type::bfv:
+            /* fall through */
+
+        case scheme_type::bgv:
+            if (requirements.plain_modulus_bit_count < SEAL_PLAIN_MOD_BIT_COUNT_MIN ||
+                requirements.plain_modulus_bit_count > SEAL_PLAIN_MOD_BIT_COUNT_MAX)
+            {
+                throw invalid_argument("plain_modulus_bit_count is invalid");
+            }
+            break;
+
+        case scheme_type::ckks:
+            if (requirements.precision_bit_count <= 0 || requirements.integer_bit_count < 0)
+            {
+                throw invalid_argument("precision_bit_count or integer_bit_count is invalid");
+            }
+            break;
+
+        default:
+            throw invalid_argument("unsupported scheme");
+        }
+
+        ParameterSelection selection;
+        shared_ptr<SEALContext> context;
+        for (size_t poly_modulus_degree = 1024; poly_modulus_degree <= SEAL_POLY_MOD_DEGREE_MAX;
+             poly_modulus_degree <<= 1)
+        {
+            int max_bit_count = CoeffModulus::MaxBitCount(poly_modulus_degree, requirements.sec_level);
+            if (!max_bit_count)
+            {
+                // No larger degrees are covered by the security standard
+                break;
+            }
+
+            context = requirements.scheme == scheme_type::ckks
+                          ? select_ckks(requirements, poly_modulus_degree, max_bit_count, selection.scale)
+                          : select_bfv_bgv(requirements, poly_modulus_degree, max_bit_count);
+            if (context)
+            {
+                break;
+            }
+        }
+        if (!context)
+        {
+            throw invalid_argument("no secure parameters satisfy the requirements");
+        }
+
+        selection.parms = context->key_context_data()->parms();
+        if (requirements.scheme != scheme_type::ckks)
+        {
+            shared_ptr<const SEALContext::ContextData> last_context_data;
+            double noise = simulate_noise(*context, requirements.multiplicative_depth, last_context_data);
+            selection.noise_budget = estimate_noise_budget(*last_context_data, noise);
+        }
+
+        // Ciphertexts at the first level do not use the special prime
+        size_t poly_modulus_degree = selection.parms.poly_modulus_degree();
+        size_t coeff_modulus_size = context->first_context_data()->parms().coeff_modulus().size();
+        for (uint8_t op = 0; op <= static_cast<uint8_t>(he_op_type::mod_switch); op++)
+        {
+            auto op_type = static_cast<he_op_type>(op);
+            selection.latency[op_type] =
+                latency_model_.predict(requirements.scheme, op_type, poly_modulus_degree, coeff_modulus_size);
+        }
+        return selection;
+    }
+} // namespace seal
@@ -0,0 +1,249 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+#include "seal/context.h"
+#include "seal/encryptionparams.h"
+#include "seal/modulus.h"
+#include "seal/util/defines.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <utility>
+
+namespace seal
+{
+    /**
+    Homomorphic operations whose latency is predicted by LatencyModel.
+    */
+    enum class he_op_type : std::uint8_t
+    {
+        // Public key encryption
+        encrypt = 0,
+
+        // Decryption
+        decrypt = 1,
+
+        // Ciphertext-ciphertext addition
+        add = 2,
+
+        // Ciphertext-plaintext multiplication
+        multiply_plain = 3,
+
+        // Ciphertext-ciphertext multiplication without relinearization
+        multiply = 4,
+
+        // Relinearization of a size 3 ciphertext
+        relinearize = 5,
+
+        // Rotation of a ciphertext (BFV and BGV rows, or CKKS slots)
+        rotate = 6,
+
+        // Modulus switching to the next level (rescaling for CKKS)
+        mod_switch = 7
+    };
+
+    /**
+    Predicts the latency of homomorphic operations for given encryption parameters. The model assumes that the
+    latency of an operation is proportional to its asymptotic cost, i.e., to n * L for additions, to
+    n * log(n) * L * (L + 1) for key switching, and to n * log(n) * L for everything else, where n is the degree of
+    the polynomial modulus and L is the number of primes in the coefficient modulus of the ciphertext. There is one
+    proportionality constant for every scheme and operation.
+
+    By default the constants are fitted to a reference run of sealbench. Measurements taken on the target machine
+    should be added with add_measurement or load_benchmark_csv: once a measurement for a scheme and operation has
+    been added, the reference constant for that pair is discarded and replaced by a fit to the measurements.
+
+    @par Thread Safety
+    In general, reading from LatencyModel is thread-safe as long as no other thread is concurrently mutating it.
+    */
+    class LatencyModel
+    {
+    public:
+        /**
+        Creates a LatencyModel with the reference calibration.
+        */
+        LatencyModel();
+
+        /**
+        Adds a measured latency of an operation on ciphertexts at the first level of the given parameters.
+
+        @param[in] scheme The encryption scheme
+        @param[in] op The operation
+        @param[in] poly_modulus_degree The degree of the polynomial modulus
+        @param[in] coeff_modulus_size The number of primes in the coefficient modulus of the ciphertexts
+        @param[in] microseconds The measured latency in microseconds
+        @throws std::invalid_argument if scheme is not BFV, CKKS, or BGV, or if any of the numerical arguments is not
+        positive
+        */
+        void add_measurement(
+            scheme_type scheme, he_op_type op, std::size_t poly_modulus_degree, std::size_t coeff_modulus_size,
+            double microseconds);
+
+        /**
+        Loads measurements from the output of sealbench in CSV format (e.g., from running sealbench with
+        --benchmark_format=csv). Benchmarks that do not correspond to an operation of he_op_type are ignored, as are
+        lines that are not benchmark results. Returns the number of measurements that were added.
+
+        @param[in] stream The stream to load the measurements from
+        @throws std::invalid_argument if a benchmark result is malformed
+        */
+        std::size_t load_benchmark_csv(std::istream &stream);
+
+        /**
+        Returns the predicted latency in microseconds of an operation on ciphertexts with the given parameters.
+
+        @param[in] scheme The encryption scheme
+        @param[in] op The operation
+        @param[in] poly_modulus_degree The degree of the polynomial modulus
+        @param[in] coeff_modulus_size The number of primes in the coefficient modulus of the ciphertexts
+        @throws std::invalid_argument if scheme is not BFV, CKKS, or BGV, or if poly_modulus_degree or
+        coeff_modulus_size is zero
+        */
+        SEAL_NODISCARD double predict(
+            scheme_type scheme, he_op_type op, std::size_t poly_modulus_degree, std::size_t coeff_modulus_size) const;
+
+    private:
+        static constexpr std::size_t op_count_ = 8;
+
+        static constexpr std::size_t scheme_count_ = 3;
+
+        // Returns the asymptotic cost of an operation, up to the proportionality constant
+        static double cost(he_op_type op, std::size_t poly_modulus_degree, std::size_t coeff_modulus_size);
+
+        // Constants are fitted in log-space, i.e., they are geometric means of measured latency per unit cost
+        std::array<std::array<double, op_count_>, scheme_count_> log_constants_;
+
+        std::array<std::array<double, op_count_>, scheme_count_> log_ratio_sums_{};
+
+        std::array<std::array<std::size_t, op_count_>, scheme_count_> measurement_counts_{};
+    };
+
+    /**
+    Describes a computation for which ParameterSelector chooses encryption parameters.
+    */
+    struct CircuitRequirements
+    {
+        /**
+        The encryption scheme.
+        */
+        scheme_type scheme = scheme_type::bfv;
+
+        /**
+        The number of sequential ciphertext-ciphertext multiplications.
+        */
+        std::size_t multiplicative_depth = 1;
+
+        /**
+        The bit size of the batching plaintext modulus (BFV and BGV only).
+        */
+        int plain_modulus_bit_count = 20;
+
+        /**
+        The number of fractional bits of precision required for the decrypted result (CKKS only).
+        */
+        int precision_bit_count = 20;
+
+        /**
+        The number of bits of the integer part of the values (CKKS only).
+        */
+        int integer_bit_count = 20;
+
+        /**
+        The security level according to HomomorphicEncryption.org security standard.
+        */
+        sec_level_type sec_level = sec_level_type::tc128;
+    };
+
+    /**
+    Stores encryption parameters chosen by ParameterSelector together with predictions of their performance.
+    */
+    struct ParameterSelection
+    {
+        /**
+        The encryption parameters.
+        */
+        EncryptionParameters parms;
+
+        /**
+        The scale to encode inputs with (CKKS only).
+        */
+        double scale = 0.0;
+
+        /**
+        The estimated noise budget in bits at the end of the computation (BFV and BGV only).
+        */
+        int noise_budget = 0;
+
+        /**
+        The predicted latency in microseconds of every operation at the first level.
+        */
+        std::map<he_op_type, double> latency;
+    };
+
+    /**
+    Chooses encryption parameters for a computation of given multiplicative depth. Among the degrees of the
+    polynomial modulus that fit the required coefficient modulus within the bound of the HomomorphicEncryption.org
+    security standard, the smallest one is chosen, and the prime sizes are chosen to be as small as possible for it.
+
+    For BFV and BGV, the coefficient modulus is sized with the noise estimates that Evaluator tracks for ciphertexts
+    (see Ciphertext::noise_estimate), simulating a chain of multiplications, each followed by relinearization and,
+    for BGV, by switching to the next level. The plaintext modulus is a batching prime. For CKKS, the coefficient
+    modulus consists of a first prime for the integer part and the scale, one prime of the size of the scale per
+    multiplication, and a special prime. The scale is chosen so that the error after the computation, which grows
+    with the degree of the polynomial modulus, stays below the required precision.
+
+    The coefficient modulus always contains a special prime, so relinearization and rotation keys can be created.
+
+    @par Thread Safety
+    In general, reading from ParameterSelector is thread-safe as long as no other thread is concurrently mutating
+    it.
+    */
+    class ParameterSelector
+    {
+    public:
+        /**
+        Creates a ParameterSelector with the reference latency model.
+        */
+        ParameterSelector() = default;
+
+        /**
+        Creates a ParameterSelector that predicts latencies with a given latency model.
+
+        @param[in] latency_model The latency model
+        */
+        explicit ParameterSelector(LatencyModel latency_model) : latency_model_(std::move(latency_model))
+        {}
+
+        /**
+        Chooses encryption parameters for a computation.
+
+        @param[in] requirements The requirements of the computation
+        @throws std::invalid_argument if requirements are invalid, or if no parameters within the security bound
+        satisfy them
+        */
+        SEAL_NODISCARD ParameterSelection select(const CircuitRequirements &requirements) const;
+
+        /**
+        Returns the latency model.
+        */
+        SEAL_NODISCARD inline const LatencyModel &latency_model() const noexcept
+        {
+            return latency_model_;
+        }
+
+        /**
+        Returns the latency model.
+        */
+        SEAL_NODISCARD inline LatencyModel &latency_model() noexcept
+        {
+            return latency_model_;
+        }
+
+    private:
+        LatencyModel latency_model_;
+    };
+} // namespace seal
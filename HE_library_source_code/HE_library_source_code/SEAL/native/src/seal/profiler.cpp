@@ -0,0 +1,60 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "seal/profiler.h"
+#include "seal/util/profiling.h"
+#include <stdexcept>
+
+using namespace std;
+using namespace seal::util;
+
+namespace seal
+{
+    namespace
+    {
+        const char *profile_event_names[profile_event_type_count] = {
+            "ntt_negacyclic_harvey", "inverse_ntt_negacyclic_harvey", "switch_key_inplace", "fast_convert_array",
+            "pool_allocation"
+        };
+    } // namespace
+
+    vector<ProfileCounters> Profiler::Snapshot()
+    {
+        vector<ProfileCounters> result;
+        result.reserve(profile_event_type_count);
+        for (size_t i = 0; i < profile_event_type_count; i++)
+        {
+            result.push_back(Snapshot(static_cast<profile_event_type>(i)));
+        }
+        return result;
+    }
+
+    ProfileCounters Profiler::Snapshot(profile_event_type event)
+    {
+        auto index = static_cast<size_t>(event);
+        if (index >= profile_event_type_count)
+        {
+            throw invalid_argument("invalid profile event");
+        }
+
+        auto &record = get_profile_record(event);
+        ProfileCounters result;
+        result.event = event;
+        result.name = profile_event_names[index];
+        result.call_count = record.call_count.load(memory_order_relaxed);
+        result.nanoseconds = record.nanoseconds.load(memory_order_relaxed);
+        result.allocated_byte_count = record.allocated_byte_count.load(memory_order_relaxed);
+        return result;
+    }
+
+    void Profiler::Reset() noexcept
+    {
+        for (size_t i = 0; i < profile_event_type_count; i++)
+        {
+            auto &record = get_profile_record(static_cast<profile_event_type>(i));
+            record.call_count.store(0, memory_order_relaxed);
+            record.nanoseconds.store(0, memory_order_relaxed);
+            record.allocated_byte_count.store(0, memory_order_relaxed);
+        }
+    }
+} // namespace seal
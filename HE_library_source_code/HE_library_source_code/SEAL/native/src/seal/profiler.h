@@ -0,0 +1,120 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+#include "seal/util/defines.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace seal
+{
+    /**
+    The primitives instrumented by Profiler.
+    */
+    enum class profile_event_type : std::uint8_t
+    {
+        // Forward negacyclic NTT of one polynomial modulo one prime (ntt_negacyclic_harvey and its lazy variant)
+        ntt = 0x0,
+
+        // Inverse negacyclic NTT of one polynomial modulo one prime
+        inverse_ntt = 0x1,
+
+        // Key switching of one polynomial (Evaluator::switch_key_inplace), i.e., one relinearization step or Galois
+        // automorphism
+        switch_key = 0x2,
+
+        // Fast RNS base conversion of one polynomial (BaseConverter::fast_convert_array)
+        fast_convert_array = 0x3,
+
+        // Allocation from a memory pool
+        pool_allocation = 0x4
+    };
+
+    /**
+    The number of values of profile_event_type.
+    */
+    constexpr std::size_t profile_event_type_count = 5;
+
+    /**
+    The counters of one instrumented primitive.
+    */
+    struct ProfileCounters
+    {
+        /**
+        The primitive.
+        */
+        profile_event_type event = profile_event_type::ntt;
+
+        /**
+        The name of the primitive, as used by the instrumented function.
+        */
+        std::string name;
+
+        /**
+        The number of calls. Nested calls of the same primitive, e.g., a lazy NTT called by a full NTT, are counted
+        once.
+        */
+        std::uint64_t call_count = 0;
+
+        /**
+        The wall-clock time spent in the primitive in nanoseconds, including nested primitives. This is zero for
+        pool_allocation.
+        */
+        std::uint64_t nanoseconds = 0;
+
+        /**
+        The number of bytes requested from memory pools. Allocations are attributed to the innermost instrumented
+        primitive running on the same thread, and all of them to pool_allocation.
+        */
+        std::uint64_t allocated_byte_count = 0;
+    };
+
+    /**
+    Provides low-overhead counters of calls, time and memory pool allocations for the performance critical primitives
+    of Microsoft SEAL, which show where the time of a computation goes (e.g., NTTs versus key switching versus base
+    conversion). The counters are only collected when Microsoft SEAL is built with the CMake option
+    SEAL_USE_PROFILING; otherwise the instrumentation compiles to nothing and all counters remain zero.
+
+    @par Thread Safety
+    The counters are global and updated atomically by all threads, so Snapshot can be called at any time, e.g., by
+    a monitoring thread. A snapshot taken during a computation is not necessarily consistent across primitives.
+    */
+    class Profiler
+    {
+    public:
+        Profiler() = delete;
+
+        /**
+        Returns whether the counters are collected, i.e., whether Microsoft SEAL was built with SEAL_USE_PROFILING.
+        */
+        SEAL_NODISCARD static constexpr bool IsEnabled() noexcept
+        {
+#ifdef SEAL_USE_PROFILING
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        /**
+        Returns the current counters of all primitives, ordered by profile_event_type.
+        */
+        SEAL_NODISCARD static std::vector<ProfileCounters> Snapshot();
+
+        /**
+        Returns the current counters of one primitive.
+
+        @param[in] event The primitive
+        @throws std::invalid_argument if event is not a valid profile_event_type
+        */
+        SEAL_NODISCARD static ProfileCounters Snapshot(profile_event_type event);
+
+        /**
+        Resets all counters to zero.
+        */
+        static void Reset() noexcept;
+    };
+} // namespace seal
@@ -4,8 +4,10 @@
 #pragma once
 
 #include "seal/batchencoder.h"
+#include "seal/bootstrapper.h"
 #include "seal/ciphertext.h"
 #include "seal/ckks.h"
+#include "seal/compactciphertext.h"
 #include "seal/context.h"
 #include "seal/decryptor.h"
 #include "seal/dynarray.h"
@@ -16,7 +18,9 @@
 #include "seal/keygenerator.h"
 #include "seal/memorymanager.h"
 #include "seal/modulus.h"
+#include "seal/paramselector.h"
 #include "seal/plaintext.h"
+#include "seal/profiler.h"
 #include "seal/publickey.h"
 #include "seal/randomgen.h"
 #include "seal/randomtostd.h"
@@ -0,0 +1,183 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "seal/util/common.h"
+#include "seal/util/lazyaccumulator.h"
+#include "seal/util/uintarith.h"
+#include "seal/util/uintarithsmallmod.h"
+#include "seal/util/uintcore.h"
+#include <algorithm>
+#include <stdexcept>
+
+#ifdef SEAL_USE_AVX512IFMA
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace seal
+{
+    namespace util
+    {
+        namespace
+        {
+            // The IFMA instructions multiply the low 52 bits of their operands
+            constexpr int ifma_bit_count = 52;
+
+#ifdef SEAL_USE_AVX512IFMA
+            __attribute__((target("avx512f,avx512ifma"))) void multiply_accumulate_avx512ifma(
+                const uint64_t *operand1, const uint64_t *operand2, size_t coeff_count, uint64_t *sums_lo,
+                uint64_t *sums_hi)
+            {
+                size_t i = 0;
+                for (; i + 8 <= coeff_count; i += 8)
+                {
+                    __m512i a = _mm512_loadu_si512(operand1 + i);
+                    __m512i b = _mm512_loadu_si512(operand2 + i);
+                    __m512i lo = _mm512_loadu_si512(sums_lo + i);
+                    __m512i hi = _mm512_loadu_si512(sums_hi + i);
+                    _mm512_storeu_si512(sums_lo + i, _mm512_madd52lo_epu64(lo, a, b));
+                    _mm512_storeu_si512(sums_hi + i, _mm512_madd52hi_epu64(hi, a, b));
+                }
+                if (i < coeff_count)
+                {
+                    auto mask = static_cast<__mmask8>((1U << (coeff_count - i)) - 1);
+                    __m512i a = _mm512_maskz_loadu_epi64(mask, operand1 + i);
+                    __m512i b = _mm512_maskz_loadu_epi64(mask, operand2 + i);
+                    __m512i lo = _mm512_maskz_loadu_epi64(mask, sums_lo + i);
+                    __m512i hi = _mm512_maskz_loadu_epi64(mask, sums_hi + i);
+                    _mm512_mask_storeu_epi64(sums_lo + i, mask, _mm512_madd52lo_epu64(lo, a, b));
+                    _mm512_mask_storeu_epi64(sums_hi + i, mask, _mm512_madd52hi_epu64(hi, a, b));
+                }
+            }
+#endif
+        } // namespace
+
+        bool has_avx512ifma() noexcept
+        {
+#ifdef SEAL_USE_AVX512IFMA
+            static const bool result = [] {
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("avx512ifma") != 0;
+            }();
+            return result;
+#else
+            return false;
+#endif
+        }
+
+        LazyProductAccumulator::LazyProductAccumulator(
+            size_t coeff_count, const Modulus &modulus, MemoryPoolHandle pool)
+            : coeff_count_(coeff_count), modulus_(modulus)
+        {
+            if (!coeff_count)
+            {
+                throw invalid_argument("coeff_count cannot be zero");
+            }
+            if (modulus.is_zero())
+            {
+                throw invalid_argument("modulus cannot be zero");
+            }
+            if (!pool)
+            {
+                throw invalid_argument("pool is uninitialized");
+            }
+
+            // The first operand is less than 4 * modulus, so products have at most 2 * bit_count + 2 bits
+            int operand_bit_count = modulus.bit_count() + 2;
+            if (operand_bit_count <= ifma_bit_count && has_avx512ifma())
+            {
+                // Both halves of a product have at most 52 bits, so 2^12 of them fit in 64 bits
+                use_avx512ifma_ = true;
+                summand_bound_ = size_t(1) << (64 - ifma_bit_count);
+            }
+            else
+            {
+                summand_bound_ = size_t(1) << min(128 - 2 * operand_bit_count + 2, 30);
+            }
+            sums_ = allocate_zero_uint(mul_safe(coeff_count, size_t(2)), pool);
+        }
+
+        void LazyProductAccumulator::multiply_accumulate(ConstCoeffIter operand1, ConstCoeffIter operand2)
+        {
+#ifdef SEAL_DEBUG
+            if (!operand1)
+            {
+                throw invalid_argument("operand1");
+            }
+            if (!operand2)
+            {
+                throw invalid_argument("operand2");
+            }
+#endif
+            if (summand_count_ == summand_bound_)
+            {
+                fold();
+            }
+
+            uint64_t *sums_lo = sums_.get();
+            uint64_t *sums_hi = sums_lo + coeff_count_;
+#ifdef SEAL_USE_AVX512IFMA
+            if (use_avx512ifma_)
+            {
+                multiply_accumulate_avx512ifma(operand1, operand2, coeff_count_, sums_lo, sums_hi);
+                summand_count_++;
+                return;
+            }
+#endif
+            SEAL_ITERATE(iter(operand1, operand2, sums_lo, sums_hi), coeff_count_, [&](auto I) {
+                unsigned long long product[2]{ 0, 0 };
+                multiply_uint64(get<0>(I), get<1>(I), product);
+                unsigned long long sum_lo;
+                unsigned char carry = add_uint64(get<2>(I), product[0], &sum_lo);
+                get<2>(I) = sum_lo;
+                get<3>(I) += product[1] + carry;
+            });
+            summand_count_++;
+        }
+
+        void LazyProductAccumulator::reduce(CoeffIter result)
+        {
+#ifdef SEAL_DEBUG
+            if (!result)
+            {
+                throw invalid_argument("result");
+            }
+#endif
+            reduce_sums(result);
+            set_zero_uint(mul_safe(coeff_count_, size_t(2)), sums_.get());
+            summand_count_ = 0;
+        }
+
+        void LazyProductAccumulator::reduce_sums(CoeffIter result) const
+        {
+            const uint64_t *sums_lo = sums_.get();
+            const uint64_t *sums_hi = sums_lo + coeff_count_;
+            if (use_avx512ifma_)
+            {
+                // The sum is sums_lo + sums_hi * 2^52
+                SEAL_ITERATE(iter(sums_lo, sums_hi, result), coeff_count_, [&](auto I) {
+                    unsigned long long sum[2];
+                    unsigned char carry = add_uint64(get<0>(I), get<1>(I) << ifma_bit_count, sum);
+                    sum[1] = (get<1>(I) >> (64 - ifma_bit_count)) + carry;
+                    get<2>(I) = barrett_reduce_128(sum, modulus_);
+                });
+            }
+            else
+            {
+                SEAL_ITERATE(iter(sums_lo, sums_hi, result), coeff_count_, [&](auto I) {
+                    unsigned long long sum[2]{ get<0>(I), get<1>(I) };
+                    get<2>(I) = barrett_reduce_128(sum, modulus_);
+                });
+            }
+        }
+
+        void LazyProductAccumulator::fold()
+        {
+            // A reduced sum has a zero high word in either representation
+            reduce_sums(sums_.get());
+            set_zero_uint(coeff_count_, sums_.get() + coeff_count_);
+            summand_count_ = 1;
+        }
+    } // namespace util
+} // namespace seal
@@ -0,0 +1,89 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+#include "seal/memorymanager.h"
+#include "seal/modulus.h"
+#include "seal/util/defines.h"
+#include "seal/util/iterator.h"
+#include "seal/util/pointer.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace seal
+{
+    namespace util
+    {
+        /**
+        Returns true if the CPU supports the AVX-512 IFMA instructions and SEAL was built to use them.
+        */
+        SEAL_NODISCARD bool has_avx512ifma() noexcept;
+
+        /**
+        Accumulates sums of coefficient-wise products of polynomials modulo a small modulus, as in the inner product of
+        key switching, and reduces the sums only when they could overflow. The sums are held in two 64-bit words per
+        coefficient. On CPUs with AVX-512 IFMA, moduli of at most 50 bits are handled with 52-bit multiply-add
+        instructions eight coefficients at a time, and the words hold the low and high 52-bit halves of the products.
+        Otherwise the words hold the 128-bit sums.
+        */
+        class LazyProductAccumulator
+        {
+        public:
+            /**
+            Creates a LazyProductAccumulator with all sums set to zero.
+
+            @param[in] coeff_count The number of coefficients of the polynomials
+            @param[in] modulus The modulus
+            @param[in] pool The MemoryPoolHandle pointing to a valid memory pool
+            @throws std::invalid_argument if coeff_count is zero, modulus is zero, or pool is uninitialized
+            */
+            LazyProductAccumulator(std::size_t coeff_count, const Modulus &modulus, MemoryPoolHandle pool);
+
+            /**
+            Adds the coefficient-wise product of two polynomials to the sums. The coefficients of operand1 must be
+            less than 4 * modulus (e.g., the output of a lazy NTT) and the coefficients of operand2 must be less than
+            modulus.
+
+            @param[in] operand1 The first polynomial
+            @param[in] operand2 The second polynomial
+            */
+            void multiply_accumulate(ConstCoeffIter operand1, ConstCoeffIter operand2);
+
+            /**
+            Writes the sums reduced modulo modulus to result and sets them to zero.
+
+            @param[out] result The polynomial to overwrite with the reduced sums
+            */
+            void reduce(CoeffIter result);
+
+            /**
+            Returns true if the sums are accumulated with AVX-512 IFMA instructions.
+            */
+            SEAL_NODISCARD inline bool uses_avx512ifma() const noexcept
+            {
+                return use_avx512ifma_;
+            }
+
+        private:
+            // Writes the reduced sums to result, which may alias the low words of the sums
+            void reduce_sums(CoeffIter result) const;
+
+            // Reduces the sums in place so that further products can be added
+            void fold();
+
+            std::size_t coeff_count_;
+
+            Modulus modulus_;
+
+            bool use_avx512ifma_ = false;
+
+            std::size_t summand_bound_;
+
+            std::size_t summand_count_ = 0;
+
+            // The first coeff_count_ words hold the low words of the sums, followed by the high words
+            Pointer<std::uint64_t> sums_;
+        };
+    } // namespace util
+} // namespace seal
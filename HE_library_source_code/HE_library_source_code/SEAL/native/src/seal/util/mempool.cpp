@@ -3,6 +3,7 @@
 
 #include "seal/util/common.h"
 #include "seal/util/mempool.h"
+#include "seal/util/profiling.h"
 #include "seal/util/uintarith.h"
 #include <cmath>
 #include <numeric>
@@ -26,6 +27,14 @@ namespace seal
         // ensure symbol is created.
         constexpr size_t MemoryPool::first_alloc_count;
 
+        // Required for C++14 compliance: static constexpr member variables are not necessarily inlined so need to
+        // ensure symbol is created.
+        constexpr size_t MemoryPoolArena::default_chunk_byte_count;
+
+        // Required for C++14 compliance: static constexpr member variables are not necessarily inlined so need to
+        // ensure symbol is created.
+        constexpr size_t MemoryPoolArena::item_alignment;
+
         MemoryPoolHeadMT::MemoryPoolHeadMT(size_t item_byte_count, bool clear_on_destruction)
             : clear_on_destruction_(clear_on_destruction), locked_(false), item_byte_count_(item_byte_count),
               item_count_(MemoryPool::first_alloc_count), first_item_(nullptr)
@@ -347,6 +356,7 @@ namespace seal
             {
                 return Pointer<seal_byte>();
             }
+            SEAL_PROFILE_ALLOCATION(byte_count);
 
             // Attempt to find size.
             ReaderLock reader_lock(pools_locker_.acquire_read());
@@ -443,6 +453,7 @@ namespace seal
             {
                 return Pointer<seal_byte>();
             }
+            SEAL_PROFILE_ALLOCATION(byte_count);
 
             // Attempt to find size.
             size_t start = 0;
@@ -492,5 +503,168 @@ namespace seal
                 return add_safe(byte_count, mul_safe(head->item_count(), head->item_byte_count()));
             });
         }
+
+        MemoryPoolItem *MemoryPoolHeadArena::get()
+        {
+            MemoryPoolItem *item = first_item_;
+            if (item)
+            {
+                first_item_ = item->next();
+                item->next() = nullptr;
+            }
+            else
+            {
+                item = arena_.allocate_item(item_byte_count_);
+                item_count_++;
+            }
+            arena_.live_item_count_++;
+            return item;
+        }
+
+        void MemoryPoolHeadArena::add(MemoryPoolItem *new_first) noexcept
+        {
+            new_first->next() = first_item_;
+            first_item_ = new_first;
+            arena_.live_item_count_--;
+        }
+
+        MemoryPoolArena::MemoryPoolArena(size_t chunk_byte_count, bool clear_on_destruction)
+            : chunk_byte_count_(chunk_byte_count), clear_on_destruction_(clear_on_destruction)
+        {
+            if (chunk_byte_count_ == 0 || chunk_byte_count_ > max_batch_alloc_byte_count)
+            {
+                throw invalid_argument("invalid chunk size");
+            }
+        }
+
+        MemoryPoolArena::~MemoryPoolArena() noexcept
+        {
+            for (MemoryPoolHead *head : pools_)
+            {
+                delete head;
+            }
+            pools_.clear();
+
+            for (auto &c : chunks_)
+            {
+                if (clear_on_destruction_)
+                {
+                    seal_memzero(c.data_ptr, c.byte_count);
+                }
+                SEAL_FREE(c.data_ptr);
+            }
+            chunks_.clear();
+        }
+
+        MemoryPoolItem *MemoryPoolArena::allocate_item(size_t item_byte_count)
+        {
+            static_assert(sizeof(MemoryPoolItem) <= item_alignment, "MemoryPoolItem does not fit in its header");
+
+            // Each item is a header holding the MemoryPoolItem followed by the data, both aligned to item_alignment
+            size_t byte_count =
+                add_safe(item_alignment, add_safe(item_byte_count, item_alignment - 1) & ~(item_alignment - 1));
+            auto padding_of = [](const seal_byte *ptr) {
+                return (item_alignment - reinterpret_cast<uintptr_t>(ptr) % item_alignment) % item_alignment;
+            };
+
+            // Move on to the first chunk, from the current one on, that has enough space
+            for (; current_chunk_ < chunks_.size(); current_chunk_++)
+            {
+                auto &c = chunks_[current_chunk_];
+                size_t padding = padding_of(c.data_ptr + c.used_byte_count);
+                if (c.byte_count - c.used_byte_count >= add_safe(padding, byte_count))
+                {
+                    break;
+                }
+            }
+            if (current_chunk_ == chunks_.size())
+            {
+                chunk new_chunk;
+                new_chunk.byte_count = max(chunk_byte_count_, add_safe(byte_count, item_alignment));
+                new_chunk.data_ptr = SEAL_MALLOC(new_chunk.byte_count);
+                if (new_chunk.data_ptr == nullptr)
+                {
+                    throw bad_alloc();
+                }
+                new_chunk.used_byte_count = 0;
+                chunks_.push_back(new_chunk);
+            }
+
+            auto &c = chunks_[current_chunk_];
+            seal_byte *header = c.data_ptr + c.used_byte_count + padding_of(c.data_ptr + c.used_byte_count);
+            c.used_byte_count = static_cast<size_t>(header - c.data_ptr) + byte_count;
+            return new (header) MemoryPoolItem(header + item_alignment);
+        }
+
+        Pointer<seal_byte> MemoryPoolArena::get_for_byte_count(size_t byte_count)
+        {
+            if (byte_count > max_single_alloc_byte_count)
+            {
+                throw invalid_argument("invalid allocation size");
+            }
+            else if (byte_count == 0)
+            {
+                return Pointer<seal_byte>();
+            }
+            SEAL_PROFILE_ALLOCATION(byte_count);
+
+            // Attempt to find size.
+            size_t start = 0;
+            size_t end = pools_.size();
+            while (start < end)
+            {
+                size_t mid = (start + end) / 2;
+                MemoryPoolHead *mid_head = pools_[mid];
+                size_t mid_byte_count = mid_head->item_byte_count();
+                if (byte_count < mid_byte_count)
+                {
+                    start = mid + 1;
+                }
+                else if (byte_count > mid_byte_count)
+                {
+                    end = mid;
+                }
+                else
+                {
+                    return Pointer<seal_byte>(mid_head);
+                }
+            }
+
+            // Size was not found so just add it, but first check if we are at
+            // maximum pool head count already.
+            if (pools_.size() >= max_pool_head_count)
+            {
+                throw runtime_error("maximum pool head count reached");
+            }
+
+            MemoryPoolHead *new_head = new MemoryPoolHeadArena(byte_count, *this);
+            pools_.insert(pools_.begin() + static_cast<ptrdiff_t>(start), new_head);
+
+            return Pointer<seal_byte>(new_head);
+        }
+
+        size_t MemoryPoolArena::alloc_byte_count() const
+        {
+            return accumulate(chunks_.cbegin(), chunks_.cend(), size_t(0), [](size_t byte_count, const chunk &c) {
+                return add_safe(byte_count, c.byte_count);
+            });
+        }
+
+        void MemoryPoolArena::reset()
+        {
+            if (live_item_count_)
+            {
+                throw logic_error("memory allocated from the arena is still in use");
+            }
+            for (MemoryPoolHead *head : pools_)
+            {
+                static_cast<MemoryPoolHeadArena *>(head)->reset();
+            }
+            for (auto &c : chunks_)
+            {
+                c.used_byte_count = 0;
+            }
+            current_chunk_ = 0;
+        }
     } // namespace util
 } // namespace seal
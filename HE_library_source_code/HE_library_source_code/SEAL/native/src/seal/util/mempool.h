@@ -223,6 +223,12 @@ namespace seal
             virtual std::size_t pool_count() const = 0;
 
             virtual std::size_t alloc_byte_count() const = 0;
+
+            // Makes all memory available again; only supported by arena pools
+            virtual void reset()
+            {
+                throw std::logic_error("memory pool does not support reset");
+            }
         };
 
         class MemoryPoolMT : public MemoryPool
@@ -279,5 +285,124 @@ namespace seal
 
             std::vector<MemoryPoolHead *> pools_;
         };
+
+        class MemoryPoolArena;
+
+        class MemoryPoolHeadArena : public MemoryPoolHead
+        {
+        public:
+            // Creates a new MemoryPoolHeadArena; items are carved from the chunks of arena.
+            MemoryPoolHeadArena(std::size_t item_byte_count, MemoryPoolArena &arena) noexcept
+                : arena_(arena), item_byte_count_(item_byte_count)
+            {}
+
+            // The items live in the chunks of the arena, so there is nothing to delete
+            ~MemoryPoolHeadArena() noexcept override = default;
+
+            // Byte size of the allocations (items) owned by this pool
+            SEAL_NODISCARD inline std::size_t item_byte_count() const noexcept override
+            {
+                return item_byte_count_;
+            }
+
+            // Returns the total number of items allocated since the last reset
+            SEAL_NODISCARD inline std::size_t item_count() const noexcept override
+            {
+                return item_count_;
+            }
+
+            SEAL_NODISCARD MemoryPoolItem *get() override;
+
+            void add(MemoryPoolItem *new_first) noexcept override;
+
+            // Forgets all items; their memory is reused after the arena is rewound
+            inline void reset() noexcept
+            {
+                item_count_ = 0;
+                first_item_ = nullptr;
+            }
+
+        private:
+            MemoryPoolHeadArena(const MemoryPoolHeadArena &copy) = delete;
+
+            MemoryPoolHeadArena &operator=(const MemoryPoolHeadArena &assign) = delete;
+
+            MemoryPoolArena &arena_;
+
+            const std::size_t item_byte_count_;
+
+            std::size_t item_count_ = 0;
+
+            MemoryPoolItem *first_item_ = nullptr;
+        };
+
+        // A single-threaded memory pool for short-lived data, e.g., the temporaries of one request. New items are
+        // carved from large chunks with a bump pointer and released items are kept for reuse by allocations of the
+        // same size, so that no allocation reaches the system allocator once the chunks are large enough. The memory
+        // is only given back by reset, which rewinds all chunks for the next request, or by destruction.
+        class MemoryPoolArena : public MemoryPool
+        {
+            friend class MemoryPoolHeadArena;
+
+        public:
+            // Default byte size of a chunk
+            static constexpr std::size_t default_chunk_byte_count = std::size_t(1) << 24;
+
+            // Alignment of every item in bytes
+            static constexpr std::size_t item_alignment = 64;
+
+            MemoryPoolArena(
+                std::size_t chunk_byte_count = default_chunk_byte_count, bool clear_on_destruction = false);
+
+            ~MemoryPoolArena() noexcept override;
+
+            SEAL_NODISCARD Pointer<seal_byte> get_for_byte_count(std::size_t byte_count) override;
+
+            SEAL_NODISCARD inline std::size_t pool_count() const override
+            {
+                return pools_.size();
+            }
+
+            SEAL_NODISCARD std::size_t alloc_byte_count() const override;
+
+            // Makes all memory available again; throws std::logic_error if any item is still in use
+            void reset() override;
+
+            // Number of items handed out and not yet released
+            SEAL_NODISCARD inline std::size_t live_item_count() const noexcept
+            {
+                return live_item_count_;
+            }
+
+        protected:
+            MemoryPoolArena(const MemoryPoolArena &copy) = delete;
+
+            MemoryPoolArena &operator=(const MemoryPoolArena &assign) = delete;
+
+        private:
+            struct chunk
+            {
+                seal_byte *data_ptr;
+
+                std::size_t byte_count;
+
+                std::size_t used_byte_count;
+            };
+
+            // Carves a new item with item_byte_count bytes of data from the chunks
+            MemoryPoolItem *allocate_item(std::size_t item_byte_count);
+
+            const std::size_t chunk_byte_count_;
+
+            const bool clear_on_destruction_;
+
+            std::vector<chunk> chunks_;
+
+            std::size_t current_chunk_ = 0;
+
+            std::size_t live_item_count_ = 0;
+
+            std::vector<MemoryPoolHead *> pools_;
+        };
     } // namespace util
 } // namespace seal
@@ -0,0 +1,324 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "seal/util/globals.h"
+#include "seal/util/noiseestimate.h"
+#include "seal/util/uintarithsmallmod.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+using namespace std;
+
+namespace seal
+{
+    namespace util
+    {
+        namespace
+        {
+            // Noise bounds are taken at this many standard deviations
+            constexpr double noise_tail_multiplier = 6.0;
+
+            inline bool is_tracked(const SEALContext::ContextData &context_data)
+            {
+                auto scheme = context_data.parms().scheme();
+                return scheme == scheme_type::bfv || scheme == scheme_type::bgv;
+            }
+
+            // Computes log2(2^a + 2^b) without overflow
+            inline double log2_sum(double a, double b)
+            {
+                double hi = max(a, b);
+                double lo = min(a, b);
+                return hi + log2(1.0 + exp2(lo - hi));
+            }
+
+            inline double to_log2_std(double noise)
+            {
+                return noise - log2(noise_tail_multiplier);
+            }
+
+            inline double from_log2_std(double log2_std)
+            {
+                // Never report a noise bound below one; this also keeps zero free to mean "no estimate"
+                return max(log2_std + log2(noise_tail_multiplier), 1.0);
+            }
+
+            double log2_modulus(const vector<Modulus> &coeff_modulus)
+            {
+                double result = 0;
+                for (auto &mod : coeff_modulus)
+                {
+                    result += log2(static_cast<double>(mod.value()));
+                }
+                return result;
+            }
+
+            // Rounding errors in BFV are centered, whereas in BGV they are multiples of t that are only congruent to
+            // the exact value modulo t and have a bias of one half after scaling down by t.
+            inline double rounding_second_moment(const SEALContext::ContextData &context_data)
+            {
+                return context_data.parms().scheme() == scheme_type::bgv ? 1.0 / 3.0 : 1.0 / 12.0;
+            }
+
+            // Dividing by a product of several primes uses fast base conversion, which adds an integer error of less
+            // than the number of primes to the rounding error
+            inline double division_second_moment(const SEALContext::ContextData &context_data, size_t prime_count)
+            {
+                double base_conversion_error = static_cast<double>(prime_count - 1);
+                return rounding_second_moment(context_data) + base_conversion_error * base_conversion_error / 3.0;
+            }
+
+            // Returns log2 of the standard deviation of a coefficient of tau_0 + tau_1 * s + ... + tau_{size-1} *
+            // s^{size-1}, where the tau_j have independent coefficients with given second moment and s is the ternary
+            // secret key. This also bounds the quotient of c(s) by q for uniformly random ciphertext polynomials.
+            double rounding_noise_log2_std(size_t poly_modulus_degree, size_t size, double second_moment)
+            {
+                double variance = 0;
+                double term = second_moment;
+                for (size_t j = 0; j < size; j++)
+                {
+                    variance += term;
+                    term *= 2.0 * static_cast<double>(poly_modulus_degree) / 3.0;
+                }
+                return 0.5 * log2(variance);
+            }
+        } // namespace
+
+        double estimate_fresh_noise(const SEALContext::ContextData &context_data, bool is_asymmetric)
+        {
+            if (!is_tracked(context_data))
+            {
+                return 0;
+            }
+
+            auto &parms = context_data.parms();
+            double coeff_count = static_cast<double>(parms.poly_modulus_degree());
+            double log2_sigma = log2(global_variables::noise_standard_deviation);
+            if (!is_asymmetric)
+            {
+                return from_log2_std(log2_sigma);
+            }
+
+            // Public key encryption has noise e * u + e_1 + e_2 * s
+            double log2_std = log2_sigma + 0.5 * log2(4.0 * coeff_count / 3.0 + 1.0);
+
+            auto prev_context_data_ptr = context_data.prev_context_data();
+            if (prev_context_data_ptr)
+            {
+                // Encryption happens at the previous level and is followed by modulus switching, which drops all
+                // special primes at once with hybrid key switching
+                auto &prev_coeff_modulus = prev_context_data_ptr->parms().coeff_modulus();
+                size_t dropped_prime_count = prev_coeff_modulus.size() - parms.coeff_modulus().size();
+                log2_std = log2_sum(
+                    log2_std - log2_modulus(prev_coeff_modulus) + log2_modulus(parms.coeff_modulus()),
+                    rounding_noise_log2_std(
+                        parms.poly_modulus_degree(), 2, division_second_moment(context_data, dropped_prime_count)));
+            }
+            return from_log2_std(log2_std);
+        }
+
+        double estimate_add_noise(double noise1, double noise2)
+        {
+            if (noise1 <= 0 || noise2 <= 0)
+            {
+                return 0;
+            }
+
+            // Operands are often correlated (e.g., x + x), so add the bounds
+            return log2_sum(noise1, noise2);
+        }
+
+        double estimate_multiply_scalar_noise(double noise, uint64_t scalar, const Modulus &plain_modulus)
+        {
+            if (noise <= 0)
+            {
+                return 0;
+            }
+
+            scalar = barrett_reduce_64(scalar, plain_modulus);
+            uint64_t centered = min(scalar, plain_modulus.value() - scalar);
+            return noise + log2(static_cast<double>(max<uint64_t>(centered, 1)));
+        }
+
+        double estimate_add_plain_noise(const SEALContext::ContextData &context_data, double noise)
+        {
+            if (noise <= 0 || !is_tracked(context_data))
+            {
+                return 0;
+            }
+
+            // BFV adds the rounding error of Delta * m and BGV adds m / t; both are at most one half
+            return log2_sum(noise, -1.0);
+        }
+
+        double estimate_multiply_plain_noise(
+            const SEALContext::ContextData &context_data, double noise, const Plaintext &plain)
+        {
+            if (noise <= 0 || !is_tracked(context_data))
+            {
+                return 0;
+            }
+
+            auto &parms = context_data.parms();
+            double plain_modulus = static_cast<double>(parms.plain_modulus().value());
+
+            // Each coefficient of e * p is a signed sum of products e_i * p_j, so its standard deviation grows with
+            // the Euclidean norm of p
+            double norm_squared = 0;
+            if (plain.is_ntt_form())
+            {
+                norm_squared = plain_modulus * plain_modulus * static_cast<double>(parms.poly_modulus_degree()) / 12.0;
+            }
+            else
+            {
+                uint64_t modulus = parms.plain_modulus().value();
+                for (size_t i = 0; i < plain.coeff_count(); i++)
+                {
+                    double centered = static_cast<double>(min(plain[i], modulus - plain[i]));
+                    norm_squared += centered * centered;
+                }
+            }
+            return noise + 0.5 * log2(max(norm_squared, 1.0));
+        }
+
+        double estimate_multiply_noise(
+            const SEALContext::ContextData &context_data, double noise1, size_t size1, double noise2, size_t size2)
+        {
+            if (noise1 <= 0 || noise2 <= 0 || !is_tracked(context_data))
+            {
+                return 0;
+            }
+
+            auto &parms = context_data.parms();
+            size_t coeff_count = parms.poly_modulus_degree();
+            double log2_coeff_count = log2(static_cast<double>(coeff_count));
+            double log2_plain_modulus = log2(static_cast<double>(parms.plain_modulus().value()));
+            double log2_std1 = to_log2_std(noise1);
+            double log2_std2 = to_log2_std(noise2);
+
+            double log2_std = 0;
+            if (parms.scheme() == scheme_type::bgv)
+            {
+                // c_1(s) * c_2(s) = m_1 * m_2 + t * (m_1 * e_2 + m_2 * e_1) + t^2 * e_1 * e_2, where the last term
+                // dominates. The biased rounding errors in e_1 and e_2 are correlated through the secret key, so the
+                // product is bounded in the worst case.
+                log2_std = log2_plain_modulus + log2_coeff_count + log2_std1 + log2_std2;
+            }
+            else
+            {
+                // With c_i(s) = Delta * m_i + e_i + q * a_i the dominant terms are t * (a_1 * e_2 + a_2 * e_1)
+                double log2_a1 = rounding_noise_log2_std(coeff_count, size1, 1.0 / 12.0);
+                double log2_a2 = rounding_noise_log2_std(coeff_count, size2, 1.0 / 12.0);
+                log2_std = log2_plain_modulus + 0.5 * log2_coeff_count +
+                           log2_sum(log2_a1 + log2_std2, log2_a2 + log2_std1);
+
+                // Quadratic term t * e_1 * e_2 / q and the rounding error of the result
+                log2_std = log2_sum(
+                    log2_std, log2_plain_modulus + 0.5 * log2_coeff_count + log2_std1 + log2_std2 -
+                                  log2_modulus(parms.coeff_modulus()));
+                log2_std = log2_sum(log2_std, rounding_noise_log2_std(coeff_count, size1 + size2 - 1, 1.0 / 12.0));
+
+                // Allow one extra bit for the smaller terms neglected above (e.g., t * m_1 * e_2)
+                log2_std += 1.0;
+            }
+            return from_log2_std(log2_std);
+        }
+
+        double estimate_key_switch_noise(
+            const SEALContext &context, const SEALContext::ContextData &context_data, double noise)
+        {
+            if (noise <= 0 || !is_tracked(context_data))
+            {
+                return 0;
+            }
+
+            auto &parms = context_data.parms();
+            auto &coeff_modulus = parms.coeff_modulus();
+            size_t coeff_count = parms.poly_modulus_degree();
+            size_t special_prime_count = context.special_prime_count();
+            double log2_special_modulus = log2_modulus(context.key_context_data()->parms().coeff_modulus()) -
+                                          log2_modulus(context.first_context_data()->parms().coeff_modulus());
+
+            // The key switching keys add sum_j [c]_{D_j} * e_j for the digits D_j, which consist of one prime each
+            // unless hybrid key switching is used, and the sum is then divided by the special modulus. Digits are
+            // extended to the full modulus by fast base conversion, which adds a term for every prime in the digit.
+            double variance = 0;
+            for (size_t digit_begin = 0; digit_begin < coeff_modulus.size(); digit_begin += special_prime_count)
+            {
+                size_t digit_end = min(digit_begin + special_prime_count, coeff_modulus.size());
+                double log2_digit_modulus = 0;
+                for (size_t i = digit_begin; i < digit_end; i++)
+                {
+                    log2_digit_modulus += log2(static_cast<double>(coeff_modulus[i].value()));
+                }
+                double ratio = exp2(log2_digit_modulus - log2_special_modulus);
+                variance += static_cast<double>(digit_end - digit_begin) * ratio * ratio / 12.0;
+            }
+            variance *= static_cast<double>(coeff_count) * global_variables::noise_standard_deviation *
+                        global_variables::noise_standard_deviation;
+            double log2_std = log2_sum(
+                0.5 * log2(variance),
+                rounding_noise_log2_std(coeff_count, 2, division_second_moment(context_data, special_prime_count)));
+
+            return from_log2_std(log2_sum(to_log2_std(noise), log2_std));
+        }
+
+        double estimate_mod_switch_noise(const SEALContext::ContextData &context_data, double noise, size_t size)
+        {
+            if (noise <= 0 || !is_tracked(context_data))
+            {
+                return 0;
+            }
+            if (!context_data.next_context_data())
+            {
+                return noise;
+            }
+
+            // The noise is scaled down by the last prime and the rounding error is added
+            auto &parms = context_data.parms();
+            double log2_std = log2_sum(
+                to_log2_std(noise) - log2(static_cast<double>(parms.coeff_modulus().back().value())),
+                rounding_noise_log2_std(parms.poly_modulus_degree(), size, rounding_second_moment(context_data)));
+            return from_log2_std(log2_std);
+        }
+
+        double estimate_truncation_noise(
+            const SEALContext::ContextData &context_data, double noise, size_t size, int bit_count)
+        {
+            if (noise <= 0 || !is_tracked(context_data))
+            {
+                return 0;
+            }
+            if (bit_count <= 0)
+            {
+                return noise;
+            }
+
+            // The rounding errors are uniform in [-2^(bit_count - 1), 2^(bit_count - 1)]
+            double log2_std = log2_sum(
+                to_log2_std(noise),
+                rounding_noise_log2_std(
+                    context_data.parms().poly_modulus_degree(), size, exp2(2.0 * bit_count) / 12.0));
+            return from_log2_std(log2_std);
+        }
+
+        int estimate_noise_budget(const SEALContext::ContextData &context_data, double noise)
+        {
+            if (!is_tracked(context_data))
+            {
+                throw logic_error("unsupported scheme");
+            }
+            if (noise <= 0)
+            {
+                throw logic_error("no noise estimate available");
+            }
+
+            // Decryption is correct as long as the noise is less than q / (2 * t)
+            auto &parms = context_data.parms();
+            double budget = log2_modulus(parms.coeff_modulus()) -
+                            log2(static_cast<double>(parms.plain_modulus().value())) - 1.0 - noise;
+            return budget > 0 ? static_cast<int>(floor(budget)) : 0;
+        }
+    } // namespace util
+} // namespace seal
@@ -0,0 +1,93 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+#include "seal/context.h"
+#include "seal/modulus.h"
+#include "seal/plaintext.h"
+#include "seal/util/defines.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace seal
+{
+    namespace util
+    {
+        /*
+        Heuristic noise estimates for the BFV and BGV schemes that do not require the secret key. A noise estimate is
+        the estimated bit length of the infinity norm of the noise e, where a BFV ciphertext decrypts to
+        Delta * m + e and a BGV ciphertext decrypts to m + t * e. Noise coefficients are modeled as independent
+        random variables and the bound is taken at six standard deviations (average-case analysis), except where
+        noise terms are correlated: sums of ciphertexts and BGV products, whose rounding errors share a bias, are
+        bounded in the worst case.
+
+        A noise estimate of zero means that no estimate is available. All functions below propagate this, and
+        return zero for the CKKS scheme.
+        */
+
+        /**
+        Returns the noise estimate of a fresh encryption at the level given by context_data.
+        */
+        SEAL_NODISCARD double estimate_fresh_noise(const SEALContext::ContextData &context_data, bool is_asymmetric);
+
+        /**
+        Returns the noise estimate of a sum or a difference of two ciphertexts.
+        */
+        SEAL_NODISCARD double estimate_add_noise(double noise1, double noise2);
+
+        /**
+        Returns the noise estimate of a ciphertext multiplied by a scalar modulo the plaintext modulus.
+        */
+        SEAL_NODISCARD double estimate_multiply_scalar_noise(
+            double noise, std::uint64_t scalar, const Modulus &plain_modulus);
+
+        /**
+        Returns the noise estimate of a ciphertext after adding or subtracting a plaintext.
+        */
+        SEAL_NODISCARD double estimate_add_plain_noise(const SEALContext::ContextData &context_data, double noise);
+
+        /**
+        Returns the noise estimate of a ciphertext after multiplying with a plaintext. Plaintexts in NTT form are
+        assumed to have uniformly random coefficients.
+        */
+        SEAL_NODISCARD double estimate_multiply_plain_noise(
+            const SEALContext::ContextData &context_data, double noise, const Plaintext &plain);
+
+        /**
+        Returns the noise estimate of the product of two ciphertexts of given sizes.
+        */
+        SEAL_NODISCARD double estimate_multiply_noise(
+            const SEALContext::ContextData &context_data, double noise1, std::size_t size1, double noise2,
+            std::size_t size2);
+
+        /**
+        Returns the noise estimate of a ciphertext after one key switching operation (relinearization step or Galois
+        automorphism) at the level given by context_data.
+        */
+        SEAL_NODISCARD double estimate_key_switch_noise(
+            const SEALContext &context, const SEALContext::ContextData &context_data, double noise);
+
+        /**
+        Returns the noise estimate of a ciphertext of given size after modulus switching from the level given by
+        context_data to the next level.
+        */
+        SEAL_NODISCARD double estimate_mod_switch_noise(
+            const SEALContext::ContextData &context_data, double noise, std::size_t size);
+
+        /**
+        Returns the noise estimate of a ciphertext of given size at the level given by context_data after each of its
+        coefficients has been rounded to a multiple of 2^bit_count.
+        */
+        SEAL_NODISCARD double estimate_truncation_noise(
+            const SEALContext::ContextData &context_data, double noise, std::size_t size, int bit_count);
+
+        /**
+        Returns the estimated invariant noise budget in bits of a ciphertext with given noise estimate at the level
+        given by context_data, or zero if the estimate exceeds the budget.
+
+        @throws std::logic_error if no estimate is available or the scheme is not BFV or BGV
+        */
+        SEAL_NODISCARD int estimate_noise_budget(const SEALContext::ContextData &context_data, double noise);
+    } // namespace util
+} // namespace seal
@@ -2,6 +2,7 @@
 // Licensed under the MIT license.
 
 #include "seal/util/ntt.h"
+#include "seal/util/profiling.h"
 #include "seal/util/uintarith.h"
 #include "seal/util/uintarithsmallmod.h"
 #include <algorithm>
@@ -392,6 +393,7 @@ namespace seal
 
         void ntt_negacyclic_harvey_lazy(CoeffIter operand, const NTTTables &tables)
         {
+            SEAL_PROFILE_SCOPE(profile_event_type::ntt);
 #ifdef SEAL_USE_INTEL_HEXL
             size_t N = size_t(1) << tables.coeff_count_power();
             uint64_t p = tables.modulus().value();
@@ -406,6 +408,7 @@ namespace seal
 
         void ntt_negacyclic_harvey(CoeffIter operand, const NTTTables &tables)
         {
+            SEAL_PROFILE_SCOPE(profile_event_type::ntt);
 #ifdef SEAL_USE_INTEL_HEXL
             size_t N = size_t(1) << tables.coeff_count_power();
             uint64_t p = tables.modulus().value();
@@ -437,6 +440,7 @@ namespace seal
 
         void inverse_ntt_negacyclic_harvey_lazy(CoeffIter operand, const NTTTables &tables)
         {
+            SEAL_PROFILE_SCOPE(profile_event_type::inverse_ntt);
 #ifdef SEAL_USE_INTEL_HEXL
             size_t N = size_t(1) << tables.coeff_count_power();
             uint64_t p = tables.modulus().value();
@@ -451,6 +455,7 @@ namespace seal
 
         void inverse_ntt_negacyclic_harvey(CoeffIter operand, const NTTTables &tables)
         {
+            SEAL_PROFILE_SCOPE(profile_event_type::inverse_ntt);
 #ifdef SEAL_USE_INTEL_HEXL
             size_t N = size_t(1) << tables.coeff_count_power();
             uint64_t p = tables.modulus().value();
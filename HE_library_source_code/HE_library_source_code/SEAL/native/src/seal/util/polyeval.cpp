@@ -0,0 +1,148 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "seal/util/common.h"
+#include "seal/util/polyeval.h"
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+using namespace std;
+
+namespace seal
+{
+    namespace util
+    {
+        PatersonStockmeyerParams select_paterson_stockmeyer_params(size_t degree)
+        {
+            if (degree == 0)
+            {
+                throw invalid_argument("degree must be positive");
+            }
+
+            // Optimal depth is the bit count of degree, i.e., ceil(log2(degree + 1))
+            int depth = get_significant_bit_count(static_cast<uint64_t>(degree));
+
+            PatersonStockmeyerParams best;
+            size_t best_cost = numeric_limits<size_t>::max();
+            for (int baby_bits = 1; baby_bits <= depth; baby_bits++)
+            {
+                size_t baby_steps = size_t(1) << baby_bits;
+                size_t giant_steps = static_cast<size_t>(depth - baby_bits);
+
+                // Non-scalar multiplications: baby steps (up to the degree), giant steps, and one product for every
+                // inner node of the recursion tree.
+                size_t cost = min(baby_steps - 1, degree) - 1 + giant_steps + ((size_t(1) << giant_steps) - 1);
+                if (cost < best_cost)
+                {
+                    best_cost = cost;
+                    best.baby_steps = baby_steps;
+                    best.giant_steps = giant_steps;
+                }
+            }
+
+            return best;
+        }
+
+        void divide_chebyshev_series(
+            const vector<double> &coeffs, size_t divisor_degree, vector<double> &quotient, vector<double> &remainder)
+        {
+            if (divisor_degree == 0)
+            {
+                throw invalid_argument("divisor_degree must be positive");
+            }
+            if (coeffs.size() > 2 * divisor_degree)
+            {
+                throw invalid_argument("coeffs has too large degree");
+            }
+
+            auto coeff = [&](size_t index) { return index < coeffs.size() ? coeffs[index] : 0.0; };
+            auto trim = [](vector<double> &poly) {
+                while (poly.size() > 1 && poly.back() == 0.0)
+                {
+                    poly.pop_back();
+                }
+                if (poly.empty())
+                {
+                    poly.push_back(0.0);
+                }
+            };
+
+            // Since T_i * T_j = (T_{i + j} + T_{|i - j|}) / 2, writing coeffs = q * T_d + r gives q_0 = c_d,
+            // q_j = 2 * c_{d + j} for j > 0, and r_i = c_i - c_{2d - i} for i < d.
+            if (coeffs.size() <= divisor_degree)
+            {
+                quotient.assign(1, 0.0);
+                remainder = coeffs;
+            }
+            else
+            {
+                quotient.resize(coeffs.size() - divisor_degree);
+                quotient[0] = coeff(divisor_degree);
+                for (size_t j = 1; j < quotient.size(); j++)
+                {
+                    quotient[j] = 2.0 * coeff(divisor_degree + j);
+                }
+
+                remainder.resize(divisor_degree);
+                for (size_t i = 0; i < divisor_degree; i++)
+                {
+                    remainder[i] = coeff(i) - coeff(2 * divisor_degree - i);
+                }
+            }
+            trim(quotient);
+            trim(remainder);
+        }
+
+        vector<double> chebyshev_coefficients(
+            const function<double(double)> &func, double lower_bound, double upper_bound, size_t degree)
+        {
+            if (!(lower_bound < upper_bound))
+            {
+                throw invalid_argument("lower_bound must be less than upper_bound");
+            }
+
+            size_t node_count = add_safe(degree, size_t(1));
+            double half_width = (upper_bound - lower_bound) / 2;
+            double center = (upper_bound + lower_bound) / 2;
+
+            vector<double> samples(node_count);
+            for (size_t i = 0; i < node_count; i++)
+            {
+                double node = cos(acos(-1.0) * (static_cast<double>(i) + 0.5) / static_cast<double>(node_count));
+                samples[i] = func(center + half_width * node);
+            }
+
+            vector<double> result(node_count);
+            for (size_t j = 0; j < node_count; j++)
+            {
+                double sum = 0;
+                for (size_t i = 0; i < node_count; i++)
+                {
+                    sum += samples[i] * cos(
+                                            acos(-1.0) * static_cast<double>(j) * (static_cast<double>(i) + 0.5) /
+                                            static_cast<double>(node_count));
+                }
+                result[j] = 2.0 * sum / static_cast<double>(node_count);
+            }
+            result[0] /= 2;
+
+            return result;
+        }
+
+        double evaluate_chebyshev_series(
+            const vector<double> &coeffs, double lower_bound, double upper_bound, double value)
+        {
+            double y = (2 * value - lower_bound - upper_bound) / (upper_bound - lower_bound);
+            double b1 = 0;
+            double b2 = 0;
+            for (size_t i = coeffs.size(); i-- > 1;)
+            {
+                double b0 = coeffs[i] + 2 * y * b1 - b2;
+                b2 = b1;
+                b1 = b0;
+            }
+            return coeffs.empty() ? 0.0 : coeffs[0] + y * b1 - b2;
+        }
+    } // namespace util
+} // namespace seal
@@ -0,0 +1,197 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+#include "seal/util/common.h"
+#include "seal/util/defines.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace seal
+{
+    namespace util
+    {
+        /**
+        Splitting parameters for the Paterson-Stockmeyer algorithm. A polynomial of degree d is evaluated using the
+        baby-step basis elements 1, ..., baby_steps - 1 and the giant-step basis elements baby_steps * 2^j for
+        j = 0, ..., giant_steps - 1. The baby step count is always a power of two and baby_steps * 2^giant_steps > d.
+        */
+        struct PatersonStockmeyerParams
+        {
+            std::size_t baby_steps = 2;
+
+            std::size_t giant_steps = 0;
+        };
+
+        /**
+        Returns Paterson-Stockmeyer splitting parameters for a polynomial of given degree. Among all splittings that
+        reach the optimal multiplicative depth ceil(log2(degree + 1)) this selects the one with the least number of
+        non-scalar multiplications.
+
+        @param[in] degree The degree of the polynomial
+        @throws std::invalid_argument if degree is zero
+        */
+        SEAL_NODISCARD PatersonStockmeyerParams select_paterson_stockmeyer_params(std::size_t degree);
+
+        /**
+        Divides a polynomial given in the power basis by x^divisor_degree, i.e., computes quotient and remainder such
+        that coeffs = quotient * x^divisor_degree + remainder. Trailing zero coefficients are removed from both outputs
+        and a zero polynomial is represented by a single zero coefficient.
+        */
+        template <typename T>
+        void divide_power_series(
+            const std::vector<T> &coeffs, std::size_t divisor_degree, std::vector<T> &quotient,
+            std::vector<T> &remainder)
+        {
+            auto trim = [](std::vector<T> &poly) {
+                while (poly.size() > 1 && poly.back() == T(0))
+                {
+                    poly.pop_back();
+                }
+                if (poly.empty())
+                {
+                    poly.push_back(T(0));
+                }
+            };
+
+            if (coeffs.size() <= divisor_degree)
+            {
+                quotient.assign(1, T(0));
+                remainder = coeffs;
+            }
+            else
+            {
+                quotient.assign(coeffs.begin() + static_cast<std::ptrdiff_t>(divisor_degree), coeffs.end());
+                remainder.assign(coeffs.begin(), coeffs.begin() + static_cast<std::ptrdiff_t>(divisor_degree));
+            }
+            trim(quotient);
+            trim(remainder);
+        }
+
+        /**
+        Divides a polynomial given in the Chebyshev basis by T_divisor_degree, i.e., computes quotient and remainder
+        (both in the Chebyshev basis) such that coeffs = quotient * T_divisor_degree + remainder. The degree of coeffs
+        must be less than 2 * divisor_degree. Trailing zero coefficients are removed from both outputs and a zero
+        polynomial is represented by a single zero coefficient.
+
+        @throws std::invalid_argument if divisor_degree is zero or the degree of coeffs is too large
+        */
+        void divide_chebyshev_series(
+            const std::vector<double> &coeffs, std::size_t divisor_degree, std::vector<double> &quotient,
+            std::vector<double> &remainder);
+
+        /**
+        Divides a polynomial by x^divisor_degree or, if chebyshev is true, by T_divisor_degree. See
+        divide_power_series and divide_chebyshev_series.
+        */
+        inline void divide_series(
+            const std::vector<double> &coeffs, std::size_t divisor_degree, bool chebyshev,
+            std::vector<double> &quotient, std::vector<double> &remainder)
+        {
+            if (chebyshev)
+            {
+                divide_chebyshev_series(coeffs, divisor_degree, quotient, remainder);
+            }
+            else
+            {
+                divide_power_series(coeffs, divisor_degree, quotient, remainder);
+            }
+        }
+
+        /**
+        Divides a polynomial with integer coefficients by x^divisor_degree.
+
+        @throws std::logic_error if chebyshev is true
+        */
+        inline void divide_series(
+            const std::vector<std::uint64_t> &coeffs, std::size_t divisor_degree, bool chebyshev,
+            std::vector<std::uint64_t> &quotient, std::vector<std::uint64_t> &remainder)
+        {
+            if (chebyshev)
+            {
+                throw std::logic_error("Chebyshev basis is not supported for integer coefficients");
+            }
+            divide_power_series(coeffs, divisor_degree, quotient, remainder);
+        }
+
+        /**
+        Returns the highest level at which a polynomial can be evaluated with the Paterson-Stockmeyer algorithm, as
+        implemented by Evaluator, from a variable at variable_level. Every non-scalar multiplication consumes one
+        level; in CKKS (is_ckks set to true) linear combinations of basis elements are additionally computed one level
+        higher and then rescaled. The result may be negative.
+
+        @param[in] coeffs The coefficients of the polynomial in increasing order of degree
+        @param[in] params The Paterson-Stockmeyer splitting parameters for the degree of the polynomial
+        @param[in] chebyshev Whether coeffs are given in the Chebyshev basis
+        @param[in] is_ckks Whether linear combinations consume a level
+        @param[in] variable_level The level of the variable
+        */
+        template <typename T>
+        SEAL_NODISCARD long paterson_stockmeyer_max_level(
+            const std::vector<T> &coeffs, const PatersonStockmeyerParams &params, bool chebyshev, bool is_ckks,
+            long variable_level)
+        {
+            // Level of the i-th basis element when every multiplication consumes one level
+            auto basis_level = [variable_level](std::size_t index) {
+                return variable_level - get_significant_bit_count(static_cast<std::uint64_t>(index - 1));
+            };
+
+            std::size_t degree = coeffs.size() - 1;
+            long result = std::numeric_limits<long>::max();
+            if (degree < params.baby_steps)
+            {
+                for (std::size_t i = 1; i <= degree; i++)
+                {
+                    if (coeffs[i] != T(0))
+                    {
+                        result = std::min(result, basis_level(i) - (is_ckks ? 1 : 0));
+                    }
+                }
+                return result;
+            }
+
+            std::size_t giant = params.baby_steps;
+            while (giant * 2 <= degree)
+            {
+                giant *= 2;
+            }
+            std::vector<T> quotient;
+            std::vector<T> remainder;
+            divide_series(coeffs, giant, chebyshev, quotient, remainder);
+
+            result = basis_level(giant) - 1;
+            if (quotient.size() > 1)
+            {
+                result = std::min(
+                    result, paterson_stockmeyer_max_level(quotient, params, chebyshev, is_ckks, variable_level) - 1);
+            }
+            if (remainder.size() > 1)
+            {
+                result = std::min(
+                    result, paterson_stockmeyer_max_level(remainder, params, chebyshev, is_ckks, variable_level));
+            }
+            return result;
+        }
+
+        /**
+        Computes the coefficients of the Chebyshev interpolant of given degree for func on the interval
+        [lower_bound, upper_bound]. The interpolation nodes are the Chebyshev points of the first kind.
+
+        @throws std::invalid_argument if lower_bound is not less than upper_bound
+        */
+        SEAL_NODISCARD std::vector<double> chebyshev_coefficients(
+            const std::function<double(double)> &func, double lower_bound, double upper_bound, std::size_t degree);
+
+        /**
+        Evaluates a Chebyshev series on [lower_bound, upper_bound] at a point using Clenshaw's recurrence.
+        */
+        SEAL_NODISCARD double evaluate_chebyshev_series(
+            const std::vector<double> &coeffs, double lower_bound, double upper_bound, double value);
+    } // namespace util
+} // namespace seal
@@ -0,0 +1,60 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "seal/util/profiling.h"
+
+using namespace std;
+
+namespace seal
+{
+    namespace util
+    {
+        namespace
+        {
+            ProfileRecord profile_records[profile_event_type_count];
+
+            // The innermost active scope on this thread
+            thread_local ProfileRecord *current_profile_record = nullptr;
+        } // namespace
+
+        ProfileRecord &get_profile_record(profile_event_type event) noexcept
+        {
+            return profile_records[static_cast<size_t>(event)];
+        }
+
+        ProfileScope::ProfileScope(profile_event_type event) noexcept
+            : record_(&get_profile_record(event)), parent_(current_profile_record)
+        {
+            if (record_ == parent_)
+            {
+                record_ = nullptr;
+                return;
+            }
+            current_profile_record = record_;
+            start_ = chrono::steady_clock::now();
+        }
+
+        ProfileScope::~ProfileScope() noexcept
+        {
+            if (!record_)
+            {
+                return;
+            }
+            auto duration = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start_);
+            record_->call_count.fetch_add(1, memory_order_relaxed);
+            record_->nanoseconds.fetch_add(static_cast<uint64_t>(duration.count()), memory_order_relaxed);
+            current_profile_record = parent_;
+        }
+
+        void profile_allocation(size_t byte_count) noexcept
+        {
+            auto &record = get_profile_record(profile_event_type::pool_allocation);
+            record.call_count.fetch_add(1, memory_order_relaxed);
+            record.allocated_byte_count.fetch_add(byte_count, memory_order_relaxed);
+            if (current_profile_record)
+            {
+                current_profile_record->allocated_byte_count.fetch_add(byte_count, memory_order_relaxed);
+            }
+        }
+    } // namespace util
+} // namespace seal
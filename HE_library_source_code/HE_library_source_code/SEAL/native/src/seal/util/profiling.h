@@ -0,0 +1,72 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+#include "seal/profiler.h"
+#include "seal/util/defines.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace seal
+{
+    namespace util
+    {
+        /**
+        The counters of one instrumented primitive, updated by ProfileScope and profile_allocation.
+        */
+        struct ProfileRecord
+        {
+            std::atomic<std::uint64_t> call_count{ 0 };
+
+            std::atomic<std::uint64_t> nanoseconds{ 0 };
+
+            std::atomic<std::uint64_t> allocated_byte_count{ 0 };
+        };
+
+        /**
+        Returns the record of a primitive.
+        */
+        SEAL_NODISCARD ProfileRecord &get_profile_record(profile_event_type event) noexcept;
+
+        /**
+        Counts one call of a primitive and the time until the scope is left. Memory pool allocations on the same
+        thread are attributed to the innermost scope. A scope nested directly inside a scope of the same primitive
+        does nothing.
+        */
+        class ProfileScope
+        {
+        public:
+            explicit ProfileScope(profile_event_type event) noexcept;
+
+            ~ProfileScope() noexcept;
+
+            ProfileScope(const ProfileScope &copy) = delete;
+
+            ProfileScope &operator=(const ProfileScope &assign) = delete;
+
+        private:
+            ProfileRecord *record_;
+
+            ProfileRecord *parent_;
+
+            std::chrono::steady_clock::time_point start_;
+        };
+
+        /**
+        Counts a memory pool allocation of byte_count bytes.
+        */
+        void profile_allocation(std::size_t byte_count) noexcept;
+    } // namespace util
+} // namespace seal
+
+// Instrument the enclosing scope as one call of the given primitive
+#ifdef SEAL_USE_PROFILING
+#define SEAL_PROFILE_SCOPE(event) ::seal::util::ProfileScope SEAL_JOIN(seal_profile_scope_, __LINE__)(event)
+#define SEAL_PROFILE_ALLOCATION(byte_count) ::seal::util::profile_allocation(byte_count)
+#else
+#define SEAL_PROFILE_SCOPE(event)
+#define SEAL_PROFILE_ALLOCATION(byte_count)
+#endif
@@ -4,6 +4,7 @@
 #include "seal/util/common.h"
 #include "seal/util/numth.h"
 #include "seal/util/polyarithsmallmod.h"
+#include "seal/util/profiling.h"
 #include "seal/util/rns.h"
 #include "seal/util/uintarithmod.h"
 #include "seal/util/uintarithsmallmod.h"
@@ -417,6 +418,7 @@ namespace seal
 
         void BaseConverter::fast_convert_array(ConstRNSIter in, RNSIter out, MemoryPoolHandle pool) const
         {
+            SEAL_PROFILE_SCOPE(profile_event_type::fast_convert_array);
 #ifdef SEAL_DEBUG
             if (in.poly_modulus_degree() != out.poly_modulus_degree())
             {
@@ -1250,5 +1252,266 @@ namespace seal
             // Use exact base convension rather than convert the base through the compose API
             base_q_to_t_conv_->exact_convert_array(phase, destination, pool);
         }
+
+        KeySwitchTool::KeySwitchTool(
+            size_t poly_modulus_degree, const RNSBase &q, const RNSBase &p, size_t digit_size,
+            const Modulus &plain_modulus, MemoryPoolHandle pool)
+            : pool_(move(pool)), coeff_count_(poly_modulus_degree), digit_size_(digit_size), t_(plain_modulus)
+        {
+            if (!pool_)
+            {
+                throw invalid_argument("pool is uninitialized");
+            }
+            int coeff_count_power = get_power_of_two(poly_modulus_degree);
+            if (coeff_count_power < 0 || poly_modulus_degree > SEAL_POLY_MOD_DEGREE_MAX ||
+                poly_modulus_degree < SEAL_POLY_MOD_DEGREE_MIN)
+            {
+                throw invalid_argument("poly_modulus_degree is invalid");
+            }
+            if (!digit_size_)
+            {
+                throw invalid_argument("digit_size is invalid");
+            }
+
+            size_t base_q_size = q.size();
+            size_t base_p_size = p.size();
+            digit_count_ = divide_round_up(base_q_size, digit_size_);
+            base_q_ = allocate<RNSBase>(pool_, q, pool_);
+            base_p_ = allocate<RNSBase>(pool_, p, pool_);
+
+            // Every digit is converted to the remaining primes of q followed by the primes of p
+            base_digit_to_q_p_conv_ = allocate<Pointer<BaseConverter>>(digit_count_, pool_);
+            for (size_t digit_index = 0; digit_index < digit_count_; digit_index++)
+            {
+                size_t digit_begin = digit_index * digit_size_;
+                size_t digit_end = min(digit_begin + digit_size_, base_q_size);
+                vector<Modulus> digit_base(q.base() + digit_begin, q.base() + digit_end);
+                vector<Modulus> complement_base(q.base(), q.base() + digit_begin);
+                complement_base.insert(complement_base.end(), q.base() + digit_end, q.base() + base_q_size);
+                complement_base.insert(complement_base.end(), p.base(), p.base() + base_p_size);
+
+                base_digit_to_q_p_conv_[digit_index] = allocate<BaseConverter>(
+                    pool_, RNSBase(digit_base, pool_), RNSBase(complement_base, pool_), pool_);
+            }
+
+            base_p_to_q_conv_ = allocate<BaseConverter>(pool_, *base_p_, *base_q_, pool_);
+
+            // Returns prod(p) mod the given modulus
+            auto prod_p_mod = [&](const Modulus &modulus) {
+                uint64_t result = 1;
+                SEAL_ITERATE(p.base(), base_p_size, [&](auto &I) {
+                    result = multiply_uint_mod(result, barrett_reduce_64(I.value(), modulus), modulus);
+                });
+                return result;
+            };
+
+            // Compute prod(p) mod q, its inverse, and (prod(p) - 1) / 2 mod q; note that all primes are odd
+            inv_prod_p_mod_q_ = allocate<MultiplyUIntModOperand>(base_q_size, pool_);
+            prod_p_mod_q_ = allocate<MultiplyUIntModOperand>(base_q_size, pool_);
+            half_prod_p_mod_q_ = allocate_uint(base_q_size, pool_);
+            SEAL_ITERATE(
+                iter(inv_prod_p_mod_q_, prod_p_mod_q_, half_prod_p_mod_q_, q.base()), base_q_size, [&](auto I) {
+                    uint64_t temp = prod_p_mod(get<3>(I));
+                    get<1>(I).set(temp, get<3>(I));
+                    uint64_t inv_two = (get<3>(I).value() + 1) >> 1;
+                    get<2>(I) = multiply_uint_mod(sub_uint_mod(temp, 1, get<3>(I)), inv_two, get<3>(I));
+                    if (!try_invert_uint_mod(temp, get<3>(I), temp))
+                    {
+                        throw logic_error("invalid rns bases");
+                    }
+                    get<0>(I).set(temp, get<3>(I));
+                });
+
+            // Since prod(p) is zero modulo p, (prod(p) - 1) / 2 is (p - 1) / 2 modulo p
+            half_prod_p_mod_p_ = allocate_uint(base_p_size, pool_);
+            SEAL_ITERATE(iter(half_prod_p_mod_p_, p.base()), base_p_size, [&](auto I) {
+                get<0>(I) = get<1>(I).value() >> 1;
+            });
+
+            if (!t_.is_zero())
+            {
+                base_p_to_t_conv_ = allocate<BaseConverter>(pool_, *base_p_, RNSBase({ t_ }, pool_), pool_);
+
+                uint64_t temp = 0;
+                if (!try_invert_uint_mod(prod_p_mod(t_), t_, temp))
+                {
+                    throw logic_error("invalid rns bases");
+                }
+                inv_prod_p_mod_t_.set(temp, t_);
+            }
+        }
+
+        void KeySwitchTool::extend_digit(
+            ConstRNSIter input, size_t digit_index, RNSIter destination, MemoryPoolHandle pool) const
+        {
+#ifdef SEAL_DEBUG
+            if (!input || !destination)
+            {
+                throw invalid_argument("input and destination cannot be null");
+            }
+            if (digit_index >= digit_count_)
+            {
+                throw out_of_range("digit_index");
+            }
+            if (!pool)
+            {
+                throw invalid_argument("pool is uninitialized");
+            }
+#endif
+            size_t base_q_size = base_q_->size();
+            size_t base_p_size = base_p_->size();
+            size_t digit_begin = digit_index * digit_size_;
+            size_t digit_end = min(digit_begin + digit_size_, base_q_size);
+
+            SEAL_ALLOCATE_GET_RNS_ITER(temp, coeff_count_, base_q_size - (digit_end - digit_begin) + base_p_size, pool);
+            base_digit_to_q_p_conv_[digit_index]->fast_convert_array(input + digit_begin, temp, pool);
+
+            // Primes of q before the digit, the digit itself, and the primes of q after the digit followed by p
+            set_poly(temp, coeff_count_, digit_begin, destination);
+            set_poly(input + digit_begin, coeff_count_, digit_end - digit_begin, destination + digit_begin);
+            set_poly(
+                temp + digit_begin, coeff_count_, base_q_size - digit_end + base_p_size, destination + digit_end);
+        }
+
+        void KeySwitchTool::divide_and_round_p_inplace(RNSIter input, MemoryPoolHandle pool) const
+        {
+#ifdef SEAL_DEBUG
+            if (!input)
+            {
+                throw invalid_argument("input cannot be null");
+            }
+            if (input.poly_modulus_degree() != coeff_count_)
+            {
+                throw invalid_argument("input is not valid for encryption parameters");
+            }
+            if (!pool)
+            {
+                throw invalid_argument("pool is uninitialized");
+            }
+#endif
+            size_t base_q_size = base_q_->size();
+            size_t base_p_size = base_p_->size();
+            RNSIter p_input = input + base_q_size;
+
+            // Add (prod(p) - 1) / 2 to change from flooring to rounding
+            SEAL_ITERATE(iter(p_input, half_prod_p_mod_p_, base_p_->base()), base_p_size, [&](auto I) {
+                add_poly_scalar_coeffmod(get<0>(I), coeff_count_, get<1>(I), get<2>(I), get<0>(I));
+            });
+
+            // (ct mod p) mod q
+            SEAL_ALLOCATE_GET_RNS_ITER(temp, coeff_count_, base_q_size, pool);
+            base_p_to_q_conv_->fast_convert_array(p_input, temp, pool);
+
+            SEAL_ITERATE(
+                iter(input, temp, half_prod_p_mod_q_, inv_prod_p_mod_q_, base_q_->base()), base_q_size, [&](auto I) {
+                    // Subtract rounding correction here; the negative sign will turn into a plus in the next
+                    // subtraction
+                    sub_poly_scalar_coeffmod(get<1>(I), coeff_count_, get<2>(I), get<4>(I), get<1>(I));
+
+                    // prod(p)^(-1) * ((ct mod qi) - (ct mod p)) mod qi
+                    sub_poly_coeffmod(get<0>(I), get<1>(I), coeff_count_, get<4>(I), get<0>(I));
+                    multiply_poly_scalar_coeffmod(get<0>(I), coeff_count_, get<3>(I), get<4>(I), get<0>(I));
+                });
+        }
+
+        void KeySwitchTool::divide_and_round_p_ntt_inplace(
+            RNSIter input, ConstNTTTablesIter q_ntt_tables, ConstNTTTablesIter p_ntt_tables,
+            MemoryPoolHandle pool) const
+        {
+#ifdef SEAL_DEBUG
+            if (!input)
+            {
+                throw invalid_argument("input cannot be null");
+            }
+            if (input.poly_modulus_degree() != coeff_count_)
+            {
+                throw invalid_argument("input is not valid for encryption parameters");
+            }
+            if (!q_ntt_tables || !p_ntt_tables)
+            {
+                throw invalid_argument("ntt_tables cannot be null");
+            }
+            if (!pool)
+            {
+                throw invalid_argument("pool is uninitialized");
+            }
+#endif
+            size_t base_q_size = base_q_->size();
+            size_t base_p_size = base_p_->size();
+            RNSIter p_input = input + base_q_size;
+
+            // Convert to non-NTT form
+            inverse_ntt_negacyclic_harvey(p_input, base_p_size, p_ntt_tables);
+
+            // Add (prod(p) - 1) / 2 to change from flooring to rounding
+            SEAL_ITERATE(iter(p_input, half_prod_p_mod_p_, base_p_->base()), base_p_size, [&](auto I) {
+                add_poly_scalar_coeffmod(get<0>(I), coeff_count_, get<1>(I), get<2>(I), get<0>(I));
+            });
+
+            // (ct mod p) mod q
+            SEAL_ALLOCATE_GET_RNS_ITER(temp, coeff_count_, base_q_size, pool);
+            base_p_to_q_conv_->fast_convert_array(p_input, temp, pool);
+
+            SEAL_ITERATE(
+                iter(input, temp, half_prod_p_mod_q_, inv_prod_p_mod_q_, base_q_->base(), q_ntt_tables), base_q_size,
+                [&](auto I) {
+                    sub_poly_scalar_coeffmod(get<1>(I), coeff_count_, get<2>(I), get<4>(I), get<1>(I));
+                    ntt_negacyclic_harvey(get<1>(I), get<5>(I));
+
+                    // prod(p)^(-1) * ((ct mod qi) - (ct mod p)) mod qi
+                    sub_poly_coeffmod(get<0>(I), get<1>(I), coeff_count_, get<4>(I), get<0>(I));
+                    multiply_poly_scalar_coeffmod(get<0>(I), coeff_count_, get<3>(I), get<4>(I), get<0>(I));
+                });
+        }
+
+        void KeySwitchTool::mod_t_and_divide_p_ntt_inplace(
+            RNSIter input, ConstNTTTablesIter q_ntt_tables, ConstNTTTablesIter p_ntt_tables,
+            MemoryPoolHandle pool) const
+        {
+#ifdef SEAL_DEBUG
+            if (!input)
+            {
+                throw invalid_argument("input cannot be null");
+            }
+            if (t_.is_zero())
+            {
+                throw logic_error("plain_modulus is not set");
+            }
+#endif
+            size_t base_q_size = base_q_->size();
+            size_t base_p_size = base_p_->size();
+            RNSIter p_input = input + base_q_size;
+
+            // Convert to non-NTT form
+            inverse_ntt_negacyclic_harvey(p_input, base_p_size, p_ntt_tables);
+
+            // Fast base conversion gives c_p + e * prod(p) for a small e, consistently modulo q and t
+            SEAL_ALLOCATE_GET_RNS_ITER(temp, coeff_count_, base_q_size, pool);
+            base_p_to_q_conv_->fast_convert_array(p_input, temp, pool);
+
+            // neg_c_p_mod_t = -c_p * prod(p)^(-1) (mod t)
+            SEAL_ALLOCATE_GET_RNS_ITER(neg_c_p_mod_t, coeff_count_, 1, pool);
+            base_p_to_t_conv_->fast_convert_array(p_input, neg_c_p_mod_t, pool);
+            negate_poly_coeffmod(neg_c_p_mod_t[0], coeff_count_, t_, neg_c_p_mod_t[0]);
+            if (inv_prod_p_mod_t_.operand != 1)
+            {
+                multiply_poly_scalar_coeffmod(neg_c_p_mod_t[0], coeff_count_, inv_prod_p_mod_t_, t_, neg_c_p_mod_t[0]);
+            }
+
+            SEAL_ALLOCATE_GET_COEFF_ITER(delta_mod_q_i, coeff_count_, pool);
+            SEAL_ITERATE(
+                iter(input, temp, prod_p_mod_q_, inv_prod_p_mod_q_, base_q_->base(), q_ntt_tables), base_q_size,
+                [&](auto I) {
+                    // delta_mod_q_i = c_p + neg_c_p_mod_t * prod(p) (mod q_i), which is zero modulo t
+                    modulo_poly_coeffs(neg_c_p_mod_t[0], coeff_count_, get<4>(I), delta_mod_q_i);
+                    multiply_poly_scalar_coeffmod(delta_mod_q_i, coeff_count_, get<2>(I), get<4>(I), delta_mod_q_i);
+                    add_poly_coeffmod(delta_mod_q_i, get<1>(I), coeff_count_, get<4>(I), delta_mod_q_i);
+                    ntt_negacyclic_harvey(delta_mod_q_i, get<5>(I));
+
+                    // c_i = (c_i - delta_mod_q_i) * prod(p)^(-1) (mod q_i)
+                    sub_poly_coeffmod(get<0>(I), delta_mod_q_i, coeff_count_, get<4>(I), get<0>(I));
+                    multiply_poly_scalar_coeffmod(get<0>(I), coeff_count_, get<3>(I), get<4>(I), get<0>(I));
+                });
+        }
     } // namespace util
 } // namespace seal
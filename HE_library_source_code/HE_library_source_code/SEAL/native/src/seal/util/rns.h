@@ -399,5 +399,122 @@ namespace seal
 
             std::uint64_t q_last_mod_t_ = 1;
         };
+
+        /**
+        Pre-computations for hybrid key switching of ciphertexts with coefficient modulus q = q_0 * ... * q_{l-1}
+        using special primes with product p. The primes of q are grouped into digits of consecutive primes; each digit
+        is extended to the basis of q and p for multiplication with the key switching keys, and the result is divided
+        by p to return to the basis of q.
+        */
+        class KeySwitchTool
+        {
+        public:
+            /**
+            @throws std::invalid_argument if poly_modulus_degree is out of range, digit_size is zero, or pool is
+            invalid.
+            @throws std::logic_error if q, p, and plain_modulus (when non-zero) are not coprime.
+            */
+            KeySwitchTool(
+                std::size_t poly_modulus_degree, const RNSBase &q, const RNSBase &p, std::size_t digit_size,
+                const Modulus &plain_modulus, MemoryPoolHandle pool);
+
+            /**
+            Extends a digit of input to the basis of q and p with fast base conversion.
+
+            @param[in] input Must be modulo q in coefficient form
+            @param[in] digit_index The index of the digit
+            @param[out] destination Must have room for q.size() + p.size() RNS components, which are set in
+            coefficient form; modulo the primes of the digit they equal input.
+            */
+            void extend_digit(
+                ConstRNSIter input, std::size_t digit_index, RNSIter destination, MemoryPoolHandle pool) const;
+
+            /**
+            Divides input by p with rounding. The result is written to the first q.size() RNS components.
+
+            @param[in] input Must be modulo q and p in coefficient form, i.e. coefficients must be less than the
+            associated modulus.
+            */
+            void divide_and_round_p_inplace(RNSIter input, MemoryPoolHandle pool) const;
+
+            void divide_and_round_p_ntt_inplace(
+                RNSIter input, ConstNTTTablesIter q_ntt_tables, ConstNTTTablesIter p_ntt_tables,
+                MemoryPoolHandle pool) const;
+
+            /**
+            Divides input by p after subtracting a multiple of t congruent to input modulo p, so that the result
+            times p is congruent to input modulo t (BGV). The result is written to the first q.size() RNS components.
+            */
+            void mod_t_and_divide_p_ntt_inplace(
+                RNSIter input, ConstNTTTablesIter q_ntt_tables, ConstNTTTablesIter p_ntt_tables,
+                MemoryPoolHandle pool) const;
+
+            SEAL_NODISCARD inline std::size_t digit_size() const noexcept
+            {
+                return digit_size_;
+            }
+
+            SEAL_NODISCARD inline std::size_t digit_count() const noexcept
+            {
+                return digit_count_;
+            }
+
+            SEAL_NODISCARD inline auto base_q() const noexcept
+            {
+                return base_q_.get();
+            }
+
+            SEAL_NODISCARD inline auto base_p() const noexcept
+            {
+                return base_p_.get();
+            }
+
+        private:
+            KeySwitchTool(const KeySwitchTool &copy) = delete;
+
+            KeySwitchTool(KeySwitchTool &&source) = delete;
+
+            KeySwitchTool &operator=(const KeySwitchTool &assign) = delete;
+
+            KeySwitchTool &operator=(KeySwitchTool &&assign) = delete;
+
+            MemoryPoolHandle pool_;
+
+            std::size_t coeff_count_ = 0;
+
+            std::size_t digit_size_ = 0;
+
+            std::size_t digit_count_ = 0;
+
+            Pointer<RNSBase> base_q_;
+
+            Pointer<RNSBase> base_p_;
+
+            // Base converters: digit --> (q without digit) U p
+            Pointer<Pointer<BaseConverter>> base_digit_to_q_p_conv_;
+
+            // Base converter: p --> q
+            Pointer<BaseConverter> base_p_to_q_conv_;
+
+            // Base converter: p --> t
+            Pointer<BaseConverter> base_p_to_t_conv_;
+
+            // prod(p)^(-1) mod q
+            Pointer<MultiplyUIntModOperand> inv_prod_p_mod_q_;
+
+            // prod(p) mod q
+            Pointer<MultiplyUIntModOperand> prod_p_mod_q_;
+
+            // (prod(p) - 1) / 2 mod q
+            Pointer<std::uint64_t> half_prod_p_mod_q_;
+
+            // (prod(p) - 1) / 2 mod p
+            Pointer<std::uint64_t> half_prod_p_mod_p_;
+
+            // prod(p)^(-1) mod t
+            MultiplyUIntModOperand inv_prod_p_mod_t_;
+
+            Modulus t_;
+        };
     } // namespace util
 } // namespace seal
@@ -156,7 +156,12 @@ namespace seal
             return false;
         }
 
+        // With hybrid key switching there is one key per digit instead of one per prime
         size_t decomp_mod_count = context.first_context_data()->parms().coeff_modulus().size();
+        if (context.special_prime_count() > 1)
+        {
+            decomp_mod_count = divide_round_up(decomp_mod_count, context.special_prime_count());
+        }
         for (auto &a : in.data())
         {
             // Check that each highest level component has right size
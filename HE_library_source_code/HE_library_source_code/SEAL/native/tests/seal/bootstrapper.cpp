@@ -0,0 +1,166 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "seal/bootstrapper.h"
+#include "seal/ckks.h"
+#include "seal/context.h"
+#include "seal/decryptor.h"
+#include "seal/encryptor.h"
+#include "seal/evaluator.h"
+#include "seal/keygenerator.h"
+#include "seal/modulus.h"
+#include "seal/util/galois.h"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdlib>
+#include <ctime>
+#include <stdexcept>
+#include <vector>
+#include "gtest/gtest.h"
+
+using namespace seal;
+using namespace std;
+
+namespace sealtest
+{
+    namespace
+    {
+        EncryptionParameters make_bootstrapping_parms(size_t poly_modulus_degree, size_t level_count)
+        {
+            EncryptionParameters parms(scheme_type::ckks);
+            parms.set_poly_modulus_degree(poly_modulus_degree);
+            vector<int> bit_sizes{ 60 };
+            bit_sizes.insert(bit_sizes.end(), level_count, 55);
+            bit_sizes.push_back(60);
+            parms.set_coeff_modulus(CoeffModulus::Create(poly_modulus_degree, bit_sizes));
+            return parms;
+        }
+    } // namespace
+
+    TEST(CKKSBootstrapperTest, Create)
+    {
+        SEALContext context(make_bootstrapping_parms(128, 16), true, sec_level_type::none);
+        CKKSBootstrappingParameters bootstrapping_parms;
+        bootstrapping_parms.coeff_to_slot_level_count = 2;
+        bootstrapping_parms.slot_to_coeff_level_count = 3;
+        CKKSBootstrapper bootstrapper(context, bootstrapping_parms);
+
+        // The overflow bound is resolved and EvalMod fits the remaining levels
+        ASSERT_TRUE(bootstrapper.parameters().overflow_bound > 0);
+        ASSERT_TRUE(bootstrapper.double_angle_count() > 0);
+        ASSERT_EQ(64ULL, bootstrapper.eval_mod_coeffs().size());
+        ASSERT_TRUE(bootstrapper.depth() > 5 + bootstrapper.double_angle_count());
+        ASSERT_EQ(
+            context.first_context_data()->chain_index() - bootstrapper.depth(),
+            context.get_context_data(bootstrapper.parms_id())->chain_index());
+
+        // The last level of CoeffToSlot and the first level of SlotToCoeff have two inputs
+        ASSERT_EQ(2ULL, bootstrapper.coeff_to_slot().size());
+        ASSERT_EQ(context.first_parms_id(), bootstrapper.coeff_to_slot()[0].parms_id);
+        ASSERT_EQ(1ULL, bootstrapper.coeff_to_slot()[0].input_count);
+        ASSERT_EQ(2ULL, bootstrapper.coeff_to_slot()[1].input_count);
+        ASSERT_EQ(3ULL, bootstrapper.slot_to_coeff().size());
+        ASSERT_EQ(2ULL, bootstrapper.slot_to_coeff()[0].input_count);
+        ASSERT_EQ(1ULL, bootstrapper.slot_to_coeff()[2].input_count);
+        ASSERT_EQ(
+            context.get_context_data(bootstrapper.parms_id())->prev_context_data()->parms_id(),
+            bootstrapper.slot_to_coeff()[2].parms_id);
+
+        // Complex conjugation is among the Galois elements
+        auto &galois_elts = bootstrapper.galois_elts();
+        ASSERT_TRUE(is_sorted(galois_elts.begin(), galois_elts.end()));
+        ASSERT_TRUE(binary_search(
+            galois_elts.begin(), galois_elts.end(), context.key_context_data()->galois_tool()->get_elt_from_step(0)));
+
+        // Invalid parameters
+        bootstrapping_parms.coeff_to_slot_level_count = 0;
+        ASSERT_THROW(CKKSBootstrapper(context, bootstrapping_parms), invalid_argument);
+        bootstrapping_parms.coeff_to_slot_level_count = 7;
+        ASSERT_THROW(CKKSBootstrapper(context, bootstrapping_parms), invalid_argument);
+        bootstrapping_parms.coeff_to_slot_level_count = 2;
+        bootstrapping_parms.eval_mod_degree = 0;
+        ASSERT_THROW(CKKSBootstrapper(context, bootstrapping_parms), invalid_argument);
+        SEALContext short_context(make_bootstrapping_parms(128, 8), true, sec_level_type::none);
+        ASSERT_THROW(CKKSBootstrapper(short_context, CKKSBootstrappingParameters()), invalid_argument);
+
+        EncryptionParameters bfv_parms(scheme_type::bfv);
+        bfv_parms.set_poly_modulus_degree(128);
+        bfv_parms.set_coeff_modulus(CoeffModulus::Create(128, { 40, 40, 40 }));
+        bfv_parms.set_plain_modulus(257);
+        SEALContext bfv_context(bfv_parms, false, sec_level_type::none);
+        ASSERT_THROW(CKKSBootstrapper(bfv_context, CKKSBootstrappingParameters()), invalid_argument);
+    }
+
+    TEST(CKKSBootstrapperTest, Bootstrap)
+    {
+        SEALContext context(make_bootstrapping_parms(128, 17), true, sec_level_type::none);
+        CKKSBootstrappingParameters bootstrapping_parms;
+        bootstrapping_parms.coeff_to_slot_level_count = 2;
+        bootstrapping_parms.slot_to_coeff_level_count = 2;
+        CKKSBootstrapper bootstrapper(context, bootstrapping_parms);
+
+        KeyGenerator keygen(context);
+        PublicKey pk;
+        keygen.create_public_key(pk);
+        RelinKeys rlk;
+        keygen.create_relin_keys(rlk);
+        GaloisKeys glk;
+        keygen.create_galois_keys(bootstrapper.galois_elts(), glk);
+
+        Encryptor encryptor(context, pk);
+        Decryptor decryptor(context, keygen.secret_key());
+        Evaluator evaluator(context);
+        CKKSEncoder encoder(context);
+        size_t slot_count = encoder.slot_count();
+        double scale = pow(2.0, 50);
+
+        vector<complex<double>> input(slot_count);
+        srand(static_cast<unsigned>(time(NULL)));
+        for (auto &value : input)
+        {
+            value = complex<double>(
+                static_cast<double>(rand()) / RAND_MAX * 2.0 - 1.0, static_cast<double>(rand()) / RAND_MAX * 2.0 - 1.0);
+        }
+
+        // Bootstrap a ciphertext at the last level
+        Plaintext plain;
+        Ciphertext encrypted;
+        encoder.encode(input, context.last_parms_id(), scale, plain);
+        encryptor.encrypt(plain, encrypted);
+        Ciphertext bootstrapped;
+        evaluator.bootstrap(encrypted, bootstrapper, rlk, glk, bootstrapped);
+        ASSERT_EQ(bootstrapper.parms_id(), bootstrapped.parms_id());
+        ASSERT_EQ(scale, bootstrapped.scale());
+
+        vector<complex<double>> output;
+        decryptor.decrypt(bootstrapped, plain);
+        encoder.decode(plain, output);
+        for (size_t i = 0; i < slot_count; i++)
+        {
+            ASSERT_NEAR(input[i].real(), output[i].real(), 1e-3);
+            ASSERT_NEAR(input[i].imag(), output[i].imag(), 1e-3);
+        }
+
+        // The result can be multiplied again and bootstrapped from any level
+        evaluator.square_inplace(bootstrapped);
+        evaluator.relinearize_inplace(bootstrapped, rlk);
+        evaluator.rescale_to_next_inplace(bootstrapped);
+        evaluator.bootstrap_inplace(bootstrapped, bootstrapper, rlk, glk);
+        ASSERT_EQ(bootstrapper.parms_id(), bootstrapped.parms_id());
+
+        decryptor.decrypt(bootstrapped, plain);
+        encoder.decode(plain, output);
+        for (size_t i = 0; i < slot_count; i++)
+        {
+            complex<double> expected = input[i] * input[i];
+            ASSERT_NEAR(expected.real(), output[i].real(), 1e-2);
+            ASSERT_NEAR(expected.imag(), output[i].imag(), 1e-2);
+        }
+
+        // A bootstrapper for other encryption parameters is rejected
+        SEALContext other_context(make_bootstrapping_parms(128, 18), true, sec_level_type::none);
+        CKKSBootstrapper other_bootstrapper(other_context, bootstrapping_parms);
+        ASSERT_THROW(evaluator.bootstrap_inplace(bootstrapped, other_bootstrapper, rlk, glk), invalid_argument);
+    }
+} // namespace sealtest
@@ -0,0 +1,305 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "seal/c/asyncworker.h"
+#include "seal/c/ciphertext.h"
+#include "seal/c/decryptor.h"
+#include "seal/c/encryptionparameters.h"
+#include "seal/c/encryptor.h"
+#include "seal/c/evaluator.h"
+#include "seal/c/keygenerator.h"
+#include "seal/c/modulus.h"
+#include "seal/c/plaintext.h"
+#include "seal/c/publickey.h"
+#include "seal/c/sealcontext.h"
+#include "seal/c/secretkey.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+
+using namespace std;
+
+namespace sealtest
+{
+    namespace
+    {
+        // Records the results of asynchronous functions; the callback may run on any worker thread
+        struct Completions
+        {
+            mutex mtx;
+
+            condition_variable cv;
+
+            vector<HRESULT> results;
+
+            HRESULT wait_idle_result = S_OK;
+
+            HRESULT set_thread_count_result = S_OK;
+
+            void wait_for(size_t count)
+            {
+                unique_lock<mutex> lock(mtx);
+                cv.wait(lock, [&] { return results.size() >= count; });
+            }
+        };
+
+        void SEAL_C_CALL record_result(HRESULT result, void *user_data)
+        {
+            Completions *completions = static_cast<Completions *>(user_data);
+            lock_guard<mutex> lock(completions->mtx);
+            completions->results.push_back(result);
+            completions->cv.notify_all();
+        }
+
+        void SEAL_C_CALL call_pool_from_worker(HRESULT result, void *user_data)
+        {
+            Completions *completions = static_cast<Completions *>(user_data);
+            completions->wait_idle_result = AsyncWorker_WaitIdle();
+            completions->set_thread_count_result = AsyncWorker_SetThreadCount(2);
+            record_result(result, user_data);
+        }
+
+        // BFV objects created through the C export library, as SEALNet does
+        class AsyncWorkerTest : public ::testing::Test
+        {
+        protected:
+            void SetUp() override
+            {
+                ASSERT_EQ(S_OK, AsyncWorker_GetThreadCount(&thread_count_));
+
+                void *parms = nullptr;
+                ASSERT_EQ(S_OK, EncParams_Create1(1, &parms));
+                ASSERT_EQ(S_OK, EncParams_SetPolyModulusDegree(parms, 1024));
+                int bit_sizes[] = { 30, 30 };
+                vector<void *> coeffs(2, nullptr);
+                ASSERT_EQ(S_OK, CoeffModulus_Create1(1024, 2, bit_sizes, coeffs.data()));
+                ASSERT_EQ(S_OK, EncParams_SetCoeffModulus(parms, 2, coeffs.data()));
+                ASSERT_EQ(S_OK, EncParams_SetPlainModulus2(parms, 1 << 6));
+                ASSERT_EQ(S_OK, SEALContext_Create(parms, false, 0, &context_));
+                for (void *coeff : coeffs)
+                {
+                    Modulus_Destroy(coeff);
+                }
+                EncParams_Destroy(parms);
+
+                ASSERT_EQ(S_OK, KeyGenerator_Create1(context_, &keygen_));
+                ASSERT_EQ(S_OK, KeyGenerator_SecretKey(keygen_, &secret_key_));
+                ASSERT_EQ(S_OK, KeyGenerator_CreatePublicKey(keygen_, false, &public_key_));
+                ASSERT_EQ(S_OK, Encryptor_Create(context_, public_key_, nullptr, &encryptor_));
+                ASSERT_EQ(S_OK, Decryptor_Create(context_, secret_key_, &decryptor_));
+                ASSERT_EQ(S_OK, Evaluator_Create(context_, &evaluator_));
+            }
+
+            void TearDown() override
+            {
+                for (void *object : ciphers_)
+                {
+                    Ciphertext_Destroy(object);
+                }
+                for (void *object : plains_)
+                {
+                    Plaintext_Destroy(object);
+                }
+                Evaluator_Destroy(evaluator_);
+                Decryptor_Destroy(decryptor_);
+                Encryptor_Destroy(encryptor_);
+                PublicKey_Destroy(public_key_);
+                SecretKey_Destroy(secret_key_);
+                KeyGenerator_Destroy(keygen_);
+                SEALContext_Destroy(context_);
+
+                // Restore the thread count for the following tests
+                AsyncWorker_SetThreadCount(thread_count_);
+            }
+
+            void *new_plain(uint64_t seed)
+            {
+                void *plain = nullptr;
+                EXPECT_EQ(S_OK, Plaintext_Create1(nullptr, &plain));
+                vector<uint64_t> coeffs{ seed % 64, (seed * 7 + 1) % 64, (seed * 13 + 5) % 64 };
+                EXPECT_EQ(S_OK, Plaintext_Set4(plain, coeffs.size(), coeffs.data()));
+                plains_.push_back(plain);
+                return plain;
+            }
+
+            void *new_cipher()
+            {
+                void *cipher = nullptr;
+                EXPECT_EQ(S_OK, Ciphertext_Create1(nullptr, &cipher));
+                ciphers_.push_back(cipher);
+                return cipher;
+            }
+
+            void *encrypt(uint64_t seed)
+            {
+                void *cipher = new_cipher();
+                EXPECT_EQ(S_OK, Encryptor_Encrypt(encryptor_, new_plain(seed), cipher, nullptr));
+                return cipher;
+            }
+
+            static vector<uint64_t> cipher_data(void *cipher)
+            {
+                uint64_t size = 0;
+                uint64_t degree = 0;
+                uint64_t coeff_modulus_size = 0;
+                EXPECT_EQ(S_OK, Ciphertext_Size(cipher, &size));
+                EXPECT_EQ(S_OK, Ciphertext_PolyModulusDegree(cipher, &degree));
+                EXPECT_EQ(S_OK, Ciphertext_CoeffModulusSize(cipher, &coeff_modulus_size));
+                vector<uint64_t> data(size * degree * coeff_modulus_size);
+                for (uint64_t i = 0; i < data.size(); i++)
+                {
+                    EXPECT_EQ(S_OK, Ciphertext_GetDataAt1(cipher, i, &data[i]));
+                }
+                return data;
+            }
+
+            uint64_t thread_count_ = 0;
+
+            void *context_ = nullptr;
+
+            void *keygen_ = nullptr;
+
+            void *secret_key_ = nullptr;
+
+            void *public_key_ = nullptr;
+
+            void *encryptor_ = nullptr;
+
+            void *decryptor_ = nullptr;
+
+            void *evaluator_ = nullptr;
+
+            vector<void *> plains_;
+
+            vector<void *> ciphers_;
+        };
+    } // namespace
+
+    TEST_F(AsyncWorkerTest, BatchMatchesSequential)
+    {
+        const size_t count = 8;
+        ASSERT_EQ(S_OK, AsyncWorker_SetThreadCount(4));
+
+        vector<void *> plains;
+        vector<void *> encrypteds;
+        for (size_t i = 0; i < count; i++)
+        {
+            plains.push_back(new_plain(i));
+            encrypteds.push_back(new_cipher());
+        }
+        ASSERT_EQ(S_OK, Encryptor_EncryptBatch(encryptor_, count, plains.data(), encrypteds.data(), nullptr));
+        for (size_t i = 0; i < count; i++)
+        {
+            void *decrypted = new_plain(0);
+            ASSERT_EQ(S_OK, Decryptor_Decrypt(decryptor_, encrypteds[i], decrypted));
+            bool equal = false;
+            ASSERT_EQ(S_OK, Plaintext_Equals(decrypted, plains[i], &equal));
+            ASSERT_TRUE(equal);
+        }
+
+        vector<void *> others;
+        vector<void *> products;
+        for (size_t i = 0; i < count; i++)
+        {
+            others.push_back(encrypt(i + count));
+            products.push_back(new_cipher());
+        }
+        ASSERT_EQ(
+            S_OK,
+            Evaluator_MultiplyBatch(evaluator_, count, encrypteds.data(), others.data(), products.data(), nullptr));
+        for (size_t i = 0; i < count; i++)
+        {
+            void *expected = new_cipher();
+            ASSERT_EQ(S_OK, Evaluator_Multiply(evaluator_, encrypteds[i], others[i], expected, nullptr));
+            ASSERT_EQ(cipher_data(expected), cipher_data(products[i]));
+        }
+
+        // A failing element fails the batch with the HRESULT of the synchronous function
+        others[count / 2] = new_cipher();
+        ASSERT_EQ(
+            E_INVALIDARG,
+            Evaluator_MultiplyBatch(evaluator_, count, encrypteds.data(), others.data(), products.data(), nullptr));
+    }
+
+    TEST_F(AsyncWorkerTest, CallbackReceivesResult)
+    {
+        void *encrypted = encrypt(1);
+        void *empty = new_cipher();
+        void *destination = new_cipher();
+        Completions completions;
+
+        ASSERT_EQ(
+            S_OK, Evaluator_MultiplyAsync(
+                      evaluator_, encrypted, encrypted, destination, nullptr, record_result, &completions));
+        completions.wait_for(1);
+        ASSERT_EQ(S_OK, completions.results[0]);
+
+        // The task fails on the worker thread and the callback receives the HRESULT of the exception
+        ASSERT_EQ(
+            S_OK, Evaluator_MultiplyAsync(
+                      evaluator_, encrypted, empty, destination, nullptr, record_result, &completions));
+        completions.wait_for(2);
+        ASSERT_EQ(E_INVALIDARG, completions.results[1]);
+
+        // Invalid arguments are reported immediately and the callback is not invoked
+        HRESULT result = Evaluator_MultiplyAsync(
+            evaluator_, nullptr, encrypted, destination, nullptr, record_result, &completions);
+        ASSERT_EQ(E_POINTER, result);
+        ASSERT_EQ(S_OK, AsyncWorker_WaitIdle());
+        ASSERT_EQ(size_t{ 2 }, completions.results.size());
+    }
+
+    TEST_F(AsyncWorkerTest, SetThreadCountRacesWithSubmit)
+    {
+        const size_t job_count = 200;
+        void *encrypted = encrypt(1);
+        void *empty = new_cipher();
+        void *destination = new_cipher();
+        Completions completions;
+
+        thread resizer([] {
+            for (uint64_t i = 0; i < 50; i++)
+            {
+                EXPECT_EQ(S_OK, AsyncWorker_SetThreadCount(1 + i % 4));
+            }
+        });
+        for (size_t i = 0; i < job_count; i++)
+        {
+            // The multiplication fails quickly, so the jobs keep racing with the resizing
+            HRESULT result = Evaluator_MultiplyAsync(
+                evaluator_, encrypted, empty, destination, nullptr, record_result, &completions);
+            ASSERT_EQ(S_OK, result);
+        }
+        resizer.join();
+
+        ASSERT_EQ(S_OK, AsyncWorker_WaitIdle());
+        ASSERT_EQ(job_count, completions.results.size());
+        for (HRESULT result : completions.results)
+        {
+            ASSERT_EQ(E_INVALIDARG, result);
+        }
+
+        uint64_t thread_count = 0;
+        ASSERT_EQ(S_OK, AsyncWorker_GetThreadCount(&thread_count));
+        ASSERT_EQ(uint64_t{ 2 }, thread_count);
+        ASSERT_EQ(E_INVALIDARG, AsyncWorker_SetThreadCount(0));
+    }
+
+    TEST_F(AsyncWorkerTest, PoolControlFromWorkerFails)
+    {
+        void *encrypted = encrypt(1);
+        Completions completions;
+
+        ASSERT_EQ(
+            S_OK, Evaluator_MultiplyAsync(
+                      evaluator_, encrypted, encrypted, new_cipher(), nullptr, call_pool_from_worker, &completions));
+        completions.wait_for(1);
+        ASSERT_EQ(S_OK, completions.results[0]);
+        ASSERT_EQ(COR_E_INVALIDOPERATION, completions.wait_idle_result);
+        ASSERT_EQ(COR_E_INVALIDOPERATION, completions.set_thread_count_result);
+    }
+} // namespace sealtest
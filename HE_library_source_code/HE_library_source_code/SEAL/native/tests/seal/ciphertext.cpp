@@ -125,6 +125,11 @@ namespace sealtest
         ASSERT_TRUE(
             is_equal_uint(ctxt.data(), ctxt2.data(), parms.poly_modulus_degree() * parms.coeff_modulus().size() * 2));
         ASSERT_TRUE(ctxt.data() != ctxt2.data());
+
+        // The noise estimate is copied but not serialized
+        ASSERT_TRUE(ctxt.noise_estimate() > 0);
+        ASSERT_EQ(ctxt.noise_estimate(), Ciphertext(ctxt).noise_estimate());
+        ASSERT_EQ(0.0, ctxt2.noise_estimate());
     }
 
     TEST(CiphertextTest, BGVCiphertextBasics)
@@ -246,6 +246,55 @@ namespace sealtest
         }
     }
 
+    TEST(CKKSEncoderTest, CKKSEncoderEncodePackedRealDecodeTest)
+    {
+        EncryptionParameters parms(scheme_type::ckks);
+        size_t slots = 32;
+        parms.set_poly_modulus_degree(slots << 1);
+        parms.set_coeff_modulus(CoeffModulus::Create(slots << 1, { 40, 40, 40, 40 }));
+        SEALContext context(parms, false, sec_level_type::none);
+        CKKSEncoder encoder(context);
+
+        srand(static_cast<unsigned>(time(NULL)));
+        int data_bound = (1 << 20);
+        double delta = (1ULL << 40);
+        Plaintext plain;
+        vector<double> values(2 * slots);
+        vector<double> result;
+        for (auto &value : values)
+        {
+            value = static_cast<double>(rand() % data_bound);
+        }
+
+        // The first half goes into the real parts and the second half into the imaginary parts
+        encoder.encode_packed_real(values, delta, plain);
+        vector<complex<double>> complex_result;
+        encoder.decode(plain, complex_result);
+        for (size_t i = 0; i < slots; i++)
+        {
+            ASSERT_NEAR(values[i], complex_result[i].real(), 0.5);
+            ASSERT_NEAR(values[slots + i], complex_result[i].imag(), 0.5);
+        }
+        encoder.decode_packed_real(plain, result);
+        ASSERT_EQ(2 * slots, result.size());
+        for (size_t i = 0; i < 2 * slots; i++)
+        {
+            ASSERT_NEAR(values[i], result[i], 0.5);
+        }
+
+        // Fewer values are padded with zeros
+        values.resize(slots + 3);
+        encoder.encode_packed_real(values, delta, plain);
+        encoder.decode_packed_real(plain, result);
+        for (size_t i = 0; i < 2 * slots; i++)
+        {
+            ASSERT_NEAR(i < values.size() ? values[i] : 0.0, result[i], 0.5);
+        }
+
+        values.resize(2 * slots + 1);
+        ASSERT_THROW(encoder.encode_packed_real(values, delta, plain), invalid_argument);
+    }
+
     TEST(CKKSEncoderTest, CKKSEncoderEncodeSingleDecodeTest)
     {
         EncryptionParameters parms(scheme_type::ckks);
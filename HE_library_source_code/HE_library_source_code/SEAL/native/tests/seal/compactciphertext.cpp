@@ -0,0 +1,107 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "seal/ciphertext.h"
+#include "seal/compactciphertext.h"
+#include "seal/context.h"
+#include "seal/encryptor.h"
+#include "seal/keygenerator.h"
+#include "seal/modulus.h"
+#include <sstream>
+#include <stdexcept>
+#include "gtest/gtest.h"
+
+using namespace seal;
+using namespace std;
+
+namespace sealtest
+{
+    TEST(CompactCiphertextTest, PackUnpackSaveLoad)
+    {
+        EncryptionParameters parms(scheme_type::bfv);
+        parms.set_poly_modulus_degree(64);
+        parms.set_coeff_modulus(CoeffModulus::Create(64, { 30, 40, 50 }));
+        parms.set_plain_modulus(257);
+        SEALContext context(parms, true, sec_level_type::none);
+        KeyGenerator keygen(context);
+        PublicKey pk;
+        keygen.create_public_key(pk);
+        Encryptor encryptor(context, pk);
+
+        // Packing is lossless without truncation
+        Ciphertext ctxt;
+        encryptor.encrypt_zero(ctxt);
+        CompactCiphertext compact;
+        compact.pack(context, ctxt);
+        ASSERT_TRUE(ctxt.parms_id() == compact.parms_id());
+        ASSERT_EQ(2ULL, compact.size());
+        ASSERT_EQ(0, compact.truncated_bit_count());
+        ASSERT_EQ(2ULL * 64 * (30 + 40) / 64, compact.data().size());
+
+        Ciphertext unpacked;
+        compact.unpack(context, unpacked);
+        ASSERT_TRUE(ctxt.parms_id() == unpacked.parms_id());
+        ASSERT_EQ(ctxt.size(), unpacked.size());
+        ASSERT_FALSE(unpacked.is_ntt_form());
+        for (size_t i = 0; i < ctxt.dyn_array().size(); i++)
+        {
+            ASSERT_EQ(ctxt.dyn_array()[i], unpacked.dyn_array()[i]);
+        }
+
+        // Serialization preserves the packed data and is smaller than for Ciphertext
+        stringstream stream;
+        compact.save(stream, compr_mode_type::none);
+        ASSERT_TRUE(compact.save_size(compr_mode_type::none) < ctxt.save_size(compr_mode_type::none));
+        CompactCiphertext loaded;
+        loaded.load(context, stream);
+        ASSERT_TRUE(compact.parms_id() == loaded.parms_id());
+        ASSERT_EQ(compact.size(), loaded.size());
+        ASSERT_EQ(compact.data().size(), loaded.data().size());
+        for (size_t i = 0; i < compact.data().size(); i++)
+        {
+            ASSERT_EQ(compact.data()[i], loaded.data()[i]);
+        }
+
+        // Truncation rounds to the nearest multiple of a power of two at a single prime
+        Ciphertext last_ctxt;
+        encryptor.encrypt_zero(context.last_parms_id(), last_ctxt);
+        uint64_t modulus = context.last_context_data()->parms().coeff_modulus()[0].value();
+        compact.pack(context, last_ctxt, 10);
+        ASSERT_EQ(10, compact.truncated_bit_count());
+        ASSERT_EQ(2ULL * 64 * 20 / 64, compact.data().size());
+        compact.unpack(context, unpacked);
+        for (size_t i = 0; i < last_ctxt.dyn_array().size(); i++)
+        {
+            uint64_t value = unpacked.dyn_array()[i];
+            uint64_t expected = last_ctxt.dyn_array()[i];
+            ASSERT_EQ(0ULL, value & 1023);
+            ASSERT_TRUE(value < modulus);
+            uint64_t distance = value > expected ? value - expected : expected - value;
+            ASSERT_TRUE(distance <= 512 || modulus - distance <= 512);
+        }
+
+        stream.str("");
+        compact.save(stream);
+        loaded.load(context, stream);
+        ASSERT_EQ(10, loaded.truncated_bit_count());
+        loaded.unpack(context, last_ctxt);
+        for (size_t i = 0; i < last_ctxt.dyn_array().size(); i++)
+        {
+            ASSERT_EQ(unpacked.dyn_array()[i], last_ctxt.dyn_array()[i]);
+        }
+
+        // Truncation is not supported with several primes or in NTT form, and must leave some bits
+        ASSERT_THROW(compact.pack(context, ctxt, 1), invalid_argument);
+        ASSERT_THROW(compact.pack(context, last_ctxt, -1), invalid_argument);
+        ASSERT_THROW(compact.pack(context, last_ctxt, 30), invalid_argument);
+
+        // Data for other parameters is rejected
+        EncryptionParameters other_parms(parms);
+        other_parms.set_plain_modulus(263);
+        SEALContext other_context(other_parms, true, sec_level_type::none);
+        ASSERT_THROW(compact.unpack(other_context, unpacked), invalid_argument);
+        stream.str("");
+        compact.save(stream);
+        ASSERT_THROW(loaded.load(other_context, stream), logic_error);
+    }
+} // namespace sealtest
@@ -414,6 +414,43 @@ namespace sealtest
         }
     }
 
+    TEST(ContextTest, HybridKeySwitchingModulusChain)
+    {
+        EncryptionParameters parms(scheme_type::ckks);
+        parms.set_poly_modulus_degree(64);
+        parms.set_coeff_modulus(CoeffModulus::Create(64, { 40, 40, 40, 40, 40, 40, 40 }));
+        {
+            SEALContext context(parms, true, sec_level_type::none);
+            ASSERT_EQ(size_t(1), context.special_prime_count());
+            ASSERT_EQ(size_t(6), context.first_context_data()->parms().coeff_modulus().size());
+            ASSERT_FALSE(!!context.first_context_data()->key_switch_tool());
+        }
+        {
+            // Seven primes with at most two digits: three special primes, and four primes in digits of three and one
+            parms.set_key_switching_digit_count(2);
+            SEALContext context(parms, true, sec_level_type::none);
+            ASSERT_EQ(size_t(3), context.special_prime_count());
+            ASSERT_EQ(size_t(4), context.key_context_data()->chain_index());
+            ASSERT_FALSE(!!context.key_context_data()->key_switch_tool());
+            auto context_data = context.first_context_data();
+            ASSERT_EQ(size_t(4), context_data->parms().coeff_modulus().size());
+            ASSERT_EQ(size_t(2), context_data->parms().key_switching_digit_count());
+            ASSERT_EQ(size_t(2), context_data->key_switch_tool()->digit_count());
+            context_data = context_data->next_context_data();
+            ASSERT_EQ(size_t(3), context_data->parms().coeff_modulus().size());
+            ASSERT_EQ(size_t(1), context_data->key_switch_tool()->digit_count());
+            ASSERT_EQ(size_t(1), context.last_context_data()->parms().coeff_modulus().size());
+            ASSERT_EQ(size_t(1), context.last_context_data()->key_switch_tool()->digit_count());
+        }
+        {
+            // A digit count of at least the number of primes minus one is the same as the default
+            parms.set_key_switching_digit_count(6);
+            SEALContext context(parms, true, sec_level_type::none);
+            ASSERT_EQ(size_t(1), context.special_prime_count());
+            ASSERT_FALSE(!!context.first_context_data()->key_switch_tool());
+        }
+    }
+
     TEST(EncryptionParameterQualifiersTest, BFVParameterError)
     {
         auto scheme = scheme_type::bfv;
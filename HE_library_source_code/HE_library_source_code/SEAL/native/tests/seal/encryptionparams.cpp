@@ -106,6 +106,12 @@ namespace sealtest
             parms3.set_poly_modulus_degree(64);
             ASSERT_TRUE(parms3 == parms1);
 
+            parms3 = parms2;
+            parms3.set_key_switching_digit_count(2);
+            ASSERT_FALSE(parms3 == parms2);
+            parms3.set_key_switching_digit_count(0);
+            ASSERT_TRUE(parms3 == parms2);
+
             parms3 = parms2;
             parms3.set_coeff_modulus({ 2 });
             parms3.set_coeff_modulus(CoeffModulus::Create(64, { 50 }));
@@ -147,6 +153,16 @@ namespace sealtest
             ASSERT_TRUE(parms.plain_modulus() == parms2.plain_modulus());
             ASSERT_TRUE(parms.poly_modulus_degree() == parms2.poly_modulus_degree());
             ASSERT_TRUE(parms == parms2);
+
+            // The key switching digit count does not change the size of the saved parameters
+            auto size_without_digit_count = parms.save_size(compr_mode_type::none);
+            parms.set_key_switching_digit_count(1);
+            ASSERT_EQ(size_without_digit_count, parms.save_size(compr_mode_type::none));
+            parms.save(stream);
+            parms2.load(stream);
+            ASSERT_EQ(size_t(1), parms2.key_switching_digit_count());
+            ASSERT_TRUE(parms.coeff_modulus() == parms2.coeff_modulus());
+            ASSERT_TRUE(parms == parms2);
         };
         encryption_parameters_save_load(scheme_type::bfv);
         encryption_parameters_save_load(scheme_type::bgv);
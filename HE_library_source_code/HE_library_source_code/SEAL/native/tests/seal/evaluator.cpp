@@ -9,9 +9,14 @@
 #include "seal/evaluator.h"
 #include "seal/keygenerator.h"
 #include "seal/modulus.h"
+#include "seal/util/polyeval.h"
+#include "seal/util/uintarithsmallmod.h"
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <ctime>
+#include <functional>
+#include <sstream>
 #include <string>
 #include "gtest/gtest.h"
 
@@ -3965,6 +3970,71 @@ namespace sealtest
         }
     }
 
+    TEST(EvaluatorTest, CKKSModSwitchToInplaceKeepsAllocation)
+    {
+        EncryptionParameters parms(scheme_type::ckks);
+        size_t slot_size = 32;
+        parms.set_poly_modulus_degree(slot_size * 2);
+        parms.set_coeff_modulus(CoeffModulus::Create(slot_size * 2, { 60, 40, 40, 40, 60 }));
+
+        SEALContext context(parms, true, sec_level_type::none);
+        KeyGenerator keygen(context);
+        CKKSEncoder encoder(context);
+        Encryptor encryptor(context, keygen.secret_key());
+        Decryptor decryptor(context, keygen.secret_key());
+        Evaluator evaluator(context);
+
+        vector<double> input(slot_size);
+        for (size_t i = 0; i < slot_size; i++)
+        {
+            input[i] = static_cast<double>(i % 7) - 3.0;
+        }
+        Plaintext plain;
+        encoder.encode(input, pow(2.0, 20), plain);
+        Ciphertext encrypted;
+        encryptor.encrypt_symmetric(plain, encrypted);
+
+        // A size 3 ciphertext checks that all polynomials are moved
+        evaluator.square_inplace(encrypted);
+        ASSERT_EQ(size_t(3), encrypted.size());
+
+        // Switching one level at a time out of place gives the expected result
+        Ciphertext expected = encrypted;
+        while (expected.parms_id() != context.last_parms_id())
+        {
+            Ciphertext next;
+            evaluator.mod_switch_to_next(expected, next);
+            expected = next;
+        }
+
+        const uint64_t *data = encrypted.data();
+        evaluator.mod_switch_to_inplace(encrypted, context.last_parms_id());
+        ASSERT_TRUE(encrypted.parms_id() == context.last_parms_id());
+        ASSERT_EQ(data, encrypted.data());
+        ASSERT_EQ(expected.dyn_array().size(), encrypted.dyn_array().size());
+        for (size_t i = 0; i < expected.dyn_array().size(); i++)
+        {
+            ASSERT_EQ(expected[i], encrypted[i]);
+        }
+        ASSERT_EQ(expected.scale(), encrypted.scale());
+
+        Plaintext plain_result;
+        vector<double> output;
+        decryptor.decrypt(encrypted, plain_result);
+        encoder.decode(plain_result, output);
+        for (size_t i = 0; i < slot_size; i++)
+        {
+            ASSERT_NEAR(input[i] * input[i], output[i], 0.01);
+        }
+
+        // Plaintexts are truncated
+        data = plain.data();
+        evaluator.mod_switch_to_inplace(plain, context.last_parms_id());
+        ASSERT_TRUE(plain.parms_id() == context.last_parms_id());
+        ASSERT_EQ(data, plain.data());
+        ASSERT_EQ(slot_size * 2, plain.coeff_count());
+    }
+
     TEST(EvaluatorTest, CKKSEncryptMultiplyRelinRescaleModSwitchAddDecrypt)
     {
         EncryptionParameters parms(scheme_type::ckks);
@@ -4290,6 +4360,94 @@ namespace sealtest
         }
     }
 
+    TEST(EvaluatorTest, CKKSEncryptSeparatePackedRealDecrypt)
+    {
+        EncryptionParameters parms(scheme_type::ckks);
+        size_t slot_size = 32;
+        parms.set_poly_modulus_degree(slot_size * 2);
+        parms.set_coeff_modulus(CoeffModulus::Create(slot_size * 2, { 60, 40, 40, 60 }));
+
+        SEALContext context(parms, true, sec_level_type::none);
+        KeyGenerator keygen(context);
+        PublicKey pk;
+        keygen.create_public_key(pk);
+        GaloisKeys glk;
+        keygen.create_galois_keys(vector<int>{ 0 }, glk);
+
+        Encryptor encryptor(context, pk);
+        Evaluator evaluator(context);
+        Decryptor decryptor(context, keygen.secret_key());
+        CKKSEncoder encoder(context);
+        const double delta = static_cast<double>(1ULL << 40);
+
+        srand(static_cast<unsigned>(time(NULL)));
+        vector<double> input(2 * slot_size);
+        for (auto &value : input)
+        {
+            value = static_cast<double>(rand() % 1000) / 100.0 - 5.0;
+        }
+
+        Plaintext plain;
+        Ciphertext encrypted;
+        encoder.encode_packed_real(input, delta, plain);
+        encryptor.encrypt(plain, encrypted);
+
+        // Linear operations act on both halves at once
+        evaluator.add_inplace(encrypted, encrypted);
+        decryptor.decrypt(encrypted, plain);
+        vector<double> packed_output;
+        encoder.decode_packed_real(plain, packed_output);
+        for (size_t i = 0; i < 2 * slot_size; i++)
+        {
+            ASSERT_NEAR(2.0 * input[i], packed_output[i], 1e-3);
+        }
+
+        Ciphertext encrypted_real;
+        Ciphertext encrypted_imag;
+        evaluator.separate_packed_real(encrypted, glk, encrypted_real, encrypted_imag);
+        ASSERT_EQ(encrypted.parms_id(), encrypted_real.parms_id());
+        ASSERT_EQ(encrypted.parms_id(), encrypted_imag.parms_id());
+        ASSERT_DOUBLE_EQ(2.0 * delta, encrypted_real.scale());
+        ASSERT_DOUBLE_EQ(2.0 * sqrt(2.0) * delta, encrypted_imag.scale());
+
+        vector<complex<double>> output;
+        decryptor.decrypt(encrypted_real, plain);
+        encoder.decode(plain, output);
+        for (size_t i = 0; i < slot_size; i++)
+        {
+            ASSERT_NEAR(2.0 * input[i], output[i].real(), 1e-3);
+            ASSERT_NEAR(0.0, output[i].imag(), 1e-3);
+        }
+        decryptor.decrypt(encrypted_imag, plain);
+        encoder.decode(plain, output);
+        for (size_t i = 0; i < slot_size; i++)
+        {
+            ASSERT_NEAR(2.0 * input[slot_size + i], output[i].real(), 1e-3);
+            ASSERT_NEAR(0.0, output[i].imag(), 1e-3);
+        }
+
+        // The separated parts can be multiplied
+        evaluator.multiply_inplace(encrypted_real, encrypted_imag);
+        evaluator.rescale_to_next_inplace(encrypted_real);
+        decryptor.decrypt(encrypted_real, plain);
+        encoder.decode(plain, output);
+        for (size_t i = 0; i < slot_size; i++)
+        {
+            ASSERT_NEAR(4.0 * input[i] * input[slot_size + i], output[i].real(), 1e-2);
+        }
+
+        // The destinations may alias the input
+        evaluator.separate_packed_real(encrypted, glk, encrypted, encrypted_imag);
+        decryptor.decrypt(encrypted, plain);
+        encoder.decode(plain, output);
+        for (size_t i = 0; i < slot_size; i++)
+        {
+            ASSERT_NEAR(2.0 * input[i], output[i].real(), 1e-3);
+        }
+        ASSERT_THROW(
+            evaluator.separate_packed_real(encrypted, glk, encrypted_imag, encrypted_imag), invalid_argument);
+    }
+
     TEST(EvaluatorTest, CKKSEncryptRescaleRotateDecrypt)
     {
         EncryptionParameters parms(scheme_type::ckks);
@@ -6140,4 +6298,916 @@ namespace sealtest
         ASSERT_TRUE(encrypted.parms_id() == parms_id);
         ASSERT_TRUE(plain.to_string() == "5x^64 + Ax^5");
     }
+
+    TEST(EvaluatorTest, CKKSEncryptEvaluatePolynomialDecrypt)
+    {
+        EncryptionParameters parms(scheme_type::ckks);
+        size_t slot_size = 16;
+        parms.set_poly_modulus_degree(64);
+        parms.set_coeff_modulus(CoeffModulus::Create(64, { 60, 40, 40, 40, 40, 40, 40, 60 }));
+        SEALContext context(parms, true, sec_level_type::none);
+        KeyGenerator keygen(context);
+        PublicKey pk;
+        keygen.create_public_key(pk);
+        RelinKeys rlk;
+        keygen.create_relin_keys(rlk);
+
+        CKKSEncoder encoder(context);
+        Encryptor encryptor(context, pk);
+        Decryptor decryptor(context, keygen.secret_key());
+        Evaluator evaluator(context);
+
+        double scale = pow(2.0, 40);
+        vector<double> input(slot_size);
+        for (size_t i = 0; i < slot_size; i++)
+        {
+            input[i] = -1.0 + 2.0 * static_cast<double>(i) / static_cast<double>(slot_size - 1);
+        }
+        Plaintext plain;
+        Ciphertext encrypted;
+        encoder.encode(input, scale, plain);
+        encryptor.encrypt(plain, encrypted);
+
+        auto evaluate = [](const vector<double> &coeffs, double x) {
+            double result = 0;
+            for (size_t i = coeffs.size(); i-- > 0;)
+            {
+                result = result * x + coeffs[i];
+            }
+            return result;
+        };
+
+        vector<vector<double>> polys{ { 0.5, 2.0 },
+                                      { 1.0, -0.5, 0.25, 0.125 },
+                                      { 0.0, 1.0, 0.0, -1.0 / 6, 0.0, 1.0 / 120, 0.0, -1.0 / 5040 },
+                                      { 0.1, 0.9, -0.8, 0.7, -0.6, 0.5, -0.4, 0.3, -0.2, 0.1, 0.2, -0.3, 0.4, -0.5, 0.6,
+                                        -0.7, 0.8, -0.9, 1.0, -0.5, 0.25, -0.125, 0.0625, 0.5, -0.25, 0.125, -0.0625,
+                                        0.03125, -1.0, 1.0, -1.0, 1.0 } };
+        Ciphertext destination;
+        vector<double> output;
+        for (auto &coeffs : polys)
+        {
+            evaluator.evaluate_polynomial(encrypted, coeffs, rlk, destination);
+            ASSERT_TRUE(util::are_close<double>(scale, destination.scale()));
+            ASSERT_EQ(destination.size(), size_t(2));
+
+            decryptor.decrypt(destination, plain);
+            encoder.decode(plain, output);
+            for (size_t i = 0; i < slot_size; i++)
+            {
+                ASSERT_NEAR(evaluate(coeffs, input[i]), output[i], 1e-3);
+            }
+        }
+
+        // Degree 31 needs five levels and the product of the leading terms
+        Ciphertext low_level;
+        evaluator.mod_switch_to_next(encrypted, low_level);
+        evaluator.mod_switch_to_next_inplace(low_level);
+        ASSERT_THROW(evaluator.evaluate_polynomial(low_level, polys[3], rlk, destination), invalid_argument);
+        ASSERT_THROW(
+            evaluator.evaluate_polynomial(encrypted, vector<double>{ 1.0, 0.0 }, rlk, destination), invalid_argument);
+
+        // In-place evaluation
+        evaluator.evaluate_polynomial(encrypted, polys[1], rlk, encrypted);
+        decryptor.decrypt(encrypted, plain);
+        encoder.decode(plain, output);
+        for (size_t i = 0; i < slot_size; i++)
+        {
+            ASSERT_NEAR(evaluate(polys[1], input[i]), output[i], 1e-3);
+        }
+    }
+
+    TEST(EvaluatorTest, CKKSEncryptEvaluateChebyshevSeriesDecrypt)
+    {
+        EncryptionParameters parms(scheme_type::ckks);
+        size_t slot_size = 16;
+        parms.set_poly_modulus_degree(64);
+        parms.set_coeff_modulus(CoeffModulus::Create(64, { 60, 40, 40, 40, 40, 40, 40, 60 }));
+        SEALContext context(parms, true, sec_level_type::none);
+        KeyGenerator keygen(context);
+        PublicKey pk;
+        keygen.create_public_key(pk);
+        RelinKeys rlk;
+        keygen.create_relin_keys(rlk);
+
+        CKKSEncoder encoder(context);
+        Encryptor encryptor(context, pk);
+        Decryptor decryptor(context, keygen.secret_key());
+        Evaluator evaluator(context);
+
+        double scale = pow(2.0, 40);
+        vector<double> input(slot_size);
+        for (size_t i = 0; i < slot_size; i++)
+        {
+            input[i] = -8.0 + 16.0 * static_cast<double>(i) / static_cast<double>(slot_size - 1);
+        }
+        Plaintext plain;
+        Ciphertext encrypted;
+        encoder.encode(input, scale, plain);
+        encryptor.encrypt(plain, encrypted);
+
+        auto sigmoid = [](double x) { return 1 / (1 + exp(-x)); };
+        Ciphertext destination;
+        vector<double> output;
+        for (size_t degree : { 3, 8, 15, 24 })
+        {
+            auto coeffs = util::chebyshev_coefficients(sigmoid, -8, 8, degree);
+            evaluator.evaluate_chebyshev_series(encrypted, coeffs, -8, 8, rlk, destination);
+            ASSERT_TRUE(util::are_close<double>(scale, destination.scale()));
+
+            decryptor.decrypt(destination, plain);
+            encoder.decode(plain, output);
+            for (size_t i = 0; i < slot_size; i++)
+            {
+                ASSERT_NEAR(util::evaluate_chebyshev_series(coeffs, -8, 8, input[i]), output[i], 1e-3);
+            }
+        }
+
+        // On [-1, 1] no level is spent on the change of variable
+        vector<double> coeffs{ 0.25, -0.5, 1.0, 0.75 };
+        encoder.encode(vector<double>(slot_size, 0.5), scale, plain);
+        encryptor.encrypt(plain, encrypted);
+        evaluator.evaluate_chebyshev_series(encrypted, coeffs, -1, 1, rlk, destination);
+        ASSERT_EQ(
+            context.get_context_data(encrypted.parms_id())->chain_index() - 2,
+            context.get_context_data(destination.parms_id())->chain_index());
+        decryptor.decrypt(destination, plain);
+        encoder.decode(plain, output);
+        for (size_t i = 0; i < slot_size; i++)
+        {
+            ASSERT_NEAR(util::evaluate_chebyshev_series(coeffs, -1, 1, 0.5), output[i], 1e-3);
+        }
+
+        ASSERT_THROW(evaluator.evaluate_chebyshev_series(encrypted, coeffs, 1, -1, rlk, destination), invalid_argument);
+        ASSERT_THROW(
+            evaluator.evaluate_chebyshev_series(encrypted, { 1.0 }, -1, 1, rlk, destination), invalid_argument);
+    }
+
+    TEST(EvaluatorTest, BFVEncryptEvaluatePolynomialDecrypt)
+    {
+        EncryptionParameters parms(scheme_type::bfv);
+        Modulus plain_modulus(PlainModulus::Batching(64, 20));
+        parms.set_poly_modulus_degree(64);
+        parms.set_plain_modulus(plain_modulus);
+        parms.set_coeff_modulus(CoeffModulus::Create(64, { 60, 60, 60, 60 }));
+        SEALContext context(parms, true, sec_level_type::none);
+        KeyGenerator keygen(context);
+        PublicKey pk;
+        keygen.create_public_key(pk);
+        RelinKeys rlk;
+        keygen.create_relin_keys(rlk);
+
+        BatchEncoder encoder(context);
+        Encryptor encryptor(context, pk);
+        Decryptor decryptor(context, keygen.secret_key());
+        Evaluator evaluator(context);
+
+        uint64_t t = plain_modulus.value();
+        vector<uint64_t> input(encoder.slot_count());
+        for (size_t i = 0; i < input.size(); i++)
+        {
+            input[i] = (i * 7919) % t;
+        }
+        Plaintext plain;
+        Ciphertext encrypted;
+        encoder.encode(input, plain);
+        encryptor.encrypt(plain, encrypted);
+
+        auto evaluate = [&](const vector<uint64_t> &coeffs, uint64_t x) {
+            uint64_t result = 0;
+            for (size_t i = coeffs.size(); i-- > 0;)
+            {
+                result = util::multiply_uint_mod(result, x, plain_modulus);
+                result = util::add_uint_mod(result, util::barrett_reduce_64(coeffs[i], plain_modulus), plain_modulus);
+            }
+            return result;
+        };
+
+        vector<vector<uint64_t>> polys{ { 3, 1 }, { 0, 0, 1 }, { 5, t - 1, 2, 0, 7, 1, t - 3, 4 }, { 1, 2, 3, 4, 5 } };
+        Ciphertext destination;
+        vector<uint64_t> output;
+        for (auto &coeffs : polys)
+        {
+            evaluator.evaluate_polynomial(encrypted, coeffs, rlk, destination);
+            ASSERT_EQ(destination.size(), size_t(2));
+            decryptor.decrypt(destination, plain);
+            encoder.decode(plain, output);
+            for (size_t i = 0; i < input.size(); i++)
+            {
+                ASSERT_EQ(evaluate(coeffs, input[i]), output[i]);
+            }
+        }
+
+        ASSERT_THROW(
+            evaluator.evaluate_polynomial(encrypted, vector<uint64_t>{ 1, t }, rlk, destination), invalid_argument);
+    }
+
+    TEST(EvaluatorTest, BGVEncryptEvaluatePolynomialDecrypt)
+    {
+        EncryptionParameters parms(scheme_type::bgv);
+        Modulus plain_modulus(PlainModulus::Batching(64, 20));
+        parms.set_poly_modulus_degree(64);
+        parms.set_plain_modulus(plain_modulus);
+        parms.set_coeff_modulus(CoeffModulus::Create(64, { 60, 60, 60, 60, 60 }));
+        SEALContext context(parms, true, sec_level_type::none);
+        KeyGenerator keygen(context);
+        PublicKey pk;
+        keygen.create_public_key(pk);
+        RelinKeys rlk;
+        keygen.create_relin_keys(rlk);
+
+        BatchEncoder encoder(context);
+        Encryptor encryptor(context, pk);
+        Decryptor decryptor(context, keygen.secret_key());
+        Evaluator evaluator(context);
+
+        uint64_t t = plain_modulus.value();
+        vector<uint64_t> input(encoder.slot_count());
+        for (size_t i = 0; i < input.size(); i++)
+        {
+            input[i] = (i * 7919 + 11) % t;
+        }
+        Plaintext plain;
+        Ciphertext encrypted;
+        encoder.encode(input, plain);
+        encryptor.encrypt(plain, encrypted);
+
+        auto evaluate = [&](const vector<uint64_t> &coeffs, uint64_t x) {
+            uint64_t result = 0;
+            for (size_t i = coeffs.size(); i-- > 0;)
+            {
+                result = util::multiply_uint_mod(result, x, plain_modulus);
+                result = util::add_uint_mod(result, coeffs[i], plain_modulus);
+            }
+            return result;
+        };
+
+        vector<vector<uint64_t>> polys{ { 0, 5 }, { 5, t - 1, 2, 0, 7, 1, t - 3, 4 } };
+        Ciphertext destination;
+        vector<uint64_t> output;
+        for (auto &coeffs : polys)
+        {
+            evaluator.evaluate_polynomial(encrypted, coeffs, rlk, destination);
+            decryptor.decrypt(destination, plain);
+            encoder.decode(plain, output);
+            for (size_t i = 0; i < input.size(); i++)
+            {
+                ASSERT_EQ(evaluate(coeffs, input[i]), output[i]);
+            }
+        }
+    }
+
+    TEST(EvaluatorTest, BGVLevelManagement)
+    {
+        EncryptionParameters parms(scheme_type::bgv);
+        Modulus plain_modulus(PlainModulus::Batching(64, 20));
+        parms.set_poly_modulus_degree(64);
+        parms.set_plain_modulus(plain_modulus);
+        parms.set_coeff_modulus(CoeffModulus::Create(64, { 60, 60, 60, 60, 60 }));
+        SEALContext context(parms, true, sec_level_type::none);
+        KeyGenerator keygen(context);
+        PublicKey pk;
+        keygen.create_public_key(pk);
+        RelinKeys rlk;
+        keygen.create_relin_keys(rlk);
+
+        BatchEncoder encoder(context);
+        Encryptor encryptor(context, pk);
+        Decryptor decryptor(context, keygen.secret_key());
+        Evaluator evaluator(context);
+        ASSERT_EQ(level_management_mode::manual, evaluator.level_management());
+        ASSERT_THROW(evaluator.set_level_management(static_cast<level_management_mode>(3)), invalid_argument);
+
+        vector<uint64_t> input1(encoder.slot_count());
+        vector<uint64_t> input2(encoder.slot_count());
+        for (size_t i = 0; i < input1.size(); i++)
+        {
+            input1[i] = i + 1;
+            input2[i] = 3 * i + 2;
+        }
+        Plaintext plain1;
+        Plaintext plain2;
+        Ciphertext encrypted1;
+        Ciphertext encrypted2;
+        encoder.encode(input1, plain1);
+        encoder.encode(input2, plain2);
+        encryptor.encrypt(plain1, encrypted1);
+        encryptor.encrypt(plain2, encrypted2);
+
+        Ciphertext low;
+        evaluator.mod_switch_to_next(encrypted2, low);
+        Ciphertext destination;
+        ASSERT_THROW(evaluator.add(encrypted1, low, destination), invalid_argument);
+
+        Plaintext plain;
+        vector<uint64_t> output;
+        auto check = [&](const Ciphertext &encrypted, const function<uint64_t(uint64_t, uint64_t)> &op) {
+            decryptor.decrypt(encrypted, plain);
+            encoder.decode(plain, output);
+            for (size_t i = 0; i < input1.size(); i++)
+            {
+                ASSERT_EQ(op(input1[i], input2[i]) % plain_modulus.value(), output[i]);
+            }
+        };
+
+        evaluator.set_level_management(level_management_mode::align);
+        evaluator.add(encrypted1, low, destination);
+        ASSERT_TRUE(destination.parms_id() == low.parms_id());
+        check(destination, [](uint64_t a, uint64_t b) { return a + b; });
+
+        evaluator.sub(low, encrypted1, destination);
+        ASSERT_TRUE(destination.parms_id() == low.parms_id());
+        check(destination, [&](uint64_t a, uint64_t b) { return b + plain_modulus.value() - a; });
+
+        evaluator.multiply(encrypted1, low, destination);
+        ASSERT_TRUE(destination.parms_id() == low.parms_id());
+        ASSERT_TRUE(encrypted1.parms_id() == context.first_parms_id());
+        check(destination, [](uint64_t a, uint64_t b) { return a * b; });
+
+        // Eager mode switches products down right away until the last level is reached
+        evaluator.set_level_management(level_management_mode::eager);
+        evaluator.multiply(encrypted1, encrypted2, destination);
+        ASSERT_TRUE(destination.parms_id() == low.parms_id());
+        evaluator.relinearize_inplace(destination, rlk);
+        check(destination, [](uint64_t a, uint64_t b) { return a * b; });
+
+        Ciphertext square = encrypted1;
+        for (size_t i = 0; i < 3; i++)
+        {
+            evaluator.square_inplace(square);
+            evaluator.relinearize_inplace(square, rlk);
+        }
+        ASSERT_TRUE(square.parms_id() == context.last_parms_id());
+        evaluator.add_inplace(square, encrypted2);
+        ASSERT_TRUE(square.parms_id() == context.last_parms_id());
+        decryptor.decrypt(square, plain);
+        encoder.decode(plain, output);
+        for (size_t i = 0; i < input1.size(); i++)
+        {
+            uint64_t power = input1[i];
+            for (size_t j = 0; j < 3; j++)
+            {
+                power = util::multiply_uint_mod(power, power, plain_modulus);
+            }
+            ASSERT_EQ(util::add_uint_mod(power, input2[i], plain_modulus), output[i]);
+        }
+    }
+
+    TEST(EvaluatorTest, CKKSLevelManagement)
+    {
+        EncryptionParameters parms(scheme_type::ckks);
+        size_t slot_size = 16;
+        parms.set_poly_modulus_degree(64);
+        parms.set_coeff_modulus(CoeffModulus::Create(64, { 60, 40, 40, 60 }));
+        SEALContext context(parms, true, sec_level_type::none);
+        KeyGenerator keygen(context);
+        PublicKey pk;
+        keygen.create_public_key(pk);
+        RelinKeys rlk;
+        keygen.create_relin_keys(rlk);
+
+        CKKSEncoder encoder(context);
+        Encryptor encryptor(context, pk);
+        Decryptor decryptor(context, keygen.secret_key());
+        Evaluator evaluator(context);
+
+        double scale = pow(2.0, 40);
+        vector<double> input1(slot_size, 1.5);
+        vector<double> input2(slot_size, -0.75);
+        Plaintext plain;
+        Ciphertext encrypted1;
+        Ciphertext encrypted2;
+        encoder.encode(input1, scale, plain);
+        encryptor.encrypt(plain, encrypted1);
+        encoder.encode(input2, scale, plain);
+        encryptor.encrypt(plain, encrypted2);
+
+        Ciphertext low;
+        evaluator.mod_switch_to_next(encrypted2, low);
+        Ciphertext destination;
+        ASSERT_THROW(evaluator.add(encrypted1, low, destination), invalid_argument);
+
+        vector<double> output;
+        evaluator.set_level_management(level_management_mode::align);
+        evaluator.add(encrypted1, low, destination);
+        ASSERT_TRUE(destination.parms_id() == low.parms_id());
+        decryptor.decrypt(destination, plain);
+        encoder.decode(plain, output);
+        for (size_t i = 0; i < slot_size; i++)
+        {
+            ASSERT_NEAR(0.75, output[i], 1e-6);
+        }
+
+        // Eager mode rescales products right away
+        evaluator.set_level_management(level_management_mode::eager);
+        evaluator.multiply(encrypted1, encrypted2, destination);
+        ASSERT_TRUE(destination.parms_id() == low.parms_id());
+        double dropped = static_cast<double>(context.first_context_data()->parms().coeff_modulus().back().value());
+        ASSERT_TRUE(util::are_close<double>(scale * scale / dropped, destination.scale()));
+        evaluator.relinearize_inplace(destination, rlk);
+        decryptor.decrypt(destination, plain);
+        encoder.decode(plain, output);
+        for (size_t i = 0; i < slot_size; i++)
+        {
+            ASSERT_NEAR(-1.125, output[i], 1e-3);
+        }
+
+        // Polynomial evaluation is unaffected by eager level management
+        evaluator.evaluate_polynomial(encrypted1, vector<double>{ 1.0, 0.5, 0.25 }, rlk, destination);
+        decryptor.decrypt(destination, plain);
+        encoder.decode(plain, output);
+        for (size_t i = 0; i < slot_size; i++)
+        {
+            ASSERT_NEAR(1.0 + 0.75 + 0.5625, output[i], 1e-3);
+        }
+    }
+
+    namespace
+    {
+        // Runs a small circuit and checks that the estimated noise budget never exceeds the actual noise budget by
+        // more than rounding, and is at most max_gap bits below it
+        void check_noise_estimate(scheme_type scheme, int max_gap)
+        {
+            EncryptionParameters parms(scheme);
+            parms.set_poly_modulus_degree(4096);
+            parms.set_coeff_modulus(CoeffModulus::BFVDefault(4096));
+            parms.set_plain_modulus(PlainModulus::Batching(4096, 17));
+            SEALContext context(parms, true, sec_level_type::none);
+            KeyGenerator keygen(context);
+            PublicKey pk;
+            keygen.create_public_key(pk);
+            RelinKeys rlk;
+            keygen.create_relin_keys(rlk);
+            GaloisKeys glk;
+            keygen.create_galois_keys(vector<int>{ 1 }, glk);
+
+            BatchEncoder encoder(context);
+            Encryptor encryptor(context, pk, keygen.secret_key());
+            Decryptor decryptor(context, keygen.secret_key());
+            Evaluator evaluator(context);
+
+            vector<uint64_t> values(encoder.slot_count());
+            for (size_t i = 0; i < values.size(); i++)
+            {
+                values[i] = (i * 7919) % parms.plain_modulus().value();
+            }
+            Plaintext plain;
+            encoder.encode(values, plain);
+
+            auto check = [&](const Ciphertext &encrypted) {
+                int actual = decryptor.invariant_noise_budget(encrypted);
+                int estimate = evaluator.estimate_noise_budget(encrypted);
+                ASSERT_LE(estimate, actual + 1);
+                ASSERT_GE(estimate + max_gap, actual);
+            };
+
+            Ciphertext encrypted1;
+            Ciphertext encrypted2;
+            encryptor.encrypt(plain, encrypted1);
+            encryptor.encrypt_symmetric(plain, encrypted2);
+            check(encrypted1);
+            check(encrypted2);
+
+            Ciphertext result;
+            evaluator.add(encrypted1, encrypted2, result);
+            check(result);
+            evaluator.multiply_plain(encrypted1, plain, result);
+            check(result);
+            evaluator.multiply(encrypted1, encrypted2, result);
+            check(result);
+            evaluator.relinearize_inplace(result, rlk);
+            check(result);
+            evaluator.rotate_rows_inplace(result, 1, glk);
+            check(result);
+            evaluator.mod_switch_to_next_inplace(result);
+            check(result);
+            evaluator.mod_switch_to_next(encrypted1, result);
+            check(result);
+        }
+    } // namespace
+
+    TEST(EvaluatorTest, BFVNoiseEstimate)
+    {
+        check_noise_estimate(scheme_type::bfv, 3);
+    }
+
+    TEST(EvaluatorTest, BGVNoiseEstimate)
+    {
+        // BGV products are estimated in the worst case
+        check_noise_estimate(scheme_type::bgv, 10);
+    }
+
+    TEST(EvaluatorTest, NoiseEstimateLevelManagement)
+    {
+        EncryptionParameters parms(scheme_type::bfv);
+        parms.set_poly_modulus_degree(8192);
+        parms.set_coeff_modulus(CoeffModulus::BFVDefault(8192));
+        parms.set_plain_modulus(PlainModulus::Batching(8192, 20));
+        SEALContext context(parms, true, sec_level_type::none);
+        KeyGenerator keygen(context);
+        PublicKey pk;
+        keygen.create_public_key(pk);
+        RelinKeys rlk;
+        keygen.create_relin_keys(rlk);
+
+        BatchEncoder encoder(context);
+        Encryptor encryptor(context, pk);
+        Decryptor decryptor(context, keygen.secret_key());
+        Evaluator evaluator(context);
+
+        Plaintext plain;
+        encoder.encode(vector<uint64_t>(encoder.slot_count(), 3), plain);
+        Ciphertext encrypted;
+        encryptor.encrypt(plain, encrypted);
+        ASSERT_TRUE(encrypted.noise_estimate() > 0);
+
+        // BFV ciphertexts are switched down only when this costs less than one bit of noise budget
+        evaluator.set_level_management(level_management_mode::eager);
+        Ciphertext product;
+        evaluator.square(encrypted, product);
+        evaluator.relinearize_inplace(product, rlk);
+        ASSERT_TRUE(product.parms_id() == context.first_parms_id());
+        int budget = evaluator.estimate_noise_budget(product);
+
+        evaluator.square_inplace(product);
+        evaluator.relinearize_inplace(product, rlk);
+        auto &context_data = *context.get_context_data(product.parms_id());
+        ASSERT_TRUE(context_data.chain_index() < context.first_context_data()->chain_index());
+        ASSERT_TRUE(evaluator.estimate_noise_budget(product) <= decryptor.invariant_noise_budget(product) + 1);
+        ASSERT_TRUE(evaluator.estimate_noise_budget(product) > 0);
+        ASSERT_TRUE(evaluator.estimate_noise_budget(product) < budget);
+
+        decryptor.decrypt(product, plain);
+        vector<uint64_t> output;
+        encoder.decode(plain, output);
+        for (auto value : output)
+        {
+            ASSERT_EQ(81ULL, value);
+        }
+
+        // No estimate is available after serialization, and never for CKKS
+        stringstream stream;
+        encrypted.save(stream);
+        Ciphertext loaded;
+        loaded.load(context, stream);
+        ASSERT_THROW(static_cast<void>(evaluator.estimate_noise_budget(loaded)), logic_error);
+
+        EncryptionParameters ckks_parms(scheme_type::ckks);
+        ckks_parms.set_poly_modulus_degree(64);
+        ckks_parms.set_coeff_modulus(CoeffModulus::Create(64, { 30, 30 }));
+        SEALContext ckks_context(ckks_parms, false, sec_level_type::none);
+        KeyGenerator ckks_keygen(ckks_context);
+        Encryptor ckks_encryptor(ckks_context, ckks_keygen.secret_key());
+        Evaluator ckks_evaluator(ckks_context);
+        CKKSEncoder ckks_encoder(ckks_context);
+        ckks_encoder.encode(1.0, pow(2.0, 20), plain);
+        ckks_encryptor.encrypt_symmetric(plain, encrypted);
+        ASSERT_EQ(0.0, encrypted.noise_estimate());
+        ASSERT_THROW(static_cast<void>(ckks_evaluator.estimate_noise_budget(encrypted)), logic_error);
+    }
+
+    namespace
+    {
+        void check_prepare_for_transport(scheme_type scheme)
+        {
+            EncryptionParameters parms(scheme);
+            parms.set_poly_modulus_degree(4096);
+            parms.set_coeff_modulus(CoeffModulus::BFVDefault(4096));
+            parms.set_plain_modulus(PlainModulus::Batching(4096, 20));
+            SEALContext context(parms, true, sec_level_type::none);
+            KeyGenerator keygen(context);
+            PublicKey pk;
+            keygen.create_public_key(pk);
+            RelinKeys rlk;
+            keygen.create_relin_keys(rlk);
+
+            BatchEncoder encoder(context);
+            Encryptor encryptor(context, pk);
+            Decryptor decryptor(context, keygen.secret_key());
+            Evaluator evaluator(context);
+
+            Plaintext plain;
+            encoder.encode(vector<uint64_t>(encoder.slot_count(), 5), plain);
+            Ciphertext encrypted;
+            encryptor.encrypt(plain, encrypted);
+            evaluator.square_inplace(encrypted);
+            evaluator.relinearize_inplace(encrypted, rlk);
+
+            // The ciphertext is switched to the last level, and truncated in BFV
+            CompactCiphertext compact;
+            evaluator.prepare_for_transport(encrypted, compact);
+            ASSERT_TRUE(compact.parms_id() == context.last_parms_id());
+            ASSERT_EQ(scheme == scheme_type::bfv, compact.truncated_bit_count() > 0);
+            ASSERT_TRUE(compact.save_size() < encrypted.save_size());
+            ASSERT_TRUE(2 * compact.save_size(compr_mode_type::none) < encrypted.save_size(compr_mode_type::none));
+
+            Ciphertext unpacked;
+            compact.unpack(context, unpacked);
+            ASSERT_TRUE(decryptor.invariant_noise_budget(unpacked) > 0);
+            vector<uint64_t> output;
+            decryptor.decrypt(compact, plain);
+            encoder.decode(plain, output);
+            for (auto value : output)
+            {
+                ASSERT_EQ(25ULL, value);
+            }
+
+            // A large noise budget to keep prevents switching and truncation
+            evaluator.prepare_for_transport(encrypted, compact, 1000);
+            ASSERT_TRUE(compact.parms_id() == encrypted.parms_id());
+            ASSERT_EQ(0, compact.truncated_bit_count());
+            evaluator.prepare_for_transport(encrypted, compact, 1, false);
+            ASSERT_EQ(0, compact.truncated_bit_count());
+
+            // Without a noise estimate the ciphertext is only packed
+            stringstream stream;
+            encrypted.save(stream);
+            Ciphertext loaded;
+            loaded.load(context, stream);
+            evaluator.prepare_for_transport(loaded, compact);
+            ASSERT_TRUE(compact.parms_id() == encrypted.parms_id());
+            ASSERT_EQ(0, compact.truncated_bit_count());
+            decryptor.decrypt(compact, plain);
+            encoder.decode(plain, output);
+            for (auto value : output)
+            {
+                ASSERT_EQ(25ULL, value);
+            }
+
+            ASSERT_THROW(evaluator.prepare_for_transport(encrypted, compact, -1), invalid_argument);
+        }
+    } // namespace
+
+    TEST(EvaluatorTest, BFVPrepareForTransport)
+    {
+        check_prepare_for_transport(scheme_type::bfv);
+    }
+
+    TEST(EvaluatorTest, BGVPrepareForTransport)
+    {
+        check_prepare_for_transport(scheme_type::bgv);
+
+        EncryptionParameters parms(scheme_type::ckks);
+        parms.set_poly_modulus_degree(64);
+        parms.set_coeff_modulus(CoeffModulus::Create(64, { 30, 30 }));
+        SEALContext context(parms, false, sec_level_type::none);
+        KeyGenerator keygen(context);
+        Encryptor encryptor(context, keygen.secret_key());
+        Evaluator evaluator(context);
+        CKKSEncoder encoder(context);
+        Plaintext plain;
+        encoder.encode(1.0, pow(2.0, 20), plain);
+        Ciphertext encrypted;
+        encryptor.encrypt_symmetric(plain, encrypted);
+        CompactCiphertext compact;
+        ASSERT_THROW(evaluator.prepare_for_transport(encrypted, compact), logic_error);
+    }
+
+    namespace
+    {
+        void check_multiply_scalar_monomial(scheme_type scheme)
+        {
+            EncryptionParameters parms(scheme);
+            parms.set_poly_modulus_degree(64);
+            parms.set_coeff_modulus(CoeffModulus::Create(64, { 40, 40 }));
+            parms.set_plain_modulus(257);
+            SEALContext context(parms, false, sec_level_type::none);
+            KeyGenerator keygen(context);
+            Encryptor encryptor(context, keygen.secret_key());
+            Decryptor decryptor(context, keygen.secret_key());
+            Evaluator evaluator(context);
+
+            Ciphertext encrypted;
+            encryptor.encrypt_symmetric(Plaintext("3x^63 + 1Fx^10 + 100x^1 + 7"), encrypted);
+            Ciphertext result;
+            Ciphertext expected;
+            Plaintext plain;
+            Plaintext plain_expected;
+
+            // Compare with multiply_plain by the same constant, including negative and unreduced constants
+            for (int64_t scalar : { int64_t(1), int64_t(-1), int64_t(5), int64_t(-200), int64_t(1000) })
+            {
+                evaluator.multiply_scalar(encrypted, scalar, result);
+                Plaintext constant(1);
+                constant[0] = static_cast<uint64_t>(((scalar % 257) + 257) % 257);
+                evaluator.multiply_plain(encrypted, constant, expected);
+                decryptor.decrypt(result, plain);
+                decryptor.decrypt(expected, plain_expected);
+                ASSERT_EQ(plain_expected.to_string(), plain.to_string());
+                ASSERT_LE(result.noise_estimate(), expected.noise_estimate() + 1e-9);
+            }
+            ASSERT_THROW(evaluator.multiply_scalar(encrypted, 0, result), invalid_argument);
+            ASSERT_THROW(evaluator.multiply_scalar(encrypted, 514, result), invalid_argument);
+
+            // Compare with multiply_plain by the same monomial; exponents of at least N flip the sign
+            Plaintext monomial;
+            for (size_t exponent : { size_t(0), size_t(1), size_t(37), size_t(63), size_t(64), size_t(100) })
+            {
+                evaluator.multiply_monomial(encrypted, -3, exponent, result);
+                monomial.resize(64);
+                monomial.set_zero();
+                monomial[exponent % 64] = exponent < 64 ? 254 : 3;
+                evaluator.multiply_plain(encrypted, monomial, expected);
+                decryptor.decrypt(result, plain);
+                decryptor.decrypt(expected, plain_expected);
+                ASSERT_EQ(plain_expected.to_string(), plain.to_string());
+            }
+            ASSERT_THROW(evaluator.multiply_monomial(encrypted, 257, 1, result), invalid_argument);
+
+            // BFV ciphertexts in NTT form are multiplied pointwise and must agree exactly with the shift
+            if (scheme == scheme_type::bfv)
+            {
+                evaluator.transform_to_ntt(encrypted, result);
+                evaluator.multiply_monomial_inplace(result, 5, 91);
+                evaluator.transform_from_ntt_inplace(result);
+                evaluator.multiply_monomial(encrypted, 5, 91, expected);
+                ASSERT_TRUE(equal(result.data(), result.data() + result.dyn_array().size(), expected.data()));
+            }
+        }
+    } // namespace
+
+    TEST(EvaluatorTest, BFVMultiplyScalarMonomial)
+    {
+        check_multiply_scalar_monomial(scheme_type::bfv);
+    }
+
+    TEST(EvaluatorTest, BGVMultiplyScalarMonomial)
+    {
+        check_multiply_scalar_monomial(scheme_type::bgv);
+    }
+
+    TEST(EvaluatorTest, CKKSMultiplyScalarMonomial)
+    {
+        EncryptionParameters parms(scheme_type::ckks);
+        parms.set_poly_modulus_degree(64);
+        parms.set_coeff_modulus(CoeffModulus::Create(64, { 40, 40 }));
+        SEALContext context(parms, false, sec_level_type::none);
+        KeyGenerator keygen(context);
+        Encryptor encryptor(context, keygen.secret_key());
+        Decryptor decryptor(context, keygen.secret_key());
+        Evaluator evaluator(context);
+        CKKSEncoder encoder(context);
+
+        vector<double> input(encoder.slot_count());
+        for (size_t i = 0; i < input.size(); i++)
+        {
+            input[i] = static_cast<double>(i) / 8.0 - 1.0;
+        }
+        Plaintext plain;
+        encoder.encode(input, pow(2.0, 20), plain);
+        Ciphertext encrypted;
+        encryptor.encrypt_symmetric(plain, encrypted);
+
+        // The scale is unchanged, so no level is consumed
+        Ciphertext result;
+        evaluator.multiply_scalar(encrypted, -3, result);
+        ASSERT_EQ(encrypted.scale(), result.scale());
+        vector<double> output;
+        decryptor.decrypt(result, plain);
+        encoder.decode(plain, output);
+        for (size_t i = 0; i < input.size(); i++)
+        {
+            ASSERT_NEAR(-3.0 * input[i], output[i], 0.01);
+        }
+        ASSERT_THROW(evaluator.multiply_scalar(encrypted, 0, result), invalid_argument);
+
+        // X^N = -1, and X^k * X^(2N - k) = 1 exactly
+        Ciphertext negated;
+        evaluator.multiply_monomial(encrypted, 1, 64, result);
+        evaluator.negate(encrypted, negated);
+        ASSERT_TRUE(equal(result.data(), result.data() + result.dyn_array().size(), negated.data()));
+        evaluator.multiply_monomial(encrypted, 1, 27, result);
+        evaluator.multiply_monomial_inplace(result, 1, 128 - 27);
+        ASSERT_TRUE(equal(result.data(), result.data() + result.dyn_array().size(), encrypted.data()));
+
+        // Agrees with the negacyclic shift of the ciphertext in normal form
+        Ciphertext expected;
+        evaluator.multiply_monomial(encrypted, 7, 45, result);
+        evaluator.transform_from_ntt(encrypted, expected);
+        evaluator.multiply_monomial_inplace(expected, 7, 45);
+        evaluator.transform_to_ntt_inplace(expected);
+        ASSERT_TRUE(equal(result.data(), result.data() + result.dyn_array().size(), expected.data()));
+    }
+
+    namespace
+    {
+        void check_hybrid_key_switching(scheme_type scheme)
+        {
+            // Six primes with two digits: two special primes and four primes for data
+            EncryptionParameters parms(scheme);
+            parms.set_poly_modulus_degree(64);
+            parms.set_coeff_modulus(CoeffModulus::Create(64, { 50, 40, 40, 40, 50, 50 }));
+            if (scheme != scheme_type::ckks)
+            {
+                parms.set_plain_modulus(PlainModulus::Batching(64, 20));
+            }
+            parms.set_key_switching_digit_count(2);
+            SEALContext context(parms, true, sec_level_type::none);
+            ASSERT_EQ(size_t(2), context.special_prime_count());
+            ASSERT_EQ(size_t(4), context.first_context_data()->parms().coeff_modulus().size());
+
+            KeyGenerator keygen(context);
+            PublicKey pk;
+            keygen.create_public_key(pk);
+            RelinKeys rlk;
+            keygen.create_relin_keys(rlk);
+            GaloisKeys glk;
+            keygen.create_galois_keys(vector<int>{ 1 }, glk);
+            ASSERT_EQ(size_t(2), rlk.key(2).size());
+            ASSERT_TRUE(is_valid_for(rlk, context));
+            ASSERT_TRUE(is_valid_for(glk, context));
+
+            Encryptor encryptor(context, pk);
+            Encryptor sym_encryptor(context, keygen.secret_key());
+            Decryptor decryptor(context, keygen.secret_key());
+            Evaluator evaluator(context);
+
+            if (scheme == scheme_type::ckks)
+            {
+                CKKSEncoder encoder(context);
+                vector<double> input(encoder.slot_count());
+                for (size_t i = 0; i < input.size(); i++)
+                {
+                    input[i] = static_cast<double>(i % 7) - 3.0;
+                }
+                Plaintext plain;
+                encoder.encode(input, pow(2.0, 40), plain);
+                Ciphertext encrypted;
+                encryptor.encrypt(plain, encrypted);
+
+                // Rotate at the first level, where all digits are full, and after rescaling, where the last digit has
+                // a single prime
+                evaluator.square_inplace(encrypted);
+                evaluator.relinearize_inplace(encrypted, rlk);
+                evaluator.rotate_vector_inplace(encrypted, 1, glk);
+                evaluator.rescale_to_next_inplace(encrypted);
+                evaluator.rotate_vector_inplace(encrypted, 1, glk);
+
+                vector<double> output;
+                decryptor.decrypt(encrypted, plain);
+                encoder.decode(plain, output);
+                for (size_t i = 0; i < input.size(); i++)
+                {
+                    double expected = input[(i + 2) % input.size()] * input[(i + 2) % input.size()];
+                    ASSERT_NEAR(expected, output[i], 0.001);
+                }
+
+                sym_encryptor.encrypt_symmetric(plain, encrypted);
+                evaluator.rotate_vector_inplace(encrypted, 1, glk);
+                decryptor.decrypt(encrypted, plain);
+                encoder.decode(plain, output);
+                for (size_t i = 0; i < input.size(); i++)
+                {
+                    double expected = input[(i + 3) % input.size()] * input[(i + 3) % input.size()];
+                    ASSERT_NEAR(expected, output[i], 0.001);
+                }
+            }
+            else
+            {
+                BatchEncoder encoder(context);
+                size_t row_size = encoder.slot_count() / 2;
+                vector<uint64_t> input(encoder.slot_count());
+                for (size_t i = 0; i < input.size(); i++)
+                {
+                    input[i] = i;
+                }
+                Plaintext plain;
+                encoder.encode(input, plain);
+                Ciphertext encrypted;
+                encryptor.encrypt(plain, encrypted);
+
+                evaluator.square_inplace(encrypted);
+                evaluator.relinearize_inplace(encrypted, rlk);
+                evaluator.rotate_rows_inplace(encrypted, 1, glk);
+                evaluator.mod_switch_to_next_inplace(encrypted);
+                evaluator.rotate_rows_inplace(encrypted, 1, glk);
+                ASSERT_TRUE(decryptor.invariant_noise_budget(encrypted) > 0);
+                ASSERT_TRUE(evaluator.estimate_noise_budget(encrypted) <= decryptor.invariant_noise_budget(encrypted));
+
+                vector<uint64_t> output;
+                decryptor.decrypt(encrypted, plain);
+                encoder.decode(plain, output);
+                for (size_t i = 0; i < input.size(); i++)
+                {
+                    size_t source = (i / row_size) * row_size + (i + 2) % row_size;
+                    ASSERT_EQ(input[source] * input[source], output[i]);
+                }
+            }
+        }
+    } // namespace
+
+    TEST(EvaluatorTest, BFVHybridKeySwitching)
+    {
+        check_hybrid_key_switching(scheme_type::bfv);
+    }
+
+    TEST(EvaluatorTest, BGVHybridKeySwitching)
+    {
+        check_hybrid_key_switching(scheme_type::bgv);
+    }
+
+    TEST(EvaluatorTest, CKKSHybridKeySwitching)
+    {
+        check_hybrid_key_switching(scheme_type::ckks);
+    }
 } // namespace sealtest
@@ -1,7 +1,12 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT license.
 
+#include "seal/ciphertext.h"
+#include "seal/context.h"
 #include "seal/dynarray.h"
+#include "seal/encryptor.h"
+#include "seal/evaluator.h"
+#include "seal/keygenerator.h"
 #include "seal/memorymanager.h"
 #include "seal/util/pointer.h"
 #include "seal/util/uintcore.h"
@@ -67,4 +72,47 @@ namespace sealtest
         }
         ASSERT_EQ(1L, pool.use_count());
     }
+
+    TEST(MemoryPoolHandleTest, Arena)
+    {
+        EncryptionParameters parms(scheme_type::bfv);
+        parms.set_poly_modulus_degree(64);
+        parms.set_coeff_modulus(CoeffModulus::Create(64, { 40, 40 }));
+        parms.set_plain_modulus(257);
+        SEALContext context(parms, false, sec_level_type::none);
+        KeyGenerator keygen(context);
+        Encryptor encryptor(context, keygen.secret_key());
+        Evaluator evaluator(context);
+        Ciphertext encrypted;
+        encryptor.encrypt_symmetric(Plaintext("1x^1 + 2"), encrypted);
+
+        MemoryPoolHandle arena = MemoryPoolHandle::Arena(size_t(1) << 16);
+        ASSERT_THROW(MemoryPoolHandle::Arena(0), invalid_argument);
+        ASSERT_THROW(MemoryPoolHandle::New().reset(), logic_error);
+        ASSERT_THROW(MemoryPoolHandle().reset(), logic_error);
+
+        size_t alloc_byte_count = 0;
+        for (int request = 0; request < 3; request++)
+        {
+            {
+                // Ciphertexts and the internal scratch memory of the evaluator both come from the arena
+                MMProfGuard guard(make_unique<MMProfFixed>(arena));
+                Ciphertext temp1(arena);
+                Ciphertext temp2(arena);
+                evaluator.square(encrypted, temp1);
+                evaluator.add(temp1, encrypted, temp2);
+                evaluator.multiply_inplace(temp2, temp1);
+                ASSERT_TRUE(arena.alloc_byte_count() > 0);
+                ASSERT_THROW(arena.reset(), logic_error);
+            }
+            arena.reset();
+
+            // Later requests reuse the memory of the first one
+            if (request == 0)
+            {
+                alloc_byte_count = arena.alloc_byte_count();
+            }
+            ASSERT_EQ(alloc_byte_count, arena.alloc_byte_count());
+        }
+    }
 } // namespace sealtest
@@ -0,0 +1,280 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "seal/batchencoder.h"
+#include "seal/ckks.h"
+#include "seal/context.h"
+#include "seal/decryptor.h"
+#include "seal/encryptor.h"
+#include "seal/evaluator.h"
+#include "seal/keygenerator.h"
+#include "seal/paramselector.h"
+#include "seal/util/uintarithsmallmod.h"
+#include <cmath>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include "gtest/gtest.h"
+
+using namespace seal;
+using namespace std;
+
+namespace sealtest
+{
+    TEST(ParameterSelectorTest, LatencyModel)
+    {
+        LatencyModel model;
+        for (auto scheme : { scheme_type::bfv, scheme_type::ckks, scheme_type::bgv })
+        {
+            for (uint8_t op = 0; op <= static_cast<uint8_t>(he_op_type::mod_switch); op++)
+            {
+                double latency = model.predict(scheme, static_cast<he_op_type>(op), 4096, 2);
+                ASSERT_TRUE(latency > 0);
+                ASSERT_TRUE(model.predict(scheme, static_cast<he_op_type>(op), 8192, 2) > latency);
+                ASSERT_TRUE(model.predict(scheme, static_cast<he_op_type>(op), 4096, 3) > latency);
+            }
+        }
+        ASSERT_THROW(static_cast<void>(model.predict(scheme_type::none, he_op_type::add, 4096, 2)), invalid_argument);
+        ASSERT_THROW(static_cast<void>(model.predict(scheme_type::bfv, he_op_type::add, 0, 2)), invalid_argument);
+        ASSERT_THROW(model.add_measurement(scheme_type::bfv, he_op_type::add, 4096, 2, -1.0), invalid_argument);
+
+        // A single measurement determines the constant of its scheme and operation
+        model.add_measurement(scheme_type::bgv, he_op_type::multiply, 4096, 2, 100.0);
+        ASSERT_NEAR(100.0, model.predict(scheme_type::bgv, he_op_type::multiply, 4096, 2), 1e-6);
+        ASSERT_NEAR(200.0, model.predict(scheme_type::bgv, he_op_type::multiply, 4096, 4), 1e-6);
+
+        // Load sealbench results; the default coefficient modulus for n = 4096 has two primes at the first level
+        stringstream stream;
+        stream << "Microsoft SEAL version: 4.1.1" << endl
+               << "name,iterations,real_time,cpu_time,time_unit,bytes_per_second,items_per_second,label,"
+               << "error_occurred,error_message" << endl
+               << "\"n=4096 / log(q)=109 / BFV / EvaluateMulCt/iterations:10\",10,6000,6000,us,,,,," << endl
+               << "\"n=4096 / log(q)=109 / BFV / EvaluateRelinInplace/iterations:10\",10,1.5,1.5,ms,,,,," << endl
+               << "\"n=4096 / log(q)=109 / BFV / EncodeBatch/iterations:10\",10,100,100,us,,,,," << endl
+               << "\"n=4096 / log(q)=109 / KeyGen / Secret/iterations:10\",10,100,100,us,,,,," << endl
+               << "\"n=4096 / log(q)=109 / CKKS / EvaluateRescaleInplace/iterations:10\",10,300000,300000,ns,,,,,"
+               << endl;
+        ASSERT_EQ(3, model.load_benchmark_csv(stream));
+        ASSERT_NEAR(6000.0, model.predict(scheme_type::bfv, he_op_type::multiply, 4096, 2), 1e-6);
+        ASSERT_NEAR(1500.0, model.predict(scheme_type::bfv, he_op_type::relinearize, 4096, 2), 1e-6);
+        ASSERT_NEAR(300.0, model.predict(scheme_type::ckks, he_op_type::mod_switch, 4096, 2), 1e-6);
+
+        stringstream malformed("\"n=4096 / log(q)=109 / BFV / Decrypt/iterations:10\",10,100,100,minutes,,,,,");
+        ASSERT_THROW(model.load_benchmark_csv(malformed), invalid_argument);
+    }
+
+    TEST(ParameterSelectorTest, BFVSelect)
+    {
+        ParameterSelector selector;
+        CircuitRequirements requirements;
+        requirements.scheme = scheme_type::bfv;
+        requirements.plain_modulus_bit_count = 20;
+
+        // A depth 2 circuit does not need the 16384 degree with the default coefficient modulus
+        requirements.multiplicative_depth = 2;
+        auto selection = selector.select(requirements);
+        ASSERT_EQ(scheme_type::bfv, selection.parms.scheme());
+        ASSERT_EQ(8192ULL, selection.parms.poly_modulus_degree());
+        ASSERT_EQ(20, selection.parms.plain_modulus().bit_count());
+        ASSERT_TRUE(selection.noise_budget > 0);
+        ASSERT_EQ(8ULL, selection.latency.size());
+        ASSERT_TRUE(selection.latency[he_op_type::multiply] > selection.latency[he_op_type::add]);
+
+        SEALContext context(selection.parms);
+        ASSERT_TRUE(context.parameters_set());
+        ASSERT_EQ(sec_level_type::tc128, context.key_context_data()->qualifiers().sec_level);
+        KeyGenerator keygen(context);
+        PublicKey pk;
+        keygen.create_public_key(pk);
+        RelinKeys rlk;
+        keygen.create_relin_keys(rlk);
+        Encryptor encryptor(context, pk);
+        Evaluator evaluator(context);
+        Decryptor decryptor(context, keygen.secret_key());
+        BatchEncoder encoder(context);
+
+        uint64_t t = selection.parms.plain_modulus().value();
+        vector<uint64_t> values(encoder.slot_count());
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            values[i] = (t - 1 - i) % t;
+        }
+        Plaintext plain;
+        encoder.encode(values, plain);
+        Ciphertext encrypted;
+        encryptor.encrypt(plain, encrypted);
+
+        // Compute x^4 with two squarings
+        for (size_t i = 0; i < requirements.multiplicative_depth; i++)
+        {
+            evaluator.square_inplace(encrypted);
+            evaluator.relinearize_inplace(encrypted, rlk);
+        }
+        ASSERT_TRUE(decryptor.invariant_noise_budget(encrypted) > 0);
+        decryptor.decrypt(encrypted, plain);
+        vector<uint64_t> result;
+        encoder.decode(plain, result);
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            uint64_t square = util::multiply_uint_mod(values[i], values[i], selection.parms.plain_modulus());
+            ASSERT_EQ(util::multiply_uint_mod(square, square, selection.parms.plain_modulus()), result[i]);
+        }
+
+        // Deeper circuits need larger parameters
+        requirements.multiplicative_depth = 5;
+        auto deep_selection = selector.select(requirements);
+        ASSERT_TRUE(deep_selection.parms.poly_modulus_degree() > selection.parms.poly_modulus_degree());
+        ASSERT_TRUE(deep_selection.latency[he_op_type::multiply] > selection.latency[he_op_type::multiply]);
+
+        // Higher security needs larger parameters
+        requirements.multiplicative_depth = 2;
+        requirements.sec_level = sec_level_type::tc256;
+        auto secure_selection = selector.select(requirements);
+        ASSERT_TRUE(secure_selection.parms.poly_modulus_degree() > selection.parms.poly_modulus_degree());
+        SEALContext secure_context(secure_selection.parms, true, sec_level_type::tc256);
+        ASSERT_EQ(sec_level_type::tc256, secure_context.key_context_data()->qualifiers().sec_level);
+    }
+
+    TEST(ParameterSelectorTest, BGVSelect)
+    {
+        ParameterSelector selector;
+        CircuitRequirements requirements;
+        requirements.scheme = scheme_type::bgv;
+        requirements.plain_modulus_bit_count = 20;
+        requirements.multiplicative_depth = 3;
+        auto selection = selector.select(requirements);
+        ASSERT_EQ(scheme_type::bgv, selection.parms.scheme());
+        ASSERT_TRUE(selection.noise_budget > 0);
+
+        // One prime per level, the prime left at the end, and the special prime
+        ASSERT_EQ(requirements.multiplicative_depth + 2, selection.parms.coeff_modulus().size());
+
+        SEALContext context(selection.parms);
+        ASSERT_TRUE(context.parameters_set());
+        KeyGenerator keygen(context);
+        PublicKey pk;
+        keygen.create_public_key(pk);
+        RelinKeys rlk;
+        keygen.create_relin_keys(rlk);
+        Encryptor encryptor(context, pk);
+        Evaluator evaluator(context);
+        Decryptor decryptor(context, keygen.secret_key());
+        BatchEncoder encoder(context);
+
+        uint64_t t = selection.parms.plain_modulus().value();
+        vector<uint64_t> values(encoder.slot_count());
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            values[i] = (t - 1 - i) % t;
+        }
+        Plaintext plain;
+        encoder.encode(values, plain);
+        Ciphertext encrypted;
+        encryptor.encrypt(plain, encrypted);
+
+        vector<uint64_t> expected = values;
+        for (size_t i = 0; i < requirements.multiplicative_depth; i++)
+        {
+            evaluator.square_inplace(encrypted);
+            evaluator.relinearize_inplace(encrypted, rlk);
+            evaluator.mod_switch_to_next_inplace(encrypted);
+            for (auto &value : expected)
+            {
+                value = util::multiply_uint_mod(value, value, selection.parms.plain_modulus());
+            }
+        }
+        ASSERT_EQ(context.last_parms_id(), encrypted.parms_id());
+        ASSERT_TRUE(decryptor.invariant_noise_budget(encrypted) > 0);
+        decryptor.decrypt(encrypted, plain);
+        vector<uint64_t> result;
+        encoder.decode(plain, result);
+        ASSERT_EQ(expected, result);
+    }
+
+    TEST(ParameterSelectorTest, CKKSSelect)
+    {
+        ParameterSelector selector;
+        CircuitRequirements requirements;
+        requirements.scheme = scheme_type::ckks;
+        requirements.multiplicative_depth = 2;
+        requirements.precision_bit_count = 20;
+        requirements.integer_bit_count = 10;
+        auto selection = selector.select(requirements);
+        ASSERT_EQ(scheme_type::ckks, selection.parms.scheme());
+        ASSERT_EQ(requirements.multiplicative_depth + 2, selection.parms.coeff_modulus().size());
+        ASSERT_TRUE(selection.scale > pow(2.0, requirements.precision_bit_count));
+
+        SEALContext context(selection.parms);
+        ASSERT_TRUE(context.parameters_set());
+        KeyGenerator keygen(context);
+        PublicKey pk;
+        keygen.create_public_key(pk);
+        RelinKeys rlk;
+        keygen.create_relin_keys(rlk);
+        Encryptor encryptor(context, pk);
+        Evaluator evaluator(context);
+        Decryptor decryptor(context, keygen.secret_key());
+        CKKSEncoder encoder(context);
+
+        vector<double> values(encoder.slot_count());
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            values[i] = cos(static_cast<double>(i));
+        }
+        Plaintext plain;
+        encoder.encode(values, selection.scale, plain);
+        Ciphertext encrypted;
+        encryptor.encrypt(plain, encrypted);
+
+        vector<double> expected = values;
+        for (size_t i = 0; i < requirements.multiplicative_depth; i++)
+        {
+            evaluator.square_inplace(encrypted);
+            evaluator.relinearize_inplace(encrypted, rlk);
+            evaluator.rescale_to_next_inplace(encrypted);
+            encrypted.scale() = selection.scale;
+            for (auto &value : expected)
+            {
+                value *= value;
+            }
+        }
+        decryptor.decrypt(encrypted, plain);
+        vector<double> result;
+        encoder.decode(plain, result);
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            ASSERT_TRUE(fabs(expected[i] - result[i]) < pow(2.0, -requirements.precision_bit_count));
+        }
+    }
+
+    TEST(ParameterSelectorTest, InvalidRequirements)
+    {
+        ParameterSelector selector;
+        CircuitRequirements requirements;
+        requirements.sec_level = sec_level_type::none;
+        ASSERT_THROW(auto selection = selector.select(requirements), invalid_argument);
+
+        requirements = CircuitRequirements();
+        requirements.scheme = scheme_type::none;
+        ASSERT_THROW(auto selection = selector.select(requirements), invalid_argument);
+
+        requirements = CircuitRequirements();
+        requirements.plain_modulus_bit_count = 61;
+        ASSERT_THROW(auto selection = selector.select(requirements), invalid_argument);
+
+        // Too deep for any secure parameters
+        requirements = CircuitRequirements();
+        requirements.multiplicative_depth = 40;
+        ASSERT_THROW(auto selection = selector.select(requirements), invalid_argument);
+
+        requirements = CircuitRequirements();
+        requirements.scheme = scheme_type::ckks;
+        requirements.precision_bit_count = 0;
+        ASSERT_THROW(auto selection = selector.select(requirements), invalid_argument);
+
+        // The first prime cannot hold the integer part and the scale
+        requirements.precision_bit_count = 40;
+        ASSERT_THROW(auto selection = selector.select(requirements), invalid_argument);
+    }
+} // namespace sealtest
@@ -0,0 +1,92 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "seal/batchencoder.h"
+#include "seal/context.h"
+#include "seal/encryptor.h"
+#include "seal/evaluator.h"
+#include "seal/keygenerator.h"
+#include "seal/modulus.h"
+#include "seal/profiler.h"
+#include <stdexcept>
+#include <vector>
+#include "gtest/gtest.h"
+
+using namespace seal;
+using namespace std;
+
+namespace sealtest
+{
+    TEST(ProfilerTest, Snapshot)
+    {
+        EncryptionParameters parms(scheme_type::bfv);
+        parms.set_poly_modulus_degree(64);
+        parms.set_coeff_modulus(CoeffModulus::Create(64, { 40, 40, 40 }));
+        parms.set_plain_modulus(PlainModulus::Batching(64, 20));
+        SEALContext context(parms, false, sec_level_type::none);
+        KeyGenerator keygen(context);
+        PublicKey pk;
+        keygen.create_public_key(pk);
+        RelinKeys rlk;
+        keygen.create_relin_keys(rlk);
+        GaloisKeys glk;
+        keygen.create_galois_keys(vector<int>{ 1 }, glk);
+        Encryptor encryptor(context, pk);
+        Evaluator evaluator(context);
+        BatchEncoder encoder(context);
+
+        Plaintext plain;
+        encoder.encode(vector<uint64_t>(encoder.slot_count(), 3), plain);
+        Ciphertext encrypted;
+        encryptor.encrypt(plain, encrypted);
+
+        Profiler::Reset();
+        evaluator.square_inplace(encrypted);
+        evaluator.relinearize_inplace(encrypted, rlk);
+        evaluator.rotate_rows_inplace(encrypted, 1, glk);
+
+        auto snapshot = Profiler::Snapshot();
+        ASSERT_EQ(profile_event_type_count, snapshot.size());
+        for (size_t i = 0; i < snapshot.size(); i++)
+        {
+            ASSERT_TRUE(snapshot[i].event == static_cast<profile_event_type>(i));
+            ASSERT_FALSE(snapshot[i].name.empty());
+        }
+        auto ntt = Profiler::Snapshot(profile_event_type::ntt);
+        auto switch_key = Profiler::Snapshot(profile_event_type::switch_key);
+        auto fast_convert_array = Profiler::Snapshot(profile_event_type::fast_convert_array);
+        auto pool_allocation = Profiler::Snapshot(profile_event_type::pool_allocation);
+        ASSERT_EQ("switch_key_inplace", switch_key.name);
+        ASSERT_THROW(auto invalid = Profiler::Snapshot(static_cast<profile_event_type>(profile_event_type_count)),
+                     invalid_argument);
+
+        if (Profiler::IsEnabled())
+        {
+            // One relinearization step and one Galois automorphism
+            ASSERT_EQ(2ULL, switch_key.call_count);
+            ASSERT_TRUE(switch_key.allocated_byte_count > 0);
+            ASSERT_TRUE(ntt.call_count > 0);
+            ASSERT_TRUE(Profiler::Snapshot(profile_event_type::inverse_ntt).call_count > 0);
+            ASSERT_TRUE(fast_convert_array.call_count > 0);
+            ASSERT_TRUE(pool_allocation.call_count > 0);
+            ASSERT_TRUE(pool_allocation.allocated_byte_count >= switch_key.allocated_byte_count);
+        }
+        else
+        {
+            for (auto &counters : snapshot)
+            {
+                ASSERT_EQ(0ULL, counters.call_count);
+                ASSERT_EQ(0ULL, counters.nanoseconds);
+                ASSERT_EQ(0ULL, counters.allocated_byte_count);
+            }
+        }
+
+        Profiler::Reset();
+        for (auto &counters : Profiler::Snapshot())
+        {
+            ASSERT_EQ(0ULL, counters.call_count);
+            ASSERT_EQ(0ULL, counters.nanoseconds);
+            ASSERT_EQ(0ULL, counters.allocated_byte_count);
+        }
+    }
+} // namespace sealtest
@@ -0,0 +1,78 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "seal/memorymanager.h"
+#include "seal/modulus.h"
+#include "seal/util/lazyaccumulator.h"
+#include "seal/util/numth.h"
+#include "seal/util/uintarithsmallmod.h"
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "gtest/gtest.h"
+
+using namespace seal;
+using namespace seal::util;
+using namespace std;
+
+namespace sealtest
+{
+    namespace util
+    {
+        TEST(LazyProductAccumulator, Create)
+        {
+            MemoryPoolHandle pool = MemoryManager::GetPool();
+            ASSERT_THROW(LazyProductAccumulator(0, Modulus(17), pool), invalid_argument);
+            ASSERT_THROW(LazyProductAccumulator(4, Modulus(0), pool), invalid_argument);
+            ASSERT_THROW(LazyProductAccumulator(4, Modulus(17), MemoryPoolHandle()), invalid_argument);
+
+            // Only moduli that leave room for lazy operands in 52 bits use IFMA
+            ASSERT_EQ(has_avx512ifma(), LazyProductAccumulator(4, Modulus(get_prime(64, 50)), pool).uses_avx512ifma());
+            ASSERT_FALSE(LazyProductAccumulator(4, Modulus(get_prime(64, 51)), pool).uses_avx512ifma());
+        }
+
+        TEST(LazyProductAccumulator, MultiplyAccumulate)
+        {
+            MemoryPoolHandle pool = MemoryManager::GetPool();
+            mt19937_64 engine(0);
+
+            // An odd number of coefficients exercises the remainder of vectorized loops, and enough summands to
+            // require intermediate reductions for 60-bit moduli
+            size_t coeff_count = 13;
+            size_t summand_count = 300;
+            for (int bit_count : { 20, 36, 50, 51, 60 })
+            {
+                Modulus modulus(get_prime(64, bit_count));
+                uniform_int_distribution<uint64_t> lazy_dist(0, 4 * modulus.value() - 1);
+                uniform_int_distribution<uint64_t> dist(0, modulus.value() - 1);
+                LazyProductAccumulator accumulator(coeff_count, modulus, pool);
+
+                // Check twice to make sure reduce resets the sums
+                for (int round = 0; round < 2; round++)
+                {
+                    vector<uint64_t> expected(coeff_count, 0);
+                    vector<uint64_t> operand1(coeff_count);
+                    vector<uint64_t> operand2(coeff_count);
+                    for (size_t j = 0; j < summand_count; j++)
+                    {
+                        for (size_t i = 0; i < coeff_count; i++)
+                        {
+                            operand1[i] = lazy_dist(engine);
+                            operand2[i] = dist(engine);
+                            expected[i] = add_uint_mod(
+                                expected[i],
+                                multiply_uint_mod(barrett_reduce_64(operand1[i], modulus), operand2[i], modulus),
+                                modulus);
+                        }
+                        accumulator.multiply_accumulate(operand1.data(), operand2.data());
+                    }
+
+                    vector<uint64_t> result(coeff_count);
+                    accumulator.reduce(result.data());
+                    ASSERT_EQ(expected, result);
+                }
+            }
+        }
+    } // namespace util
+} // namespace sealtest
@@ -554,6 +554,57 @@ namespace sealtest
             }
         }
 
+        TEST(MemoryPoolTests, TestMemoryPoolArena)
+        {
+            ASSERT_THROW(MemoryPoolArena(0), invalid_argument);
+
+            MemoryPoolArena pool(1024);
+            ASSERT_TRUE(0LL == pool.pool_count());
+            ASSERT_TRUE(0LL == pool.alloc_byte_count());
+
+            Pointer<uint64_t> pointer{ pool.get_for_byte_count(bytes_per_uint64 * 0) };
+            ASSERT_FALSE(pointer.is_set());
+
+            // Items are aligned, and released items are reused by allocations of the same size
+            pointer = pool.get_for_byte_count(bytes_per_uint64 * 2);
+            uint64_t *allocation1 = pointer.get();
+            ASSERT_EQ(0ULL, reinterpret_cast<uintptr_t>(allocation1) % MemoryPoolArena::item_alignment);
+            ASSERT_TRUE(1LL == pool.live_item_count());
+            pointer.release();
+            ASSERT_TRUE(0LL == pool.live_item_count());
+            pointer = pool.get_for_byte_count(bytes_per_uint64 * 2);
+            ASSERT_TRUE(allocation1 == pointer.get());
+
+            // New items are carved from the same chunk with a bump pointer
+            Pointer<uint64_t> pointer2 = pool.get_for_byte_count(bytes_per_uint64 * 3);
+            ASSERT_TRUE(2LL == pool.pool_count());
+            ASSERT_TRUE(pointer2.get() > allocation1);
+            ASSERT_TRUE(pointer2.get() < allocation1 + 1024 / bytes_per_uint64);
+            ASSERT_EQ(0ULL, reinterpret_cast<uintptr_t>(pointer2.get()) % MemoryPoolArena::item_alignment);
+            ASSERT_TRUE(1024LL == pool.alloc_byte_count());
+
+            // Larger allocations get a chunk of their own
+            Pointer<uint64_t> pointer3 = pool.get_for_byte_count(4096);
+            ASSERT_TRUE(pool.alloc_byte_count() > 4096LL + 1024LL);
+            pointer3[511] = 1;
+
+            // Memory cannot be reset while in use, and is reused from the start afterwards
+            ASSERT_THROW(pool.reset(), logic_error);
+            pointer.release();
+            pointer2.release();
+            pointer3.release();
+            size_t alloc_byte_count = pool.alloc_byte_count();
+            pool.reset();
+            ASSERT_TRUE(alloc_byte_count == pool.alloc_byte_count());
+            pointer = pool.get_for_byte_count(bytes_per_uint64 * 3);
+            ASSERT_TRUE(allocation1 == pointer.get());
+            pointer.release();
+
+            // Other memory pools cannot be reset
+            MemoryPoolST pool_st;
+            ASSERT_THROW(static_cast<MemoryPool &>(pool_st).reset(), logic_error);
+        }
+
         TEST(MemoryPoolTests, Allocate)
         {
             MemoryPool &pool = *global_variables::global_memory_pool;
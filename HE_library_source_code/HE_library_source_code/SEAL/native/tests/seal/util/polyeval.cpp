@@ -0,0 +1,101 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "seal/util/polyeval.h"
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include "gtest/gtest.h"
+
+using namespace seal::util;
+using namespace std;
+
+namespace sealtest
+{
+    namespace util
+    {
+        TEST(PolyEval, SelectPatersonStockmeyerParams)
+        {
+            ASSERT_THROW(static_cast<void>(select_paterson_stockmeyer_params(0)), invalid_argument);
+
+            for (size_t degree = 1; degree < 300; degree++)
+            {
+                auto params = select_paterson_stockmeyer_params(degree);
+                ASSERT_EQ(size_t(0), params.baby_steps & (params.baby_steps - 1));
+                ASSERT_TRUE(params.baby_steps >= 2);
+                ASSERT_TRUE((params.baby_steps << params.giant_steps) > degree);
+
+                // Depth must be optimal
+                ASSERT_TRUE((params.baby_steps << params.giant_steps) <= 2 * degree + 1);
+            }
+
+            auto params = select_paterson_stockmeyer_params(1);
+            ASSERT_EQ(size_t(2), params.baby_steps);
+            ASSERT_EQ(size_t(0), params.giant_steps);
+            params = select_paterson_stockmeyer_params(63);
+            ASSERT_EQ(size_t(64), params.baby_steps << params.giant_steps);
+            ASSERT_TRUE(params.giant_steps > 0);
+        }
+
+        TEST(PolyEval, DividePowerSeries)
+        {
+            vector<uint64_t> quotient;
+            vector<uint64_t> remainder;
+            divide_power_series(vector<uint64_t>{ 1, 2, 3, 4, 5 }, 2, quotient, remainder);
+            ASSERT_EQ((vector<uint64_t>{ 3, 4, 5 }), quotient);
+            ASSERT_EQ((vector<uint64_t>{ 1, 2 }), remainder);
+
+            divide_power_series(vector<uint64_t>{ 1, 0, 3 }, 4, quotient, remainder);
+            ASSERT_EQ((vector<uint64_t>{ 0 }), quotient);
+            ASSERT_EQ((vector<uint64_t>{ 1, 0, 3 }), remainder);
+
+            divide_power_series(vector<uint64_t>{ 0, 0, 3 }, 2, quotient, remainder);
+            ASSERT_EQ((vector<uint64_t>{ 3 }), quotient);
+            ASSERT_EQ((vector<uint64_t>{ 0 }), remainder);
+        }
+
+        TEST(PolyEval, DivideChebyshevSeries)
+        {
+            vector<double> quotient;
+            vector<double> remainder;
+            ASSERT_THROW(divide_chebyshev_series({ 1, 2, 3, 4, 5 }, 2, quotient, remainder), invalid_argument);
+            ASSERT_THROW(divide_chebyshev_series({ 1, 2 }, 0, quotient, remainder), invalid_argument);
+
+            // Check quotient * T_4 + remainder against the dividend at a few points
+            vector<double> coeffs{ 0.5, -1.0, 0.25, 2.0, 1.5, -0.75, 0.125, 3.0 };
+            divide_chebyshev_series(coeffs, 4, quotient, remainder);
+            ASSERT_EQ(size_t(4), quotient.size());
+            ASSERT_TRUE(remainder.size() <= 4);
+            for (double x = -1.0; x <= 1.0; x += 0.125)
+            {
+                double t4 = evaluate_chebyshev_series({ 0, 0, 0, 0, 1 }, -1, 1, x);
+                double expected = evaluate_chebyshev_series(coeffs, -1, 1, x);
+                double actual = evaluate_chebyshev_series(quotient, -1, 1, x) * t4 +
+                                evaluate_chebyshev_series(remainder, -1, 1, x);
+                ASSERT_NEAR(expected, actual, 1e-12);
+            }
+        }
+
+        TEST(PolyEval, ChebyshevCoefficients)
+        {
+            ASSERT_THROW(auto coeffs = chebyshev_coefficients([](double x) { return x; }, 1, 1, 3), invalid_argument);
+
+            // Polynomials of low degree are reproduced exactly
+            auto coeffs = chebyshev_coefficients([](double x) { return 2 * x * x - 1; }, -1, 1, 4);
+            ASSERT_EQ(size_t(5), coeffs.size());
+            ASSERT_NEAR(0.0, coeffs[0], 1e-12);
+            ASSERT_NEAR(0.0, coeffs[1], 1e-12);
+            ASSERT_NEAR(1.0, coeffs[2], 1e-12);
+            ASSERT_NEAR(0.0, coeffs[3], 1e-12);
+            ASSERT_NEAR(0.0, coeffs[4], 1e-12);
+
+            auto sigmoid = [](double x) { return 1 / (1 + exp(-x)); };
+            coeffs = chebyshev_coefficients(sigmoid, -8, 8, 31);
+            for (double x = -8.0; x <= 8.0; x += 0.25)
+            {
+                ASSERT_NEAR(sigmoid(x), evaluate_chebyshev_series(coeffs, -8, 8, x), 1e-4);
+            }
+        }
+    } // namespace util
+} // namespace sealtest
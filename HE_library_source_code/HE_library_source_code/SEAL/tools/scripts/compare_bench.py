@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+
+# Copyright (c) Microsoft Corporation. All rights reserved.
+# Licensed under the MIT license.
+
+"""Compares two sealbench runs saved in Google Benchmark's JSON format, e.g., with
+
+    sealbench --benchmark_out=baseline.json --benchmark_out_format=json
+
+and reports the relative change of every benchmark case present in both runs. Cases that became slower by more than
+the threshold are flagged as regressions, in which case the script exits with status 1.
+
+When the runs have repetitions (--benchmark_repetitions), the median aggregate is compared; otherwise the mean over
+all entries of a case.
+"""
+
+import argparse
+import json
+import statistics
+import sys
+
+TIME_UNIT_TO_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load_times(path, metric):
+    with open(path) as f:
+        benchmarks = json.load(f).get("benchmarks", [])
+
+    medians = {}
+    iterations = {}
+    for entry in benchmarks:
+        name = entry.get("run_name", entry["name"])
+        if entry.get("error_occurred"):
+            continue
+        time_ns = entry[metric] * TIME_UNIT_TO_NS[entry.get("time_unit", "ns")]
+        if entry.get("run_type") == "aggregate":
+            if entry.get("aggregate_name") == "median":
+                medians[name] = time_ns
+        else:
+            iterations.setdefault(name, []).append(time_ns)
+
+    times = {name: statistics.mean(values) for name, values in iterations.items()}
+    times.update(medians)
+    return times
+
+
+def format_time(time_ns):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if time_ns >= scale:
+            return "{:.2f} {}".format(time_ns / scale, unit)
+    return "{:.0f} ns".format(time_ns)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare two sealbench JSON outputs and flag regressions.")
+    parser.add_argument("baseline", help="JSON output of the baseline run")
+    parser.add_argument("contender", help="JSON output of the run to check")
+    parser.add_argument(
+        "--threshold", type=float, default=5.0, help="slowdown in percent reported as a regression (default: 5)")
+    parser.add_argument(
+        "--metric", choices=("real_time", "cpu_time"), default="real_time", help="time to compare (default: real_time)")
+    args = parser.parse_args()
+
+    baseline = load_times(args.baseline, args.metric)
+    contender = load_times(args.contender, args.metric)
+
+    common = [name for name in baseline if name in contender]
+    if not common:
+        print("No common benchmark cases")
+        return 1
+
+    name_width = max(len(name) for name in common)
+    print("{:<{}}  {:>12}  {:>12}  {:>8}".format("Benchmark", name_width, "Baseline", "Contender", "Change"))
+    regressions = []
+    for name in common:
+        change = 100.0 * (contender[name] - baseline[name]) / baseline[name] if baseline[name] > 0 else 0.0
+        flag = ""
+        if change > args.threshold:
+            flag = "  REGRESSION"
+            regressions.append(name)
+        elif change < -args.threshold:
+            flag = "  improved"
+        print(
+            "{:<{}}  {:>12}  {:>12}  {:>+7.1f}%{}".format(
+                name, name_width, format_time(baseline[name]), format_time(contender[name]), change, flag))
+
+    for name in sorted(set(baseline) - set(contender)):
+        print("Only in baseline: " + name)
+    for name in sorted(set(contender) - set(baseline)):
+        print("Only in contender: " + name)
+
+    if regressions:
+        print("{} of {} benchmark cases regressed by more than {}%".format(
+            len(regressions), len(common), args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -478,6 +478,22 @@ static void BM_BigInt_ModInverseEq(benchmark::State& state) {
         modinveq_BigInt(a, b);
 }
 
+// native integers only
+template <typename I>
+static void modmultmontgomeryeq_BigInt(I a, const I& b, const I& m, const I& mInv) {
+    a.ModMulMontgomeryEq(b, m, mInv);
+}
+
+template <typename I>
+static void BM_BigInt_ModMultMontgomeryEq(benchmark::State& state) {
+    I a(smalla);
+    I m(smallm);
+    I b(I(smallb).ToMontgomery(m));
+    I mInv(m.ComputeMontgomeryInverse());
+    while (state.KeepRunning())
+        modmultmontgomeryeq_BigInt(a, b, m, mInv);
+}
+
 #define DO_BENCHMARK_TEMPLATE(X, Y) BENCHMARK_TEMPLATE(X, Y)->Unit(benchmark::kMicrosecond);
 
 // clang-format off
@@ -509,6 +525,7 @@ BENCHMARK_TEMPLATE(BM_BigInt_ModSub, NativeInteger)->Unit(benchmark::kMicrosecon
 BENCHMARK_TEMPLATE(BM_BigInt_ModSubEq, NativeInteger)->Unit(benchmark::kMicrosecond)->ArgName("Small")->Arg(0);
 BENCHMARK_TEMPLATE(BM_BigInt_ModMult, NativeInteger)->Unit(benchmark::kMicrosecond)->ArgName("Small")->Arg(0);
 BENCHMARK_TEMPLATE(BM_BigInt_ModMultEq, NativeInteger)->Unit(benchmark::kMicrosecond)->ArgName("Small")->Arg(0);
+BENCHMARK_TEMPLATE(BM_BigInt_ModMultMontgomeryEq, NativeInteger)->Unit(benchmark::kMicrosecond)->ArgName("Small")->Arg(0);
 BENCHMARK_TEMPLATE(BM_BigInt_ModExp, NativeInteger)->Unit(benchmark::kMicrosecond)->ArgName("Small")->Arg(0);
 BENCHMARK_TEMPLATE(BM_BigInt_ModExpEq, NativeInteger)->Unit(benchmark::kMicrosecond)->ArgName("Small")->Arg(0);
 BENCHMARK_TEMPLATE(BM_BigInt_ModInverse, NativeInteger)->Unit(benchmark::kMicrosecond)->ArgName("Small")->Arg(0);
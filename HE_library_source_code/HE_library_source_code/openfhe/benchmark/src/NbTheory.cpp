@@ -35,6 +35,7 @@
 
 #define _USE_MATH_DEFINES
 #include "lattice/lat-hal.h"
+#include "math/hal/intnat/transformnat-simd.h"
 
 #include "benchmark/benchmark.h"
 
@@ -392,5 +393,54 @@ static void BM_PROU3(benchmark::State& state) {  // benchmark
 
 BENCHMARK(BM_PROU3);  // register benchmark
 
+//==================================
+// NTT benchmarks for each SIMD engine; the arguments are the engine, log2 of the ring dimension and the modulus size
+
+static void NTT_Engine(benchmark::State& state, bool forward) {
+    auto engine           = static_cast<intnat::NTTEngine>(state.range(0));
+    usint ringDim         = 1 << state.range(1);
+    usint cycloOrder      = 2 * ringDim;
+    NativeInteger modulus = FirstPrime<NativeInteger>(state.range(2), cycloOrder);
+    modulus               = PreviousPrime<NativeInteger>(modulus, cycloOrder);
+    NativeInteger root    = RootOfUnity<NativeInteger>(cycloOrder, modulus);
+    auto tables           = ChineseRemainderTransformFTT<NativeVector>::GetTables(root, cycloOrder, modulus);
+
+    const intnat::NTTEngine defaultEngine = intnat::GetNTTEngine();
+    if (!intnat::SetNTTEngine(engine)) {
+        state.SkipWithError("NTT engine is not supported on this machine");
+        return;
+    }
+    DiscreteUniformGeneratorImpl<NativeVector> dug;
+    dug.SetModulus(modulus);
+    NativeVector a = dug.GenerateVector(ringDim);
+
+    while (state.KeepRunning()) {
+        if (forward)
+            ChineseRemainderTransformFTT<NativeVector>().ForwardTransformToBitReverseInPlace(*tables, &a);
+        else
+            ChineseRemainderTransformFTT<NativeVector>().InverseTransformFromBitReverseInPlace(*tables, &a);
+    }
+    state.SetItemsProcessed(state.iterations() * ringDim);
+    intnat::SetNTTEngine(defaultEngine);
+}
+
+static void BM_NTT_FORWARD(benchmark::State& state) {
+    NTT_Engine(state, true);
+}
+
+static void BM_NTT_INVERSE(benchmark::State& state) {
+    NTT_Engine(state, false);
+}
+
+static void NTTArguments(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"engine", "logn", "bits"});
+    b->ArgsProduct({{intnat::NTT_SCALAR, intnat::NTT_AVX2, intnat::NTT_AVX512, intnat::NTT_AVX512IFMA},
+                    {10, 12, 14, 16},
+                    {50, 60}});
+}
+
+BENCHMARK(BM_NTT_FORWARD)->Unit(benchmark::kMicrosecond)->Apply(NTTArguments);
+BENCHMARK(BM_NTT_INVERSE)->Unit(benchmark::kMicrosecond)->Apply(NTTArguments);
+
 // execute the benchmarks
 BENCHMARK_MAIN();
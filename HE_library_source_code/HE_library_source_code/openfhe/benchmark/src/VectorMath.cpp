@@ -36,6 +36,8 @@
 
 #include "vechelper.h"
 #include "lattice/elemparamfactory.h"
+#include "math/hal/intnat/transformnat-simd.h"
+#include "math/nbtheory.h"
 
 #include "benchmark/benchmark.h"
 
@@ -121,6 +123,26 @@ static void BM_BigVec_Multeq(benchmark::State& state) {  // benchmark
     }
 }
 
+// Montgomery mult, native vectors only
+template <typename V>
+static void multmontgomeryeq_BigVec(V& a, const V& b) {
+    a.ModMulMontgomeryEq(b);
+}
+
+template <typename V>
+static void BM_BigVec_MultMontgomeryeq(benchmark::State& state) {  // benchmark
+    auto p     = state.range(0);
+    size_t idx = ElemParamFactory::GetNearestIndex(p);
+    typename V::Integer q(ElemParamFactory::DefaultSet[idx].q);
+    V b = makeVector<V>(p, q);
+    V a = makeVector<V>(p, q);
+    b.ToMontgomeryEq();
+
+    while (state.KeepRunning()) {
+        multmontgomeryeq_BigVec<V>(a, b);
+    }
+}
+
 #define DO_NATIVEVECTOR_BENCHMARK(X)                                                                     \
     BENCHMARK_TEMPLATE(X, NativeVector)->Unit(benchmark::kMicrosecond)->ArgName("parm_16")->Arg(16);     \
     BENCHMARK_TEMPLATE(X, NativeVector)->Unit(benchmark::kMicrosecond)->ArgName("parm_1024")->Arg(1024); \
@@ -139,6 +161,7 @@ DO_NATIVEVECTOR_BENCHMARK(BM_BigVec_Add)
 DO_NATIVEVECTOR_BENCHMARK(BM_BigVec_Addeq)
 DO_NATIVEVECTOR_BENCHMARK(BM_BigVec_Mult)
 DO_NATIVEVECTOR_BENCHMARK(BM_BigVec_Multeq)
+DO_NATIVEVECTOR_BENCHMARK(BM_BigVec_MultMontgomeryeq)
 
 #ifdef WITH_BE2
 DO_VECTOR_BENCHMARK_TEMPLATE(BM_BigVec_Add, M2Vector)
@@ -161,5 +184,77 @@ DO_VECTOR_BENCHMARK_TEMPLATE(BM_BigVec_Mult, M6Vector)
 DO_VECTOR_BENCHMARK_TEMPLATE(BM_BigVec_Multeq, M6Vector)
 #endif
 
+//==================================
+// Element-wise operations of native vectors for each SIMD engine; the arguments are the engine, log2 of the vector
+// length and the modulus size
+
+template <typename Op>
+static void NativeVec_Engine(benchmark::State& state, Op op) {
+    auto engine     = static_cast<intnat::NTTEngine>(state.range(0));
+    usint length    = 1 << state.range(1);
+    NativeInteger q = FirstPrime<NativeInteger>(state.range(2), 2 * length);
+    q               = PreviousPrime<NativeInteger>(q, 2 * length);
+
+    const intnat::NTTEngine defaultEngine = intnat::GetNTTEngine();
+    if (!intnat::SetNTTEngine(engine)) {
+        state.SkipWithError("SIMD engine is not supported on this machine");
+        return;
+    }
+    DiscreteUniformGeneratorImpl<NativeVector> dug;
+    dug.SetModulus(q);
+    NativeVector a  = dug.GenerateVector(length);
+    NativeVector b  = dug.GenerateVector(length);
+    NativeInteger c = dug.GenerateInteger();
+
+    while (state.KeepRunning()) {
+        op(a, b, c);
+    }
+    state.SetItemsProcessed(state.iterations() * length);
+    intnat::SetNTTEngine(defaultEngine);
+}
+
+static void BM_NativeVec_ModAddEq(benchmark::State& state) {
+    NativeVec_Engine(state, [](NativeVector& a, const NativeVector& b, const NativeInteger&) { a.ModAddEq(b); });
+}
+
+static void BM_NativeVec_ModSubEq(benchmark::State& state) {
+    NativeVec_Engine(state, [](NativeVector& a, const NativeVector& b, const NativeInteger&) { a.ModSubEq(b); });
+}
+
+static void BM_NativeVec_ModAddScalarEq(benchmark::State& state) {
+    NativeVec_Engine(state, [](NativeVector& a, const NativeVector&, const NativeInteger& c) { a.ModAddEq(c); });
+}
+
+static void BM_NativeVec_ModSubScalarEq(benchmark::State& state) {
+    NativeVec_Engine(state, [](NativeVector& a, const NativeVector&, const NativeInteger& c) { a.ModSubEq(c); });
+}
+
+static void BM_NativeVec_ModMulEq(benchmark::State& state) {
+    NativeVec_Engine(state, [](NativeVector& a, const NativeVector& b, const NativeInteger&) { a.ModMulEq(b); });
+}
+
+static void BM_NativeVec_ModMulNoCheckEq(benchmark::State& state) {
+    NativeVec_Engine(state, [](NativeVector& a, const NativeVector& b, const NativeInteger&) { a.ModMulNoCheckEq(b); });
+}
+
+static void BM_NativeVec_ModMulScalarEq(benchmark::State& state) {
+    NativeVec_Engine(state, [](NativeVector& a, const NativeVector&, const NativeInteger& c) { a.ModMulEq(c); });
+}
+
+static void VectorEngineArguments(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"engine", "logn", "bits"});
+    b->ArgsProduct({{intnat::NTT_SCALAR, intnat::NTT_AVX2, intnat::NTT_AVX512, intnat::NTT_AVX512IFMA},
+                    {13, 16},
+                    {50, 60}});
+}
+
+BENCHMARK(BM_NativeVec_ModAddEq)->Unit(benchmark::kMicrosecond)->Apply(VectorEngineArguments);
+BENCHMARK(BM_NativeVec_ModSubEq)->Unit(benchmark::kMicrosecond)->Apply(VectorEngineArguments);
+BENCHMARK(BM_NativeVec_ModAddScalarEq)->Unit(benchmark::kMicrosecond)->Apply(VectorEngineArguments);
+BENCHMARK(BM_NativeVec_ModSubScalarEq)->Unit(benchmark::kMicrosecond)->Apply(VectorEngineArguments);
+BENCHMARK(BM_NativeVec_ModMulEq)->Unit(benchmark::kMicrosecond)->Apply(VectorEngineArguments);
+BENCHMARK(BM_NativeVec_ModMulNoCheckEq)->Unit(benchmark::kMicrosecond)->Apply(VectorEngineArguments);
+BENCHMARK(BM_NativeVec_ModMulScalarEq)->Unit(benchmark::kMicrosecond)->Apply(VectorEngineArguments);
+
 // execute the benchmarks
 BENCHMARK_MAIN();
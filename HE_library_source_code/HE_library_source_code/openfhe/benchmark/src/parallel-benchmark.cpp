@@ -0,0 +1,125 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Description:
+  This code measures how DCRTPoly operations scale with the number of threads for the OpenMP
+  scheduler and the work-stealing thread pool. Runs with more threads than the machine has are skipped.
+ */
+
+#include "benchmark/benchmark.h"
+
+#include "lattice/lat-hal.h"
+#include "math/distrgen.h"
+#include "utils/parallel.h"
+
+#include <memory>
+#include <vector>
+
+using namespace lbcrypto;
+
+// number of independent products computed by the nested benchmark, like the rotations of a bootstrapping step
+static const size_t NESTED_LOOPS = 8;
+
+static bool SetUpThreads(benchmark::State& state) {
+    int threads = state.range(1);
+    if (threads > OpenFHEParallelControls.GetMachineThreads()) {
+        state.SkipWithError("more threads than the machine has");
+        return false;
+    }
+    OpenFHEParallelControls.SetScheduler(static_cast<ParallelScheduler>(state.range(0)));
+    OpenFHEParallelControls.SetNumThreads(threads);
+    return true;
+}
+
+static void TearDownThreads() {
+    OpenFHEParallelControls.SetScheduler(ParallelScheduler::OPENMP);
+    OpenFHEParallelControls.Enable();
+}
+
+static std::vector<DCRTPoly> MakePolys(benchmark::State& state, size_t count) {
+    usint n     = 1 << 14;
+    auto params = std::make_shared<ILDCRTParams<BigInteger>>(2 * n, state.range(2), 50);
+    DCRTPoly::DugType dug;
+    std::vector<DCRTPoly> polys;
+    for (size_t i = 0; i < count; ++i)
+        polys.emplace_back(dug, params, Format::EVALUATION);
+    return polys;
+}
+
+static void DCRT_Times(benchmark::State& state) {
+    if (!SetUpThreads(state))
+        return;
+    auto polys = MakePolys(state, 2);
+    for (auto _ : state) {
+        DCRTPoly c = polys[0] * polys[1];
+        benchmark::DoNotOptimize(c);
+    }
+    TearDownThreads();
+}
+
+static void DCRT_SwitchFormat(benchmark::State& state) {
+    if (!SetUpThreads(state))
+        return;
+    auto polys = MakePolys(state, 1);
+    for (auto _ : state) {
+        polys[0].SwitchFormat();
+        benchmark::ClobberMemory();
+    }
+    TearDownThreads();
+}
+
+static void DCRT_NestedTimes(benchmark::State& state) {
+    if (!SetUpThreads(state))
+        return;
+    auto polys = MakePolys(state, NESTED_LOOPS + 1);
+    std::vector<DCRTPoly> results(NESTED_LOOPS);
+    for (auto _ : state) {
+        ParallelFor(0, NESTED_LOOPS, [&](size_t i) { results[i] = polys[i] * polys[NESTED_LOOPS]; });
+        benchmark::ClobberMemory();
+    }
+    TearDownThreads();
+}
+
+static void ParallelArguments(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"scheduler", "threads", "limbs"});
+    int64_t openmp{static_cast<int64_t>(ParallelScheduler::OPENMP)};
+    int64_t threadPool{static_cast<int64_t>(ParallelScheduler::THREAD_POOL)};
+    b->ArgsProduct({{openmp, threadPool}, {1, 2, 4, 8, 16, 32, 64}, {8, 32}});
+    b->UseRealTime();
+}
+
+BENCHMARK(DCRT_Times)->Unit(benchmark::kMicrosecond)->Apply(ParallelArguments);
+BENCHMARK(DCRT_SwitchFormat)->Unit(benchmark::kMicrosecond)->Apply(ParallelArguments);
+BENCHMARK(DCRT_NestedTimes)->Unit(benchmark::kMicrosecond)->Apply(ParallelArguments);
+
+// execute the benchmarks
+BENCHMARK_MAIN();
@@ -124,38 +124,37 @@ DCRTPolyImpl<VecType>::DCRTPolyImpl(const std::vector<DCRTPolyImpl::PolyType>& t
 }
 
 /*The dgg will be the seed to populate the towers of the DCRTPolyImpl with
- * random numbers. The algorithm to populate the towers can be seen below. */
+ * random numbers. The samples are drawn once and written straight into all
+ * towers, which share one buffer. */
 template <typename VecType>
 DCRTPolyImpl<VecType>::DCRTPolyImpl(const DggType& dgg, const std::shared_ptr<DCRTPolyImpl::Params>& dcrtParams,
                                     Format format)
-    : m_params{dcrtParams}, m_format{format} {
+    : m_params{dcrtParams}, m_format{Format::COEFFICIENT} {
     const usint rdim     = m_params->GetRingDimension();
     const auto dggValues = dgg.GenerateIntVector(rdim);
-    m_vectors.reserve(m_params->GetParams().size());
-    for (auto& p : m_params->GetParams()) {
-        NativeVector ildv(rdim, p->GetModulus());
-        for (usint j = 0; j < rdim; j++) {
-            NativeInteger::SignedNativeInt k = (dggValues.get())[j];
-            auto m                           = p->GetModulus().ConvertToInt();
-            auto dcrt_qmodulus               = static_cast<NativeInteger::SignedNativeInt>(m);
-            auto dgg_stddev                  = dgg.GetStd();
-            if (dgg_stddev > dcrt_qmodulus) {
-                // rescale k to dcrt_qmodulus
-                k = static_cast<NativeInteger::Integer>(k % dcrt_qmodulus);
-            }
-            if (k < 0) {
-                k *= (-1);
-                ildv[j] = static_cast<NativeInteger::Integer>(dcrt_qmodulus) - static_cast<NativeInteger::Integer>(k);
-            }
-            else {
-                ildv[j] = static_cast<NativeInteger::Integer>(k);
+    const auto* values   = dggValues.get();
+    DCRTPolyImpl::AllocateZeroLimbs();
+    for (auto& limb : m_vectors) {
+        const auto q{limb.GetModulus().ConvertToInt()};
+        auto* ildv{&limb[0]};
+        if (dgg.GetStd() > static_cast<NativeInteger::SignedNativeInt>(q)) {
+            // rescale the samples to the modulus
+            const auto sq{static_cast<NativeInteger::SignedNativeInt>(q)};
+            for (usint j = 0; j < rdim; ++j) {
+                NativeInteger::SignedNativeInt k = values[j] % sq;
+                ildv[j] = static_cast<NativeInteger::Integer>(k) + (k < 0 ? q : 0);
             }
         }
-        DCRTPolyImpl::PolyType ilvector(p);
-        ilvector.SetValues(std::move(ildv), Format::COEFFICIENT);
-        ilvector.SetFormat(m_format);
-        m_vectors.push_back(std::move(ilvector));
+        else {
+            // negative samples wrap around to q - |k|; the loop has no branches, so it is vectorized
+            // when AVX2 is enabled (WITH_NATIVEOPT)
+            for (usint j = 0; j < rdim; ++j)
+                ildv[j] = static_cast<NativeInteger::Integer>(values[j]) +
+                          (q & -static_cast<NativeInteger::Integer>(values[j] < 0));
+        }
     }
+    if (format != Format::COEFFICIENT)
+        DCRTPolyImpl::SwitchFormat();
 }
 
 template <typename VecType>
@@ -191,28 +190,20 @@ DCRTPolyImpl<VecType>::DCRTPolyImpl(const BugType& bug, const std::shared_ptr<Pa
 template <typename VecType>
 DCRTPolyImpl<VecType>::DCRTPolyImpl(const TugType& tug, const std::shared_ptr<Params>& dcrtParams, Format format,
                                     uint32_t h)
-    : m_params{dcrtParams}, m_format{format} {
+    : m_params{dcrtParams}, m_format{Format::COEFFICIENT} {
     const usint rdim     = m_params->GetRingDimension();
     const auto tugValues = tug.GenerateIntVector(rdim, h);
-    m_vectors.reserve(m_params->GetParams().size());
-    for (auto& p : m_params->GetParams()) {
-        NativeVector iltvs(rdim, p->GetModulus());
-        for (usint j = 0; j < rdim; j++) {
-            NativeInteger::SignedNativeInt k = (tugValues.get())[j];
-            if (k < 0) {
-                k *= (-1);
-                iltvs[j] = static_cast<NativeInteger::Integer>(p->GetModulus().ConvertToInt()) -
-                           static_cast<NativeInteger::Integer>(k);
-            }
-            else {
-                iltvs[j] = static_cast<NativeInteger::Integer>(k);
-            }
-        }
-        DCRTPolyImpl<VecType>::PolyType ilvector(p);
-        ilvector.SetValues(std::move(iltvs), Format::COEFFICIENT);
-        ilvector.SetFormat(m_format);
-        m_vectors.push_back(std::move(ilvector));
+    const auto* values   = tugValues.get();
+    DCRTPolyImpl::AllocateZeroLimbs();
+    for (auto& limb : m_vectors) {
+        const auto q{limb.GetModulus().ConvertToInt()};
+        auto* iltvs{&limb[0]};
+        for (usint j = 0; j < rdim; ++j)
+            iltvs[j] = static_cast<NativeInteger::Integer>(values[j]) +
+                       (q & -static_cast<NativeInteger::Integer>(values[j] < 0));
     }
+    if (format != Format::COEFFICIENT)
+        DCRTPolyImpl::SwitchFormat();
 }
 
 template <typename VecType>
@@ -227,6 +218,63 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::CloneWithNoise(const DiscreteGaussi
     return res = element;
 }
 
+template <typename VecType>
+void DCRTPolyImpl<VecType>::AllocateZeroLimbs() {
+    const auto& params{m_params->GetParams()};
+    m_vectors.clear();
+    m_vectors.reserve(params.size());
+#if BLOCK_VECTOR_ALLOCATION != 1
+    size_t bytes{0};
+    for (const auto& p : params)
+        bytes += intnat::LimbBuffer::Footprint(p->GetRingDimension() * sizeof(NativeInteger));
+    NativeVector::Allocator alloc(std::make_shared<intnat::LimbBuffer>(bytes));
+    for (const auto& p : params)
+        m_vectors.emplace_back(p, m_format, NativeVector(p->GetRingDimension(), p->GetModulus(), alloc));
+#else
+    for (const auto& p : params)
+        m_vectors.emplace_back(p, m_format, true);
+#endif
+}
+
+template <typename VecType>
+void DCRTPolyImpl<VecType>::CopyLimbs(const std::vector<PolyType>& limbs) {
+#if BLOCK_VECTOR_ALLOCATION != 1
+    size_t bytes{0};
+    for (const auto& limb : limbs) {
+        if (!limb.IsEmpty())
+            bytes += intnat::LimbBuffer::Footprint(limb.GetLength() * sizeof(NativeInteger));
+    }
+    NativeVector::Allocator alloc(std::make_shared<intnat::LimbBuffer>(bytes));
+    std::vector<PolyType> copies;
+    copies.reserve(limbs.size());
+    for (const auto& limb : limbs) {
+        if (limb.IsEmpty())
+            copies.emplace_back(limb);
+        else
+            copies.emplace_back(limb.GetParams(), limb.GetFormat(), NativeVector(limb.GetValues(), alloc));
+    }
+    m_vectors = std::move(copies);
+#else
+    m_vectors = limbs;
+#endif
+}
+
+template <typename VecType>
+bool DCRTPolyImpl<VecType>::HasContiguousLimbs() const {
+    for (size_t i = 0; i < m_vectors.size(); ++i) {
+        if (m_vectors[i].IsEmpty())
+            return false;
+    }
+    for (size_t i = 1; i < m_vectors.size(); ++i) {
+        const auto& prev{m_vectors[i - 1].GetValues()};
+        size_t stride{intnat::LimbBuffer::Footprint(prev.GetLength() * sizeof(NativeInteger))};
+        auto end{reinterpret_cast<const char*>(&prev[0]) + stride};
+        if (reinterpret_cast<const char*>(&m_vectors[i].GetValues()[0]) != end)
+            return false;
+    }
+    return true;
+}
+
 template <typename VecType>
 DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::CloneTowers(uint32_t startTower, uint32_t endTower) const {
     std::vector<NativeInteger> m(endTower - startTower + 1);
@@ -272,8 +320,7 @@ std::vector<DCRTPolyImpl<VecType>> DCRTPolyImpl<VecType>::CRTDecompose(uint32_t
     if (baseBits == 0) {
         std::vector<DCRTPolyType> result(size, *eval);
 
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-        for (size_t i = 0; i < size; ++i) {
+        ParallelFor(0, size, [&](size_t i) {
             for (size_t k = 0; k < size; ++k) {
                 if (i != k) {
                     DCRTPolyImpl::PolyType tmp((*coef).m_vectors[i]);
@@ -282,7 +329,7 @@ std::vector<DCRTPolyImpl<VecType>> DCRTPolyImpl<VecType>::CRTDecompose(uint32_t
                     result[i].m_vectors[k] = std::move(tmp);
                 }
             }
-        }
+        });
         return result;
     }
 
@@ -300,8 +347,7 @@ std::vector<DCRTPolyImpl<VecType>> DCRTPolyImpl<VecType>::CRTDecompose(uint32_t
     }
     std::vector<DCRTPolyType> result(nWindows);
 
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-    for (size_t i = 0; i < size; ++i) {
+    ParallelFor(0, size, [&](size_t i) {
         auto decomposed = (*coef).m_vectors[i].BaseDecompose(baseBits, false);
         for (size_t j = 0; j < decomposed.size(); j++) {
             DCRTPolyImpl<VecType> currentDCRTPoly(*coef);
@@ -314,7 +360,7 @@ std::vector<DCRTPolyImpl<VecType>> DCRTPolyImpl<VecType>::CRTDecompose(uint32_t
             currentDCRTPoly.SwitchFormat();
             result[j + arrWindows[i]] = std::move(currentDCRTPoly);
         }
-    }
+    });
     return result;
 }
 
@@ -382,9 +428,7 @@ template <typename VecType>
 DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::Negate() const {
     DCRTPolyImpl<VecType> tmp(m_params, m_format);
     size_t size{m_vectors.size()};
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-    for (size_t i = 0; i < size; ++i)
-        tmp.m_vectors[i] = m_vectors[i].Negate();
+    ParallelFor(0, size, [&](size_t i) { tmp.m_vectors[i] = m_vectors[i].Negate(); });
     return tmp;
 }
 
@@ -399,18 +443,14 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::Minus(const DCRTPolyImpl& rhs) cons
         OPENFHE_THROW(math_error, "tower size mismatch; cannot subtract");
     DCRTPolyImpl<VecType> tmp(m_params, m_format);
     size_t size{m_vectors.size()};
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-    for (size_t i = 0; i < size; ++i)
-        tmp.m_vectors[i] = m_vectors[i].Minus(rhs.m_vectors[i]);
+    ParallelFor(0, size, [&](size_t i) { tmp.m_vectors[i] = m_vectors[i].Minus(rhs.m_vectors[i]); });
     return tmp;
 }
 
 template <typename VecType>
 DCRTPolyImpl<VecType>& DCRTPolyImpl<VecType>::operator+=(const DCRTPolyImpl& rhs) {
     size_t size{m_vectors.size()};
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-    for (size_t i = 0; i < size; ++i)
-        m_vectors[i] += rhs.m_vectors[i];
+    ParallelFor(0, size, [&](size_t i) { m_vectors[i] += rhs.m_vectors[i]; });
     return *this;
 }
 
@@ -418,27 +458,21 @@ template <typename VecType>
 DCRTPolyImpl<VecType>& DCRTPolyImpl<VecType>::operator+=(const Integer& rhs) {
     NativeInteger val{rhs};
     size_t size{m_vectors.size()};
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-    for (size_t i = 0; i < size; ++i)
-        m_vectors[i] += val;
+    ParallelFor(0, size, [&](size_t i) { m_vectors[i] += val; });
     return *this;
 }
 
 template <typename VecType>
 DCRTPolyImpl<VecType>& DCRTPolyImpl<VecType>::operator+=(const NativeInteger& rhs) {
     size_t size{m_vectors.size()};
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-    for (size_t i = 0; i < size; ++i)
-        m_vectors[i] += rhs;
+    ParallelFor(0, size, [&](size_t i) { m_vectors[i] += rhs; });
     return *this;
 }
 
 template <typename VecType>
 DCRTPolyImpl<VecType>& DCRTPolyImpl<VecType>::operator-=(const DCRTPolyImpl& rhs) {
     size_t size{m_vectors.size()};
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-    for (size_t i = 0; i < size; ++i)
-        m_vectors[i] -= rhs.m_vectors[i];
+    ParallelFor(0, size, [&](size_t i) { m_vectors[i] -= rhs.m_vectors[i]; });
     return *this;
 }
 
@@ -446,18 +480,14 @@ template <typename VecType>
 DCRTPolyImpl<VecType>& DCRTPolyImpl<VecType>::operator-=(const Integer& rhs) {
     NativeInteger val{rhs};
     size_t size{m_vectors.size()};
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-    for (size_t i = 0; i < size; ++i)
-        m_vectors[i] -= val;
+    ParallelFor(0, size, [&](size_t i) { m_vectors[i] -= val; });
     return *this;
 }
 
 template <typename VecType>
 DCRTPolyImpl<VecType>& DCRTPolyImpl<VecType>::operator-=(const NativeInteger& rhs) {
     size_t size{m_vectors.size()};
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-    for (size_t i = 0; i < size; ++i)
-        m_vectors[i] -= rhs;
+    ParallelFor(0, size, [&](size_t i) { m_vectors[i] -= rhs; });
     return *this;
 }
 
@@ -545,9 +575,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::Plus(const Integer& rhs) const {
     NativeInteger val{rhs};
     DCRTPolyImpl<VecType> tmp(m_params, m_format);
     size_t size{m_vectors.size()};
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-    for (size_t i = 0; i < size; ++i)
-        tmp.m_vectors[i] = m_vectors[i].Plus(val);
+    ParallelFor(0, size, [&](size_t i) { tmp.m_vectors[i] = m_vectors[i].Plus(val); });
     return tmp;
 }
 
@@ -555,9 +583,7 @@ template <typename VecType>
 DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::Plus(const std::vector<Integer>& crtElement) const {
     DCRTPolyImpl<VecType> tmp(m_params, m_format);
     size_t size{m_vectors.size()};
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-    for (size_t i = 0; i < size; ++i)
-        tmp.m_vectors[i] = m_vectors[i].Plus(NativeInteger(crtElement[i]));
+    ParallelFor(0, size, [&](size_t i) { tmp.m_vectors[i] = m_vectors[i].Plus(NativeInteger(crtElement[i])); });
     return tmp;
 }
 
@@ -566,9 +592,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::Minus(const Integer& rhs) const {
     NativeInteger val{rhs};
     DCRTPolyImpl<VecType> tmp(m_params, m_format);
     size_t size{m_vectors.size()};
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-    for (size_t i = 0; i < size; ++i)
-        tmp.m_vectors[i] = m_vectors[i].Minus(val);
+    ParallelFor(0, size, [&](size_t i) { tmp.m_vectors[i] = m_vectors[i].Minus(val); });
     return tmp;
 }
 
@@ -576,9 +600,7 @@ template <typename VecType>
 DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::Minus(const std::vector<Integer>& crtElement) const {
     DCRTPolyImpl<VecType> tmp(m_params, m_format);
     size_t size{m_vectors.size()};
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-    for (size_t i = 0; i < size; ++i)
-        tmp.m_vectors[i] = m_vectors[i].Minus(NativeInteger(crtElement[i]));
+    ParallelFor(0, size, [&](size_t i) { tmp.m_vectors[i] = m_vectors[i].Minus(NativeInteger(crtElement[i])); });
     return tmp;
 }
 
@@ -587,9 +609,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::Times(const Integer& rhs) const {
     NativeInteger val{rhs};
     DCRTPolyImpl<VecType> tmp(m_params, m_format);
     size_t size{m_vectors.size()};
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-    for (size_t i = 0; i < size; ++i)
-        tmp.m_vectors[i] = m_vectors[i].Times(val);
+    ParallelFor(0, size, [&](size_t i) { tmp.m_vectors[i] = m_vectors[i].Times(val); });
     return tmp;
 }
 
@@ -597,9 +617,7 @@ template <typename VecType>
 DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::Times(NativeInteger::SignedNativeInt rhs) const {
     DCRTPolyImpl<VecType> tmp(m_params, m_format);
     size_t size{m_vectors.size()};
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-    for (size_t i = 0; i < size; ++i)
-        tmp.m_vectors[i] = m_vectors[i].Times(rhs);
+    ParallelFor(0, size, [&](size_t i) { tmp.m_vectors[i] = m_vectors[i].Times(rhs); });
     return tmp;
 }
 
@@ -607,9 +625,7 @@ template <typename VecType>
 DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::Times(const std::vector<Integer>& crtElement) const {
     DCRTPolyImpl<VecType> tmp(m_params, m_format);
     size_t size{m_vectors.size()};
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-    for (size_t i = 0; i < size; ++i)
-        tmp.m_vectors[i] = m_vectors[i].Times(NativeInteger(crtElement[i]));
+    ParallelFor(0, size, [&](size_t i) { tmp.m_vectors[i] = m_vectors[i].Times(NativeInteger(crtElement[i])); });
     return tmp;
 }
 
@@ -619,9 +635,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::Times(const std::vector<NativeInteg
         OPENFHE_THROW(math_error, "tower size mismatch; cannot multiply");
     DCRTPolyImpl<VecType> tmp(m_params, m_format);
     size_t size{m_vectors.size()};
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-    for (size_t i = 0; i < size; ++i)
-        tmp.m_vectors[i] = m_vectors[i].Times(rhs[i]);
+    ParallelFor(0, size, [&](size_t i) { tmp.m_vectors[i] = m_vectors[i].Times(rhs[i]); });
     return tmp;
 }
 
@@ -629,9 +643,7 @@ template <typename VecType>
 DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::TimesNoCheck(const std::vector<NativeInteger>& rhs) const {
     size_t vecSize = m_vectors.size() < rhs.size() ? m_vectors.size() : rhs.size();
     DCRTPolyImpl<VecType> tmp(m_params, m_format);
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(vecSize))
-    for (size_t i = 0; i < vecSize; ++i)
-        tmp.m_vectors[i] = m_vectors[i].Times(rhs[i]);
+    ParallelFor(0, vecSize, [&](size_t i) { tmp.m_vectors[i] = m_vectors[i].Times(rhs[i]); });
     return tmp;
 }
 
@@ -639,18 +651,14 @@ template <typename VecType>
 DCRTPolyImpl<VecType>& DCRTPolyImpl<VecType>::operator*=(const Integer& rhs) {
     NativeInteger val{rhs};
     size_t size{m_vectors.size()};
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-    for (size_t i = 0; i < size; ++i)
-        m_vectors[i] *= val;
+    ParallelFor(0, size, [&](size_t i) { m_vectors[i] *= val; });
     return *this;
 }
 
 template <typename VecType>
 DCRTPolyImpl<VecType>& DCRTPolyImpl<VecType>::operator*=(const NativeInteger& rhs) {
     size_t size{m_vectors.size()};
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-    for (size_t i = 0; i < size; ++i)
-        m_vectors[i] *= rhs;
+    ParallelFor(0, size, [&](size_t i) { m_vectors[i] *= rhs; });
     return *this;
 }
 
@@ -700,9 +708,7 @@ void DCRTPolyImpl<VecType>::AddILElementOne() {
     if (m_format != Format::EVALUATION)
         OPENFHE_THROW(not_available_error, "Cannot call AddILElementOne() on DCRTPoly in COEFFICIENT format.");
     size_t size{m_vectors.size()};
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-    for (size_t i = 0; i < size; ++i)
-        m_vectors[i].AddILElementOne();
+    ParallelFor(0, size, [&](size_t i) { m_vectors[i].AddILElementOne(); });
 }
 
 template <typename VecType>
@@ -752,8 +758,7 @@ void DCRTPolyImpl<VecType>::DropLastElementAndScale(const std::vector<NativeInte
     this->DropLastElement();
     size_t size{m_vectors.size()};
 
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-    for (size_t i = 0; i < size; ++i) {
+    ParallelFor(0, size, [&](size_t i) {
         auto tmp = lastPoly;
         tmp.SwitchModulus(m_vectors[i].GetModulus(), m_vectors[i].GetRootOfUnity(), 0, 0);
         tmp *= QlQlInvModqlDivqlModq[i];
@@ -763,7 +768,7 @@ void DCRTPolyImpl<VecType>::DropLastElementAndScale(const std::vector<NativeInte
         m_vectors[i] += tmp;
         if (m_format == Format::COEFFICIENT)
             m_vectors[i].SwitchFormat();
-    }
+    });
 }
 
 /**
@@ -799,15 +804,14 @@ void DCRTPolyImpl<VecType>::ModReduce(const NativeInteger& t, const std::vector<
     this->DropLastElement();
     size_t size{m_vectors.size()};
 
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-    for (size_t i = 0; i < size; ++i) {
+    ParallelFor(0, size, [&](size_t i) {
         auto tmp{delta};
         tmp.SwitchModulus(m_vectors[i].GetModulus(), m_vectors[i].GetRootOfUnity(), 0, 0);
         if (m_format == Format::EVALUATION)
             tmp.SwitchFormat();
         m_vectors[i] += (tmp *= t);
         m_vectors[i] *= qlInvModq[i];
-    }
+    });
 }
 
 /* methods to access individual members of the DCRTPolyImpl. Result is
@@ -1018,15 +1022,14 @@ void DCRTPolyImpl<VecType>::TimesQovert(const std::shared_ptr<Params>& paramsQ,
         OPENFHE_THROW(math_error, "Sizes of vectors do not match.");
     uint32_t size(m_vectors.size());
     uint32_t ringDim(m_params->GetRingDimension());
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-    for (size_t i = 0; i < size; ++i) {
+    ParallelFor(0, size, [&](size_t i) {
         for (uint32_t ri = 0; ri < ringDim; ++ri) {
             NativeInteger& xi = m_vectors[i][ri];
             xi.ModMulFastConstEq(NegQModt, t, NegQModtPrecon);
         }
         // TODO: move this inside ri loop
         m_vectors[i] = m_vectors[i].Times(tInvModq[i]);
-    }
+    });
 }
 
 template <typename VecType>
@@ -1041,8 +1044,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::ApproxSwitchCRTBasis(
     usint sizeQ   = (m_vectors.size() > paramsQ->GetParams().size()) ? paramsQ->GetParams().size() : m_vectors.size();
     usint sizeP   = ans.m_vectors.size();
 
-    #pragma omp parallel for
-    for (usint ri = 0; ri < ringDim; ri++) {
+    ParallelFor(0, ringDim, [&](usint ri) {
         std::vector<DoubleNativeInt> sum(sizeP);
         for (usint i = 0; i < sizeQ; i++) {
             const NativeInteger& xi     = m_vectors[i][ri];
@@ -1057,7 +1059,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::ApproxSwitchCRTBasis(
             const NativeInteger& pj = ans.m_vectors[j].GetModulus();
             ans.m_vectors[j][ri]    = BarrettUint128ModUint64(sum[j], pj.ConvertToInt(), modpBarrettMu[j]);
         }
-    }
+    });
     return ans;
 }
 
@@ -1069,12 +1071,11 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::ApproxSwitchCRTBasis(
 
     for (usint i = 0; i < sizeQ; i++) {
         auto xQHatInvModqi = m_vectors[i] * QHatInvModq[i];
-    #pragma omp parallel for
-        for (usint j = 0; j < sizeP; j++) {
+        ParallelFor(0, sizeP, [&](usint j) {
             auto temp = xQHatInvModqi;
             temp.SwitchModulus(ans.m_vectors[j].GetModulus(), ans.m_vectors[j].GetRootOfUnity(), 0, 0);
             ans.m_vectors[j] += (temp *= QHatModp[i][j]);
-        }
+        });
     }
     return ans;
 }
@@ -1104,13 +1105,12 @@ void DCRTPolyImpl<VecType>::ApproxModUp(const std::shared_ptr<Params>& paramsQ,
 
     m_vectors.resize(sizeQP);
 
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(sizeP))
     // populate the towers corresponding to CRT basis P and convert them to
     // evaluation representation
-    for (size_t j = 0; j < sizeP; j++) {
+    ParallelFor(0, sizeP, [&](size_t j) {
         m_vectors[sizeQ + j] = partP.m_vectors[j];
         m_vectors[sizeQ + j].SetFormat(Format::EVALUATION);
-    }
+    });
     // if the input polynomial was in evaluation representation, use the towers
     // for Q from it
     if (polyInNTT.size() > 0) {
@@ -1120,10 +1120,7 @@ void DCRTPolyImpl<VecType>::ApproxModUp(const std::shared_ptr<Params>& paramsQ,
     }
     else {
 // else call NTT for the towers for Q
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(sizeQ))
-        for (size_t i = 0; i < sizeQ; ++i) {
-            m_vectors[i].SwitchFormat();
-        }
+        ParallelFor(0, sizeQ, [&](size_t i) { m_vectors[i].SwitchFormat(); });
     }
     m_format = Format::EVALUATION;
     m_params = paramsQP;
@@ -1143,14 +1140,13 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::ApproxModDown(
 
     DCRTPolyImpl<VecType> partP(paramsP, m_format, true);
 
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(sizeP))
-    for (usint j = 0; j < sizeP; ++j) {
+    ParallelFor(0, sizeP, [&](usint j) {
         partP.m_vectors[j] = m_vectors[sizeQ + j];
         partP.m_vectors[j].SetFormat(Format::COEFFICIENT);
         // Multiply everything by -t^(-1) mod P (BGVrns only)
         if (t > 0)
             partP.m_vectors[j] *= tInvModp[j];
-    }
+    });
     partP.OverrideFormat(Format::COEFFICIENT);
 
     DCRTPolyImpl<VecType> partPSwitchedToQ =
@@ -1162,14 +1158,13 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::ApproxModDown(
     if (diffQ > 0)
         ans.DropLastElements(diffQ);
 
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(sizeQ))
-    for (usint i = 0; i < sizeQ; ++i) {
+    ParallelFor(0, sizeQ, [&](usint i) {
         // Multiply everything by t mod Q (BGVrns only)
         if (t > 0)
             partPSwitchedToQ.m_vectors[i] *= t;
         partPSwitchedToQ.m_vectors[i].SetFormat(Format::EVALUATION);
         ans.m_vectors[i] = (m_vectors[i] - partPSwitchedToQ.m_vectors[i]) * PInvModq[i];
-    }
+    });
     return ans;
 }
 
@@ -1187,8 +1182,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::SwitchCRTBasis(const std::shared_pt
     usint sizeQ   = m_vectors.size();
     usint sizeP   = ans.m_vectors.size();
 
-    #pragma omp parallel for
-    for (usint ri = 0; ri < ringDim; ri++) {
+    ParallelFor(0, ringDim, [&](usint ri) {
         std::vector<NativeInteger> xQHatInvModq(sizeQ);
         double nu{0.5};
 
@@ -1223,7 +1217,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::SwitchCRTBasis(const std::shared_pt
             // second round - remove q-overflows
             ans.m_vectors[j][ri] = curNativeValue.ModSubFast(alphaQModpri[j], pj);
         }
-    }
+    });
 
     return ans;
 }
@@ -1261,8 +1255,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::SwitchCRTBasis(const std::shared_pt
         OPENFHE_THROW(config_error, "Size of QHatModp[0] " + std::to_string(QHatModp[0].size()) +
                                         " is less than sizeQ " + std::to_string(sizeQ));
 
-    #pragma omp parallel for
-    for (usint ri = 0; ri < ringDim; ri++) {
+    ParallelFor(0, ringDim, [&](usint ri) {
         std::vector<NativeInteger> xQHatInvModq(sizeQ);
         double nu = 0.5;
 
@@ -1300,7 +1293,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::SwitchCRTBasis(const std::shared_pt
             // second round - remove q-overflows
             ans.m_vectors[j][ri].ModSubFastEq(alphaQModpri[j], pj);
         }
-    }
+    });
 
     return ans;
 }
@@ -1330,13 +1323,12 @@ void DCRTPolyImpl<VecType>::ExpandCRTBasis(
 
     m_vectors.resize(sizeQP);
 
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(sizeP))
     // populate the towers corresponding to CRT basis P and convert them to
     // evaluation representation
-    for (size_t j = 0; j < sizeP; j++) {
+    ParallelFor(0, sizeP, [&](size_t j) {
         m_vectors[sizeQ + j] = partP.m_vectors[j];
         m_vectors[sizeQ + j].SetFormat(resultFormat);
-    }
+    });
 
     if (resultFormat == Format::EVALUATION) {
         // if the input polynomial was in evaluation representation, use the towers
@@ -1347,9 +1339,7 @@ void DCRTPolyImpl<VecType>::ExpandCRTBasis(
         }
         else {
             // else call NTT for the towers for Q
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(sizeQ))
-            for (size_t i = 0; i < sizeQ; i++)
-                m_vectors[i].SetFormat(Format::EVALUATION);
+            ParallelFor(0, sizeQ, [&](size_t i) { m_vectors[i].SetFormat(Format::EVALUATION); });
         }
     }
     m_format = resultFormat;
@@ -1384,10 +1374,7 @@ void DCRTPolyImpl<VecType>::ExpandCRTBasisReverseOrder(
                 std::make_move_iterator(partP.m_vectors.end()));
     temp.insert(temp.end(), std::make_move_iterator(m_vectors.begin()), std::make_move_iterator(m_vectors.end()));
 
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(sizeQP))
-    for (size_t i = 0; i < sizeQP; i++) {
-        temp[i].SetFormat(resultFormat);
-    }
+    ParallelFor(0, sizeQP, [&](size_t i) { temp[i].SetFormat(resultFormat); });
 
     if (resultFormat == Format::EVALUATION) {
         // if the input polynomial was in evaluation representation, use the towers
@@ -1398,9 +1385,7 @@ void DCRTPolyImpl<VecType>::ExpandCRTBasisReverseOrder(
         }
         else {
             // else call NTT for the towers for Q
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(sizeQ))
-            for (size_t i = 0; i < sizeQ; i++)
-                temp[sizeP + i].SetFormat(Format::EVALUATION);
+            ParallelFor(0, sizeQ, [&](size_t i) { temp[sizeP + i].SetFormat(Format::EVALUATION); });
         }
     }
     m_format  = resultFormat;
@@ -1417,8 +1402,7 @@ void DCRTPolyImpl<VecType>::FastExpandCRTBasisPloverQ(const Precomputations& pre
 
 #if defined(HAVE_INT128) && NATIVEINT == 64
     // (k + kl)n
-    #pragma omp parallel for
-    for (usint ri = 0; ri < ringDim; ri++) {
+    ParallelFor(0, ringDim, [&](usint ri) {
         std::vector<DoubleNativeInt> sum(sizePl);
         for (usint i = 0; i < sizeQ; i++) {
             const NativeInteger& xi                     = m_vectors[i][ri];
@@ -1437,7 +1421,7 @@ void DCRTPolyImpl<VecType>::FastExpandCRTBasisPloverQ(const Precomputations& pre
             const NativeInteger& pj = partPl.m_vectors[j].GetModulus();
             partPl.m_vectors[j][ri] = BarrettUint128ModUint64(sum[j], pj.ConvertToInt(), precomputed.modpBarrettMu[j]);
         }
-    }
+    });
 
     // EMM: (l + ll)n
     // EFP: ln
@@ -1450,24 +1434,17 @@ void DCRTPolyImpl<VecType>::FastExpandCRTBasisPloverQ(const Precomputations& pre
     // Expand with zeros as should be
     m_vectors.resize(sizeQlPl);
 
-    #pragma omp parallel for
-    for (size_t i = 0; i < sizeQl; i++) {
-        m_vectors[i] = partQl.m_vectors[i];
-    }
+    ParallelFor(0, sizeQl, [&](size_t i) { m_vectors[i] = partQl.m_vectors[i]; });
 
     // We cannot use two indices in one for loop with omp parallel for.
-    #pragma omp parallel for
-    for (size_t j = 0; j < sizePl; j++) {
-        m_vectors[sizeQl + j] = partPl.m_vectors[j];
-    }
+    ParallelFor(0, sizePl, [&](size_t j) { m_vectors[sizeQl + j] = partPl.m_vectors[j]; });
 
     m_params = precomputed.paramsQlPl;
 }
 
 #else
     // (k + kl)n
-    #pragma omp parallel for
-    for (usint ri = 0; ri < ringDim; ri++) {
+    ParallelFor(0, ringDim, [&](usint ri) {
         std::vector<DoubleNativeInt> sum(sizePl);
         for (usint i = 0; i < sizeQ; i++) {
             const NativeInteger& xi                     = m_vectors[i][ri];
@@ -1481,7 +1458,7 @@ void DCRTPolyImpl<VecType>::FastExpandCRTBasisPloverQ(const Precomputations& pre
                 partPl.m_vectors[j][ri].ModAddFastEq(xQHatInvModqi.ModMulFast(qInvModpi[j], pj, mu_j), pj);
             }
         }
-    }
+    });
 
     // EMM: (l + ll)n
     // EFP: ln
@@ -1494,16 +1471,10 @@ void DCRTPolyImpl<VecType>::FastExpandCRTBasisPloverQ(const Precomputations& pre
     // Expand with zeros as should be
     m_vectors.resize(sizeQlPl);
 
-    #pragma omp parallel for
-    for (size_t i = 0; i < sizeQl; i++) {
-        m_vectors[i] = partQl.m_vectors[i];
-    }
+    ParallelFor(0, sizeQl, [&](size_t i) { m_vectors[i] = partQl.m_vectors[i]; });
 
     // We cannot use two indices in one for loop with omp parallel for.
-    #pragma omp parallel for
-    for (size_t j = 0; j < sizePl; j++) {
-        m_vectors[sizeQl + j] = partPl.m_vectors[j];
-    }
+    ParallelFor(0, sizePl, [&](size_t j) { m_vectors[sizeQl + j] = partPl.m_vectors[j]; });
 
     m_params = precomputed.paramsQlPl;
 }
@@ -1515,15 +1486,14 @@ void DCRTPolyImpl<VecType>::ExpandCRTBasisQlHat(const std::shared_ptr<Params>& p
                                                 const std::vector<NativeInteger>& QlHatModqPrecon, const usint sizeQ) {
     size_t sizeQl(m_vectors.size());
     usint ringDim(m_params->GetRingDimension());
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(sizeQl))
-    for (size_t i = 0; i < sizeQl; i++) {
+    ParallelFor(0, sizeQl, [&](size_t i) {
         const NativeInteger& qi               = m_vectors[i].GetModulus();
         const NativeInteger& QlHatModqi       = QlHatModq[i];
         const NativeInteger& QlHatModqiPrecon = QlHatModqPrecon[i];
         for (usint ri = 0; ri < ringDim; ri++) {
             m_vectors[i][ri].ModMulFastConstEq(QlHatModqi, qi, QlHatModqiPrecon);
         }
-    }
+    });
     m_vectors.resize(sizeQ);
     for (size_t i = sizeQl; i < sizeQ; i++) {
         typename DCRTPolyImpl<VecType>::PolyType newvec(paramsQ->GetParams()[i], m_format, true);
@@ -1565,8 +1535,7 @@ typename DCRTPolyImpl<VecType>::PolyType DCRTPolyImpl<VecType>::ScaleAndRound(
                 // we fit in 63 bits, so we can do multiplications and
                 // additions without modulo reduction, and do modulo reduction
                 // only once
-#pragma omp parallel for
-                for (usint ri = 0; ri < ringDim; ri++) {
+                ParallelFor(0, ringDim, [&](usint ri) {
                     double floatSum      = 0.5;
                     NativeInteger intSum = 0, tmp;
                     for (usint i = 0; i < sizeQ; i++) {
@@ -1581,7 +1550,7 @@ typename DCRTPolyImpl<VecType>::PolyType DCRTPolyImpl<VecType>::ScaleAndRound(
                     intSum += static_cast<uint64_t>(floatSum);
                     // mod a power of two
                     coefficients[ri] = intSum.ConvertToInt() & tMinus1;
-                }
+                });
             }
             else {
                 // In case of qMSB + sizeQMSB >= 52 we decompose x_i in the basis
@@ -1593,8 +1562,7 @@ typename DCRTPolyImpl<VecType>::PolyType DCRTPolyImpl<VecType>::ScaleAndRound(
                 // is bounded by 2^{-53}. Thus the floating point error is bounded by
                 // sizeQ * 2^30 * 2^{-53}. We always have sizeQ < 2^11, which means the
                 // error is bounded by 1/4, and the rounding will be correct.
-#pragma omp parallel for
-                for (usint ri = 0; ri < ringDim; ri++) {
+                ParallelFor(0, ringDim, [&](usint ri) {
                     double floatSum      = 0.5;
                     NativeInteger intSum = 0, tmp;
                     for (usint i = 0; i < sizeQ; i++) {
@@ -1608,7 +1576,7 @@ typename DCRTPolyImpl<VecType>::PolyType DCRTPolyImpl<VecType>::ScaleAndRound(
                     intSum += static_cast<uint64_t>(floatSum);
                     // mod a power of two
                     coefficients[ri] = intSum.ConvertToInt() & tMinus1;
-                }
+                });
             }
         }
         else {
@@ -1618,8 +1586,7 @@ typename DCRTPolyImpl<VecType>::PolyType DCRTPolyImpl<VecType>::ScaleAndRound(
                 // we fit in 62 bits, so we can do multiplications and
                 // additions without modulo reduction, and do modulo reduction
                 // only once
-#pragma omp parallel for
-                for (usint ri = 0; ri < ringDim; ri++) {
+                ParallelFor(0, ringDim, [&](usint ri) {
                     double floatSum      = 0.5;
                     NativeInteger intSum = 0;
                     NativeInteger tmpHi, tmpLo;
@@ -1640,11 +1607,10 @@ typename DCRTPolyImpl<VecType>::PolyType DCRTPolyImpl<VecType>::ScaleAndRound(
                     intSum += static_cast<uint64_t>(floatSum);
                     // mod a power of two
                     coefficients[ri] = intSum.ConvertToInt() & tMinus1;
-                }
+                });
             }
             else {
-#pragma omp parallel for
-                for (usint ri = 0; ri < ringDim; ri++) {
+                ParallelFor(0, ringDim, [&](usint ri) {
                     double floatSum      = 0.5;
                     NativeInteger intSum = 0;
                     NativeInteger tmpHi, tmpLo;
@@ -1664,7 +1630,7 @@ typename DCRTPolyImpl<VecType>::PolyType DCRTPolyImpl<VecType>::ScaleAndRound(
                     intSum += static_cast<uint64_t>(floatSum);
                     // mod a power of two
                     coefficients[ri] = intSum.ConvertToInt() & tMinus1;
-                }
+                });
             }
         }
     }
@@ -1684,8 +1650,7 @@ typename DCRTPolyImpl<VecType>::PolyType DCRTPolyImpl<VecType>::ScaleAndRound(
                 // we fit in 52 bits, so we can do multiplications and
                 // additions without modulo reduction, and do modulo reduction
                 // only once using floating point techniques
-#pragma omp parallel for
-                for (usint ri = 0; ri < ringDim; ri++) {
+                ParallelFor(0, ringDim, [&](usint ri) {
                     double floatSum      = 0.0;
                     NativeInteger intSum = 0, tmp;
                     for (usint i = 0; i < sizeQ; i++) {
@@ -1704,7 +1669,7 @@ typename DCRTPolyImpl<VecType>::PolyType DCRTPolyImpl<VecType>::ScaleAndRound(
                     floatSum -= td * quot;
                     // rounding
                     coefficients[ri] = static_cast<uint64_t>(floatSum + 0.5);
-                }
+                });
             }
             else {
                 // In case of qMSB + sizeQMSB >= 52 we decompose x_i in the basis
@@ -1716,8 +1681,7 @@ typename DCRTPolyImpl<VecType>::PolyType DCRTPolyImpl<VecType>::ScaleAndRound(
                 // is bounded by 2^{-53}. Thus the floating point error is bounded by
                 // sizeQ * 2^30 * 2^{-53}. We always have sizeQ < 2^11, which means the
                 // error is bounded by 1/4, and the rounding will be correct.
-#pragma omp parallel for
-                for (usint ri = 0; ri < ringDim; ri++) {
+                ParallelFor(0, ringDim, [&](usint ri) {
                     double floatSum{0.0};
                     NativeInteger intSum{0};
                     for (usint i = 0; i < sizeQ; i++) {
@@ -1733,7 +1697,7 @@ typename DCRTPolyImpl<VecType>::PolyType DCRTPolyImpl<VecType>::ScaleAndRound(
                     floatSum -= td * quot;
                     // rounding
                     coefficients[ri] = static_cast<uint64_t>(floatSum + 0.5);
-                }
+                });
             }
         }
         else {
@@ -1743,8 +1707,7 @@ typename DCRTPolyImpl<VecType>::PolyType DCRTPolyImpl<VecType>::ScaleAndRound(
                 // we fit in 52 bits, so we can do multiplications and
                 // additions without modulo reduction, and do modulo reduction
                 // only once using floating point techniques
-#pragma omp parallel for
-                for (usint ri = 0; ri < ringDim; ri++) {
+                ParallelFor(0, ringDim, [&](usint ri) {
                     double floatSum      = 0.0;
                     NativeInteger intSum = 0;
                     NativeInteger tmpHi, tmpLo;
@@ -1769,11 +1732,10 @@ typename DCRTPolyImpl<VecType>::PolyType DCRTPolyImpl<VecType>::ScaleAndRound(
                     floatSum -= td * quot;
                     // rounding
                     coefficients[ri] = static_cast<uint64_t>(floatSum + 0.5);
-                }
+                });
             }
             else {
-#pragma omp parallel for
-                for (usint ri = 0; ri < ringDim; ri++) {
+                ParallelFor(0, ringDim, [&](usint ri) {
                     double floatSum      = 0.0;
                     NativeInteger intSum = 0;
                     NativeInteger tmpHi, tmpLo;
@@ -1797,7 +1759,7 @@ typename DCRTPolyImpl<VecType>::PolyType DCRTPolyImpl<VecType>::ScaleAndRound(
                     floatSum -= td * quot;
                     // rounding
                     coefficients[ri] = static_cast<uint64_t>(floatSum + 0.5);
-                }
+                });
             }
         }
     }
@@ -1823,8 +1785,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::ApproxScaleAndRound(
     size_t sizeQ  = sizeQP - sizeP;
 
 #if defined(HAVE_INT128) && NATIVEINT == 64
-    #pragma omp parallel for
-    for (usint ri = 0; ri < ringDim; ri++) {
+    ParallelFor(0, ringDim, [&](usint ri) {
         for (usint j = 0; j < sizeP; j++) {
             DoubleNativeInt curValue = 0;
 
@@ -1841,7 +1802,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::ApproxScaleAndRound(
 
             ans.m_vectors[j][ri] = BarrettUint128ModUint64(curValue, pj.ConvertToInt(), modpBarretMu[j]);
         }
-    }
+    });
     return ans;
 }
 
@@ -1851,8 +1812,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::ApproxScaleAndRound(
         mu[j] = (paramsP->GetParams()[j]->GetModulus()).ComputeMu();
     }
 
-    #pragma omp parallel for
-    for (usint ri = 0; ri < ringDim; ri++) {
+    ParallelFor(0, ringDim, [&](usint ri) {
         for (usint j = 0; j < sizeP; j++) {
             const NativeInteger& pj                                  = paramsP->GetParams()[j]->GetModulus();
             const std::vector<NativeInteger>& tPSHatInvModsDivsModpj = tPSHatInvModsDivsModp[j];
@@ -1866,7 +1826,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::ApproxScaleAndRound(
             const NativeInteger& xi = m_vectors[sizeQ + j][ri];
             ans.m_vectors[j][ri].ModAddFastEq(xi.ModMulFast(tPSHatInvModsDivsModpj[sizeQ], pj, mu[j]), pj);
         }
-    }
+    });
     return ans;
 }
 #endif
@@ -1900,8 +1860,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::ScaleAndRound(
         mu[j] = (paramsOutput->GetParams()[j]->GetModulus()).ComputeMu();
 
 #if defined(HAVE_INT128) && NATIVEINT == 64
-    #pragma omp parallel for
-    for (usint ri = 0; ri < ringDim; ++ri) {
+    ParallelFor(0, ringDim, [&](usint ri) {
         double nu = 0.5;
         for (size_t i = 0; i < sizeI; ++i) {
             // possible loss of precision if modulus greater than 2^53 + 1
@@ -1949,13 +1908,12 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::ScaleAndRound(
                         .ModAddFast(BarrettUint128ModUint64(alpha, oj.ConvertToInt(), modoBarretMu[j]), oj);
             }
         }
-    }
+    });
     return ans;
 }
 
 #else
-    #pragma omp parallel for
-    for (usint ri = 0; ri < ringDim; ++ri) {
+    ParallelFor(0, ringDim, [&](usint ri) {
         double nu = 0.5;
         for (size_t i = 0; i < sizeI; ++i) {
             // possible loss of precision if modulus greater than 2^53 + 1
@@ -1995,7 +1953,7 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::ScaleAndRound(
                 curValue.ModAddFastEq(exponent.ModMul(mantissa, oj, mu[j]), oj);
             }
         }
-    }
+    });
     return ans;
 }
 #endif
@@ -2013,8 +1971,7 @@ typename DCRTPolyImpl<VecType>::PolyType DCRTPolyImpl<VecType>::ScaleAndRound(
 
     DCRTPolyImpl::PolyType::Vector coefficients(n, t.ConvertToInt());
 
-#pragma omp parallel for
-    for (usint k = 0; k < n; k++) {
+    ParallelFor(0, n, [&](usint k) {
         // TODO: use 64 bit words in case NativeInteger uses smaller word size
         NativeInteger s = 0, tmp;
         for (usint i = 0; i < sizeQ; i++) {
@@ -2035,7 +1992,7 @@ typename DCRTPolyImpl<VecType>::PolyType DCRTPolyImpl<VecType>::ScaleAndRound(
 
         // shift by log(gamma) to get the result
         coefficients[k] = s >> 26;
-    }
+    });
 
     // Setting the root of unity to ONE as the calculation is expensive
     // It is assumed that no polynomial multiplications in evaluation
@@ -2147,31 +2104,28 @@ void DCRTPolyImpl<VecType>::FastBaseConvqToBskMontgomery(
     const uint64_t mtilde_minus_1 = mtilde - 1;
 
     std::vector<uint64_t> result_mtilde(n, 0);
-#pragma omp parallel for
-    for (uint32_t k = 0; k < n; k++) {
+    ParallelFor(0, n, [&](uint32_t k) {
         for (uint32_t i = 0; i < numQ; i++) {
             result_mtilde[k] += ximtildeQHatModqi[i * n + k].ConvertToInt() * QHatModmtilde[i];
         }
         result_mtilde[k] &= mtilde_minus_1;
-    }
+    });
 
     // now we have input in Basis (q U Bsk U mtilde)
     // next we perform Small Motgomery Reduction mod q
     // ----------------------- step 1 -----------------------
     // NativeInteger *r_m_tildes = new NativeInteger[n];
 
-#pragma omp parallel for
-    for (uint32_t k = 0; k < n; k++) {
+    ParallelFor(0, n, [&](uint32_t k) {
         result_mtilde[k] *= negQInvModmtilde;
         result_mtilde[k] &= mtilde_minus_1;
-    }
+    });
 
     for (uint32_t i = 0; i < numBsk; i++) {
         const NativeInteger& currentqModBski       = QModbsk[i];
         const NativeInteger& currentqModBskiPrecon = QModbskPrecon[i];
 
-#pragma omp parallel for
-        for (uint32_t k = 0; k < n; k++) {
+        ParallelFor(0, n, [&](uint32_t k) {
             NativeInteger r_m_tilde = NativeInteger(result_mtilde[k]);  // mtilde = 2^16 < all moduli of Bsk
             if (result_mtilde[k] >= mtilde_half)
                 r_m_tilde += moduliBsk[i] - mtilde;  // centred remainder
@@ -2182,7 +2136,7 @@ void DCRTPolyImpl<VecType>::FastBaseConvqToBskMontgomery(
                                    moduliBsk[i]);  // (c``_m + (r_mtilde* q)) mod Bski
             m_vectors[numQ + i][k] =
                 r_m_tilde.ModMulFastConst(mtildeInvModbsk[i], moduliBsk[i], mtildeInvModbskPrecon[i]);
-        }
+        });
     }
 
     // if the input polynomial was in evaluation representation, use the towers
@@ -2192,14 +2146,10 @@ void DCRTPolyImpl<VecType>::FastBaseConvqToBskMontgomery(
             m_vectors[i] = polyInNTT[i];
     }
     else {  // else call NTT for the towers for q
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numQ))
-        for (size_t i = 0; i < numQ; i++)
-            m_vectors[i].SwitchFormat();
+        ParallelFor(0, numQ, [&](size_t i) { m_vectors[i].SwitchFormat(); });
     }
 
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(numBsk))
-    for (uint32_t i = 0; i < numBsk; i++)
-        m_vectors[numQ + i].SwitchFormat();
+    ParallelFor(0, numBsk, [&](uint32_t i) { m_vectors[numQ + i].SwitchFormat(); });
 
     m_format = EVALUATION;
 
@@ -2232,17 +2182,15 @@ void DCRTPolyImpl<VecType>::FastRNSFloorq(
         const NativeInteger& currenttqDivqiModqi       = tQHatInvModq[i];
         const NativeInteger& currenttqDivqiModqiPrecon = tQHatInvModqPrecon[i];
 
-#pragma omp parallel for
-        for (uint32_t k = 0; k < n; k++) {
+        ParallelFor(0, n, [&](uint32_t k) {
             // multiply by t*(q/qi)^-1 mod qi
             m_vectors[i][k].ModMulFastConstEq(currenttqDivqiModqi, moduliQ[i], currenttqDivqiModqiPrecon);
-        }
+        });
     }
 
 #if defined(HAVE_INT128) && NATIVEINT == 64
     for (uint32_t j = 0; j < numBsk; j++) {
-    #pragma omp parallel for
-        for (uint32_t k = 0; k < n; k++) {
+        ParallelFor(0, n, [&](uint32_t k) {
             DoubleNativeInt aq = 0;
             for (uint32_t i = 0; i < numQ; i++) {
                 const NativeInteger& InvqiModBjValue = qInvModbsk[i][j];
@@ -2250,7 +2198,7 @@ void DCRTPolyImpl<VecType>::FastRNSFloorq(
                 aq += Mul128(xi.ConvertToInt(), InvqiModBjValue.ConvertToInt());
             }
             txiqiDivqModqi[j * n + k] = BarrettUint128ModUint64(aq, moduliBsk[j].ConvertToInt(), modbskBarrettMu[j]);
-        }
+        });
     }
 
     // now we have FastBaseConv( |t*ct|q, q, Bsk ) in txiqiDivqModqi
@@ -2258,12 +2206,11 @@ void DCRTPolyImpl<VecType>::FastRNSFloorq(
     for (uint32_t i = 0; i < numBsk; i++) {
         const NativeInteger& currenttDivqModBski       = tQInvModbsk[i];
         const NativeInteger& currenttDivqModBskiPrecon = tQInvModbskPrecon[i];
-    #pragma omp parallel for
-        for (uint32_t k = 0; k < n; k++) {
+        ParallelFor(0, n, [&](uint32_t k) {
             // Not worthy to use lazy reduction here
             m_vectors[i + numQ][k].ModMulFastConstEq(currenttDivqModBski, moduliBsk[i], currenttDivqModBskiPrecon);
             m_vectors[i + numQ][k].ModSubFastEq(txiqiDivqModqi[i * n + k], moduliBsk[i]);
-        }
+        });
     }
     delete[] txiqiDivqModqi;
     txiqiDivqModqi = nullptr;
@@ -2276,15 +2223,14 @@ void DCRTPolyImpl<VecType>::FastRNSFloorq(
     }
 
     for (uint32_t j = 0; j < numBsk; j++) {
-    #pragma omp parallel for
-        for (uint32_t k = 0; k < n; k++) {
+        ParallelFor(0, n, [&](uint32_t k) {
             for (uint32_t i = 0; i < numQ; i++) {
                 const NativeInteger& InvqiModBjValue = qInvModbsk[i][j];
                 NativeInteger& xi                    = m_vectors[i][k];
                 txiqiDivqModqi[j * n + k].ModAddFastEq(xi.ModMulFast(InvqiModBjValue, moduliBsk[j], mu[j]),
                                                        moduliBsk[j]);
             }
-        }
+        });
     }
 
     // now we have FastBaseConv( |t*ct|q, q, Bsk ) in txiqiDivqModqi
@@ -2292,12 +2238,11 @@ void DCRTPolyImpl<VecType>::FastRNSFloorq(
     for (uint32_t i = 0; i < numBsk; i++) {
         const NativeInteger& currenttDivqModBski       = tQInvModbsk[i];
         const NativeInteger& currenttDivqModBskiPrecon = tQInvModbskPrecon[i];
-    #pragma omp parallel for
-        for (uint32_t k = 0; k < n; k++) {
+        ParallelFor(0, n, [&](uint32_t k) {
             // Not worthy to use lazy reduction here
             m_vectors[i + numQ][k].ModMulFastConstEq(currenttDivqModBski, moduliBsk[i], currenttDivqModBskiPrecon);
             m_vectors[i + numQ][k].ModSubFastEq(txiqiDivqModqi[i * n + k], moduliBsk[i]);
-        }
+        });
     }
     delete[] txiqiDivqModqi;
     txiqiDivqModqi = nullptr;
@@ -2331,15 +2276,13 @@ void DCRTPolyImpl<VecType>::FastBaseConvSK(
     for (uint32_t i = 0; i < sizeBsk - 1; i++) {  // exclude msk residue
         const NativeInteger& currentBDivBiModBi       = BHatInvModb[i];
         const NativeInteger& currentBDivBiModBiPrecon = BHatInvModbPrecon[i];
-    #pragma omp parallel for
-        for (uint32_t k = 0; k < n; k++) {
+        ParallelFor(0, n, [&](uint32_t k) {
             m_vectors[sizeQ + i][k].ModMulFastConstEq(currentBDivBiModBi, moduliBsk[i], currentBDivBiModBiPrecon);
-        }
+        });
     }
 
     for (uint32_t j = 0; j < sizeQ; j++) {
-    #pragma omp parallel for
-        for (uint32_t k = 0; k < n; k++) {
+        ParallelFor(0, n, [&](uint32_t k) {
             DoubleNativeInt result = 0;
             for (uint32_t i = 0; i < sizeBsk - 1; i++) {  // exclude msk residue
                 const NativeInteger& currentBDivBiModqj = BHatModq[i][j];
@@ -2347,14 +2290,13 @@ void DCRTPolyImpl<VecType>::FastBaseConvSK(
                 result += Mul128(xi.ConvertToInt(), currentBDivBiModqj.ConvertToInt());
             }
             m_vectors[j][k] = BarrettUint128ModUint64(result, moduliQ[j].ConvertToInt(), modqBarrettMu[j]);
-        }
+        });
     }
 
     // calculate alphaskx
     // FastBaseConv(x, B, msk)
     NativeInteger* alphaskxVector = new NativeInteger[n];
-    #pragma omp parallel for
-    for (uint32_t k = 0; k < n; k++) {
+    ParallelFor(0, n, [&](uint32_t k) {
         DoubleNativeInt result = 0;
         for (uint32_t i = 0; i < sizeBsk - 1; i++) {
             const NativeInteger& currentBDivBiModmsk = BHatModmsk[i];
@@ -2362,14 +2304,13 @@ void DCRTPolyImpl<VecType>::FastBaseConvSK(
         }
         alphaskxVector[k] =
             BarrettUint128ModUint64(result, moduliBsk[sizeBsk - 1].ConvertToInt(), modbskBarrettMu[sizeBsk - 1]);
-    }
+    });
 
     // subtract xsk
-    #pragma omp parallel for
-    for (uint32_t k = 0; k < n; k++) {
+    ParallelFor(0, n, [&](uint32_t k) {
         alphaskxVector[k] = alphaskxVector[k].ModSubFast(m_vectors[sizeQ + sizeBsk - 1][k], moduliBsk[sizeBsk - 1]);
         alphaskxVector[k].ModMulFastConstEq(BInvModmsk, moduliBsk[sizeBsk - 1], BInvModmskPrecon);
-    }
+    });
 
     // do (m_vector - alphaskx*M) mod q
     NativeInteger mskDivTwo = moduliBsk[sizeBsk - 1] / 2;
@@ -2377,15 +2318,14 @@ void DCRTPolyImpl<VecType>::FastBaseConvSK(
         const NativeInteger& currentBModqi       = BModq[i];
         const NativeInteger& currentBModqiPrecon = BModqPrecon[i];
 
-    #pragma omp parallel for
-        for (uint32_t k = 0; k < n; k++) {
+        ParallelFor(0, n, [&](uint32_t k) {
             NativeInteger alphaskBModqi = alphaskxVector[k];
             if (alphaskBModqi > mskDivTwo)
                 alphaskBModqi = alphaskBModqi.ModSubFast(moduliBsk[sizeBsk - 1], moduliQ[i]);
 
             alphaskBModqi.ModMulFastConstEq(currentBModqi, moduliQ[i], currentBModqiPrecon);
             m_vectors[i][k] = m_vectors[i][k].ModSubFast(alphaskBModqi, moduliQ[i]);
-        }
+        });
     }
 
     // drop extra vectors
@@ -2427,10 +2367,9 @@ void DCRTPolyImpl<VecType>::FastBaseConvSK(
     for (uint32_t i = 0; i < sizeBsk - 1; i++) {  // exclude msk residue
         const NativeInteger& currentBDivBiModBi       = BHatInvModb[i];
         const NativeInteger& currentBDivBiModBiPrecon = BHatInvModbPrecon[i];
-    #pragma omp parallel for
-        for (uint32_t k = 0; k < n; k++) {
+        ParallelFor(0, n, [&](uint32_t k) {
             m_vectors[sizeQ + i][k].ModMulFastConstEq(currentBDivBiModBi, moduliBsk[i], currentBDivBiModBiPrecon);
-        }
+        });
     }
 
     std::vector<NativeInteger> mu(sizeQ);
@@ -2439,15 +2378,14 @@ void DCRTPolyImpl<VecType>::FastBaseConvSK(
     }
 
     for (uint32_t j = 0; j < sizeQ; j++) {
-    #pragma omp parallel for
-        for (uint32_t k = 0; k < n; k++) {
+        ParallelFor(0, n, [&](uint32_t k) {
             m_vectors[j][k] = NativeInteger(0);
             for (uint32_t i = 0; i < sizeBsk - 1; i++) {  // exclude msk residue
                 const NativeInteger& currentBDivBiModqj = BHatModq[i][j];
                 const NativeInteger& xi                 = m_vectors[sizeQ + i][k];
                 m_vectors[j][k].ModAddFastEq(xi.ModMulFast(currentBDivBiModqj, moduliQ[j], mu[j]), moduliQ[j]);
             }
-        }
+        });
     }
 
     NativeInteger muBsk = moduliBsk[sizeBsk - 1].ComputeMu();
@@ -2455,8 +2393,7 @@ void DCRTPolyImpl<VecType>::FastBaseConvSK(
     // calculate alphaskx
     // FastBaseConv(x, B, msk)
     NativeInteger* alphaskxVector = new NativeInteger[n];
-    #pragma omp parallel for
-    for (uint32_t k = 0; k < n; k++) {
+    ParallelFor(0, n, [&](uint32_t k) {
         for (uint32_t i = 0; i < sizeBsk - 1; i++) {
             const NativeInteger& currentBDivBiModmsk = BHatModmsk[i];
             // changed from ModAddFastEq to ModAddEq
@@ -2464,14 +2401,13 @@ void DCRTPolyImpl<VecType>::FastBaseConvSK(
                 m_vectors[sizeQ + i][k].ModMul(currentBDivBiModmsk, moduliBsk[sizeBsk - 1], muBsk),
                 moduliBsk[sizeBsk - 1]);
         }
-    }
+    });
 
     // subtract xsk
-    #pragma omp parallel for
-    for (uint32_t k = 0; k < n; k++) {
+    ParallelFor(0, n, [&](uint32_t k) {
         alphaskxVector[k] = alphaskxVector[k].ModSubFast(m_vectors[sizeQ + sizeBsk - 1][k], moduliBsk[sizeBsk - 1]);
         alphaskxVector[k].ModMulFastConstEq(BInvModmsk, moduliBsk[sizeBsk - 1], BInvModmskPrecon);
-    }
+    });
 
     // do (m_vector - alphaskx*M) mod q
     NativeInteger mskDivTwo = moduliBsk[sizeBsk - 1] / 2;
@@ -2479,15 +2415,14 @@ void DCRTPolyImpl<VecType>::FastBaseConvSK(
         const NativeInteger& currentBModqi       = BModq[i];
         const NativeInteger& currentBModqiPrecon = BModqPrecon[i];
 
-    #pragma omp parallel for
-        for (uint32_t k = 0; k < n; k++) {
+        ParallelFor(0, n, [&](uint32_t k) {
             NativeInteger alphaskBModqi = alphaskxVector[k];
             if (alphaskBModqi > mskDivTwo)
                 alphaskBModqi = alphaskBModqi.ModSubFast(moduliBsk[sizeBsk - 1], moduliQ[i]);
 
             alphaskBModqi.ModMulFastConstEq(currentBModqi, moduliQ[i], currentBModqiPrecon);
             m_vectors[i][k] = m_vectors[i][k].ModSubFast(alphaskBModqi, moduliQ[i]);
-        }
+        });
     }
 
     // drop extra vectors
@@ -2517,9 +2452,7 @@ template <typename VecType>
 void DCRTPolyImpl<VecType>::SwitchFormat() {
     m_format = (m_format == Format::COEFFICIENT) ? Format::EVALUATION : Format::COEFFICIENT;
     size_t size{m_vectors.size()};
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-    for (size_t i = 0; i < size; ++i)
-        m_vectors[i].SwitchFormat();
+    ParallelFor(0, size, [&](size_t i) { m_vectors[i].SwitchFormat(); });
 }
 
 template <typename VecType>
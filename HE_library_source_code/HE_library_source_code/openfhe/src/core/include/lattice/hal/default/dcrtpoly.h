@@ -73,11 +73,17 @@ public:
 
     DCRTPolyImpl() = default;
 
-    DCRTPolyImpl(const DCRTPolyType& e) noexcept : m_params{e.m_params}, m_format{e.m_format}, m_vectors{e.m_vectors} {}
+    DCRTPolyImpl(const DCRTPolyType& e) noexcept : m_params{e.m_params}, m_format{e.m_format} {
+        DCRTPolyImpl::CopyLimbs(e.m_vectors);
+    }
     DCRTPolyType& operator=(const DCRTPolyType& rhs) noexcept override {
-        m_params  = rhs.m_params;
-        m_format  = rhs.m_format;
-        m_vectors = rhs.m_vectors;
+        m_params = rhs.m_params;
+        m_format = rhs.m_format;
+        // limbs of the same number are copied in place, keeping their buffer
+        if (m_vectors.size() == rhs.m_vectors.size())
+            m_vectors = rhs.m_vectors;
+        else
+            DCRTPolyImpl::CopyLimbs(rhs.m_vectors);
         return *this;
     }
 
@@ -101,9 +107,13 @@ public:
     DCRTPolyImpl(const std::shared_ptr<Params>& params, Format format = Format::EVALUATION,
                  bool initializeElementToZero = false) noexcept
         : m_params{params}, m_format{format} {
+        if (initializeElementToZero) {
+            DCRTPolyImpl::AllocateZeroLimbs();
+            return;
+        }
         m_vectors.reserve(m_params->GetParams().size());
         for (const auto& p : m_params->GetParams())
-            m_vectors.emplace_back(p, m_format, initializeElementToZero);
+            m_vectors.emplace_back(p, m_format, false);
     }
 
     DCRTPolyImpl(const DggType& dgg, const std::shared_ptr<Params>& p, Format f = Format::EVALUATION);
@@ -139,9 +149,7 @@ public:
     DCRTPolyType& operator-=(const NativeInteger& rhs) override;
     DCRTPolyType& operator*=(const DCRTPolyType& rhs) override {
         size_t size{m_vectors.size()};
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-        for (size_t i = 0; i < size; ++i)
-            m_vectors[i] *= rhs.m_vectors[i];
+        ParallelFor(0, size, [&](size_t i) { m_vectors[i] *= rhs.m_vectors[i]; });
         return *this;
     }
     DCRTPolyType& operator*=(const Integer& rhs) override;
@@ -169,10 +177,8 @@ public:
             OPENFHE_THROW(math_error, "tower size mismatch; cannot add");
         if (m_vectors[0].GetModulus() != rhs.m_vectors[0].GetModulus())
             OPENFHE_THROW(math_error, "Modulus missmatch");
-        DCRTPolyType tmp(m_params, m_format);
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-        for (size_t i = 0; i < size; ++i)
-            tmp.m_vectors[i] = m_vectors[i].PlusNoCheck(rhs.m_vectors[i]);
+        DCRTPolyType tmp(*this);
+        ParallelFor(0, size, [&](size_t i) { tmp.m_vectors[i].PlusNoCheckEq(rhs.m_vectors[i]); });
         return tmp;
     }
 
@@ -190,10 +196,8 @@ public:
             OPENFHE_THROW(math_error, "tower size mismatch; cannot multiply");
         if (m_vectors[0].GetModulus() != rhs.m_vectors[0].GetModulus())
             OPENFHE_THROW(math_error, "Modulus missmatch");
-        DCRTPolyType tmp(m_params, m_format);
-#pragma omp parallel for num_threads(OpenFHEParallelControls.GetThreadLimit(size))
-        for (size_t i = 0; i < size; ++i)
-            tmp.m_vectors[i] = m_vectors[i].TimesNoCheck(rhs.m_vectors[i]);
+        DCRTPolyType tmp(*this);
+        ParallelFor(0, size, [&](size_t i) { tmp.m_vectors[i].TimesNoCheckEq(rhs.m_vectors[i]); });
         return tmp;
     }
     DCRTPolyType Times(const Integer& rhs) const override;
@@ -402,7 +406,23 @@ public:
         m_vectors[index] = std::move(element);
     }
 
+    /**
+     * @brief Checks whether the limbs are stored one after another in a single
+     * buffer, so that a kernel can run over all of them in one pass. This is the
+     * case for polynomials initialized to zero, for Gaussian and ternary samples
+     * and for copies, as long as no limb is replaced or resized.
+     *
+     * @return true if the limbs are contiguous
+     */
+    bool HasContiguousLimbs() const;
+
 protected:
+    // Initializes all limbs to zero in one buffer
+    void AllocateZeroLimbs();
+
+    // Replaces the limbs by copies of the given limbs in one buffer
+    void CopyLimbs(const std::vector<PolyType>& limbs);
+
     std::shared_ptr<Params> m_params{std::make_shared<DCRTPolyImpl::Params>(0, 1)};
     Format m_format{Format::EVALUATION};
     std::vector<PolyType> m_vectors;
@@ -47,6 +47,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -422,6 +423,20 @@ void PolyImpl<VecType>::SwitchFormat() {
     if (!m_values)
         OPENFHE_THROW(not_available_error, "Poly switch format to empty values");
 
+    if constexpr (std::is_same_v<VecType, NativeVector>) {
+        // native parameters carry their NTT tables, which saves the table lookup on every transform
+        if (const auto& tables = m_params->GetNTTTables()) {
+            if (m_format != Format::COEFFICIENT) {
+                m_format = Format::COEFFICIENT;
+                ChineseRemainderTransformFTT<VecType>().InverseTransformFromBitReverseInPlace(*tables, &(*m_values));
+                return;
+            }
+            m_format = Format::EVALUATION;
+            ChineseRemainderTransformFTT<VecType>().ForwardTransformToBitReverseInPlace(*tables, &(*m_values));
+            return;
+        }
+    }
+
     if (m_format != Format::COEFFICIENT) {
         m_format = Format::COEFFICIENT;
         ChineseRemainderTransformFTT<VecType>().InverseTransformFromBitReverseInPlace(ru, co, &(*m_values));
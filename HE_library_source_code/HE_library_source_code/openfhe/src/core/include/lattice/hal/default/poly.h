@@ -86,6 +86,9 @@ public:
     PolyImpl(const std::shared_ptr<ILDCRTParams<Integer>>& params, Format format = Format::EVALUATION,
              bool initializeElementToZero = false);
 
+    PolyImpl(const std::shared_ptr<Params>& params, Format format, VecType&& values) noexcept
+        : m_format{format}, m_params{params}, m_values{std::make_unique<VecType>(std::move(values))} {}
+
     PolyImpl(bool initializeElementToMax, const std::shared_ptr<Params>& params, Format format = Format::EVALUATION)
         : m_format{format}, m_params{params} {
         if (initializeElementToMax)
@@ -230,6 +233,10 @@ public:
         tmp.m_values->ModAddNoCheckEq(*rhs.m_values);
         return tmp;
     }
+    PolyImpl& PlusNoCheckEq(const PolyImpl& rhs) {
+        m_values->ModAddNoCheckEq(*rhs.m_values);
+        return *this;
+    }
     PolyImpl& operator+=(const PolyImpl& element) override;
 
     PolyImpl Plus(const Integer& element) const override;
@@ -262,6 +269,10 @@ public:
         tmp.m_values->ModMulNoCheckEq(*rhs.m_values);
         return tmp;
     }
+    PolyImpl& TimesNoCheckEq(const PolyImpl& rhs) {
+        m_values->ModMulNoCheckEq(*rhs.m_values);
+        return *this;
+    }
     PolyImpl& operator*=(const PolyImpl& rhs) override {
         if (m_params->GetRingDimension() != rhs.m_params->GetRingDimension())
             OPENFHE_THROW(math_error, "RingDimension missmatch");
@@ -44,7 +44,9 @@
 #include "utils/exception.h"
 #include "utils/inttypes.h"
 
+#include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 namespace lbcrypto {
@@ -79,7 +81,9 @@ public:
    */
     ILParamsImpl(usint order, const IntType& modulus, const IntType& rootOfUnity,
                  const IntType& bigModulus = IntType(0), const IntType& bigRootOfUnity = IntType(0))
-        : ElemParams<IntType>(order, modulus, rootOfUnity, bigModulus, bigRootOfUnity) {}
+        : ElemParams<IntType>(order, modulus, rootOfUnity, bigModulus, bigRootOfUnity) {
+        PreComputeNTTTables();
+    }
 
     /**
    * @brief Constructor for the case of partially pre-computed parameters.
@@ -88,14 +92,16 @@ public:
    * @param &modulus the ciphertext modulus.
    */
     ILParamsImpl(usint order, const IntType& modulus)
-        : ElemParams<IntType>(order, modulus, RootOfUnity<IntType>(order, modulus)) {}
+        : ElemParams<IntType>(order, modulus, RootOfUnity<IntType>(order, modulus)) {
+        PreComputeNTTTables();
+    }
 
     /**
    * @brief Copy constructor.
    *
    * @param &rhs the input set of parameters which is copied.
    */
-    ILParamsImpl(const ILParamsImpl& rhs) : ElemParams<IntType>(rhs) {}
+    ILParamsImpl(const ILParamsImpl& rhs) : ElemParams<IntType>(rhs), m_nttTables(rhs.m_nttTables) {}
 
     /**
    * @brief Assignment Operator.
@@ -105,6 +111,7 @@ public:
    */
     ILParamsImpl& operator=(const ILParamsImpl& rhs) {
         ElemParams<IntType>::operator=(rhs);
+        m_nttTables = rhs.m_nttTables;
         return *this;
     }
 
@@ -113,10 +120,12 @@ public:
    *
    * @param &rhs the input set of parameters which is copied.
    */
-    ILParamsImpl(ILParamsImpl&& rhs) noexcept : ElemParams<IntType>(std::move(rhs)) {}
+    ILParamsImpl(ILParamsImpl&& rhs) noexcept
+        : ElemParams<IntType>(std::move(rhs)), m_nttTables(std::move(rhs.m_nttTables)) {}
 
     ILParamsImpl& operator=(ILParamsImpl&& rhs) noexcept {
         ElemParams<IntType>::operator=(std::move(rhs));
+        m_nttTables = std::move(rhs.m_nttTables);
         return *this;
     }
 
@@ -138,6 +147,18 @@ public:
         return ElemParams<IntType>::operator==(rhs);
     }
 
+    /**
+   * @brief Returns the NTT tables for the modulus, cyclotomic order and root of
+   * unity of these parameters. They are resolved once when the parameters are
+   * built, so transforms using them skip the table lookup.
+   *
+   * @return a handle to the tables, or nullptr if the parameters are not native
+   * or do not define a power-of-two cyclotomic ring with an NTT-friendly modulus
+   */
+    const std::shared_ptr<const intnat::NTTTablesNat<NativeVector>>& GetNTTTables() const {
+        return m_nttTables;
+    }
+
     template <class Archive>
     void save(Archive& ar, std::uint32_t const version) const {
         ar(::cereal::base_class<ElemParams<IntType>>(this));
@@ -150,6 +171,7 @@ public:
                                                  " is from a later version of the library");
         }
         ar(::cereal::base_class<ElemParams<IntType>>(this));
+        PreComputeNTTTables();
     }
 
     std::string SerializedObjectName() const override {
@@ -160,12 +182,26 @@ public:
     }
 
 private:
+    void PreComputeNTTTables() {
+        if constexpr (std::is_same_v<IntType, NativeInteger>) {
+            const auto co = this->m_cyclotomicOrder;
+            const auto& q = this->m_ciphertextModulus;
+            const auto& r = this->m_rootOfUnity;
+            if (IsPowerOfTwo(co) && this->m_ringDimension == (co >> 1) && r != IntType(0) && r != IntType(1) &&
+                q.Mod(IntType(co)) == IntType(1)) {
+                m_nttTables = ChineseRemainderTransformFTT<NativeVector>::GetTables(r, co, q);
+            }
+        }
+    }
+
     std::ostream& doprint(std::ostream& out) const override {
         out << "ILParams ";
         ElemParams<IntType>::doprint(out);
         out << std::endl;
         return out;
     }
+
+    std::shared_ptr<const intnat::NTTTablesNat<NativeVector>> m_nttTables;
 };
 
 }  // namespace lbcrypto
@@ -44,6 +44,7 @@
 #include "utils/debug.h"
 #include "utils/exception.h"
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
 #include <string>
@@ -121,18 +122,27 @@ std::shared_ptr<int64_t> DiscreteGaussianGeneratorImpl<VecType>::GenerateIntVect
         return ans;
     }
 
-    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    FillPeikert(ans.get(), size);
+    return ans;
+}
+
+template <typename VecType>
+void DiscreteGaussianGeneratorImpl<VecType>::FillPeikert(int64_t* values, usint size) const {
+    PRNG& g            = PseudoRandomNumberGenerator::GetPRNG();
+    const double halfA = m_a / 2;
     for (usint i = 0; i < size; ++i) {
-        // we need to use the binary uniform generator rather than regular
-        // continuous distribution; see DG14 for details
-        double seed = distribution(PseudoRandomNumberGenerator::GetPRNG()) - 0.5;
-        double tmp  = std::abs(seed) - m_a / 2;
-        int64_t val = 0;
-        if (tmp > 0)
-            val = static_cast<int64_t>(FindInVector(m_vals, tmp)) * (seed > 0 ? 1 : -1);
-        (ans.get())[i] = val;
+        // a uniform deviate in [0, 1) with 53 bits of precision built from two PRNG outputs
+        uint64_t hi = g();
+        uint64_t lo = g();
+        double seed = static_cast<double>((hi << 21) | (lo >> 11)) * 0x1p-53 - 0.5;
+        double tmp  = std::abs(seed) - halfA;
+        if (tmp <= 0) {
+            values[i] = 0;
+            continue;
+        }
+        int64_t val = FindInVector(m_vals, tmp);
+        values[i]   = (seed > 0) ? val : -val;
     }
-    return ans;
 }
 
 template <typename VecType>
@@ -205,6 +205,15 @@ private:
 
     usint FindInVector(const std::vector<double>& S, double search) const;
 
+    /**
+   * @brief Fills an array with samples of Peikert's inversion method. The
+   * uniform deviates are built directly from the PRNG output, and each one is
+   * looked up in the table with a binary search.
+   * @param values the array to fill.
+   * @param size the number of samples to generate.
+   */
+    void FillPeikert(int64_t* values, usint size) const;
+
     static double UnnormalizedGaussianPDF(const double& mean, const double& sigma, int32_t x) {
         return pow(M_E, -pow(x - mean, 2) / (2. * sigma * sigma));
     }
@@ -49,8 +49,9 @@
 #include <thread>
 
 // #define FIXED_SEED // if defined, then uses a fixed seed number for
-// reproducible results during debug. Use only one OMP thread to ensure
-// reproducibility
+// reproducible results during debug. Use only one thread to ensure
+// reproducibility, as the sub-streams are assigned to threads in the order of
+// their first use of the PRNG
 
 namespace lbcrypto {
 
@@ -66,126 +67,36 @@ typedef Blake2Engine PRNG;
  * all crypto capabilities in OpenFHE) depends on the randomness of uniform,
  * ternary, and Gaussian distributions, which derive their randomness from the
  * PRNG.
+ *
+ * Every thread draws from its own sub-stream of a single counter-based engine
+ * seeded once per process. The sub-streams are created on first use without
+ * locks, so the PRNG can be used from any thread, inside or outside parallel
+ * regions.
  */
 class PseudoRandomNumberGenerator {
 public:
     /**
-   * @brief  Returns a reference to the PRNG engine
+   * @brief Generates the seed of the process if it has not been generated yet.
+   * Calling it is optional; it only moves the cost of seeding out of the first
+   * call to GetPRNG.
    */
+    static void InitPRNG();
 
-    // TODO: there may be an issue here
-    static void InitPRNG() {
-        int threads = OpenFHEParallelControls.GetNumThreads();
-        if (threads == 0) {
-            threads = 1;
-        }
-#pragma omp parallel for num_threads(threads)
-        for (int i = 0; i < threads; ++i) {
-            GetPRNG();
-        }
-    }
-
+    /**
+   * @brief  Returns a reference to the PRNG engine of the calling thread
+   */
     static PRNG& GetPRNG() {
-        // initialization of PRNGs
-        if (m_prng == nullptr) {
-#pragma omp critical
-            {
-#if defined(FIXED_SEED)
-                // Only used for debugging in the single-threaded mode.
-                std::cerr << "**FOR DEBUGGING ONLY!!!!  Using fixed initializer for "
-                             "PRNG. Use a single thread only, e.g., OMP_NUM_THREADS=1!"
-                          << std::endl;
-
-                std::array<uint32_t, 16> seed{};
-                seed[0] = 1;
-                m_prng  = std::make_shared<PRNG>(seed);
-#else
-                // A 512-bit seed is generated for each thread (this roughly corresponds
-                // to 256 bits of security). The seed is the sum of a random sample
-                // generated using std::random_device (typically works correctly in
-                // Linux, MacOS X, and MinGW starting with GCC 9.2) and a BLAKE2 sample
-                // seeded from current time stamp, a hash of the current thread, and a
-                // memory location of a heap variable. The BLAKE2 sample is added in
-                // case random_device is deterministic (happens on MinGW with GCC
-                // below 9.2). All future calls to PRNG use the seed generated here.
-
-                // The code below derives randomness from time, thread id, and a memory
-                // location of a heap variable. This seed is relevant only if the
-                // implementation of random_device is deterministic (as in older
-                // versions of GCC in MinGW)
-                std::array<uint32_t, 16> initKey{};
-                // high-resolution clock typically has a nanosecond tick period
-                // Arguably this may give up to 32 bits of entropy as the clock gets
-                // recycled every 4.3 seconds
-                initKey[0] = std::chrono::high_resolution_clock::now().time_since_epoch().count();
-                // A thread id is often close to being random (on most systems)
-                initKey[1] = std::hash<std::thread::id>{}(std::this_thread::get_id());
-                    // On a 64-bit machine, the thread id is 64 bits long
-                    // skip on 32-bit arm architectures
-    #if !defined(__arm__) && !defined(__EMSCRIPTEN__)
-                if (sizeof(size_t) == 8)
-                    initKey[2] = (std::hash<std::thread::id>{}(std::this_thread::get_id()) >> 32);
-    #endif
-
-                // heap variable; we are going to use the least 32 bits of its memory
-                // location as the counter for BLAKE2 This will increase the entropy of
-                // the BLAKE2 sample
-                void* mem        = malloc(1);
-                uint32_t counter = reinterpret_cast<long long>(mem);  // NOLINT
-                free(mem);
-
-                PRNG gen(initKey, counter);
-
-                std::uniform_int_distribution<uint32_t> distribution(0);
-                std::array<uint32_t, 16> seed{};
-                for (uint32_t i = 0; i < 16; i++) {
-                    seed[i] = distribution(gen);
-                }
-
-                std::array<uint32_t, 16> rdseed{};
-                size_t attempts  = 3;
-                bool rdGenPassed = false;
-                size_t idx       = 0;
-                while (!rdGenPassed && idx < attempts) {
-                    try {
-                        std::random_device genR;
-                        for (uint32_t i = 0; i < 16; i++) {
-                            // we use the fact that there is no overflow for unsigned integers
-                            // (from C++ standard) i.e., arithmetic mod 2^32 is performed. For
-                            // the seed to be random, it is sufficient for one of the two
-                            // samples below to be random. In almost all practical cases,
-                            // distribution(genR) is random. We add distribution(gen) just in
-                            // case there is an implementation issue with random_device (as in
-                            // older MinGW systems).
-                            rdseed[i] = distribution(genR);
-                        }
-                        rdGenPassed = true;
-                    }
-                    catch (std::exception& e) {
-                    }
-                    idx++;
-                }
-
-                for (uint32_t i = 0; i < 16; i++) {
-                    seed[i] += rdseed[i];
-                }
-
-                m_prng = std::make_shared<PRNG>(seed);
-#endif
-            }
-        }
+        if (m_prng == nullptr)
+            m_prng = CreatePRNG();
         return *m_prng;
     }
 
 private:
-    // shared pointer to a thread-specific PRNG engine
-    static std::shared_ptr<PRNG> m_prng;
+    // creates the engine of the calling thread, using the next free sub-stream
+    static PRNG* CreatePRNG();
 
-#if !defined(FIXED_SEED)
-        // avoid contention on m_prng
-        // local copies of m_prng are created for each thread
-    #pragma omp threadprivate(m_prng)
-#endif
+    // the engine of the calling thread
+    static thread_local PRNG* m_prng;
 };
 
 }  // namespace lbcrypto
@@ -0,0 +1,188 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  This file contains the allocator that lets the limbs of a DCRT polynomial share one contiguous buffer
+ */
+
+#ifndef LBCRYPTO_MATH_HAL_INTNAT_LIMBALLOCATOR_H
+#define LBCRYPTO_MATH_HAL_INTNAT_LIMBALLOCATOR_H
+
+#include "config_core.h"
+#ifdef WITH_LIMB_POOL
+    #include "utils/blockAllocator/poolAllocator.h"
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace intnat {
+
+/**
+ * @brief A buffer for the limbs of a DCRT polynomial. The limbs are carved
+ * from the buffer one after another, each starting at a cache line, and the
+ * memory is released when the last vector using it is destroyed. OpenFHE
+ * built WITH_LIMB_POOL takes the buffer from PoolAllocator and returns it there.
+ */
+class LimbBuffer {
+public:
+    static constexpr size_t ALIGNMENT = 64;
+
+    /**
+     * @param bytes is the total size of the limbs, each rounded up with
+     * Footprint().
+     */
+    explicit LimbBuffer(size_t bytes)
+#ifdef WITH_LIMB_POOL
+        : m_capacity{bytes}, m_data{static_cast<char*>(lbcrypto::PoolAllocator::Allocate(bytes))} {}
+#else
+        : m_capacity{bytes}, m_data{static_cast<char*>(::operator new(bytes, std::align_val_t{ALIGNMENT}))} {}
+#endif
+
+    ~LimbBuffer() {
+#ifdef WITH_LIMB_POOL
+        lbcrypto::PoolAllocator::Deallocate(m_data, m_capacity);
+#else
+        ::operator delete(m_data, std::align_val_t{ALIGNMENT});
+#endif
+    }
+
+    LimbBuffer(const LimbBuffer&)            = delete;
+    LimbBuffer& operator=(const LimbBuffer&) = delete;
+
+    /**
+     * @return the number of bytes a limb of the given size takes in the buffer
+     */
+    static constexpr size_t Footprint(size_t bytes) {
+        return (bytes + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+    }
+
+    /**
+     * Carves the next limb from the buffer; safe to call from several threads.
+     *
+     * @param bytes is the size of the limb.
+     * @return the memory of the limb, or nullptr if the buffer is full
+     */
+    void* Allocate(size_t bytes) {
+        size_t size{Footprint(bytes)};
+        size_t offset{m_used.fetch_add(size, std::memory_order_relaxed)};
+        return (offset + size <= m_capacity) ? m_data + offset : nullptr;
+    }
+
+    /**
+     * @return true if p points into the buffer
+     */
+    bool Owns(const void* p) const {
+        auto c{static_cast<const char*>(p)};
+        return !std::less<const char*>{}(c, m_data) && std::less<const char*>{}(c, m_data + m_capacity);
+    }
+
+private:
+    size_t m_capacity;
+    char* m_data;
+    std::atomic<size_t> m_used{0};
+};
+
+/**
+ * @brief The allocator of native vectors. By default, it allocates from the
+ * heap; given a LimbBuffer, it carves the vectors from the buffer as long as
+ * there is space left and uses the heap afterwards. Copies of a vector are
+ * allocated from the heap, so a buffer is shared only by the vectors it was
+ * made for, and moved vectors keep their buffer alive. OpenFHE built
+ * WITH_LIMB_POOL allocates from PoolAllocator instead of the heap.
+ */
+template <typename T>
+class LimbAllocator {
+public:
+    using value_type                             = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+    using is_always_equal                        = std::false_type;
+
+    LimbAllocator() noexcept = default;
+
+    explicit LimbAllocator(std::shared_ptr<LimbBuffer> buffer) noexcept : m_buffer{std::move(buffer)} {}
+
+    template <typename U>
+    LimbAllocator(const LimbAllocator<U>& other) noexcept : m_buffer{other.m_buffer} {}
+
+    T* allocate(size_t n) {
+        if (m_buffer) {
+            if (void* p = m_buffer->Allocate(n * sizeof(T)))
+                return static_cast<T*>(p);
+        }
+#ifdef WITH_LIMB_POOL
+        return static_cast<T*>(lbcrypto::PoolAllocator::Allocate(n * sizeof(T)));
+#else
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+#endif
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        // the memory of the buffer is released with the buffer
+        if (!m_buffer || !m_buffer->Owns(p)) {
+#ifdef WITH_LIMB_POOL
+            lbcrypto::PoolAllocator::Deallocate(p, n * sizeof(T));
+#else
+            (void)n;
+            ::operator delete(p);
+#endif
+        }
+    }
+
+    LimbAllocator select_on_container_copy_construction() const noexcept {
+        return LimbAllocator();
+    }
+
+    friend bool operator==(const LimbAllocator& a, const LimbAllocator& b) noexcept {
+        return a.m_buffer == b.m_buffer;
+    }
+
+    friend bool operator!=(const LimbAllocator& a, const LimbAllocator& b) noexcept {
+        return a.m_buffer != b.m_buffer;
+    }
+
+private:
+    template <typename U>
+    friend class LimbAllocator;
+
+    std::shared_ptr<LimbBuffer> m_buffer;
+};
+
+}  // namespace intnat
+
+#endif
@@ -0,0 +1,125 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+
+/*
+  This file contains the interface of the SIMD kernels for the element-wise modular operations of native vectors
+ */
+
+#ifndef LBCRYPTO_MATH_HAL_INTNAT_MUBINTVECNAT_SIMD_H
+#define LBCRYPTO_MATH_HAL_INTNAT_MUBINTVECNAT_SIMD_H
+
+#include <cstdint>
+
+namespace intnat {
+
+/*
+  The kernels use the engine selected with SetNTTEngine() (see transformnat-simd.h). All inputs are fully reduced
+  modulo q, and so are the outputs. An operation returns false, leaving the vector unchanged, if the current engine
+  has no kernel for it that is faster than the scalar code; the caller then falls back to the scalar loop. This is
+  always the case for NTT_SCALAR and for moduli q >= 2^60; NTT_AVX2 only accelerates the additions and subtractions,
+  as the multiplications of AVX2 are too narrow to beat the scalar 64-bit multiplier.
+ */
+
+/**
+ * In-place modular addition a[i] = a[i] + b[i] mod q.
+ *
+ * @param[in,out] a is the first summand and the result.
+ * @param b is the second summand.
+ * @param modulus is q.
+ * @param n is the length of the vectors.
+ * @return true if the current engine computed the result
+ */
+bool ModAddSIMD(uint64_t* a, const uint64_t* b, uint64_t modulus, uint32_t n);
+
+/**
+ * In-place modular subtraction a[i] = a[i] - b[i] mod q.
+ *
+ * @param[in,out] a is the minuend and the result.
+ * @param b is the subtrahend.
+ * @param modulus is q.
+ * @param n is the length of the vectors.
+ * @return true if the current engine computed the result
+ */
+bool ModSubSIMD(uint64_t* a, const uint64_t* b, uint64_t modulus, uint32_t n);
+
+/**
+ * In-place modular addition of a scalar a[i] = a[i] + b mod q.
+ *
+ * @param[in,out] a is the first summand and the result.
+ * @param b is the scalar.
+ * @param modulus is q.
+ * @param n is the length of the vector.
+ * @return true if the current engine computed the result
+ */
+bool ModAddConstSIMD(uint64_t* a, uint64_t b, uint64_t modulus, uint32_t n);
+
+/**
+ * In-place modular subtraction of a scalar a[i] = a[i] - b mod q.
+ *
+ * @param[in,out] a is the minuend and the result.
+ * @param b is the scalar.
+ * @param modulus is q.
+ * @param n is the length of the vector.
+ * @return true if the current engine computed the result
+ */
+bool ModSubConstSIMD(uint64_t* a, uint64_t b, uint64_t modulus, uint32_t n);
+
+/**
+ * In-place modular multiplication a[i] = a[i] * b[i] mod q with Barrett
+ * reduction. NTT_AVX512IFMA uses 52-bit multiplications for q < 2^50.
+ *
+ * @param[in,out] a is the first factor and the result.
+ * @param b is the second factor.
+ * @param modulus is q.
+ * @param n is the length of the vectors.
+ * @return true if the current engine computed the result
+ */
+bool ModMulSIMD(uint64_t* a, const uint64_t* b, uint64_t modulus, uint32_t n);
+
+/**
+ * In-place modular multiplication by a scalar a[i] = a[i] * b mod q with
+ * Shoup's precomputation. NTT_AVX512IFMA uses 52-bit multiplications for
+ * q < 2^51.
+ *
+ * @param[in,out] a is the first factor and the result.
+ * @param b is the scalar.
+ * @param bPrecon is the precomputation floor(b * 2^64 / q), see
+ * NativeIntegerT::PrepModMulConst().
+ * @param modulus is q.
+ * @param n is the length of the vector.
+ * @return true if the current engine computed the result
+ */
+bool ModMulConstSIMD(uint64_t* a, uint64_t b, uint64_t bPrecon, uint64_t modulus, uint32_t n);
+
+}  // namespace intnat
+
+#endif
@@ -37,6 +37,8 @@
 #define LBCRYPTO_INC_MATH_HAL_INTNAT_MUBINTVECNAT_H
 
 #include "math/hal/basicint.h"
+#include "math/hal/intnat/limballocator.h"
+#include "math/hal/intnat/mubintvecnat-simd.h"
 #include "math/hal/intnat/ubintnat.h"
 #include "math/hal/vector.h"
 
@@ -48,6 +50,7 @@
 #include <initializer_list>
 #include <iostream>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -123,7 +126,7 @@ private:
     IntegerType m_modulus{0};
 
 #if BLOCK_VECTOR_ALLOCATION != 1
-    std::vector<IntegerType> m_data{};
+    std::vector<IntegerType, LimbAllocator<IntegerType>> m_data{};
 #else
     xvector<IntegerType> m_data;
 #endif
@@ -133,8 +136,24 @@ private:
         return length < m_data.size();
     }
 
+    // The SIMD kernels of mubintvecnat-simd.h work on the 64-bit values of the vector
+    static constexpr bool HasSIMDKernels() {
+        return std::is_same_v<IntegerType, NativeIntegerT<uint64_t>>;
+    }
+
+    uint64_t* SIMDData() {
+        return reinterpret_cast<uint64_t*>(m_data.data());
+    }
+
+    const uint64_t* SIMDData() const {
+        return reinterpret_cast<const uint64_t*>(m_data.data());
+    }
+
 public:
     using BasicInt = typename IntegerType::Integer;
+#if BLOCK_VECTOR_ALLOCATION != 1
+    using Allocator = LimbAllocator<IntegerType>;
+#endif
 
     constexpr NativeVectorT() = default;
 
@@ -187,6 +206,28 @@ public:
     constexpr NativeVectorT(NativeVectorT&& v) noexcept
         : m_modulus{std::move(v.m_modulus)}, m_data{std::move(v.m_data)} {}
 
+#if BLOCK_VECTOR_ALLOCATION != 1
+    /**
+   * Constructor for a zero vector whose entries are taken from an allocator,
+   * e.g., from the contiguous buffer of a DCRT polynomial.
+   *
+   * @param length is the length of the native vector, in terms of the number of
+   * entries.
+   * @param modulus is the modulus of the ring.
+   * @param alloc is the allocator of the entries.
+   */
+    NativeVectorT(usint length, const IntegerType& modulus, const Allocator& alloc)
+        : m_modulus{modulus}, m_data(length, alloc) {}
+
+    /**
+   * Copy constructor that takes the entries from an allocator.
+   *
+   * @param v is the native vector to be copied.
+   * @param alloc is the allocator of the entries.
+   */
+    NativeVectorT(const NativeVectorT& v, const Allocator& alloc) : m_modulus{v.m_modulus}, m_data(v.m_data, alloc) {}
+#endif
+
     /**
    * Basic constructor for specifying the length of the vector
    * the modulus and an initializer list.
@@ -411,6 +452,10 @@ public:
     NativeVectorT& ModAddNoCheckEq(const NativeVectorT& b) {
         size_t size{m_data.size()};
         auto mv{m_modulus};
+        if constexpr (HasSIMDKernels()) {
+            if (ModAddSIMD(SIMDData(), b.SIMDData(), mv.ConvertToInt(), size))
+                return *this;
+        }
         for (size_t i = 0; i < size; ++i)
             m_data[i].ModAddFastEq(b[i], mv);
         return *this;
@@ -486,6 +531,21 @@ public:
     NativeVectorT& ModMulNoCheckEq(const NativeVectorT& b) {
         size_t size{m_data.size()};
         auto mv{m_modulus};
+        if constexpr (HasSIMDKernels()) {
+            if (ModMulSIMD(SIMDData(), b.SIMDData(), mv.ConvertToInt(), size))
+                return *this;
+        }
+#ifdef NATIVEINT_MONTGOMERY_MOD
+        if (mv.IsMontgomeryModulus()) {
+            // the Montgomery product a * b * R^{-1} is scaled back by R mod q with Shoup's multiplication
+            auto qInv{mv.ComputeMontgomeryInverse()};
+            auto r{mv.ComputeMontgomeryR()};
+            auto rPrecon{r.PrepModMulConst(mv)};
+            for (size_t i = 0; i < size; ++i)
+                m_data[i].ModMulMontgomeryEq(b[i], mv, qInv).ModMulFastConstEq(r, mv, rPrecon);
+            return *this;
+        }
+#endif
 #ifdef NATIVEINT_BARRET_MOD
         auto mu{m_modulus.ComputeMu()};
         for (size_t i = 0; i < size; ++i)
@@ -497,6 +557,41 @@ public:
         return *this;
     }
 
+    /**
+   * Conversion to Montgomery form, see NativeIntegerT::ToMontgomery. Assumes
+   * the entries are < modulus. In-place variant.
+   *
+   * @return is the vector in Montgomery form.
+   */
+    NativeVectorT& ToMontgomeryEq();
+
+    /**
+   * Conversion from Montgomery form. In-place variant.
+   *
+   * @return is the vector in plain form.
+   */
+    NativeVectorT& FromMontgomeryEq();
+
+    /**
+   * Vector Montgomery modular multiplication, see
+   * NativeIntegerT::ModMulMontgomery. If b is in Montgomery form, the result is
+   * the modular product of the vectors in the form of this vector, so a vector
+   * that multiplies many others can be converted once. Assumes the entries are
+   * < modulus.
+   *
+   * @param &b is the vector to multiply.
+   * @return is the result of the Montgomery multiplication.
+   */
+    NativeVectorT ModMulMontgomery(const NativeVectorT& b) const;
+
+    /**
+   * Vector Montgomery modular multiplication. In-place variant.
+   *
+   * @param &b is the vector to multiply.
+   * @return is the result of the Montgomery multiplication.
+   */
+    NativeVectorT& ModMulMontgomeryEq(const NativeVectorT& b);
+
     /**
    * Vector multiplication without applying the modulus operation.
    *
@@ -40,6 +40,7 @@
 #include "math/hal/intnat/ubintnat.h"
 #include "math/hal/intnat/mubintvecnat.h"
 #include "math/hal/intnat/transformnat.h"
+#include "math/hal/intnat/transformnat-simd.h"
 #include "math/nbtheory.h"
 
 #include "utils/exception.h"
@@ -47,33 +48,33 @@
 #include "utils/utilities.h"
 
 #include <map>
+#include <type_traits>
 #include <vector>
 
 namespace intnat {
 
+// The SIMD engines of transformnat-simd.h work on the 64-bit values of native vectors
 template <typename VecType>
-std::map<typename VecType::Integer, VecType>
-    ChineseRemainderTransformFTTNat<VecType>::m_cycloOrderInverseTableByModulus;
+constexpr bool HasSIMDTransform() {
+    return std::is_same_v<typename VecType::Integer, NativeIntegerT<uint64_t>>;
+}
 
 template <typename VecType>
-std::map<typename VecType::Integer, VecType>
-    ChineseRemainderTransformFTTNat<VecType>::m_cycloOrderInversePreconTableByModulus;
+inline const uint64_t* SIMDTransformData(const VecType& vec) {
+    return reinterpret_cast<const uint64_t*>(&vec[0]);
+}
 
 template <typename VecType>
-std::map<typename VecType::Integer, VecType>
-    ChineseRemainderTransformFTTNat<VecType>::m_rootOfUnityReverseTableByModulus;
+inline uint64_t* SIMDTransformData(VecType* vec) {
+    return reinterpret_cast<uint64_t*>(&(*vec)[0]);
+}
 
 template <typename VecType>
-std::map<typename VecType::Integer, VecType>
-    ChineseRemainderTransformFTTNat<VecType>::m_rootOfUnityInverseReverseTableByModulus;
+std::map<std::pair<typename VecType::Integer, usint>, std::shared_ptr<const NTTTablesNat<VecType>>>
+    ChineseRemainderTransformFTTNat<VecType>::m_tablesByModulusCycloOrder;
 
 template <typename VecType>
-std::map<typename VecType::Integer, VecType>
-    ChineseRemainderTransformFTTNat<VecType>::m_rootOfUnityPreconReverseTableByModulus;
-
-template <typename VecType>
-std::map<typename VecType::Integer, VecType>
-    ChineseRemainderTransformFTTNat<VecType>::m_rootOfUnityInversePreconReverseTableByModulus;
+std::shared_mutex ChineseRemainderTransformFTTNat<VecType>::m_tablesMutex;
 
 template <typename VecType>
 std::map<typename VecType::Integer, VecType> ChineseRemainderTransformArbNat<VecType>::m_cyclotomicPolyMap;
@@ -300,6 +301,13 @@ template <typename VecType>
 void NumberTheoreticTransformNat<VecType>::ForwardTransformToBitReverseInPlace(const VecType& rootOfUnityTable,
                                                                                const VecType& preconRootOfUnityTable,
                                                                                VecType* element) {
+    if constexpr (HasSIMDTransform<VecType>()) {
+        if (ForwardTransformToBitReverseInPlaceSIMD(
+                SIMDTransformData(rootOfUnityTable), SIMDTransformData(preconRootOfUnityTable),
+                element->GetModulus().ConvertToInt(), element->GetLength(), SIMDTransformData(element)))
+            return;
+    }
+
     auto modulus{element->GetModulus()};
     uint32_t n(element->GetLength() >> 1), t{n}, logt{lbcrypto::GetMSB(t)};
     for (uint32_t m{1}; m < n; m <<= 1, t >>= 1, --logt) {
@@ -372,6 +380,13 @@ void NumberTheoreticTransformNat<VecType>::ForwardTransformToBitReverse(const Ve
         (*result)[i] = element[i];
     }
 
+    if constexpr (HasSIMDTransform<VecType>()) {
+        if (ForwardTransformToBitReverseInPlaceSIMD(SIMDTransformData(rootOfUnityTable),
+                                                    SIMDTransformData(preconRootOfUnityTable),
+                                                    modulus.ConvertToInt(), n, SIMDTransformData(result)))
+            return;
+    }
+
     uint32_t indexOmega, indexHi;
     NativeInteger preconOmega;
     IntType omega, omegaFactor, loVal, hiVal, zero(0);
@@ -492,6 +507,14 @@ template <typename VecType>
 void NumberTheoreticTransformNat<VecType>::InverseTransformFromBitReverseInPlace(
     const VecType& rootOfUnityInverseTable, const VecType& preconRootOfUnityInverseTable, const IntType& cycloOrderInv,
     const IntType& preconCycloOrderInv, VecType* element) {
+    if constexpr (HasSIMDTransform<VecType>()) {
+        if (InverseTransformFromBitReverseInPlaceSIMD(
+                SIMDTransformData(rootOfUnityInverseTable), SIMDTransformData(preconRootOfUnityInverseTable),
+                cycloOrderInv.ConvertToInt(), preconCycloOrderInv.ConvertToInt(),
+                element->GetModulus().ConvertToInt(), element->GetLength(), SIMDTransformData(element)))
+            return;
+    }
+
     auto modulus{element->GetModulus()};
     uint32_t n(element->GetLength());
     for (uint32_t i{0}; i < n; i += 2) {
@@ -571,6 +594,88 @@ void NumberTheoreticTransformNat<VecType>::InverseTransformFromBitReverse(
     return;
 }
 
+template <typename VecType>
+void NumberTheoreticTransformNat<VecType>::ForwardTransformToBitReverseInPlaceMontgomery(const VecType& rootOfUnityTable,
+                                                                                         const IntType& modulusInverse,
+                                                                                         VecType* element) {
+    auto modulus{element->GetModulus()};
+    uint32_t n(element->GetLength() >> 1), t{n}, logt{lbcrypto::GetMSB(t)};
+    for (uint32_t m{1}; m < n; m <<= 1, t >>= 1, --logt) {
+        for (uint32_t i{0}; i < m; ++i) {
+            auto omega{rootOfUnityTable[i + m]};
+            for (uint32_t j1{i << logt}, j2{j1 + t}; j1 < j2; ++j1) {
+                auto omegaFactor{(*element)[j1 + t]};
+                omegaFactor.ModMulMontgomeryEq(omega, modulus, modulusInverse);
+                auto loVal{(*element)[j1 + 0]};
+                auto hiVal{loVal + omegaFactor};
+                if (hiVal >= modulus)
+                    hiVal -= modulus;
+                if (loVal < omegaFactor)
+                    loVal += modulus;
+                loVal -= omegaFactor;
+                (*element)[j1 + 0] = hiVal;
+                (*element)[j1 + t] = loVal;
+            }
+        }
+    }
+    for (uint32_t i{0}; i < (n << 1); i += 2) {
+        auto omegaFactor{(*element)[i + 1]};
+        omegaFactor.ModMulMontgomeryEq(rootOfUnityTable[(i >> 1) + n], modulus, modulusInverse);
+        auto loVal{(*element)[i + 0]};
+        auto hiVal{loVal + omegaFactor};
+        if (hiVal >= modulus)
+            hiVal -= modulus;
+        if (loVal < omegaFactor)
+            loVal += modulus;
+        loVal -= omegaFactor;
+        (*element)[i + 0] = hiVal;
+        (*element)[i + 1] = loVal;
+    }
+}
+
+template <typename VecType>
+void NumberTheoreticTransformNat<VecType>::InverseTransformFromBitReverseInPlaceMontgomery(
+    const VecType& rootOfUnityInverseTable, const IntType& cycloOrderInv, const IntType& modulusInverse,
+    VecType* element) {
+    auto modulus{element->GetModulus()};
+    uint32_t n(element->GetLength());
+    for (uint32_t i{0}; i < n; i += 2) {
+        auto hiVal{(*element)[i + 1]};
+        auto loVal{(*element)[i + 0]};
+        auto omegaFactor{loVal};
+        if (omegaFactor < hiVal)
+            omegaFactor += modulus;
+        omegaFactor -= hiVal;
+        loVal += hiVal;
+        if (loVal >= modulus)
+            loVal -= modulus;
+        loVal.ModMulMontgomeryEq(cycloOrderInv, modulus, modulusInverse);
+        omegaFactor.ModMulMontgomeryEq(rootOfUnityInverseTable[(i + n) >> 1], modulus, modulusInverse);
+        omegaFactor.ModMulMontgomeryEq(cycloOrderInv, modulus, modulusInverse);
+        (*element)[i + 0] = loVal;
+        (*element)[i + 1] = omegaFactor;
+    }
+    for (uint32_t m{n >> 2}, t{2}, logt{2}; m >= 1; m >>= 1, t <<= 1, ++logt) {
+        for (uint32_t i{0}; i < m; ++i) {
+            auto omega{rootOfUnityInverseTable[i + m]};
+            for (uint32_t j1{i << logt}, j2{j1 + t}; j1 < j2; ++j1) {
+                auto hiVal{(*element)[j1 + t]};
+                auto loVal{(*element)[j1 + 0]};
+                auto omegaFactor{loVal};
+                if (omegaFactor < hiVal)
+                    omegaFactor += modulus;
+                omegaFactor -= hiVal;
+                loVal += hiVal;
+                if (loVal >= modulus)
+                    loVal -= modulus;
+                omegaFactor.ModMulMontgomeryEq(omega, modulus, modulusInverse);
+                (*element)[j1 + 0] = loVal;
+                (*element)[j1 + t] = omegaFactor;
+            }
+        }
+    }
+}
+
 template <typename VecType>
 void ChineseRemainderTransformFTTNat<VecType>::ForwardTransformToBitReverseInPlace(const IntType& rootOfUnity,
                                                                                    const usint CycloOrder,
@@ -588,15 +693,7 @@ void ChineseRemainderTransformFTTNat<VecType>::ForwardTransformToBitReverseInPla
         OPENFHE_THROW(lbcrypto::math_error, "element size must be equal to CyclotomicOrder / 2");
     }
 
-    IntType modulus = element->GetModulus();
-
-    auto mapSearch = m_rootOfUnityReverseTableByModulus.find(modulus);
-    if (mapSearch == m_rootOfUnityReverseTableByModulus.end() || mapSearch->second.GetLength() != CycloOrderHf) {
-        PreCompute(rootOfUnity, CycloOrder, modulus);
-    }
-
-    NumberTheoreticTransformNat<VecType>().ForwardTransformToBitReverseInPlace(
-        m_rootOfUnityReverseTableByModulus[modulus], m_rootOfUnityPreconReverseTableByModulus[modulus], element);
+    ForwardTransformToBitReverseInPlace(*GetTables(rootOfUnity, CycloOrder, element->GetModulus()), element);
 }
 
 template <typename VecType>
@@ -617,16 +714,17 @@ void ChineseRemainderTransformFTTNat<VecType>::ForwardTransformToBitReverse(cons
         OPENFHE_THROW(lbcrypto::math_error, "result size must be equal to CyclotomicOrder / 2");
     }
 
-    IntType modulus = element.GetModulus();
-
-    auto mapSearch = m_rootOfUnityReverseTableByModulus.find(modulus);
-    if (mapSearch == m_rootOfUnityReverseTableByModulus.end() || mapSearch->second.GetLength() != CycloOrderHf) {
-        PreCompute(rootOfUnity, CycloOrder, modulus);
+    auto tables = GetTables(rootOfUnity, CycloOrder, element.GetModulus());
+#ifdef NATIVEINT_MONTGOMERY_MOD
+    result->SetModulus(element.GetModulus());
+    for (usint i = 0; i < CycloOrderHf; i++) {
+        (*result)[i] = element[i];
     }
-
-    NumberTheoreticTransformNat<VecType>().ForwardTransformToBitReverse(
-        element, m_rootOfUnityReverseTableByModulus[modulus], m_rootOfUnityPreconReverseTableByModulus[modulus],
-        result);
+    ForwardTransformToBitReverseInPlace(*tables, result);
+#else
+    NumberTheoreticTransformNat<VecType>().ForwardTransformToBitReverse(element, tables->rootOfUnityReverseTable,
+                                                                        tables->rootOfUnityPreconReverseTable, result);
+#endif
 
     return;
 }
@@ -648,18 +746,7 @@ void ChineseRemainderTransformFTTNat<VecType>::InverseTransformFromBitReverseInP
         OPENFHE_THROW(lbcrypto::math_error, "element size must be equal to CyclotomicOrder / 2");
     }
 
-    IntType modulus = element->GetModulus();
-
-    auto mapSearch = m_rootOfUnityReverseTableByModulus.find(modulus);
-    if (mapSearch == m_rootOfUnityReverseTableByModulus.end() || mapSearch->second.GetLength() != CycloOrderHf) {
-        PreCompute(rootOfUnity, CycloOrder, modulus);
-    }
-
-    usint msb = lbcrypto::GetMSB(CycloOrderHf - 1);
-    NumberTheoreticTransformNat<VecType>().InverseTransformFromBitReverseInPlace(
-        m_rootOfUnityInverseReverseTableByModulus[modulus], m_rootOfUnityInversePreconReverseTableByModulus[modulus],
-        m_cycloOrderInverseTableByModulus[modulus][msb], m_cycloOrderInversePreconTableByModulus[modulus][msb],
-        element);
+    InverseTransformFromBitReverseInPlace(*GetTables(rootOfUnity, CycloOrder, element->GetModulus()), element);
 }
 
 template <typename VecType>
@@ -680,12 +767,7 @@ void ChineseRemainderTransformFTTNat<VecType>::InverseTransformFromBitReverse(co
         OPENFHE_THROW(lbcrypto::math_error, "result size must be equal to CyclotomicOrder / 2");
     }
 
-    IntType modulus = element.GetModulus();
-
-    auto mapSearch = m_rootOfUnityReverseTableByModulus.find(modulus);
-    if (mapSearch == m_rootOfUnityReverseTableByModulus.end() || mapSearch->second.GetLength() != CycloOrderHf) {
-        PreCompute(rootOfUnity, CycloOrder, modulus);
-    }
+    auto tables = GetTables(rootOfUnity, CycloOrder, element.GetModulus());
 
     usint n = element.GetLength();
     result->SetModulus(element.GetModulus());
@@ -693,70 +775,125 @@ void ChineseRemainderTransformFTTNat<VecType>::InverseTransformFromBitReverse(co
         (*result)[i] = element[i];
     }
 
-    usint msb = lbcrypto::GetMSB(CycloOrderHf - 1);
-    NumberTheoreticTransformNat<VecType>().InverseTransformFromBitReverseInPlace(
-        m_rootOfUnityInverseReverseTableByModulus[modulus], m_rootOfUnityInversePreconReverseTableByModulus[modulus],
-        m_cycloOrderInverseTableByModulus[modulus][msb], m_cycloOrderInversePreconTableByModulus[modulus][msb], result);
+    InverseTransformFromBitReverseInPlace(*tables, result);
 
     return;
 }
 
 template <typename VecType>
-void ChineseRemainderTransformFTTNat<VecType>::PreCompute(const IntType& rootOfUnity, const usint CycloOrder,
-                                                          const IntType& modulus) {
-    // Half of cyclo order
-    usint CycloOrderHf = (CycloOrder >> 1);
+void ChineseRemainderTransformFTTNat<VecType>::ForwardTransformToBitReverseInPlace(const NTTTablesNat<VecType>& tables,
+                                                                                   VecType* element) {
+    if (element->GetLength() != tables.rootOfUnityReverseTable.GetLength()) {
+        OPENFHE_THROW(lbcrypto::math_error, "element size must be equal to the ring dimension of the tables");
+    }
 
-    auto mapSearch = m_rootOfUnityReverseTableByModulus.find(modulus);
-    if (mapSearch == m_rootOfUnityReverseTableByModulus.end() || mapSearch->second.GetLength() != CycloOrderHf) {
-#pragma omp critical
-        {
-            IntType x(1), xinv(1);
-            usint msb  = lbcrypto::GetMSB(CycloOrderHf - 1);
-            IntType mu = modulus.ComputeMu();
-            VecType Table(CycloOrderHf, modulus);
-            VecType TableI(CycloOrderHf, modulus);
-            IntType rootOfUnityInverse = rootOfUnity.ModInverse(modulus);
-            usint iinv;
-            for (usint i = 0; i < CycloOrderHf; i++) {
-                iinv         = lbcrypto::ReverseBits(i, msb);
-                Table[iinv]  = x;
-                TableI[iinv] = xinv;
-                x.ModMulEq(rootOfUnity, modulus, mu);
-                xinv.ModMulEq(rootOfUnityInverse, modulus, mu);
-            }
-            m_rootOfUnityReverseTableByModulus[modulus]        = Table;
-            m_rootOfUnityInverseReverseTableByModulus[modulus] = TableI;
+#ifdef NATIVEINT_MONTGOMERY_MOD
+    // the SIMD engines keep Shoup's multiplication
+    if (tables.rootOfUnityMontgomeryReverseTable.GetLength() != 0 &&
+        (!HasSIMDTransform<VecType>() || GetNTTEngine() == NTT_SCALAR)) {
+        NumberTheoreticTransformNat<VecType>().ForwardTransformToBitReverseInPlaceMontgomery(
+            tables.rootOfUnityMontgomeryReverseTable, tables.modulusMontgomeryInverse, element);
+        return;
+    }
+#endif
+    NumberTheoreticTransformNat<VecType>().ForwardTransformToBitReverseInPlace(
+        tables.rootOfUnityReverseTable, tables.rootOfUnityPreconReverseTable, element);
+}
 
-            VecType TableCOI(msb + 1, modulus);
-            for (usint i = 0; i < msb + 1; i++) {
-                IntType coInv(IntType(1 << i).ModInverse(modulus));
-                TableCOI[i] = coInv;
-            }
-            m_cycloOrderInverseTableByModulus[modulus] = TableCOI;
+template <typename VecType>
+void ChineseRemainderTransformFTTNat<VecType>::InverseTransformFromBitReverseInPlace(
+    const NTTTablesNat<VecType>& tables, VecType* element) {
+    if (element->GetLength() != tables.rootOfUnityInverseReverseTable.GetLength()) {
+        OPENFHE_THROW(lbcrypto::math_error, "element size must be equal to the ring dimension of the tables");
+    }
 
-            NativeInteger nativeModulus = modulus.ConvertToInt();
-            VecType preconTable(CycloOrderHf, nativeModulus);
-            VecType preconTableI(CycloOrderHf, nativeModulus);
+#ifdef NATIVEINT_MONTGOMERY_MOD
+    if (tables.rootOfUnityInverseMontgomeryReverseTable.GetLength() != 0 &&
+        (!HasSIMDTransform<VecType>() || GetNTTEngine() == NTT_SCALAR)) {
+        NumberTheoreticTransformNat<VecType>().InverseTransformFromBitReverseInPlaceMontgomery(
+            tables.rootOfUnityInverseMontgomeryReverseTable, tables.cycloOrderInverseMontgomery,
+            tables.modulusMontgomeryInverse, element);
+        return;
+    }
+#endif
+    NumberTheoreticTransformNat<VecType>().InverseTransformFromBitReverseInPlace(
+        tables.rootOfUnityInverseReverseTable, tables.rootOfUnityInversePreconReverseTable, tables.cycloOrderInverse,
+        tables.cycloOrderInversePrecon, element);
+}
 
-            for (usint i = 0; i < CycloOrderHf; i++) {
-                preconTable[i] = NativeInteger(m_rootOfUnityReverseTableByModulus[modulus][i].ConvertToInt())
-                                     .PrepModMulConst(nativeModulus);
-                preconTableI[i] = NativeInteger(m_rootOfUnityInverseReverseTableByModulus[modulus][i].ConvertToInt())
-                                      .PrepModMulConst(nativeModulus);
-            }
+template <typename VecType>
+std::shared_ptr<const NTTTablesNat<VecType>> ChineseRemainderTransformFTTNat<VecType>::GetTables(
+    const IntType& rootOfUnity, const usint CycloOrder, const IntType& modulus) {
+    const std::pair<IntType, usint> key{modulus, CycloOrder};
+    {
+        std::shared_lock<std::shared_mutex> lock(m_tablesMutex);
+        auto mapSearch = m_tablesByModulusCycloOrder.find(key);
+        if (mapSearch != m_tablesByModulusCycloOrder.end() && mapSearch->second->rootOfUnity == rootOfUnity)
+            return mapSearch->second;
+    }
 
-            VecType preconTableCOI(msb + 1, nativeModulus);
-            for (usint i = 0; i < msb + 1; i++) {
-                preconTableCOI[i] = NativeInteger(m_cycloOrderInverseTableByModulus[modulus][i].ConvertToInt())
-                                        .PrepModMulConst(nativeModulus);
-            }
+    // The tables are built without holding the lock. Threads racing to build the same tables compute identical
+    // values, and the first one to insert them wins.
+    usint CycloOrderHf = (CycloOrder >> 1);
 
-            m_rootOfUnityPreconReverseTableByModulus[modulus]        = preconTable;
-            m_rootOfUnityInversePreconReverseTableByModulus[modulus] = preconTableI;
-            m_cycloOrderInversePreconTableByModulus[modulus]         = preconTableCOI;
-        }
+    auto tables         = std::make_shared<NTTTablesNat<VecType>>();
+    tables->rootOfUnity = rootOfUnity;
+
+    IntType x(1), xinv(1);
+    usint msb  = lbcrypto::GetMSB(CycloOrderHf - 1);
+    IntType mu = modulus.ComputeMu();
+    VecType Table(CycloOrderHf, modulus);
+    VecType TableI(CycloOrderHf, modulus);
+    IntType rootOfUnityInverse = rootOfUnity.ModInverse(modulus);
+    usint iinv;
+    for (usint i = 0; i < CycloOrderHf; i++) {
+        iinv         = lbcrypto::ReverseBits(i, msb);
+        Table[iinv]  = x;
+        TableI[iinv] = xinv;
+        x.ModMulEq(rootOfUnity, modulus, mu);
+        xinv.ModMulEq(rootOfUnityInverse, modulus, mu);
+    }
+
+    NativeInteger nativeModulus = modulus.ConvertToInt();
+    VecType preconTable(CycloOrderHf, nativeModulus);
+    VecType preconTableI(CycloOrderHf, nativeModulus);
+
+    for (usint i = 0; i < CycloOrderHf; i++) {
+        preconTable[i]  = NativeInteger(Table[i].ConvertToInt()).PrepModMulConst(nativeModulus);
+        preconTableI[i] = NativeInteger(TableI[i].ConvertToInt()).PrepModMulConst(nativeModulus);
     }
+
+    tables->rootOfUnityReverseTable              = std::move(Table);
+    tables->rootOfUnityInverseReverseTable       = std::move(TableI);
+    tables->rootOfUnityPreconReverseTable        = std::move(preconTable);
+    tables->rootOfUnityInversePreconReverseTable = std::move(preconTableI);
+
+    tables->cycloOrderInverse = IntType(CycloOrderHf).ModInverse(modulus);
+    tables->cycloOrderInversePrecon =
+        NativeInteger(tables->cycloOrderInverse.ConvertToInt()).PrepModMulConst(nativeModulus);
+
+#ifdef NATIVEINT_MONTGOMERY_MOD
+    if (modulus.IsMontgomeryModulus()) {
+        tables->rootOfUnityMontgomeryReverseTable = tables->rootOfUnityReverseTable;
+        tables->rootOfUnityMontgomeryReverseTable.ToMontgomeryEq();
+        tables->rootOfUnityInverseMontgomeryReverseTable = tables->rootOfUnityInverseReverseTable;
+        tables->rootOfUnityInverseMontgomeryReverseTable.ToMontgomeryEq();
+        tables->cycloOrderInverseMontgomery = tables->cycloOrderInverse.ToMontgomery(modulus);
+        tables->modulusMontgomeryInverse    = modulus.ComputeMontgomeryInverse();
+    }
+#endif
+
+    std::unique_lock<std::shared_mutex> lock(m_tablesMutex);
+    auto& entry = m_tablesByModulusCycloOrder[key];
+    if (entry == nullptr || entry->rootOfUnity != rootOfUnity)
+        entry = std::move(tables);
+    return entry;
+}
+
+template <typename VecType>
+void ChineseRemainderTransformFTTNat<VecType>::PreCompute(const IntType& rootOfUnity, const usint CycloOrder,
+                                                          const IntType& modulus) {
+    GetTables(rootOfUnity, CycloOrder, modulus);
 }
 
 template <typename VecType>
@@ -778,12 +915,8 @@ void ChineseRemainderTransformFTTNat<VecType>::PreCompute(std::vector<IntType>&
 
 template <typename VecType>
 void ChineseRemainderTransformFTTNat<VecType>::Reset() {
-    m_cycloOrderInverseTableByModulus.clear();
-    m_cycloOrderInversePreconTableByModulus.clear();
-    m_rootOfUnityReverseTableByModulus.clear();
-    m_rootOfUnityInverseReverseTableByModulus.clear();
-    m_rootOfUnityPreconReverseTableByModulus.clear();
-    m_rootOfUnityInversePreconReverseTableByModulus.clear();
+    std::unique_lock<std::shared_mutex> lock(m_tablesMutex);
+    m_tablesByModulusCycloOrder.clear();
 }
 
 template <typename VecType>
@@ -0,0 +1,118 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  This file contains the interface of the SIMD engines for the power-of-two NTT in the native math backend
+ */
+
+#ifndef LBCRYPTO_MATH_HAL_INTNAT_TRANSFORMNAT_SIMD_H
+#define LBCRYPTO_MATH_HAL_INTNAT_TRANSFORMNAT_SIMD_H
+
+#include <cstdint>
+
+namespace intnat {
+
+/**
+ * @brief Engines for the NTT in the ring Z_q[X]/(X^n+1) over 64-bit native integers. By default, the fastest engine
+ * the CPU supports is used. NTT_AVX512IFMA needs q < 2^51 and uses NTT_AVX512 for larger moduli; all SIMD engines
+ * need q < 2^62, which holds for every native modulus of OpenFHE. The element-wise operations of native vectors
+ * (mubintvecnat-simd.h) use the same engine.
+ */
+enum NTTEngine {
+    NTT_SCALAR = 0,
+    NTT_AVX2,
+    NTT_AVX512,
+    NTT_AVX512IFMA,
+};
+
+/**
+ * Checks whether an NTT engine can be used: the library was compiled with
+ * its kernels and the CPU supports its instruction set.
+ *
+ * @param engine is the engine to check.
+ * @return true if the engine can be selected with SetNTTEngine()
+ */
+bool IsNTTEngineSupported(NTTEngine engine);
+
+/**
+ * @return the engine used for all subsequent transforms
+ */
+NTTEngine GetNTTEngine();
+
+/**
+ * Selects the engine for all subsequent transforms, e.g., to compare engines
+ * in tests and benchmarks. The results do not depend on the engine.
+ *
+ * @param engine is the engine to use.
+ * @return false, keeping the current engine, if the engine is not supported
+ */
+bool SetNTTEngine(NTTEngine engine);
+
+/**
+ * In-place forward transform in the ring Z_q[X]/(X^n+1) with the current
+ * engine. Inputs and outputs are fully reduced modulo q.
+ *
+ * @param rootOfUnityTable is the table with the 2n-th root of unity powers in
+ * bit reverse order.
+ * @param preconRootOfUnityTable is Shoup's precomputation of the table.
+ * @param modulus is q.
+ * @param n is the ring dimension.
+ * @param[in,out] element is the input/output of the transform.
+ * @return false, leaving element unchanged, if the current engine is
+ * NTT_SCALAR or cannot handle the modulus or the ring dimension
+ */
+bool ForwardTransformToBitReverseInPlaceSIMD(const uint64_t* rootOfUnityTable, const uint64_t* preconRootOfUnityTable,
+                                             uint64_t modulus, uint32_t n, uint64_t* element);
+
+/**
+ * In-place inverse transform in the ring Z_q[X]/(X^n+1) with the current
+ * engine, including the scaling by the inverse of n. Inputs and outputs are
+ * fully reduced modulo q.
+ *
+ * @param rootOfUnityInverseTable is the table with the inverse 2n-th root of
+ * unity powers in bit reverse order.
+ * @param preconRootOfUnityInverseTable is Shoup's precomputation of the table.
+ * @param cycloOrderInv is the inverse of n modulo q.
+ * @param preconCycloOrderInv is Shoup's precomputation of cycloOrderInv.
+ * @param modulus is q.
+ * @param n is the ring dimension.
+ * @param[in,out] element is the input/output of the transform.
+ * @return false, leaving element unchanged, if the current engine is
+ * NTT_SCALAR or cannot handle the modulus or the ring dimension
+ */
+bool InverseTransformFromBitReverseInPlaceSIMD(const uint64_t* rootOfUnityInverseTable,
+                                               const uint64_t* preconRootOfUnityInverseTable, uint64_t cycloOrderInv,
+                                               uint64_t preconCycloOrderInv, uint64_t modulus, uint32_t n,
+                                               uint64_t* element);
+
+}  // namespace intnat
+
+#endif
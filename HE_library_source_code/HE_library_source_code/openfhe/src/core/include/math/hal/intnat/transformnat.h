@@ -41,7 +41,9 @@
 #include "utils/inttypes.h"
 
 #include <map>
+#include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -239,6 +241,75 @@ public:
                                                const VecType& preconRootOfUnityInverseTable,
                                                const IntType& cycloOrderInv, const IntType& preconCycloOrderInv,
                                                VecType* element);
+
+    /**
+   * In-place forward transform in the ring Z_q[X]/(X^n+1) with prime q and
+   * power-of-two n s.t. 2n|q-1. Bit reversing indexes. The butterflies use
+   * Montgomery multiplication instead of NTL's, so q has to be odd and smaller
+   * than R / 2 (see NativeIntegerT::ModMulMontgomery). The scalar code is always
+   * used. [Algorithm 1 in https://eprint.iacr.org/2016/504.pdf]
+   *
+   * @param &rootOfUnityTable is the table with the root of unity powers in bit
+   * reverse order, in Montgomery form.
+   * @param &modulusInverse is q.ComputeMontgomeryInverse().
+   * @param[in,out] &element is the input/output of the transform of type VecType and length n.
+   * @return none
+   */
+    void ForwardTransformToBitReverseInPlaceMontgomery(const VecType& rootOfUnityTable, const IntType& modulusInverse,
+                                                       VecType* element);
+
+    /**
+   * In-place inverse transform in the ring Z_q[X]/(X^n+1) with prime q and
+   * power-of-two n s.t. 2n|q-1. Bit reversing indexes. The butterflies use
+   * Montgomery multiplication instead of NTL's, so q has to be odd and smaller
+   * than R / 2 (see NativeIntegerT::ModMulMontgomery). The scalar code is always
+   * used. [Algorithm 2 in https://eprint.iacr.org/2016/504.pdf]
+   *
+   * @param &rootOfUnityInverseTable is the table with the inverse 2n-th root of
+   * unity powers in bit reverse order, in Montgomery form.
+   * @param &cycloOrderInv is inverse of n modulo q, in Montgomery form
+   * @param &modulusInverse is q.ComputeMontgomeryInverse().
+   * @param[in,out] &element is the input/output of the transform of type VecType and length n.
+   * @return none
+   */
+    void InverseTransformFromBitReverseInPlaceMontgomery(const VecType& rootOfUnityInverseTable,
+                                                         const IntType& cycloOrderInv, const IntType& modulusInverse,
+                                                         VecType* element);
+};
+
+/**
+ * @brief Precomputed tables for the transforms in the ring Z_q[X]/(X^n+1) for one prime modulus q and one ring
+ * dimension n. The tables never change after they are built, so a handle to them can be shared by all element
+ * parameters with the same modulus and ring dimension and used from several threads.
+ */
+template <typename VecType>
+struct NTTTablesNat {
+    using IntType = typename VecType::Integer;
+
+    /// the 2n-th root of unity the tables were built from
+    IntType rootOfUnity;
+    /// forward roots of unity for NTT, with bits reversed (aka twiddle factors)
+    VecType rootOfUnityReverseTable;
+    /// Shoup's precomputations of #rootOfUnityReverseTable
+    VecType rootOfUnityPreconReverseTable;
+    /// inverse roots of unity for iNTT, with bits reversed (aka inverse twiddle factors)
+    VecType rootOfUnityInverseReverseTable;
+    /// Shoup's precomputations of #rootOfUnityInverseReverseTable
+    VecType rootOfUnityInversePreconReverseTable;
+    /// inverse of n modulo q
+    IntType cycloOrderInverse;
+    /// Shoup's precomputation of #cycloOrderInverse
+    IntType cycloOrderInversePrecon;
+#ifdef NATIVEINT_MONTGOMERY_MOD
+    /// #rootOfUnityReverseTable in Montgomery form, empty if q is not suitable for Montgomery multiplication
+    VecType rootOfUnityMontgomeryReverseTable;
+    /// #rootOfUnityInverseReverseTable in Montgomery form, empty if q is not suitable for Montgomery multiplication
+    VecType rootOfUnityInverseMontgomeryReverseTable;
+    /// #cycloOrderInverse in Montgomery form
+    IntType cycloOrderInverseMontgomery;
+    /// the inverse of q modulo R
+    IntType modulusMontgomeryInverse;
+#endif
 };
 
 /**
@@ -318,6 +389,39 @@ public:
    */
     void InverseTransformFromBitReverseInPlace(const IntType& rootOfUnity, const usint CycloOrder, VecType* element);
 
+    /**
+   * In-place Forward Transform in the ring Z_q[X]/(X^n+1) with tables obtained from GetTables(). Unlike the
+   * overload taking the root of unity, it does not look up the tables.
+   *
+   * @param &tables are the tables for the modulus and the ring dimension of \p element.
+   * @param[in,out] &element is the input/output of the transform of type VecType and length n.
+   * @return none
+   */
+    void ForwardTransformToBitReverseInPlace(const NTTTablesNat<VecType>& tables, VecType* element);
+
+    /**
+   * In-place Inverse Transform in the ring Z_q[X]/(X^n+1) with tables obtained from GetTables(). Unlike the
+   * overload taking the root of unity, it does not look up the tables.
+   *
+   * @param &tables are the tables for the modulus and the ring dimension of \p element.
+   * @param[in,out] &element is the input/output of the transform of type VecType and length n.
+   * @return none
+   */
+    void InverseTransformFromBitReverseInPlace(const NTTTablesNat<VecType>& tables, VecType* element);
+
+    /**
+   * Returns the tables for transforms in the ring Z_q[X]/(X^n+1), building
+   * them on first use. Tables are cached by modulus and cyclotomic order, so
+   * rings of different dimensions sharing a prime do not evict each other.
+   *
+   * @param &rootOfUnity is the 2n-th root of unity in Z_q.
+   * @param CycloOrder is a power-of-two, equal to 2n.
+   * @param modulus is q, the prime modulus
+   * @return a handle to the tables, which stays valid after Reset()
+   */
+    static std::shared_ptr<const NTTTablesNat<VecType>> GetTables(const IntType& rootOfUnity, const usint CycloOrder,
+                                                                  const IntType& modulus);
+
     /**
    * Precomputation of root of unity tables for transforms in the ring
    * Z_q[X]/(X^n+1)
@@ -347,25 +451,12 @@ public:
    */
     void Reset();
 
-    /// map to store the cyclo order inverse with modulus as a key
-    /// For inverse FTT, we also need #m_cycloOrderInversePreconTableByModulus (this is to use an N-size NTT for FTT instead of 2N-size NTT).
-    static std::map<IntType, VecType> m_cycloOrderInverseTableByModulus;
-
-    /// map to store the cyclo order inverse preconditioned with modulus as a key
-    /// Shoup's precomputation of above #m_cycloOrderInverseTableByModulus
-    static std::map<IntType, VecType> m_cycloOrderInversePreconTableByModulus;
-
-    /// map to store the forward roots of Unity for NTT, with bits reversed, with modulus as a key (aka twiddle factors)
-    static std::map<IntType, VecType> m_rootOfUnityReverseTableByModulus;
-
-    /// map to store inverse roots of unity for iNTT, with bits reversed, with modulus as a key (aka inverse twiddle factors)
-    static std::map<IntType, VecType> m_rootOfUnityInverseReverseTableByModulus;
-
-    /// map to store Shoup's precomputations of forward roots of unity for NTT, with bits reversed, with modulus as a key
-    static std::map<IntType, VecType> m_rootOfUnityPreconReverseTableByModulus;
+    /// map to store the tables with (modulus, cyclotomic order) as a key
+    static std::map<std::pair<IntType, usint>, std::shared_ptr<const NTTTablesNat<VecType>>>
+        m_tablesByModulusCycloOrder;
 
-    /// map to store Shoup's precomputations of inverse rou for iNTT, with bits reversed, with modulus as a key
-    static std::map<IntType, VecType> m_rootOfUnityInversePreconReverseTableByModulus;
+    /// guards #m_tablesByModulusCycloOrder; lookups take it shared, insertions exclusively
+    static std::shared_mutex m_tablesMutex;
 };
 
 // struct used as a key in BlueStein transform
@@ -72,6 +72,11 @@
 // optimize away the test
 #define NATIVEINT_DO_CHECKS false
 #define NATIVEINT_BARRET_MOD
+// with the CMake option WITH_MONTGOMERY, native vectors and the scalar NTT use Montgomery instead of Barrett
+// and Shoup multiplication
+#ifdef WITH_MONTGOMERY
+    #define NATIVEINT_MONTGOMERY_MOD
+#endif
 
 // TODO: remove these?
 using U32BITS = uint32_t;
@@ -1493,6 +1498,115 @@ public:
         return *this;
     }
 
+    /*  The next subroutines implement Montgomery multiplication with the radix
+    R = 2^MaxBits(), the size of the native integer. An integer a is in
+    Montgomery form when a * R mod q is stored instead of a. The Montgomery
+    product of a and b is a * b * R^{-1} mod q, so if b is in Montgomery form,
+    the product is a * b mod q and keeps the form of a. It takes one full and
+    two half multiplications and no shifts, which makes it cheaper than Barrett
+    multiplication when one operand is reused and can be converted once, or
+    when values stay in Montgomery form over a chain of multiplications. The
+    modulus has to be odd and smaller than R / 2. The method was proposed in
+    P. L. Montgomery, Modular Multiplication Without Trial Division, 1985.
+    */
+
+    /**
+   * Checks whether Montgomery multiplication can be used modulo this integer.
+   *
+   * @return true if this integer is odd and smaller than R / 2.
+   */
+    bool IsMontgomeryModulus() const {
+        return (m_value & 0x1) && (m_value >> (NativeIntegerT::MaxBits() - 1)) == 0;
+    }
+
+    /**
+   * Precomputation for Montgomery multiplication modulo this integer.
+   *
+   * @return the inverse of this integer modulo R.
+   */
+    NativeIntegerT ComputeMontgomeryInverse() const {
+        if ((m_value & 0x1) == 0)
+            OPENFHE_THROW(lbcrypto::math_error, "Montgomery multiplication needs an odd modulus");
+        // the sign of the difference in ModMulMontgomery is only correct for q < R / 2
+        if ((m_value >> (NativeIntegerT::MaxBits() - 1)) != 0)
+            OPENFHE_THROW(lbcrypto::math_error, "Montgomery multiplication needs a modulus smaller than R / 2");
+        // every Newton step doubles the number of correct low bits, which starts at 3 for an odd integer
+        NativeInt inv{m_value};
+        for (usint bits = 3; bits < NativeIntegerT::MaxBits(); bits <<= 1)
+            inv *= NativeInt(2) - m_value * inv;
+        return {inv};
+    }
+
+    /**
+   * Converts to Montgomery form. Assumes the integer is < modulus.
+   *
+   * @param modulus is the modulus to perform operations with.
+   * @return this * R mod modulus.
+   */
+    NativeIntegerT ToMontgomery(const NativeIntegerT& modulus) const {
+        // a * R mod q = a * R - floor(a * R / q) * q, where the first term vanishes modulo R
+        return {NativeInt(0) - PrepModMulConst(modulus).m_value * modulus.m_value};
+    }
+
+    /**
+   * Computes R mod this integer, the factor that turns a Montgomery product of
+   * two integers in standard form back into their plain product.
+   *
+   * @return R mod this integer.
+   */
+    NativeIntegerT ComputeMontgomeryR() const {
+        return {(NativeInt(0) - m_value) % m_value};
+    }
+
+    /**
+   * Converts from Montgomery form.
+   *
+   * @param modulus is the modulus to perform operations with.
+   * @param &qInv is the precomputation modulus.ComputeMontgomeryInverse().
+   * @return this * R^{-1} mod modulus.
+   */
+    NativeIntegerT FromMontgomery(const NativeIntegerT& modulus, const NativeIntegerT& qInv) const {
+        NativeInt r{MultDHi(m_value * qInv.m_value, modulus.m_value)};
+        return {r == 0 ? r : modulus.m_value - r};
+    }
+
+    /**
+   * Montgomery modular multiplication. Assumes the operands are < modulus.
+   *
+   * @param &b is the NativeIntegerT to multiply, in Montgomery form to get
+   * the plain product.
+   * @param modulus is the modulus to perform operations with.
+   * @param &qInv is the precomputation modulus.ComputeMontgomeryInverse().
+   * @return this * b * R^{-1} mod modulus.
+   */
+    NativeIntegerT ModMulMontgomery(const NativeIntegerT& b, const NativeIntegerT& modulus,
+                                    const NativeIntegerT& qInv) const {
+        typeD prod;
+        MultD(m_value, b.m_value, prod);
+        // the low halves of a * b and m * q are equal, so the difference of the high halves is the result
+        auto r = static_cast<SignedNativeInt>(prod.hi - MultDHi(prod.lo * qInv.m_value, modulus.m_value));
+        return {static_cast<NativeInt>(r >= 0 ? r : r + modulus.m_value)};
+    }
+
+    /**
+   * Montgomery modular multiplication. Assumes the operands are < modulus.
+   * In-place variant.
+   *
+   * @param &b is the NativeIntegerT to multiply, in Montgomery form to get
+   * the plain product.
+   * @param modulus is the modulus to perform operations with.
+   * @param &qInv is the precomputation modulus.ComputeMontgomeryInverse().
+   * @return this * b * R^{-1} mod modulus.
+   */
+    NativeIntegerT& ModMulMontgomeryEq(const NativeIntegerT& b, const NativeIntegerT& modulus,
+                                       const NativeIntegerT& qInv) {
+        typeD prod;
+        MultD(m_value, b.m_value, prod);
+        auto r  = static_cast<SignedNativeInt>(prod.hi - MultDHi(prod.lo * qInv.m_value, modulus.m_value));
+        m_value = static_cast<NativeInt>(r >= 0 ? r : r + modulus.m_value);
+        return *this;
+    }
+
     /**
    * Modulus exponentiation operation.
    *
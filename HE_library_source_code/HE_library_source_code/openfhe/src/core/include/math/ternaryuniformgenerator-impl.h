@@ -43,12 +43,24 @@
 
 #include <memory>
 #include <random>
+#include <vector>
 
 namespace lbcrypto {
 
 template <typename VecType>
-std::uniform_int_distribution<int> TernaryUniformGeneratorImpl<VecType>::m_distribution =
-    std::uniform_int_distribution<int>(-1, 1);
+void TernaryUniformGeneratorImpl<VecType>::FillTernary(int32_t* values, usint size) {
+    PRNG& g = PseudoRandomNumberGenerator::GetPRNG();
+    usint i = 0;
+    while (i < size) {
+        uint32_t word = g();
+        for (uint32_t k = 0; k < 16 && i < size; ++k, word >>= 2) {
+            // the candidate is always written; the position only advances when it is accepted
+            uint32_t candidate = word & 0x3;
+            values[i]          = static_cast<int32_t>(candidate) - 1;
+            i += (candidate != 0x3);
+        }
+    }
+}
 
 template <typename VecType>
 VecType TernaryUniformGeneratorImpl<VecType>::GenerateVector(usint size, const typename VecType::Integer& modulus,
@@ -58,15 +70,15 @@ VecType TernaryUniformGeneratorImpl<VecType>::GenerateVector(usint size, const t
 
     if (h == 0) {
         // regular ternary distribution
+        std::vector<int32_t> randomNumbers(size);
+        FillTernary(randomNumbers.data(), size);
 
-        int32_t randomNumber;
-
+        const typename VecType::Integer minusOne(modulus - typename VecType::Integer(1));
         for (usint i = 0; i < size; i++) {
-            randomNumber = m_distribution(PseudoRandomNumberGenerator::GetPRNG());
-            if (randomNumber < 0)
-                v[i] = modulus - typename VecType::Integer(1);
+            if (randomNumbers[i] < 0)
+                v[i] = minusOne;
             else
-                v[i] = typename VecType::Integer(randomNumber);
+                v[i] = typename VecType::Integer(randomNumbers[i]);
         }
     }
     else {
@@ -113,9 +125,7 @@ std::shared_ptr<int32_t> TernaryUniformGeneratorImpl<VecType>::GenerateIntVector
     std::shared_ptr<int32_t> ans(new int32_t[size], std::default_delete<int32_t[]>());
 
     if (h == 0) {
-        for (usint i = 0; i < size; i++) {
-            (ans.get())[i] = m_distribution(PseudoRandomNumberGenerator::GetPRNG());
-        }
+        FillTernary(ans.get(), size);
     }
     else {
         int32_t randomIndex;
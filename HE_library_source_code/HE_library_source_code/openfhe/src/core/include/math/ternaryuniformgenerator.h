@@ -82,7 +82,14 @@ public:
     std::shared_ptr<int32_t> GenerateIntVector(usint size, usint h = 0) const;
 
 private:
-    static std::uniform_int_distribution<int> m_distribution;
+    /**
+   * @brief Fills an array with values drawn uniformly from {-1, 0, 1}. Every
+   * 32-bit output of the PRNG is split into 16 two-bit candidates, of which
+   * the value 3 is rejected, so about 12 samples are obtained per PRNG output.
+   * @param values the array to fill.
+   * @param size the number of values to generate.
+   */
+    static void FillTernary(int32_t* values, usint size);
 };
 
 }  // namespace lbcrypto
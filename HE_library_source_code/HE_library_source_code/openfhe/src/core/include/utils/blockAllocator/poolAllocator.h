@@ -0,0 +1,97 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  This file contains the thread-caching pool that native vectors and DCRT limbs are allocated from
+ */
+
+#ifndef LBCRYPTO_UTILS_BLOCKALLOCATOR_POOLALLOCATOR_H
+#define LBCRYPTO_UTILS_BLOCKALLOCATOR_POOLALLOCATOR_H
+
+#include <cstddef>
+
+namespace lbcrypto {
+
+/**
+ * @brief A process-wide pool of large, cache-line aligned memory blocks. Block
+ * sizes are rounded up to size classes: every power of two from MIN_BLOCK to
+ * MAX_BLOCK, so a limb of 2^10 to 2^17 64-bit words fills its class exactly,
+ * plus seven classes evenly spaced between consecutive powers of two, so the
+ * buffer of a DCRT polynomial wastes at most 1/8 of its size. Freed blocks go
+ * to a cache of the calling thread and, once that cache is full, to a depot
+ * shared by all threads; a block freed by one thread can be reused by any
+ * other. Smaller and larger sizes go straight to the heap.
+ */
+class PoolAllocator {
+public:
+    static constexpr size_t ALIGNMENT = 64;
+    static constexpr size_t MIN_BLOCK = size_t(1) << 13;
+    static constexpr size_t MAX_BLOCK = size_t(1) << 28;
+
+    // the bytes of free blocks a thread keeps for itself and the bytes kept in the shared depot
+    static constexpr size_t THREAD_CACHE_LIMIT = size_t(1) << 26;
+    static constexpr size_t DEPOT_LIMIT        = size_t(1) << 30;
+
+    /**
+     * @param bytes is the size of the block.
+     * @return a block of at least the given size aligned to ALIGNMENT
+     */
+    static void* Allocate(size_t bytes);
+
+    /**
+     * Returns a block to the pool.
+     *
+     * @param p is a block from Allocate.
+     * @param bytes is the size the block was allocated with.
+     */
+    static void Deallocate(void* p, size_t bytes) noexcept;
+
+    /**
+     * @return the number of bytes Allocate reserves for a block of the given
+     * size
+     */
+    static size_t BlockSize(size_t bytes) noexcept;
+
+    /**
+     * @return the number of bytes held in free blocks by the calling thread
+     * and by the shared depot
+     */
+    static size_t GetCachedBytes() noexcept;
+
+    /**
+     * Frees the blocks cached by the calling thread and by the shared depot.
+     */
+    static void Release() noexcept;
+};
+
+}  // namespace lbcrypto
+
+#endif
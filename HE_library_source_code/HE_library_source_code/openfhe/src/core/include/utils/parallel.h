@@ -36,12 +36,57 @@
 #ifndef SRC_CORE_LIB_UTILS_PARALLEL_H_
 #define SRC_CORE_LIB_UTILS_PARALLEL_H_
 
+#include "utils/threadpool.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
 #ifdef PARALLEL
     #include <omp.h>
 #endif
 
 namespace lbcrypto {
 
+// @Brief schedulers that can run the loops of ParallelFor
+enum class ParallelScheduler {
+    // a team of OpenMP threads forked and joined for every loop
+    OPENMP,
+    // the tasks of the persistent work-stealing ThreadPool, which supports nested loops
+    THREAD_POOL,
+};
+
+/**
+ * @brief Limits the number of threads of the parallel regions started by the calling thread while
+ * the object is alive, including the regions nested in ParallelFor loops. This allows a request to
+ * run on a thread budget without changing the settings of the other threads of the process.
+ * Scopes can be nested; an inner scope can only lower the limit.
+ */
+class ParallelThreadScope {
+public:
+    /**
+     * @param threads is the maximum number of threads; 0 keeps the current limit.
+     */
+    explicit ParallelThreadScope(uint32_t threads);
+    ~ParallelThreadScope();
+
+    ParallelThreadScope(const ParallelThreadScope&)            = delete;
+    ParallelThreadScope& operator=(const ParallelThreadScope&) = delete;
+
+    /**
+     * @return the limit of the calling thread, 0 when no scope limits it
+     */
+    static uint32_t GetLimit() {
+        return limit;
+    }
+
+private:
+    uint32_t previousLimit;
+    int previousOpenMPThreads{0};
+
+    static thread_local uint32_t limit;
+};
+
 class ParallelControls {
 public:
     // @Brief CTOR, enables parallel operations as default
@@ -62,6 +107,7 @@ public:
     void Enable() const {
 #ifdef PARALLEL
         omp_set_num_threads(machineThreads);
+        numThreads = machineThreads;
 #endif
     }
 
@@ -69,6 +115,7 @@ public:
     void Disable() const {
 #ifdef PARALLEL
         omp_set_num_threads(1);
+        numThreads = 1;
 #endif
     }
 
@@ -108,10 +155,12 @@ public:
 #endif
     }
 
-    // @Brief returns min of int n and machineThreads
+    // @Brief returns min of int n, machineThreads and the limit of the ParallelThreadScope of the calling thread
     int GetThreadLimit(int n) const {
 #ifdef PARALLEL
-        return n > machineThreads ? machineThreads : n;
+        int threads = n > machineThreads ? machineThreads : n;
+        int limit   = static_cast<int>(ParallelThreadScope::GetLimit());
+        return limit != 0 && limit < threads ? limit : threads;
 #else
         return 1;
 #endif
@@ -121,16 +170,76 @@ public:
     void SetNumThreads(int nthreads) {
 #ifdef PARALLEL
         // set number of thread, but limit to the system set number of machine threads...
-        omp_set_num_threads(nthreads > machineThreads ? machineThreads : nthreads);
+        numThreads = nthreads > machineThreads ? machineThreads : nthreads;
+        omp_set_num_threads(numThreads);
 #endif
     }
 
+    // @Brief selects the scheduler running the loops of ParallelFor
+    void SetScheduler(ParallelScheduler newScheduler) {
+        scheduler = newScheduler;
+    }
+
+    ParallelScheduler GetScheduler() const {
+        return scheduler;
+    }
+
+    // @Brief returns the number of threads set by Enable(), Disable() or SetNumThreads()
+    int GetThreadSetting() const {
+        return numThreads.load(std::memory_order_relaxed);
+    }
+
 private:
     int machineThreads{1};
+    // unlike the OpenMP setting of the calling thread, this setting applies to the threads of the ThreadPool too
+    mutable std::atomic<int> numThreads{1};
+    ParallelScheduler scheduler{ParallelScheduler::OPENMP};
 };
 
 extern ParallelControls OpenFHEParallelControls;
 
+/**
+ * @brief Calls f(i) for all i in [begin, end) in parallel with the scheduler selected in
+ * OpenFHEParallelControls. The loop runs on at most as many threads as the number set with
+ * Enable(), Disable() or SetNumThreads() and the limit of the ParallelThreadScope of the calling
+ * thread, which also applies to the loops nested in f.
+ *
+ * @param begin is the first index.
+ * @param end is the index after the last one.
+ * @param f is the body of the loop.
+ */
+template <typename Function>
+void ParallelFor(size_t begin, size_t end, Function&& f) {
+#ifdef PARALLEL
+    if (end <= begin)
+        return;
+    if (OpenFHEParallelControls.GetScheduler() == ParallelScheduler::THREAD_POOL) {
+        uint32_t threads = OpenFHEParallelControls.GetThreadSetting();
+        uint32_t limit   = ParallelThreadScope::GetLimit();
+        if (limit == 0) {
+            ThreadPool::GetInstance().ParallelFor(begin, end, threads, f);
+            return;
+        }
+        // the iterations run by the workers of the pool keep the limit of the calling thread
+        ThreadPool::GetInstance().ParallelFor(begin, end, limit < threads ? limit : threads, [&f, limit](size_t i) {
+            ParallelThreadScope scope(limit);
+            f(i);
+        });
+        return;
+    }
+    // the OpenMP setting of the calling thread includes the limit of its ParallelThreadScope
+    size_t threads = omp_get_max_threads();
+    if (threads > end - begin)
+        threads = end - begin;
+    #pragma omp parallel for num_threads(threads)
+    for (size_t i = begin; i < end; ++i)
+        f(i);
+#else
+    for (size_t i = begin; i < end; ++i)
+        f(i);
+#endif
+}
+
 }  // namespace lbcrypto
 
 #endif /* SRC_CORE_LIB_UTILS_PARALLEL_H_ */
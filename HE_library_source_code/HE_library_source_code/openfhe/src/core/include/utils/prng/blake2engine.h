@@ -85,6 +85,20 @@ class Blake2Engine {
                         result_type counter)
       : m_counter(counter), m_seed(seed), m_buffer({}), m_bufferIndex(0) {}
 
+  /**
+   * @brief Constructor of one of 2^32 independent sub-streams of the engine
+   * with the given seed. The sub-streams use disjoint ranges of the counter,
+   * so sub-stream 0 produces the same samples as the engine without
+   * sub-streams. Engines replacing Blake2Engine need to provide this
+   * constructor too.
+   */
+  Blake2Engine(const std::array<result_type, 16>& seed, result_type counter,
+               result_type stream)
+      : m_counter((static_cast<uint64_t>(stream) << 32) | counter),
+        m_seed(seed),
+        m_buffer({}),
+        m_bufferIndex(0) {}
+
   /**
    * @brief minimum value used by C+11 distribution generators when no lower
    * bound is explicitly specified by the user
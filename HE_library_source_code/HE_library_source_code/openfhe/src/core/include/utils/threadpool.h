@@ -0,0 +1,141 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  This file contains the task scheduler for parallel operation
+ */
+
+#ifndef LBCRYPTO_UTILS_THREADPOOL_H
+#define LBCRYPTO_UTILS_THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace lbcrypto {
+
+/**
+ * @brief A persistent pool of threads running parallel loops with work stealing.
+ * Every worker owns a queue of tasks; it takes the newest task from its own queue
+ * and steals the oldest task of another worker when its queue is empty. A thread
+ * waiting for a loop to finish runs pending tasks in the meantime, so loops can
+ * be nested to any depth without oversubscribing the cores or deadlocking. OpenMP
+ * regions reached from a loop run on a single thread.
+ */
+class ThreadPool {
+public:
+    /**
+     * @param threadCount is the number of threads that can run a loop, including
+     * the calling thread; the pool starts threadCount - 1 workers.
+     */
+    explicit ThreadPool(uint32_t threadCount);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @return the pool used by the library, with as many threads as OpenFHEParallelControls.GetMachineThreads()
+     */
+    static ThreadPool& GetInstance();
+
+    /**
+     * @return the number of threads that can run a loop, including the calling
+     * thread
+     */
+    uint32_t GetThreadCount() const {
+        return static_cast<uint32_t>(m_workers.size()) + 1;
+    }
+
+    /**
+     * Calls f(i) for all i in [begin, end) on at most maxThreads threads,
+     * including the calling thread, and returns when all calls are done. The
+     * first exception thrown by f is rethrown.
+     *
+     * @param begin is the first index.
+     * @param end is the index after the last one.
+     * @param maxThreads is the maximum number of threads.
+     * @param f is the body of the loop.
+     */
+    template <typename Function>
+    void ParallelFor(size_t begin, size_t end, uint32_t maxThreads, Function&& f) {
+        if (end <= begin)
+            return;
+        struct Context {
+            std::remove_reference_t<Function>* body;
+            size_t begin;
+        } context{&f, begin};
+        Run(end - begin, maxThreads, &context, [](void* c, size_t first, size_t last) {
+            auto context{static_cast<Context*>(c)};
+            for (size_t i = first; i < last; ++i)
+                (*context->body)(context->begin + i);
+        });
+    }
+
+private:
+    using ChunkFunction = void (*)(void*, size_t, size_t);
+
+    struct Loop;
+
+    struct Worker {
+        std::mutex mutex;
+        std::deque<Loop*> tasks;
+        std::thread thread;
+    };
+
+    void Run(size_t count, uint32_t maxThreads, void* context, ChunkFunction function);
+
+    // Runs a task from the queue of the calling worker or stolen from another queue
+    bool RunPendingTask();
+
+    void WorkerLoop(uint32_t index);
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::atomic<size_t> m_queuedTasks{0};
+    std::atomic<uint32_t> m_nextQueue{0};
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wakeup;
+    bool m_stop{false};
+
+    static thread_local const ThreadPool* m_currentPool;
+    static thread_local uint32_t m_workerIndex;
+};
+
+}  // namespace lbcrypto
+
+#endif
@@ -0,0 +1,174 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+
+/*
+  This code selects the SIMD kernels of the element-wise operations of native vectors at runtime
+ */
+
+#include "math/hal/intnat/mubintvecnat-simd.h"
+#include "math/hal/intnat/transformnat-simd.h"
+
+namespace intnat {
+
+namespace simd {
+
+// The kernels are defined in transformnat-avx2.cpp and transformnat-avx512.cpp, next to the NTT kernels of the same
+// instruction sets. The AVX2 kernels need a multiple of 4 elements, and the AVX-512 kernels a multiple of 8.
+
+void ModAddAVX2(uint64_t* a, const uint64_t* b, uint64_t modulus, uint32_t n);
+void ModSubAVX2(uint64_t* a, const uint64_t* b, uint64_t modulus, uint32_t n);
+void ModAddConstAVX2(uint64_t* a, uint64_t b, uint64_t modulus, uint32_t n);
+void ModSubConstAVX2(uint64_t* a, uint64_t b, uint64_t modulus, uint32_t n);
+void ModAddAVX512(uint64_t* a, const uint64_t* b, uint64_t modulus, uint32_t n);
+void ModSubAVX512(uint64_t* a, const uint64_t* b, uint64_t modulus, uint32_t n);
+void ModAddConstAVX512(uint64_t* a, uint64_t b, uint64_t modulus, uint32_t n);
+void ModSubConstAVX512(uint64_t* a, uint64_t b, uint64_t modulus, uint32_t n);
+void ModMulAVX512(uint64_t* a, const uint64_t* b, uint64_t modulus, uint64_t mu, uint32_t shift, uint32_t n);
+void ModMulAVX512IFMA(uint64_t* a, const uint64_t* b, uint64_t modulus, uint64_t mu, uint32_t msb, uint32_t n);
+void ModMulConstAVX512(uint64_t* a, uint64_t b, uint64_t bp, uint64_t modulus, uint32_t n);
+void ModMulConstAVX512IFMA(uint64_t* a, uint64_t b, uint64_t bp, uint64_t modulus, uint32_t n);
+
+}  // namespace simd
+
+namespace {
+
+// The engine for the element-wise operations on vectors modulo q; the kernels need q < 2^60
+NTTEngine VectorEngineFor(uint64_t modulus) {
+    return modulus < (uint64_t(1) << 60) ? GetNTTEngine() : NTT_SCALAR;
+}
+
+// The number of elements handled by the kernels of an engine; the scalar code does the rest
+uint32_t SIMDLength(NTTEngine engine, uint32_t n) {
+    return engine == NTT_AVX2 ? n & ~3u : n & ~7u;
+}
+
+uint32_t BitLength(uint64_t x) {
+    return 64 - __builtin_clzll(x);
+}
+
+uint64_t ModMulScalar(uint64_t x, uint64_t y, uint64_t modulus) {
+    return static_cast<uint64_t>(static_cast<unsigned __int128>(x) * y % modulus);
+}
+
+}  // namespace
+
+bool ModAddSIMD(uint64_t* a, const uint64_t* b, uint64_t modulus, uint32_t n) {
+    NTTEngine engine = VectorEngineFor(modulus);
+    if (engine == NTT_SCALAR)
+        return false;
+    uint32_t m = SIMDLength(engine, n);
+    if (engine == NTT_AVX2)
+        simd::ModAddAVX2(a, b, modulus, m);
+    else
+        simd::ModAddAVX512(a, b, modulus, m);
+    for (uint32_t i = m; i < n; ++i)
+        a[i] = a[i] + b[i] >= modulus ? a[i] + b[i] - modulus : a[i] + b[i];
+    return true;
+}
+
+bool ModSubSIMD(uint64_t* a, const uint64_t* b, uint64_t modulus, uint32_t n) {
+    NTTEngine engine = VectorEngineFor(modulus);
+    if (engine == NTT_SCALAR)
+        return false;
+    uint32_t m = SIMDLength(engine, n);
+    if (engine == NTT_AVX2)
+        simd::ModSubAVX2(a, b, modulus, m);
+    else
+        simd::ModSubAVX512(a, b, modulus, m);
+    for (uint32_t i = m; i < n; ++i)
+        a[i] = a[i] >= b[i] ? a[i] - b[i] : a[i] + (modulus - b[i]);
+    return true;
+}
+
+bool ModAddConstSIMD(uint64_t* a, uint64_t b, uint64_t modulus, uint32_t n) {
+    NTTEngine engine = VectorEngineFor(modulus);
+    if (engine == NTT_SCALAR)
+        return false;
+    uint32_t m = SIMDLength(engine, n);
+    if (engine == NTT_AVX2)
+        simd::ModAddConstAVX2(a, b, modulus, m);
+    else
+        simd::ModAddConstAVX512(a, b, modulus, m);
+    for (uint32_t i = m; i < n; ++i)
+        a[i] = a[i] + b >= modulus ? a[i] + b - modulus : a[i] + b;
+    return true;
+}
+
+bool ModSubConstSIMD(uint64_t* a, uint64_t b, uint64_t modulus, uint32_t n) {
+    NTTEngine engine = VectorEngineFor(modulus);
+    if (engine == NTT_SCALAR)
+        return false;
+    uint32_t m = SIMDLength(engine, n);
+    if (engine == NTT_AVX2)
+        simd::ModSubConstAVX2(a, b, modulus, m);
+    else
+        simd::ModSubConstAVX512(a, b, modulus, m);
+    for (uint32_t i = m; i < n; ++i)
+        a[i] = a[i] >= b ? a[i] - b : a[i] + (modulus - b);
+    return true;
+}
+
+bool ModMulSIMD(uint64_t* a, const uint64_t* b, uint64_t modulus, uint32_t n) {
+    NTTEngine engine = VectorEngineFor(modulus);
+    if (engine == NTT_SCALAR || engine == NTT_AVX2 || modulus < 4)
+        return false;
+    uint32_t m   = SIMDLength(engine, n);
+    uint32_t msb = BitLength(modulus);
+    if (engine == NTT_AVX512IFMA && msb <= 50) {
+        uint64_t mu = static_cast<uint64_t>((static_cast<unsigned __int128>(1) << (2 * msb)) / modulus);
+        simd::ModMulAVX512IFMA(a, b, modulus, mu, msb, m);
+    }
+    else {
+        // the Barrett constant of NativeIntegerT::ComputeMu()
+        uint64_t mu = static_cast<uint64_t>((static_cast<unsigned __int128>(1) << (2 * msb + 3)) / modulus);
+        simd::ModMulAVX512(a, b, modulus, mu, msb - 2, m);
+    }
+    for (uint32_t i = m; i < n; ++i)
+        a[i] = ModMulScalar(a[i], b[i], modulus);
+    return true;
+}
+
+bool ModMulConstSIMD(uint64_t* a, uint64_t b, uint64_t bPrecon, uint64_t modulus, uint32_t n) {
+    NTTEngine engine = VectorEngineFor(modulus);
+    if (engine == NTT_SCALAR || engine == NTT_AVX2)
+        return false;
+    uint32_t m = SIMDLength(engine, n);
+    if (engine == NTT_AVX512IFMA && modulus < (uint64_t(1) << 51))
+        simd::ModMulConstAVX512IFMA(a, b, bPrecon, modulus, m);
+    else
+        simd::ModMulConstAVX512(a, b, bPrecon, modulus, m);
+    for (uint32_t i = m; i < n; ++i)
+        a[i] = ModMulScalar(a[i], b, modulus);
+    return true;
+}
+
+}  // namespace intnat
@@ -195,12 +195,7 @@ NativeVectorT<IntegerType>& NativeVectorT<IntegerType>::ModEq(const IntegerType&
 template <class IntegerType>
 NativeVectorT<IntegerType> NativeVectorT<IntegerType>::ModAdd(const IntegerType& b) const {
     auto ans(*this);
-    auto mv{m_modulus};
-    auto bv{b};
-    if (bv.m_value >= mv.m_value)
-        bv.ModEq(mv);
-    for (size_t i = 0; i < ans.m_data.size(); ++i)
-        ans.m_data[i] = ans.m_data[i].ModAddFast(bv, mv);
+    ans.ModAddEq(b);
     return ans;
 }
 
@@ -210,6 +205,10 @@ NativeVectorT<IntegerType>& NativeVectorT<IntegerType>::ModAddEq(const IntegerTy
     auto bv{b};
     if (bv.m_value >= mv.m_value)
         bv.ModEq(mv);
+    if constexpr (HasSIMDKernels()) {
+        if (ModAddConstSIMD(SIMDData(), bv.m_value, mv.m_value, m_data.size()))
+            return *this;
+    }
     for (size_t i = 0; i < m_data.size(); ++i)
         m_data[i] = m_data[i].ModAddFast(bv, mv);
     return *this;
@@ -232,10 +231,8 @@ template <class IntegerType>
 NativeVectorT<IntegerType> NativeVectorT<IntegerType>::ModAdd(const NativeVectorT& b) const {
     if (m_modulus != b.m_modulus || m_data.size() != b.m_data.size())
         OPENFHE_THROW(lbcrypto::math_error, "ModAdd called on NativeVectorT's with different parameters.");
-    auto mv{m_modulus};
     auto ans(*this);
-    for (size_t i = 0; i < ans.m_data.size(); ++i)
-        ans.m_data[i].ModAddFastEq(b[i], mv);
+    ans.ModAddNoCheckEq(b);
     return ans;
 }
 
@@ -243,21 +240,13 @@ template <class IntegerType>
 NativeVectorT<IntegerType>& NativeVectorT<IntegerType>::ModAddEq(const NativeVectorT& b) {
     if (m_data.size() != b.m_data.size() || m_modulus != b.m_modulus)
         OPENFHE_THROW(lbcrypto::math_error, "ModAddEq called on NativeVectorT's with different parameters.");
-    auto mv{m_modulus};
-    for (size_t i = 0; i < m_data.size(); ++i)
-        m_data[i].ModAddFastEq(b[i], mv);
-    return *this;
+    return ModAddNoCheckEq(b);
 }
 
 template <class IntegerType>
 NativeVectorT<IntegerType> NativeVectorT<IntegerType>::ModSub(const IntegerType& b) const {
-    auto mv{m_modulus};
-    auto bv{b};
     auto ans(*this);
-    if (bv.m_value >= mv.m_value)
-        bv.ModEq(mv);
-    for (size_t i = 0; i < ans.m_data.size(); ++i)
-        ans[i].ModSubFastEq(bv, mv);
+    ans.ModSubEq(b);
     return ans;
 }
 
@@ -267,6 +256,10 @@ NativeVectorT<IntegerType>& NativeVectorT<IntegerType>::ModSubEq(const IntegerTy
     auto bv{b};
     if (bv.m_value >= mv.m_value)
         bv.ModEq(mv);
+    if constexpr (HasSIMDKernels()) {
+        if (ModSubConstSIMD(SIMDData(), bv.m_value, mv.m_value, m_data.size()))
+            return *this;
+    }
     for (size_t i = 0; i < m_data.size(); ++i)
         m_data[i].ModSubFastEq(bv, mv);
     return *this;
@@ -276,10 +269,8 @@ template <class IntegerType>
 NativeVectorT<IntegerType> NativeVectorT<IntegerType>::ModSub(const NativeVectorT& b) const {
     if (m_data.size() != b.m_data.size() || m_modulus != b.m_modulus)
         OPENFHE_THROW(lbcrypto::math_error, "ModSub called on NativeVectorT's with different parameters.");
-    auto mv{m_modulus};
     auto ans(*this);
-    for (size_t i = 0; i < ans.m_data.size(); ++i)
-        ans[i].ModSubFastEq(b[i], mv);
+    ans.ModSubEq(b);
     return ans;
 }
 
@@ -287,6 +278,10 @@ template <class IntegerType>
 NativeVectorT<IntegerType>& NativeVectorT<IntegerType>::ModSubEq(const NativeVectorT& b) {
     if (m_data.size() != b.m_data.size() || m_modulus != b.m_modulus)
         OPENFHE_THROW(lbcrypto::math_error, "ModSubEq called on NativeVectorT's with different parameters.");
+    if constexpr (HasSIMDKernels()) {
+        if (ModSubSIMD(SIMDData(), b.SIMDData(), m_modulus.m_value, m_data.size()))
+            return *this;
+    }
     for (size_t i = 0; i < m_data.size(); ++i)
         m_data[i].ModSubFastEq(b[i], m_modulus);
     return *this;
@@ -294,14 +289,8 @@ NativeVectorT<IntegerType>& NativeVectorT<IntegerType>::ModSubEq(const NativeVec
 
 template <class IntegerType>
 NativeVectorT<IntegerType> NativeVectorT<IntegerType>::ModMul(const IntegerType& b) const {
-    auto mv{m_modulus};
-    auto bv{b};
     auto ans(*this);
-    if (bv.m_value >= mv.m_value)
-        bv.ModEq(mv);
-    auto bconst{bv.PrepModMulConst(mv)};
-    for (size_t i = 0; i < ans.m_data.size(); ++i)
-        ans[i].ModMulFastConstEq(bv, mv, bconst);
+    ans.ModMulEq(b);
     return ans;
 }
 
@@ -312,6 +301,20 @@ NativeVectorT<IntegerType>& NativeVectorT<IntegerType>::ModMulEq(const IntegerTy
     if (bv.m_value >= mv.m_value)
         bv.ModEq(mv);
     auto bconst{bv.PrepModMulConst(mv)};
+    if constexpr (HasSIMDKernels()) {
+        if (ModMulConstSIMD(SIMDData(), bv.m_value, bconst.m_value, mv.m_value, m_data.size()))
+            return *this;
+    }
+#ifdef NATIVEINT_MONTGOMERY_MOD
+    if (mv.IsMontgomeryModulus()) {
+        // b is converted once, so the Montgomery products are the plain products
+        auto qInv{mv.ComputeMontgomeryInverse()};
+        auto bm{bv.ToMontgomery(mv)};
+        for (size_t i = 0; i < m_data.size(); ++i)
+            m_data[i].ModMulMontgomeryEq(bm, mv, qInv);
+        return *this;
+    }
+#endif
     for (size_t i = 0; i < m_data.size(); ++i)
         m_data[i].ModMulFastConstEq(bv, mv, bconst);
     return *this;
@@ -322,16 +325,7 @@ NativeVectorT<IntegerType> NativeVectorT<IntegerType>::ModMul(const NativeVector
     if (m_data.size() != b.m_data.size() || m_modulus != b.m_modulus)
         OPENFHE_THROW(lbcrypto::math_error, "ModMul called on NativeVectorT's with different parameters.");
     auto ans(*this);
-    uint32_t size(m_data.size());
-    auto mv{m_modulus};
-#ifdef NATIVEINT_BARRET_MOD
-    auto mu{m_modulus.ComputeMu()};
-    for (uint32_t i = 0; i < size; ++i)
-        ans[i].ModMulFastEq(b[i], mv, mu);
-#else
-    for (uint32_t i = 0; i < size; ++i)
-        ans[i].ModMulFastEq(b[i], mv);
-#endif
+    ans.ModMulNoCheckEq(b);
     return ans;
 }
 
@@ -339,16 +333,42 @@ template <class IntegerType>
 NativeVectorT<IntegerType>& NativeVectorT<IntegerType>::ModMulEq(const NativeVectorT& b) {
     if (m_data.size() != b.m_data.size() || m_modulus != b.m_modulus)
         OPENFHE_THROW(lbcrypto::math_error, "ModMulEq called on NativeVectorT's with different parameters.");
+    return ModMulNoCheckEq(b);
+}
+
+template <class IntegerType>
+NativeVectorT<IntegerType>& NativeVectorT<IntegerType>::ToMontgomeryEq() {
     auto mv{m_modulus};
+    for (size_t i = 0; i < m_data.size(); ++i)
+        m_data[i] = m_data[i].ToMontgomery(mv);
+    return *this;
+}
+
+template <class IntegerType>
+NativeVectorT<IntegerType>& NativeVectorT<IntegerType>::FromMontgomeryEq() {
+    auto mv{m_modulus};
+    auto qInv{m_modulus.ComputeMontgomeryInverse()};
+    for (size_t i = 0; i < m_data.size(); ++i)
+        m_data[i] = m_data[i].FromMontgomery(mv, qInv);
+    return *this;
+}
+
+template <class IntegerType>
+NativeVectorT<IntegerType> NativeVectorT<IntegerType>::ModMulMontgomery(const NativeVectorT& b) const {
+    auto ans(*this);
+    ans.ModMulMontgomeryEq(b);
+    return ans;
+}
+
+template <class IntegerType>
+NativeVectorT<IntegerType>& NativeVectorT<IntegerType>::ModMulMontgomeryEq(const NativeVectorT& b) {
+    if (m_data.size() != b.m_data.size() || m_modulus != b.m_modulus)
+        OPENFHE_THROW(lbcrypto::math_error, "ModMulMontgomeryEq called on NativeVectorT's with different parameters.");
+    auto mv{m_modulus};
+    auto qInv{m_modulus.ComputeMontgomeryInverse()};
     size_t size{m_data.size()};
-#ifdef NATIVEINT_BARRET_MOD
-    auto mu{m_modulus.ComputeMu()};
-    for (size_t i = 0; i < size; ++i)
-        m_data[i].ModMulFastEq(b[i], mv, mu);
-#else
     for (size_t i = 0; i < size; ++i)
-        m_data[i].ModMulFastEq(b[i], mv);
-#endif
+        m_data[i].ModMulMontgomeryEq(b[i], mv, qInv);
     return *this;
 }
 
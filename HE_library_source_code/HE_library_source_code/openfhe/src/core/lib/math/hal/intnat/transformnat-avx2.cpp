@@ -0,0 +1,258 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  This code provides the AVX2 kernels of the power-of-two NTT, see math/hal/intnat/transformnat-simd.h, and of the
+  element-wise operations of native vectors, see math/hal/intnat/mubintvecnat-simd.h.
+  It is compiled with -mavx2 and must only be called when the CPU supports AVX2. To keep AVX2 instructions out of
+  code shared with other translation units, this file includes no library or standard headers except <immintrin.h>
+  and <cstdint>.
+ */
+
+#include <cstdint>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#endif
+
+namespace intnat {
+namespace simd {
+
+#if defined(__AVX2__)
+
+extern const bool AVX2_COMPILED = true;
+
+namespace {
+
+// The high and low halves of 64x64-bit products are assembled from 32x32-bit products, as AVX2 has no 64-bit
+// multiplication. Values are below 2^63, so signed comparisons can be used.
+
+inline __m256i MulHi(__m256i a, __m256i b) {
+    const __m256i lo32 = _mm256_set1_epi64x(0xFFFFFFFF);
+    __m256i aHi        = _mm256_srli_epi64(a, 32);
+    __m256i bHi        = _mm256_srli_epi64(b, 32);
+    __m256i ll         = _mm256_mul_epu32(a, b);
+    __m256i lh         = _mm256_mul_epu32(a, bHi);
+    __m256i hl         = _mm256_mul_epu32(aHi, b);
+    __m256i hh         = _mm256_mul_epu32(aHi, bHi);
+    __m256i mid        = _mm256_add_epi64(_mm256_srli_epi64(ll, 32), _mm256_and_si256(lh, lo32));
+    mid                = _mm256_add_epi64(mid, _mm256_and_si256(hl, lo32));
+    __m256i hi         = _mm256_add_epi64(hh, _mm256_srli_epi64(lh, 32));
+    hi                 = _mm256_add_epi64(hi, _mm256_srli_epi64(hl, 32));
+    return _mm256_add_epi64(hi, _mm256_srli_epi64(mid, 32));
+}
+
+inline __m256i MulLo(__m256i a, __m256i b) {
+    __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b),
+                                     _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+    return _mm256_add_epi64(_mm256_mul_epu32(a, b), _mm256_slli_epi64(cross, 32));
+}
+
+// x mod q for x < 2q
+inline __m256i ModReduce(__m256i x, __m256i q) {
+    return _mm256_sub_epi64(x, _mm256_andnot_si256(_mm256_cmpgt_epi64(q, x), q));
+}
+
+// Shoup's modular multiplication y * w mod q with the precomputation wp = floor(w * 2^64 / q)
+inline __m256i MulMod(__m256i y, __m256i w, __m256i wp, __m256i q) {
+    __m256i qhat = MulHi(y, wp);
+    return ModReduce(_mm256_sub_epi64(MulLo(y, w), MulLo(qhat, q)), q);
+}
+
+// Cooley-Tukey butterfly (x, y) -> (x + w * y, x - w * y)
+inline void ButterflyCT(__m256i& x, __m256i& y, __m256i w, __m256i wp, __m256i q) {
+    __m256i t = MulMod(y, w, wp, q);
+    __m256i d = _mm256_add_epi64(_mm256_sub_epi64(x, t), q);
+    x         = ModReduce(_mm256_add_epi64(x, t), q);
+    y         = ModReduce(d, q);
+}
+
+// Gentleman-Sande butterfly (x, y) -> (x + y, w * (x - y)); the difference needs no reduction before MulMod
+inline void ButterflyGS(__m256i& x, __m256i& y, __m256i w, __m256i wp, __m256i q) {
+    __m256i d = _mm256_add_epi64(_mm256_sub_epi64(x, y), q);
+    x         = ModReduce(_mm256_add_epi64(x, y), q);
+    y         = MulMod(d, w, wp, q);
+}
+
+// Stage with distance 2 between butterfly inputs on 8 coefficients: two butterflies per 128-bit half
+template <bool Forward>
+void StageT2(const uint64_t* w, const uint64_t* wp, __m256i q, uint32_t n, uint64_t* a) {
+    for (uint32_t j = 0; j < n; j += 8, w += 2, wp += 2) {
+        __m256i v0  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + j));
+        __m256i v1  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + j + 4));
+        __m256i x   = _mm256_permute2x128_si256(v0, v1, 0x20);
+        __m256i y   = _mm256_permute2x128_si256(v0, v1, 0x31);
+        __m256i vw  = _mm256_permute4x64_epi64(_mm256_castsi128_si256(_mm_loadu_si128(
+                                                  reinterpret_cast<const __m128i*>(w))), 0x50);
+        __m256i vwp = _mm256_permute4x64_epi64(_mm256_castsi128_si256(_mm_loadu_si128(
+                                                   reinterpret_cast<const __m128i*>(wp))), 0x50);
+        if (Forward)
+            ButterflyCT(x, y, vw, vwp, q);
+        else
+            ButterflyGS(x, y, vw, vwp, q);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(a + j), _mm256_permute2x128_si256(x, y, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(a + j + 4), _mm256_permute2x128_si256(x, y, 0x31));
+    }
+}
+
+// Stage with distance 1 between butterfly inputs on 8 coefficients: the inputs are interleaved
+template <bool Forward>
+void StageT1(const uint64_t* w, const uint64_t* wp, __m256i q, uint32_t n, uint64_t* a) {
+    for (uint32_t j = 0; j < n; j += 8, w += 4, wp += 4) {
+        __m256i v0  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + j));
+        __m256i v1  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + j + 4));
+        __m256i x   = _mm256_unpacklo_epi64(v0, v1);
+        __m256i y   = _mm256_unpackhi_epi64(v0, v1);
+        __m256i vw  = _mm256_permute4x64_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(w)), 0xD8);
+        __m256i vwp = _mm256_permute4x64_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(wp)), 0xD8);
+        if (Forward)
+            ButterflyCT(x, y, vw, vwp, q);
+        else
+            ButterflyGS(x, y, vw, vwp, q);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(a + j), _mm256_unpacklo_epi64(x, y));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(a + j + 4), _mm256_unpackhi_epi64(x, y));
+    }
+}
+
+template <bool Forward>
+void WideStage(uint32_t m, uint32_t t, const uint64_t* w, const uint64_t* wp, __m256i q, uint64_t* a) {
+    for (uint32_t i{0}; i < m; ++i) {
+        const __m256i vw  = _mm256_set1_epi64x(w[m + i]);
+        const __m256i vwp = _mm256_set1_epi64x(wp[m + i]);
+        uint64_t* x       = a + 2 * i * t;
+        uint64_t* y       = x + t;
+        for (uint32_t j{0}; j < t; j += 4) {
+            __m256i vx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + j));
+            __m256i vy = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + j));
+            if (Forward)
+                ButterflyCT(vx, vy, vw, vwp, q);
+            else
+                ButterflyGS(vx, vy, vw, vwp, q);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(x + j), vx);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(y + j), vy);
+        }
+    }
+}
+
+// Element-wise kernels of native vectors, see math/hal/intnat/mubintvecnat-simd.h. The length n is a multiple of 4.
+
+template <typename Op>
+inline void ForEach(uint64_t* a, const uint64_t* b, uint32_t n, Op op) {
+    for (uint32_t i{0}; i < n; i += 4) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(a + i), op(x, y));
+    }
+}
+
+template <typename Op>
+inline void ForEach(uint64_t* a, uint32_t n, Op op) {
+    for (uint32_t i{0}; i < n; i += 4) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(a + i), op(x));
+    }
+}
+
+}  // namespace
+
+void ForwardTransformAVX2(const uint64_t* w, const uint64_t* wp, uint64_t modulus, uint32_t n, uint64_t* a) {
+    const __m256i q = _mm256_set1_epi64x(modulus);
+    uint32_t m{1}, t{n >> 1};
+    for (; t >= 4; m <<= 1, t >>= 1)
+        WideStage<true>(m, t, w, wp, q, a);
+    StageT2<true>(w + m, wp + m, q, n, a);
+    StageT1<true>(w + 2 * m, wp + 2 * m, q, n, a);
+}
+
+void InverseTransformAVX2(const uint64_t* w, const uint64_t* wp, uint64_t wn, uint64_t wnp, uint64_t ninv,
+                          uint64_t ninvp, uint64_t modulus, uint32_t n, uint64_t* a) {
+    const __m256i q = _mm256_set1_epi64x(modulus);
+    StageT1<false>(w + (n >> 1), wp + (n >> 1), q, n, a);
+    StageT2<false>(w + (n >> 2), wp + (n >> 2), q, n, a);
+    uint32_t m{n >> 3}, t{4};
+    for (; m > 1; m >>= 1, t <<= 1)
+        WideStage<false>(m, t, w, wp, q, a);
+
+    // the last stage also scales by the inverse of n: wn is the product of its twiddle factor and the inverse of n
+    const __m256i vwn  = _mm256_set1_epi64x(wn);
+    const __m256i vwnp = _mm256_set1_epi64x(wnp);
+    const __m256i vn   = _mm256_set1_epi64x(ninv);
+    const __m256i vnp  = _mm256_set1_epi64x(ninvp);
+    uint64_t* x        = a;
+    uint64_t* y        = a + t;
+    for (uint32_t j{0}; j < t; j += 4) {
+        __m256i vx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + j));
+        __m256i vy = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + j));
+        __m256i s  = _mm256_add_epi64(vx, vy);
+        __m256i d  = _mm256_add_epi64(_mm256_sub_epi64(vx, vy), q);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(x + j), MulMod(s, vn, vnp, q));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(y + j), MulMod(d, vwn, vwnp, q));
+    }
+}
+
+void ModAddAVX2(uint64_t* a, const uint64_t* b, uint64_t modulus, uint32_t n) {
+    const __m256i q = _mm256_set1_epi64x(modulus);
+    ForEach(a, b, n, [q](__m256i x, __m256i y) { return ModReduce(_mm256_add_epi64(x, y), q); });
+}
+
+void ModSubAVX2(uint64_t* a, const uint64_t* b, uint64_t modulus, uint32_t n) {
+    const __m256i q = _mm256_set1_epi64x(modulus);
+    ForEach(a, b, n, [q](__m256i x, __m256i y) { return ModReduce(_mm256_add_epi64(_mm256_sub_epi64(x, y), q), q); });
+}
+
+void ModAddConstAVX2(uint64_t* a, uint64_t b, uint64_t modulus, uint32_t n) {
+    const __m256i q = _mm256_set1_epi64x(modulus);
+    const __m256i y = _mm256_set1_epi64x(b);
+    ForEach(a, n, [q, y](__m256i x) { return ModReduce(_mm256_add_epi64(x, y), q); });
+}
+
+void ModSubConstAVX2(uint64_t* a, uint64_t b, uint64_t modulus, uint32_t n) {
+    const __m256i q = _mm256_set1_epi64x(modulus);
+    const __m256i y = _mm256_set1_epi64x(modulus - b);
+    ForEach(a, n, [q, y](__m256i x) { return ModReduce(_mm256_add_epi64(x, y), q); });
+}
+
+#else
+
+extern const bool AVX2_COMPILED = false;
+
+void ForwardTransformAVX2(const uint64_t*, const uint64_t*, uint64_t, uint32_t, uint64_t*) {}
+void InverseTransformAVX2(const uint64_t*, const uint64_t*, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t,
+                          uint32_t, uint64_t*) {}
+void ModAddAVX2(uint64_t*, const uint64_t*, uint64_t, uint32_t) {}
+void ModSubAVX2(uint64_t*, const uint64_t*, uint64_t, uint32_t) {}
+void ModAddConstAVX2(uint64_t*, uint64_t, uint64_t, uint32_t) {}
+void ModSubConstAVX2(uint64_t*, uint64_t, uint64_t, uint32_t) {}
+
+#endif
+
+}  // namespace simd
+}  // namespace intnat
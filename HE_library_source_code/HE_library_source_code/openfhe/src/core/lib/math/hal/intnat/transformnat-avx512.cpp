@@ -0,0 +1,397 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  This code provides the AVX-512 kernels of the power-of-two NTT, see math/hal/intnat/transformnat-simd.h, and of the
+  element-wise operations of native vectors, see math/hal/intnat/mubintvecnat-simd.h.
+  It is compiled with -mavx512f -mavx512dq -mavx512ifma and must only be called when the CPU supports these
+  instruction sets. To keep instructions of these sets out of code shared with other translation units, this file
+  includes no library or standard headers except <immintrin.h> and <cstdint>.
+ */
+
+#include <cstdint>
+
+#if defined(__AVX512F__) && defined(__AVX512DQ__) && defined(__AVX512IFMA__)
+    // g++ 12 reports the _mm512_undefined_epi32() inside the intrinsics as maybe uninitialized
+    #if defined(__GNUC__) && !defined(__clang__)
+        #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+    #endif
+    #include <immintrin.h>
+#endif
+
+namespace intnat {
+namespace simd {
+
+#if defined(__AVX512F__) && defined(__AVX512DQ__) && defined(__AVX512IFMA__)
+
+extern const bool AVX512_COMPILED = true;
+
+namespace {
+
+// Shoup's modular multiplication y * w mod q with the precomputation wp = floor(w * 2^64 / q). The high half of the
+// 64x64-bit product is assembled from four 32x32-bit products.
+struct MulModAVX512 {
+    static inline __m512i Precon(__m512i wp) {
+        return wp;
+    }
+
+    static inline __m512i MulHi(__m512i a, __m512i b) {
+        const __m512i lo32 = _mm512_set1_epi64(0xFFFFFFFF);
+        __m512i aHi        = _mm512_srli_epi64(a, 32);
+        __m512i bHi        = _mm512_srli_epi64(b, 32);
+        __m512i ll         = _mm512_mul_epu32(a, b);
+        __m512i lh         = _mm512_mul_epu32(a, bHi);
+        __m512i hl         = _mm512_mul_epu32(aHi, b);
+        __m512i hh         = _mm512_mul_epu32(aHi, bHi);
+        __m512i mid        = _mm512_add_epi64(_mm512_srli_epi64(ll, 32), _mm512_and_si512(lh, lo32));
+        mid                = _mm512_add_epi64(mid, _mm512_and_si512(hl, lo32));
+        __m512i hi         = _mm512_add_epi64(hh, _mm512_srli_epi64(lh, 32));
+        hi                 = _mm512_add_epi64(hi, _mm512_srli_epi64(hl, 32));
+        return _mm512_add_epi64(hi, _mm512_srli_epi64(mid, 32));
+    }
+
+    // returns y * w mod q for any y < 2^64
+    static inline __m512i MulMod(__m512i y, __m512i w, __m512i wp, __m512i q) {
+        __m512i qhat = MulHi(y, wp);
+        __m512i r    = _mm512_sub_epi64(_mm512_mullo_epi64(y, w), _mm512_mullo_epi64(qhat, q));
+        return _mm512_min_epu64(r, _mm512_sub_epi64(r, q));
+    }
+};
+
+// Shoup's modular multiplication with 52-bit integer fused multiply-add and the precomputation
+// floor(w * 2^52 / q) = wp >> 12. Requires q < 2^51, so that the intermediate result in [0, 2q) fits in 52 bits.
+struct MulModIFMA {
+    static inline __m512i Precon(__m512i wp) {
+        return _mm512_srli_epi64(wp, 12);
+    }
+
+    // returns y * w mod q for any y < 2^52
+    static inline __m512i MulMod(__m512i y, __m512i w, __m512i wp, __m512i q) {
+        const __m512i zero   = _mm512_setzero_si512();
+        const __m512i mask52 = _mm512_set1_epi64((uint64_t(1) << 52) - 1);
+        __m512i qhat         = _mm512_madd52hi_epu64(zero, y, wp);
+        __m512i r = _mm512_sub_epi64(_mm512_madd52lo_epu64(zero, y, w), _mm512_madd52lo_epu64(zero, qhat, q));
+        r         = _mm512_and_si512(r, mask52);
+        return _mm512_min_epu64(r, _mm512_sub_epi64(r, q));
+    }
+};
+
+inline __m512i ModReduce(__m512i x, __m512i q) {
+    return _mm512_min_epu64(x, _mm512_sub_epi64(x, q));
+}
+
+// Cooley-Tukey butterfly (x, y) -> (x + w * y, x - w * y)
+template <typename M>
+inline void ButterflyCT(__m512i& x, __m512i& y, __m512i w, __m512i wp, __m512i q) {
+    __m512i t = M::MulMod(y, w, wp, q);
+    __m512i d = _mm512_add_epi64(_mm512_sub_epi64(x, t), q);
+    x         = ModReduce(_mm512_add_epi64(x, t), q);
+    y         = ModReduce(d, q);
+}
+
+// Gentleman-Sande butterfly (x, y) -> (x + y, w * (x - y)); the difference needs no reduction before MulMod
+template <typename M>
+inline void ButterflyGS(__m512i& x, __m512i& y, __m512i w, __m512i wp, __m512i q) {
+    __m512i d = _mm512_add_epi64(_mm512_sub_epi64(x, y), q);
+    x         = ModReduce(_mm512_add_epi64(x, y), q);
+    y         = M::MulMod(d, w, wp, q);
+}
+
+// Permutations for the stages with distance t < 8 between butterfly inputs, which work on 16 coefficients in two
+// registers: the inputs x and y of the eight butterflies, the twiddle factor of each butterfly, and the way back
+struct SmallStagePermutation {
+    __m512i x, y, w, lo, hi;
+    __mmask8 wMask;
+
+    explicit SmallStagePermutation(uint32_t t) {
+        alignas(64) uint64_t ix[8], iy[8], iw[8], ilo[8], ihi[8];
+        for (uint32_t l = 0; l < 8; ++l) {
+            ix[l] = (l / t) * 2 * t + l % t;
+            iy[l] = ix[l] + t;
+            iw[l] = l / t;
+        }
+        for (uint32_t p = 0; p < 16; ++p) {
+            uint32_t b = p / (2 * t), o = p % (2 * t);
+            uint64_t i = (o < t) ? b * t + o : 8 + b * t + o - t;
+            (p < 8 ? ilo[p] : ihi[p - 8]) = i;
+        }
+        x     = _mm512_load_si512(ix);
+        y     = _mm512_load_si512(iy);
+        w     = _mm512_load_si512(iw);
+        lo    = _mm512_load_si512(ilo);
+        hi    = _mm512_load_si512(ihi);
+        wMask = static_cast<__mmask8>((1u << (8 / t)) - 1);
+    }
+};
+
+template <typename M, bool Forward>
+void SmallStage(uint32_t t, const uint64_t* w, const uint64_t* wp, __m512i q, uint32_t n, uint64_t* a) {
+    const SmallStagePermutation perm(t);
+    const uint32_t twiddleStep = 8 / t;
+    for (uint32_t j = 0; j < n; j += 16, w += twiddleStep, wp += twiddleStep) {
+        __m512i v0  = _mm512_loadu_si512(a + j);
+        __m512i v1  = _mm512_loadu_si512(a + j + 8);
+        __m512i x   = _mm512_permutex2var_epi64(v0, perm.x, v1);
+        __m512i y   = _mm512_permutex2var_epi64(v0, perm.y, v1);
+        __m512i vw  = _mm512_permutexvar_epi64(perm.w, _mm512_maskz_loadu_epi64(perm.wMask, w));
+        __m512i vwp = M::Precon(_mm512_permutexvar_epi64(perm.w, _mm512_maskz_loadu_epi64(perm.wMask, wp)));
+        if (Forward)
+            ButterflyCT<M>(x, y, vw, vwp, q);
+        else
+            ButterflyGS<M>(x, y, vw, vwp, q);
+        _mm512_storeu_si512(a + j, _mm512_permutex2var_epi64(x, perm.lo, y));
+        _mm512_storeu_si512(a + j + 8, _mm512_permutex2var_epi64(x, perm.hi, y));
+    }
+}
+
+template <typename M>
+inline __m512i BroadcastPrecon(uint64_t wp) {
+    return M::Precon(_mm512_set1_epi64(wp));
+}
+
+template <typename M>
+void ForwardTransform(const uint64_t* w, const uint64_t* wp, uint64_t modulus, uint32_t n, uint64_t* a) {
+    const __m512i q = _mm512_set1_epi64(modulus);
+    uint32_t m{1}, t{n >> 1};
+    for (; t >= 8; m <<= 1, t >>= 1) {
+        for (uint32_t i{0}; i < m; ++i) {
+            const __m512i vw  = _mm512_set1_epi64(w[m + i]);
+            const __m512i vwp = BroadcastPrecon<M>(wp[m + i]);
+            uint64_t* x       = a + 2 * i * t;
+            uint64_t* y       = x + t;
+            for (uint32_t j{0}; j < t; j += 8) {
+                __m512i vx = _mm512_loadu_si512(x + j);
+                __m512i vy = _mm512_loadu_si512(y + j);
+                ButterflyCT<M>(vx, vy, vw, vwp, q);
+                _mm512_storeu_si512(x + j, vx);
+                _mm512_storeu_si512(y + j, vy);
+            }
+        }
+    }
+    for (; t >= 1; m <<= 1, t >>= 1)
+        SmallStage<M, true>(t, w + m, wp + m, q, n, a);
+}
+
+template <typename M>
+void InverseTransform(const uint64_t* w, const uint64_t* wp, uint64_t wn, uint64_t wnp, uint64_t ninv,
+                      uint64_t ninvp, uint64_t modulus, uint32_t n, uint64_t* a) {
+    const __m512i q = _mm512_set1_epi64(modulus);
+    uint32_t m{n >> 1}, t{1};
+    for (; t < 8; m >>= 1, t <<= 1)
+        SmallStage<M, false>(t, w + m, wp + m, q, n, a);
+    for (; m > 1; m >>= 1, t <<= 1) {
+        for (uint32_t i{0}; i < m; ++i) {
+            const __m512i vw  = _mm512_set1_epi64(w[m + i]);
+            const __m512i vwp = BroadcastPrecon<M>(wp[m + i]);
+            uint64_t* x       = a + 2 * i * t;
+            uint64_t* y       = x + t;
+            for (uint32_t j{0}; j < t; j += 8) {
+                __m512i vx = _mm512_loadu_si512(x + j);
+                __m512i vy = _mm512_loadu_si512(y + j);
+                ButterflyGS<M>(vx, vy, vw, vwp, q);
+                _mm512_storeu_si512(x + j, vx);
+                _mm512_storeu_si512(y + j, vy);
+            }
+        }
+    }
+
+    // the last stage also scales by the inverse of n: wn is the product of its twiddle factor and the inverse of n
+    const __m512i vwn  = _mm512_set1_epi64(wn);
+    const __m512i vwnp = BroadcastPrecon<M>(wnp);
+    const __m512i vn   = _mm512_set1_epi64(ninv);
+    const __m512i vnp  = BroadcastPrecon<M>(ninvp);
+    uint64_t* x        = a;
+    uint64_t* y        = a + t;
+    for (uint32_t j{0}; j < t; j += 8) {
+        __m512i vx = _mm512_loadu_si512(x + j);
+        __m512i vy = _mm512_loadu_si512(y + j);
+        __m512i s  = _mm512_add_epi64(vx, vy);
+        __m512i d  = _mm512_add_epi64(_mm512_sub_epi64(vx, vy), q);
+        _mm512_storeu_si512(x + j, M::MulMod(s, vn, vnp, q));
+        _mm512_storeu_si512(y + j, M::MulMod(d, vwn, vwnp, q));
+    }
+}
+
+// Element-wise kernels of native vectors, see math/hal/intnat/mubintvecnat-simd.h. The length n is a multiple of 8.
+
+// the full 128-bit product of a and b: returns the low half and sets hi to the high half
+inline __m512i MulFull(__m512i a, __m512i b, __m512i& hi) {
+    const __m512i lo32 = _mm512_set1_epi64(0xFFFFFFFF);
+    __m512i aHi        = _mm512_srli_epi64(a, 32);
+    __m512i bHi        = _mm512_srli_epi64(b, 32);
+    __m512i ll         = _mm512_mul_epu32(a, b);
+    __m512i lh         = _mm512_mul_epu32(a, bHi);
+    __m512i hl         = _mm512_mul_epu32(aHi, b);
+    __m512i hh         = _mm512_mul_epu32(aHi, bHi);
+    __m512i mid        = _mm512_add_epi64(_mm512_srli_epi64(ll, 32), _mm512_and_si512(lh, lo32));
+    mid                = _mm512_add_epi64(mid, _mm512_and_si512(hl, lo32));
+    hi                 = _mm512_add_epi64(hh, _mm512_srli_epi64(lh, 32));
+    hi                 = _mm512_add_epi64(hi, _mm512_srli_epi64(hl, 32));
+    hi                 = _mm512_add_epi64(hi, _mm512_srli_epi64(mid, 32));
+    return _mm512_or_si512(_mm512_slli_epi64(mid, 32), _mm512_and_si512(ll, lo32));
+}
+
+// bits [s, s + 64) of the 128-bit integer (hi, lo) for 0 <= s < 128; shift counts of 64 or more give zero
+inline __m512i ShiftRight128(__m512i lo, __m512i hi, uint64_t s) {
+    __m512i r = _mm512_or_si512(_mm512_srl_epi64(lo, _mm_cvtsi64_si128(s)),
+                                _mm512_sll_epi64(hi, _mm_cvtsi64_si128(64 - s)));
+    return _mm512_or_si512(r, _mm512_srl_epi64(hi, _mm_cvtsi64_si128(s - 64)));
+}
+
+template <typename Op>
+inline void ForEach(uint64_t* a, const uint64_t* b, uint32_t n, Op op) {
+    for (uint32_t i{0}; i < n; i += 8) {
+        __m512i x = _mm512_loadu_si512(a + i);
+        __m512i y = _mm512_loadu_si512(b + i);
+        _mm512_storeu_si512(a + i, op(x, y));
+    }
+}
+
+template <typename Op>
+inline void ForEach(uint64_t* a, uint32_t n, Op op) {
+    for (uint32_t i{0}; i < n; i += 8)
+        _mm512_storeu_si512(a + i, op(_mm512_loadu_si512(a + i)));
+}
+
+}  // namespace
+
+void ForwardTransformAVX512(const uint64_t* w, const uint64_t* wp, uint64_t modulus, uint32_t n, uint64_t* a) {
+    ForwardTransform<MulModAVX512>(w, wp, modulus, n, a);
+}
+
+void InverseTransformAVX512(const uint64_t* w, const uint64_t* wp, uint64_t wn, uint64_t wnp, uint64_t ninv,
+                            uint64_t ninvp, uint64_t modulus, uint32_t n, uint64_t* a) {
+    InverseTransform<MulModAVX512>(w, wp, wn, wnp, ninv, ninvp, modulus, n, a);
+}
+
+void ForwardTransformAVX512IFMA(const uint64_t* w, const uint64_t* wp, uint64_t modulus, uint32_t n, uint64_t* a) {
+    ForwardTransform<MulModIFMA>(w, wp, modulus, n, a);
+}
+
+void InverseTransformAVX512IFMA(const uint64_t* w, const uint64_t* wp, uint64_t wn, uint64_t wnp, uint64_t ninv,
+                                uint64_t ninvp, uint64_t modulus, uint32_t n, uint64_t* a) {
+    InverseTransform<MulModIFMA>(w, wp, wn, wnp, ninv, ninvp, modulus, n, a);
+}
+
+void ModAddAVX512(uint64_t* a, const uint64_t* b, uint64_t modulus, uint32_t n) {
+    const __m512i q = _mm512_set1_epi64(modulus);
+    ForEach(a, b, n, [q](__m512i x, __m512i y) { return ModReduce(_mm512_add_epi64(x, y), q); });
+}
+
+void ModSubAVX512(uint64_t* a, const uint64_t* b, uint64_t modulus, uint32_t n) {
+    const __m512i q = _mm512_set1_epi64(modulus);
+    ForEach(a, b, n, [q](__m512i x, __m512i y) {
+        __m512i d = _mm512_sub_epi64(x, y);
+        return _mm512_min_epu64(d, _mm512_add_epi64(d, q));
+    });
+}
+
+void ModAddConstAVX512(uint64_t* a, uint64_t b, uint64_t modulus, uint32_t n) {
+    const __m512i q = _mm512_set1_epi64(modulus);
+    const __m512i y = _mm512_set1_epi64(b);
+    ForEach(a, n, [q, y](__m512i x) { return ModReduce(_mm512_add_epi64(x, y), q); });
+}
+
+void ModSubConstAVX512(uint64_t* a, uint64_t b, uint64_t modulus, uint32_t n) {
+    const __m512i q = _mm512_set1_epi64(modulus);
+    const __m512i y = _mm512_set1_epi64(modulus - b);
+    ForEach(a, n, [q, y](__m512i x) { return ModReduce(_mm512_add_epi64(x, y), q); });
+}
+
+// Barrett reduction as in NativeIntegerT::ModMulFastEq with mu = floor(2^(2 * msb + 3) / q) and shift = msb - 2
+void ModMulAVX512(uint64_t* a, const uint64_t* b, uint64_t modulus, uint64_t mu, uint32_t shift, uint32_t n) {
+    const __m512i q   = _mm512_set1_epi64(modulus);
+    const __m512i vmu = _mm512_set1_epi64(mu);
+    ForEach(a, b, n, [=](__m512i x, __m512i y) {
+        __m512i hi, mhi;
+        __m512i lo  = MulFull(x, y, hi);
+        __m512i mlo = MulFull(ShiftRight128(lo, hi, shift), vmu, mhi);
+        __m512i qe  = ShiftRight128(mlo, mhi, shift + 7);
+        return ModReduce(_mm512_sub_epi64(lo, _mm512_mullo_epi64(qe, q)), q);
+    });
+}
+
+// Barrett reduction with 52-bit integer fused multiply-add for q < 2^50: with k = msb and mu = floor(2^(2 * k) / q),
+// the quotient estimate floor(floor(x * y / 2^(k - 1)) * mu / 2^(k + 1)) is off by at most 2
+void ModMulAVX512IFMA(uint64_t* a, const uint64_t* b, uint64_t modulus, uint64_t mu, uint32_t msb, uint32_t n) {
+    const __m512i zero   = _mm512_setzero_si512();
+    const __m512i mask52 = _mm512_set1_epi64((uint64_t(1) << 52) - 1);
+    const __m512i q      = _mm512_set1_epi64(modulus);
+    const __m512i vmu    = _mm512_set1_epi64(mu);
+    ForEach(a, b, n, [=](__m512i x, __m512i y) {
+        __m512i lo  = _mm512_madd52lo_epu64(zero, x, y);
+        __m512i hi  = _mm512_madd52hi_epu64(zero, x, y);
+        __m512i t   = _mm512_or_si512(_mm512_srli_epi64(lo, msb - 1), _mm512_slli_epi64(hi, 53 - msb));
+        __m512i mlo = _mm512_madd52lo_epu64(zero, t, vmu);
+        __m512i mhi = _mm512_madd52hi_epu64(zero, t, vmu);
+        __m512i qe  = _mm512_or_si512(_mm512_srli_epi64(mlo, msb + 1), _mm512_slli_epi64(mhi, 51 - msb));
+        __m512i r   = _mm512_and_si512(_mm512_sub_epi64(lo, _mm512_madd52lo_epu64(zero, qe, q)), mask52);
+        return ModReduce(ModReduce(r, _mm512_add_epi64(q, q)), q);
+    });
+}
+
+void ModMulConstAVX512(uint64_t* a, uint64_t b, uint64_t bp, uint64_t modulus, uint32_t n) {
+    const __m512i q  = _mm512_set1_epi64(modulus);
+    const __m512i w  = _mm512_set1_epi64(b);
+    const __m512i wp = _mm512_set1_epi64(bp);
+    ForEach(a, n, [=](__m512i x) { return MulModAVX512::MulMod(x, w, wp, q); });
+}
+
+void ModMulConstAVX512IFMA(uint64_t* a, uint64_t b, uint64_t bp, uint64_t modulus, uint32_t n) {
+    const __m512i q  = _mm512_set1_epi64(modulus);
+    const __m512i w  = _mm512_set1_epi64(b);
+    const __m512i wp = _mm512_set1_epi64(bp >> 12);  // floor(b * 2^52 / q)
+    ForEach(a, n, [=](__m512i x) { return MulModIFMA::MulMod(x, w, wp, q); });
+}
+
+#else
+
+extern const bool AVX512_COMPILED = false;
+
+void ForwardTransformAVX512(const uint64_t*, const uint64_t*, uint64_t, uint32_t, uint64_t*) {}
+void InverseTransformAVX512(const uint64_t*, const uint64_t*, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t,
+                            uint32_t, uint64_t*) {}
+void ForwardTransformAVX512IFMA(const uint64_t*, const uint64_t*, uint64_t, uint32_t, uint64_t*) {}
+void InverseTransformAVX512IFMA(const uint64_t*, const uint64_t*, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t,
+                                uint32_t, uint64_t*) {}
+void ModAddAVX512(uint64_t*, const uint64_t*, uint64_t, uint32_t) {}
+void ModSubAVX512(uint64_t*, const uint64_t*, uint64_t, uint32_t) {}
+void ModAddConstAVX512(uint64_t*, uint64_t, uint64_t, uint32_t) {}
+void ModSubConstAVX512(uint64_t*, uint64_t, uint64_t, uint32_t) {}
+void ModMulAVX512(uint64_t*, const uint64_t*, uint64_t, uint64_t, uint32_t, uint32_t) {}
+void ModMulAVX512IFMA(uint64_t*, const uint64_t*, uint64_t, uint64_t, uint32_t, uint32_t) {}
+void ModMulConstAVX512(uint64_t*, uint64_t, uint64_t, uint64_t, uint32_t) {}
+void ModMulConstAVX512IFMA(uint64_t*, uint64_t, uint64_t, uint64_t, uint32_t) {}
+
+#endif
+
+}  // namespace simd
+}  // namespace intnat
@@ -0,0 +1,185 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  This code selects the SIMD engine of the power-of-two NTT at runtime
+ */
+
+#include "math/hal/intnat/transformnat-simd.h"
+
+#include <atomic>
+#include <initializer_list>
+
+namespace intnat {
+
+namespace simd {
+
+// The kernels are defined in transformnat-avx2.cpp and transformnat-avx512.cpp, which are compiled for their
+// instruction sets. The flags tell whether the compiler could do so.
+extern const bool AVX2_COMPILED;
+extern const bool AVX512_COMPILED;
+
+void ForwardTransformAVX2(const uint64_t* w, const uint64_t* wp, uint64_t modulus, uint32_t n, uint64_t* a);
+void InverseTransformAVX2(const uint64_t* w, const uint64_t* wp, uint64_t wn, uint64_t wnp, uint64_t ninv,
+                          uint64_t ninvp, uint64_t modulus, uint32_t n, uint64_t* a);
+void ForwardTransformAVX512(const uint64_t* w, const uint64_t* wp, uint64_t modulus, uint32_t n, uint64_t* a);
+void InverseTransformAVX512(const uint64_t* w, const uint64_t* wp, uint64_t wn, uint64_t wnp, uint64_t ninv,
+                            uint64_t ninvp, uint64_t modulus, uint32_t n, uint64_t* a);
+void ForwardTransformAVX512IFMA(const uint64_t* w, const uint64_t* wp, uint64_t modulus, uint32_t n, uint64_t* a);
+void InverseTransformAVX512IFMA(const uint64_t* w, const uint64_t* wp, uint64_t wn, uint64_t wnp, uint64_t ninv,
+                                uint64_t ninvp, uint64_t modulus, uint32_t n, uint64_t* a);
+
+}  // namespace simd
+
+namespace {
+
+bool CPUSupports(NTTEngine engine) {
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    switch (engine) {
+        case NTT_SCALAR:
+            return true;
+        case NTT_AVX2:
+            return __builtin_cpu_supports("avx2");
+        case NTT_AVX512:
+            return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq");
+        case NTT_AVX512IFMA:
+            return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq") &&
+                   __builtin_cpu_supports("avx512ifma");
+    }
+    return false;
+#else
+    return engine == NTT_SCALAR;
+#endif
+}
+
+NTTEngine FastestNTTEngine() {
+    for (auto engine : {NTT_AVX512IFMA, NTT_AVX512, NTT_AVX2}) {
+        if (IsNTTEngineSupported(engine))
+            return engine;
+    }
+    return NTT_SCALAR;
+}
+
+std::atomic<NTTEngine>& CurrentNTTEngine() {
+    static std::atomic<NTTEngine> engine{FastestNTTEngine()};
+    return engine;
+}
+
+// The engine for a transform: the SIMD kernels need two registers' worth of coefficients, and IFMA needs q < 2^51
+NTTEngine NTTEngineFor(uint64_t modulus, uint32_t n) {
+    NTTEngine engine = CurrentNTTEngine().load(std::memory_order_relaxed);
+    if (modulus >= (uint64_t(1) << 62))
+        return NTT_SCALAR;
+    if (engine == NTT_AVX512IFMA && modulus >= (uint64_t(1) << 51))
+        engine = NTT_AVX512;
+    if (n < (engine == NTT_AVX2 ? 8u : 16u))
+        return NTT_SCALAR;
+    return engine;
+}
+
+// Shoup's precomputation floor(w * 2^64 / q)
+uint64_t Precon(uint64_t w, uint64_t modulus) {
+    return static_cast<uint64_t>((static_cast<unsigned __int128>(w) << 64) / modulus);
+}
+
+}  // namespace
+
+bool IsNTTEngineSupported(NTTEngine engine) {
+    switch (engine) {
+        case NTT_SCALAR:
+            return true;
+        case NTT_AVX2:
+            return simd::AVX2_COMPILED && CPUSupports(engine);
+        case NTT_AVX512:
+        case NTT_AVX512IFMA:
+            return simd::AVX512_COMPILED && CPUSupports(engine);
+    }
+    return false;
+}
+
+NTTEngine GetNTTEngine() {
+    return CurrentNTTEngine().load(std::memory_order_relaxed);
+}
+
+bool SetNTTEngine(NTTEngine engine) {
+    if (!IsNTTEngineSupported(engine))
+        return false;
+    CurrentNTTEngine().store(engine, std::memory_order_relaxed);
+    return true;
+}
+
+bool ForwardTransformToBitReverseInPlaceSIMD(const uint64_t* rootOfUnityTable, const uint64_t* preconRootOfUnityTable,
+                                             uint64_t modulus, uint32_t n, uint64_t* element) {
+    switch (NTTEngineFor(modulus, n)) {
+        case NTT_AVX2:
+            simd::ForwardTransformAVX2(rootOfUnityTable, preconRootOfUnityTable, modulus, n, element);
+            return true;
+        case NTT_AVX512:
+            simd::ForwardTransformAVX512(rootOfUnityTable, preconRootOfUnityTable, modulus, n, element);
+            return true;
+        case NTT_AVX512IFMA:
+            simd::ForwardTransformAVX512IFMA(rootOfUnityTable, preconRootOfUnityTable, modulus, n, element);
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool InverseTransformFromBitReverseInPlaceSIMD(const uint64_t* rootOfUnityInverseTable,
+                                               const uint64_t* preconRootOfUnityInverseTable, uint64_t cycloOrderInv,
+                                               uint64_t preconCycloOrderInv, uint64_t modulus, uint32_t n,
+                                               uint64_t* element) {
+    NTTEngine engine = NTTEngineFor(modulus, n);
+    if (engine == NTT_SCALAR)
+        return false;
+
+    // twiddle factor of the last stage times the inverse of n
+    uint64_t wn = static_cast<uint64_t>(static_cast<unsigned __int128>(rootOfUnityInverseTable[1]) * cycloOrderInv %
+                                        modulus);
+    uint64_t wnp = Precon(wn, modulus);
+    switch (engine) {
+        case NTT_AVX2:
+            simd::InverseTransformAVX2(rootOfUnityInverseTable, preconRootOfUnityInverseTable, wn, wnp, cycloOrderInv,
+                                       preconCycloOrderInv, modulus, n, element);
+            return true;
+        case NTT_AVX512:
+            simd::InverseTransformAVX512(rootOfUnityInverseTable, preconRootOfUnityInverseTable, wn, wnp,
+                                         cycloOrderInv, preconCycloOrderInv, modulus, n, element);
+            return true;
+        default:
+            simd::InverseTransformAVX512IFMA(rootOfUnityInverseTable, preconRootOfUnityInverseTable, wn, wnp,
+                                             cycloOrderInv, preconCycloOrderInv, modulus, n, element);
+            return true;
+    }
+}
+
+}  // namespace intnat
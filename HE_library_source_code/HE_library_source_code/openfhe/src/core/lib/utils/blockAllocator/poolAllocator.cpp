@@ -0,0 +1,211 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  This file contains the thread-caching pool that native vectors and DCRT limbs are allocated from
+ */
+
+#include "utils/blockAllocator/poolAllocator.h"
+
+#include "math/nbtheory.h"
+
+#include <cstdint>
+#include <mutex>
+#include <new>
+
+namespace lbcrypto {
+
+namespace {
+
+// size classes per doubling of the block size
+constexpr uint32_t STEPS       = 8;
+constexpr uint32_t MIN_LOG     = 13;
+constexpr uint32_t MAX_LOG     = 28;
+constexpr uint32_t NUM_CLASSES = (MAX_LOG - MIN_LOG) * STEPS + 1;
+
+static_assert(PoolAllocator::MIN_BLOCK == size_t(1) << MIN_LOG && PoolAllocator::MAX_BLOCK == size_t(1) << MAX_LOG,
+              "the size classes must span MIN_BLOCK to MAX_BLOCK");
+
+// class 0 holds MIN_BLOCK bytes; the STEPS classes after it split (2^k, 2^(k+1)] into equal steps
+uint32_t SizeClass(size_t bytes) {
+    if (bytes <= PoolAllocator::MIN_BLOCK)
+        return 0;
+    uint32_t k{GetMSB(static_cast<uint64_t>(bytes - 1)) - 1};
+    uint32_t shift{k - 3};
+    auto j{static_cast<uint32_t>((bytes + (size_t(1) << shift) - 1) >> shift)};
+    return 1 + (k - MIN_LOG) * STEPS + (j - STEPS - 1);
+}
+
+size_t ClassSize(uint32_t c) {
+    if (c == 0)
+        return PoolAllocator::MIN_BLOCK;
+    uint32_t k{MIN_LOG + (c - 1) / STEPS};
+    size_t j{STEPS + 1 + (c - 1) % STEPS};
+    return j << (k - 3);
+}
+
+void* NewBlock(size_t bytes) {
+    return ::operator new(bytes, std::align_val_t{PoolAllocator::ALIGNMENT});
+}
+
+void DeleteBlock(void* p) noexcept {
+    ::operator delete(p, std::align_val_t{PoolAllocator::ALIGNMENT});
+}
+
+// a free block stores the link to the next free block of its class in its first bytes
+struct FreeBlock {
+    FreeBlock* next;
+};
+
+struct FreeLists {
+    FreeBlock* heads[NUM_CLASSES]{};
+    size_t bytes{0};
+
+    void* Pop(uint32_t c) noexcept {
+        FreeBlock* b{heads[c]};
+        if (b != nullptr) {
+            heads[c] = b->next;
+            bytes -= ClassSize(c);
+        }
+        return b;
+    }
+
+    void Push(uint32_t c, void* p) noexcept {
+        auto b{static_cast<FreeBlock*>(p)};
+        b->next  = heads[c];
+        heads[c] = b;
+        bytes += ClassSize(c);
+    }
+
+    void Clear() noexcept {
+        for (uint32_t c = 0; c < NUM_CLASSES; ++c) {
+            while (void* p = Pop(c))
+                DeleteBlock(p);
+        }
+    }
+};
+
+struct Depot {
+    std::mutex mutex;
+    FreeLists lists;
+};
+
+// never destroyed, so that threads exiting during static destruction can still return their blocks
+Depot& GetDepot() {
+    static Depot* depot{new Depot};
+    return *depot;
+}
+
+void* PopFromDepot(uint32_t c) {
+    auto& depot{GetDepot()};
+    std::lock_guard<std::mutex> lock(depot.mutex);
+    return depot.lists.Pop(c);
+}
+
+void PushToDepot(uint32_t c, void* p) noexcept {
+    auto& depot{GetDepot()};
+    {
+        std::lock_guard<std::mutex> lock(depot.mutex);
+        if (depot.lists.bytes + ClassSize(c) <= PoolAllocator::DEPOT_LIMIT) {
+            depot.lists.Push(c, p);
+            return;
+        }
+    }
+    DeleteBlock(p);
+}
+
+// set once the cache of the thread is destroyed; blocks freed afterwards go to the depot
+thread_local bool t_cacheDestroyed{false};
+
+struct ThreadCache {
+    FreeLists lists;
+
+    ~ThreadCache() {
+        for (uint32_t c = 0; c < NUM_CLASSES; ++c) {
+            while (void* p = lists.Pop(c))
+                PushToDepot(c, p);
+        }
+        t_cacheDestroyed = true;
+    }
+};
+
+thread_local ThreadCache t_cache;
+
+}  // namespace
+
+void* PoolAllocator::Allocate(size_t bytes) {
+    if (bytes < MIN_BLOCK || bytes > MAX_BLOCK)
+        return NewBlock(bytes);
+    uint32_t c{SizeClass(bytes)};
+    if (!t_cacheDestroyed) {
+        if (void* p = t_cache.lists.Pop(c))
+            return p;
+    }
+    if (void* p = PopFromDepot(c))
+        return p;
+    return NewBlock(ClassSize(c));
+}
+
+void PoolAllocator::Deallocate(void* p, size_t bytes) noexcept {
+    if (p == nullptr)
+        return;
+    if (bytes < MIN_BLOCK || bytes > MAX_BLOCK) {
+        DeleteBlock(p);
+        return;
+    }
+    uint32_t c{SizeClass(bytes)};
+    if (!t_cacheDestroyed && t_cache.lists.bytes + ClassSize(c) <= THREAD_CACHE_LIMIT) {
+        t_cache.lists.Push(c, p);
+        return;
+    }
+    PushToDepot(c, p);
+}
+
+size_t PoolAllocator::BlockSize(size_t bytes) noexcept {
+    return (bytes < MIN_BLOCK || bytes > MAX_BLOCK) ? bytes : ClassSize(SizeClass(bytes));
+}
+
+size_t PoolAllocator::GetCachedBytes() noexcept {
+    size_t bytes{t_cacheDestroyed ? 0 : t_cache.lists.bytes};
+    auto& depot{GetDepot()};
+    std::lock_guard<std::mutex> lock(depot.mutex);
+    return bytes + depot.lists.bytes;
+}
+
+void PoolAllocator::Release() noexcept {
+    if (!t_cacheDestroyed)
+        t_cache.lists.Clear();
+    auto& depot{GetDepot()};
+    std::lock_guard<std::mutex> lock(depot.mutex);
+    depot.lists.Clear();
+}
+
+}  // namespace lbcrypto
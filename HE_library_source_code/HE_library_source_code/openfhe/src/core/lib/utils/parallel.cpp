@@ -39,4 +39,27 @@ namespace lbcrypto {
 
 ParallelControls OpenFHEParallelControls;
 
+thread_local uint32_t ParallelThreadScope::limit = 0;
+
+ParallelThreadScope::ParallelThreadScope(uint32_t threads) : previousLimit(limit) {
+    if (threads != 0 && (limit == 0 || threads < limit))
+        limit = threads;
+#ifdef PARALLEL
+    // the plain OpenMP regions follow the setting of the calling thread
+    int openMPThreads = omp_get_max_threads();
+    if (limit != 0 && static_cast<int>(limit) < openMPThreads) {
+        previousOpenMPThreads = openMPThreads;
+        omp_set_num_threads(limit);
+    }
+#endif
+}
+
+ParallelThreadScope::~ParallelThreadScope() {
+    limit = previousLimit;
+#ifdef PARALLEL
+    if (previousOpenMPThreads != 0)
+        omp_set_num_threads(previousOpenMPThreads);
+#endif
+}
+
 }
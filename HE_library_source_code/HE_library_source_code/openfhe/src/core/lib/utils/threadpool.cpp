@@ -0,0 +1,218 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  This file contains the task scheduler for parallel operation
+ */
+
+#include "utils/threadpool.h"
+#include "utils/parallel.h"
+
+#include <algorithm>
+#include <exception>
+
+#ifdef PARALLEL
+    #include <omp.h>
+#endif
+
+namespace lbcrypto {
+
+thread_local const ThreadPool* ThreadPool::m_currentPool = nullptr;
+thread_local uint32_t ThreadPool::m_workerIndex          = 0;
+
+namespace {
+
+// Runs the OpenMP regions reached from a loop on the calling thread alone, the pool already keeps every core busy
+class SerialOpenMPScope {
+public:
+    SerialOpenMPScope() {
+#ifdef PARALLEL
+        m_threads = omp_get_max_threads();
+        omp_set_num_threads(1);
+#endif
+    }
+    ~SerialOpenMPScope() {
+#ifdef PARALLEL
+        omp_set_num_threads(m_threads);
+#endif
+    }
+
+private:
+    int m_threads{1};
+};
+
+}  // namespace
+
+// A loop is split into chunks of consecutive iterations that the threads claim one by one. Every helping thread
+// gets a task pointing to the loop; the loop is finished when all chunks are done and all tasks are consumed.
+struct ThreadPool::Loop {
+    ChunkFunction function;
+    void* context;
+    size_t count;
+    size_t chunkSize;
+    size_t chunkCount;
+    std::atomic<size_t> nextChunk{0};
+    std::atomic<size_t> doneChunks{0};
+    std::atomic<uint32_t> pendingTasks{0};
+    std::mutex errorMutex;
+    std::exception_ptr error;
+
+    void RunChunks() {
+        for (size_t chunk = nextChunk.fetch_add(1); chunk < chunkCount; chunk = nextChunk.fetch_add(1)) {
+            size_t first{chunk * chunkSize};
+            try {
+                function(context, first, std::min(count, first + chunkSize));
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error)
+                    error = std::current_exception();
+            }
+            doneChunks.fetch_add(1, std::memory_order_release);
+        }
+    }
+};
+
+ThreadPool::ThreadPool(uint32_t threadCount) {
+    uint32_t workerCount{threadCount > 1 ? threadCount - 1 : 0};
+    m_workers.reserve(workerCount);
+    for (uint32_t i = 0; i < workerCount; ++i)
+        m_workers.emplace_back(std::make_unique<Worker>());
+    for (uint32_t i = 0; i < workerCount; ++i)
+        m_workers[i]->thread = std::thread(&ThreadPool::WorkerLoop, this, i);
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_stop = true;
+    }
+    m_wakeup.notify_all();
+    for (auto& worker : m_workers)
+        worker->thread.join();
+}
+
+ThreadPool& ThreadPool::GetInstance() {
+    // never destroyed, so that loops can run during the destruction of static objects
+    static ThreadPool* pool = new ThreadPool(OpenFHEParallelControls.GetMachineThreads());
+    return *pool;
+}
+
+void ThreadPool::Run(size_t count, uint32_t maxThreads, void* context, ChunkFunction function) {
+    SerialOpenMPScope scope;
+    size_t threadCount{std::min<size_t>({count, maxThreads, GetThreadCount()})};
+    if (threadCount <= 1) {
+        function(context, 0, count);
+        return;
+    }
+
+    // a few chunks per thread balance iterations of different cost
+    constexpr size_t CHUNKS_PER_THREAD = 4;
+    Loop loop;
+    loop.function   = function;
+    loop.context    = context;
+    loop.count      = count;
+    loop.chunkSize  = (count + threadCount * CHUNKS_PER_THREAD - 1) / (threadCount * CHUNKS_PER_THREAD);
+    loop.chunkCount = (count + loop.chunkSize - 1) / loop.chunkSize;
+
+    uint32_t helperCount = static_cast<uint32_t>(std::min<size_t>(threadCount, loop.chunkCount) - 1);
+    loop.pendingTasks.store(helperCount, std::memory_order_relaxed);
+    uint32_t first{m_nextQueue.fetch_add(helperCount, std::memory_order_relaxed)};
+    for (uint32_t i = 0; i < helperCount; ++i) {
+        Worker& worker = *m_workers[(first + i) % m_workers.size()];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.tasks.push_back(&loop);
+    }
+    m_queuedTasks.fetch_add(helperCount);
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+    }
+    m_wakeup.notify_all();
+
+    loop.RunChunks();
+    while (loop.doneChunks.load(std::memory_order_acquire) < loop.chunkCount ||
+           loop.pendingTasks.load(std::memory_order_acquire) > 0) {
+        if (!RunPendingTask())
+            std::this_thread::yield();
+    }
+    if (loop.error)
+        std::rethrow_exception(loop.error);
+}
+
+bool ThreadPool::RunPendingTask() {
+    Loop* loop{nullptr};
+    size_t workerCount{m_workers.size()};
+    bool isWorker{m_currentPool == this};
+    if (isWorker) {
+        Worker& own = *m_workers[m_workerIndex];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            loop = own.tasks.back();
+            own.tasks.pop_back();
+        }
+    }
+    uint32_t start{isWorker ? m_workerIndex + 1 : 0};
+    for (size_t i = 0; loop == nullptr && i < workerCount; ++i) {
+        Worker& victim = *m_workers[(start + i) % workerCount];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            loop = victim.tasks.front();
+            victim.tasks.pop_front();
+        }
+    }
+    if (loop == nullptr)
+        return false;
+
+    m_queuedTasks.fetch_sub(1);
+    loop->RunChunks();
+    // the loop may be gone as soon as its last task is released
+    loop->pendingTasks.fetch_sub(1, std::memory_order_release);
+    return true;
+}
+
+void ThreadPool::WorkerLoop(uint32_t index) {
+    m_currentPool = this;
+    m_workerIndex = index;
+#ifdef PARALLEL
+    // OpenMP regions inside the tasks run on the worker alone
+    omp_set_num_threads(1);
+#endif
+    while (true) {
+        if (RunPendingTask())
+            continue;
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_wakeup.wait(lock, [this] { return m_stop || m_queuedTasks.load() > 0; });
+        if (m_stop)
+            return;
+    }
+}
+
+}  // namespace lbcrypto
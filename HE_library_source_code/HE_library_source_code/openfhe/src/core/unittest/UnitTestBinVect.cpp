@@ -41,6 +41,7 @@
 #include "lattice/ildcrtparams.h"
 #include "lattice/ilelement.h"
 #include "lattice/ilparams.h"
+#include "math/hal/intnat/transformnat-simd.h"
 #include "testdefs.h"
 #include "utils/debug.h"
 #include "utils/inttypes.h"
@@ -553,3 +554,92 @@ void modmul_vector(const std::string& msg) {
 TEST(UTBinVect, modmul_vector) {
     RUN_BIG_BACKENDS(modmul_vector, "modmul_vector")
 }
+
+// Montgomery multiplication is only provided by native vectors; it has to agree with Barrett multiplication
+TEST(UTBinVect, native_montgomery_mod_mul) {
+    for (usint bits : {30, 50, 59}) {
+        NativeInteger q = FirstPrime<NativeInteger>(bits, 2048);
+        DiscreteUniformGeneratorImpl<NativeVector> dug;
+        dug.SetModulus(q);
+        NativeVector a       = dug.GenerateVector(1024);
+        NativeVector b       = dug.GenerateVector(1024);
+        NativeVector product = a.ModMul(b);
+
+        NativeVector bMont(b);
+        bMont.ToMontgomeryEq();
+        EXPECT_EQ(product, a.ModMulMontgomery(bMont)) << "Failure ModMulMontgomery for " << bits << " bits";
+
+        // the product of two vectors in Montgomery form stays in Montgomery form
+        NativeVector aMont(a);
+        aMont.ToMontgomeryEq();
+        aMont.ModMulMontgomeryEq(bMont);
+        aMont.FromMontgomeryEq();
+        EXPECT_EQ(product, aMont) << "Failure ModMulMontgomeryEq for " << bits << " bits";
+
+        bMont.FromMontgomeryEq();
+        EXPECT_EQ(b, bMont) << "Failure FromMontgomeryEq for " << bits << " bits";
+
+        NativeInteger qInv = q.ComputeMontgomeryInverse();
+        for (usint i = 0; i < 16; i++) {
+            NativeInteger x = a[i].ModMulMontgomery(b[i].ToMontgomery(q), q, qInv);
+            EXPECT_EQ(product[i], x) << "Failure ModMulMontgomery for " << bits << " bits";
+            x = a[i].ToMontgomery(q);
+            x.ModMulMontgomeryEq(b[i], q, qInv);
+            EXPECT_EQ(product[i], x) << "Failure ModMulMontgomeryEq for " << bits << " bits";
+            EXPECT_EQ(a[i], a[i].ToMontgomery(q).FromMontgomery(q, qInv)) << "Failure FromMontgomery";
+        }
+    }
+    EXPECT_THROW(NativeInteger(1024).ComputeMontgomeryInverse(), lbcrypto::math_error);
+
+    // the sign of the Montgomery reduction is only correct for moduli below R / 2
+    NativeInteger big(uint64_t(1) << (NativeInteger::MaxBits() - 1));
+    EXPECT_THROW((big + 1).ComputeMontgomeryInverse(), lbcrypto::math_error);
+    EXPECT_FALSE((big + 1).IsMontgomeryModulus());
+    EXPECT_FALSE(NativeInteger(1024).IsMontgomeryModulus());
+    EXPECT_TRUE((big - 1).IsMontgomeryModulus());
+    EXPECT_EQ(NativeInteger(2), (big - 1).ComputeMontgomeryR());
+
+    // vectors with even moduli fall back to Barrett multiplication
+    NativeInteger q(1024);
+    NativeVector a(4, q, {1023, 0, 1, 5});
+    NativeVector b(4, q, {1023, 7, 1019, 1});
+    NativeVector product = a.ModMul(b);
+    for (usint i = 0; i < a.GetLength(); i++)
+        EXPECT_EQ(a[i].ModMul(b[i], q), product[i]) << "Failure ModMul modulo " << q;
+    EXPECT_EQ(a.ModMul(NativeInteger(3)), a.ModMul(NativeVector(4, q, {3, 3, 3, 3}))) << "Failure ModMul scalar";
+}
+
+// The SIMD kernels of the element-wise operations of native vectors have to agree with the scalar code, also on the
+// elements after the last full register and for moduli around the 50- and 51-bit limits of the IFMA kernels
+TEST(UTBinVect, native_simd_kernels) {
+    const intnat::NTTEngine defaultEngine = intnat::GetNTTEngine();
+    DiscreteUniformGeneratorImpl<NativeVector> dug;
+    const char* operations[] = {"ModAdd", "ModSub", "ModAdd scalar", "ModSub scalar", "ModMul", "ModMul scalar"};
+
+    for (usint length : {1, 7, 16, 1021}) {
+        for (usint bits : {30, 50, 51, 52, 59}) {
+            NativeInteger q = FirstPrime<NativeInteger>(bits, 2048);
+            dug.SetModulus(q);
+            NativeVector a = dug.GenerateVector(length);
+            NativeVector b = dug.GenerateVector(length);
+            NativeInteger c = dug.GenerateInteger();
+            a[0]            = q - 1;
+            b[0]            = q - 1;
+
+            ASSERT_TRUE(intnat::SetNTTEngine(intnat::NTT_SCALAR));
+            std::vector<NativeVector> expected{a.ModAdd(b), a.ModSub(b), a.ModAdd(c),
+                                               a.ModSub(c), a.ModMul(b), a.ModMul(c)};
+
+            for (auto engine : {intnat::NTT_AVX2, intnat::NTT_AVX512, intnat::NTT_AVX512IFMA}) {
+                if (!intnat::SetNTTEngine(engine))
+                    continue;
+                std::vector<NativeVector> result{a.ModAdd(b), a.ModSub(b), a.ModAdd(c),
+                                                 a.ModSub(c), a.ModMul(b), a.ModMul(c)};
+                for (size_t i = 0; i < expected.size(); ++i)
+                    EXPECT_EQ(expected[i], result[i]) << operations[i] << ", engine " << engine << ", n = " << length
+                                                      << ", " << bits << " bits";
+            }
+        }
+    }
+    intnat::SetNTTEngine(defaultEngine);
+}
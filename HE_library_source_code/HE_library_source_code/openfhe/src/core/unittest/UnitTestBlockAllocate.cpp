@@ -37,13 +37,18 @@
 #include <assert.h>
 #include <stdio.h>
 
+#include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <new>
+#include <thread>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "math/math-hal.h"
 #include "utils/blockAllocator/blockAllocator.h"
+#include "utils/blockAllocator/poolAllocator.h"
 #include "utils/debug.h"
 #include "utils/inttypes.h"
 #include "utils/utilities.h"
@@ -250,3 +255,50 @@ TEST(UTBlockAllocate, block_allocator_test) {
     Benchmark("Heap Blocks (Run 2)", AllocHeapBlocks, DeallocHeapBlocks);
     Benchmark("Heap Blocks (Run 3)", AllocHeapBlocks, DeallocHeapBlocks);
 }
+
+TEST(UTBlockAllocate, pool_allocator_test) {
+    PoolAllocator::Release();
+
+    // a limb of 2^10 to 2^17 words fills its size class, and no block wastes more than 1/8 of its size
+    for (size_t n = size_t(1) << 10; n <= size_t(1) << 17; n <<= 1)
+        EXPECT_EQ(PoolAllocator::BlockSize(n * sizeof(uint64_t)), n * sizeof(uint64_t)) << "Failure: limb of " << n;
+    for (size_t bytes = PoolAllocator::MIN_BLOCK; bytes <= PoolAllocator::MAX_BLOCK; bytes += bytes / 7 + 1) {
+        size_t size{PoolAllocator::BlockSize(bytes)};
+        EXPECT_GE(size, bytes) << "Failure: size class of " << bytes;
+        EXPECT_LE(size, bytes + bytes / 8) << "Failure: size class of " << bytes;
+    }
+    EXPECT_EQ(PoolAllocator::BlockSize(100), 100u) << "Failure: small block";
+    EXPECT_EQ(PoolAllocator::BlockSize(PoolAllocator::MAX_BLOCK + 1), PoolAllocator::MAX_BLOCK + 1)
+        << "Failure: large block";
+
+    // a freed block is reused by the next allocation of its class
+    void* p{PoolAllocator::Allocate(9000)};
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % PoolAllocator::ALIGNMENT, 0u) << "Failure: alignment";
+    std::memset(p, 1, PoolAllocator::BlockSize(9000));
+    PoolAllocator::Deallocate(p, 9000);
+    EXPECT_EQ(PoolAllocator::GetCachedBytes(), PoolAllocator::BlockSize(9000)) << "Failure: cached bytes";
+    EXPECT_EQ(PoolAllocator::Allocate(9200), p) << "Failure: reuse";
+    PoolAllocator::Deallocate(p, 9200);
+
+    // blocks move between threads, and a thread returns its cache when it exits
+    std::vector<void*> blocks(16);
+    std::thread([&blocks]() {
+        for (auto& b : blocks)
+            b = PoolAllocator::Allocate(size_t(1) << 16);
+    }).join();
+    for (auto b : blocks)
+        PoolAllocator::Deallocate(b, size_t(1) << 16);
+    std::thread([]() {
+        void* b{PoolAllocator::Allocate(size_t(1) << 20)};
+        PoolAllocator::Deallocate(b, size_t(1) << 20);
+    }).join();
+    EXPECT_EQ(PoolAllocator::GetCachedBytes(), PoolAllocator::BlockSize(9000) + (size_t(16) << 16) + (size_t(1) << 20))
+        << "Failure: cached bytes of several threads";
+
+    // small and large blocks bypass the pool
+    PoolAllocator::Deallocate(PoolAllocator::Allocate(100), 100);
+    PoolAllocator::Deallocate(PoolAllocator::Allocate(PoolAllocator::MAX_BLOCK + 1), PoolAllocator::MAX_BLOCK + 1);
+
+    PoolAllocator::Release();
+    EXPECT_EQ(PoolAllocator::GetCachedBytes(), 0u) << "Failure: release";
+}
@@ -593,6 +593,103 @@ TEST(UTDCRTPoly, DCRT_mod_ops_on_two_elements) {
     RUN_BIG_DCRTPOLYS(DCRT_mod_ops_on_two_elements, "DCRT DCRT_mod_ops_on_two_elements");
 }
 
+template <typename Element>
+void DCRT_contiguous_limbs(const std::string& msg) {
+    usint order     = 2048;
+    usint nBits     = 50;
+    usint towersize = 4;
+
+    std::shared_ptr<ILDCRTParams<typename Element::Integer>> ildcrtparams =
+        GenerateDCRTParams<typename Element::Integer>(order, towersize, nBits);
+
+    Element zero(ildcrtparams, Format::EVALUATION, true);
+    EXPECT_TRUE(zero.HasContiguousLimbs()) << msg << " Failure: zero polynomial";
+    for (usint i = 0; i < towersize; i++)
+        EXPECT_EQ(NativeInteger(0), zero.GetElementAtIndex(i).at(i)) << msg << " Failure: zero tower " << i;
+
+    typename Element::DugType dug;
+    Element op1(dug, ildcrtparams);
+    Element op2(dug, ildcrtparams);
+
+    // copies are contiguous and stay so through in-place operations and assignments of the same shape
+    Element sum(op1);
+    EXPECT_TRUE(sum.HasContiguousLimbs()) << msg << " Failure: copy";
+    EXPECT_EQ(op1, sum) << msg << " Failure: copy";
+    sum += op2;
+    sum = op1 + op2;
+    EXPECT_TRUE(sum.HasContiguousLimbs()) << msg << " Failure: assignment";
+
+    Element assigned;
+    assigned = sum;
+    EXPECT_TRUE(assigned.HasContiguousLimbs()) << msg << " Failure: assignment to an empty polynomial";
+    EXPECT_EQ(sum, assigned) << msg << " Failure: assignment to an empty polynomial";
+
+    // a limb taken out of the polynomial keeps its values after the polynomial is gone
+    NativePoly limb;
+    {
+        Element tmp(sum);
+        limb = std::move(tmp.GetAllElements()[1]);
+    }
+    EXPECT_EQ(sum.GetElementAtIndex(1), limb) << msg << " Failure: moved limb";
+
+    // replacing a limb keeps the polynomial correct but not contiguous
+    DiscreteUniformGeneratorImpl<NativeVector> nativeDug;
+    assigned.SetElementAtIndex(2, NativePoly(nativeDug, ildcrtparams->GetParams()[2]));
+    EXPECT_FALSE(assigned.HasContiguousLimbs()) << msg << " Failure: replaced limb";
+    assigned.SetElementAtIndex(2, sum.GetElementAtIndex(2));
+    EXPECT_EQ(sum, assigned) << msg << " Failure: replaced limb";
+}
+
+TEST(UTDCRTPoly, DCRT_contiguous_limbs) {
+    RUN_BIG_DCRTPOLYS(DCRT_contiguous_limbs, "DCRT DCRT_contiguous_limbs");
+}
+
+// every limb of a sampled polynomial holds the same small signed values
+template <typename Element>
+void CheckSampledLimbs(const Element& poly, int64_t bound, const std::string& msg) {
+    EXPECT_TRUE(poly.HasContiguousLimbs()) << msg << " Failure: limbs are not contiguous";
+    const auto& first = poly.GetElementAtIndex(0);
+    for (usint i = 0; i < poly.GetNumOfElements(); i++) {
+        const auto& limb = poly.GetElementAtIndex(i);
+        uint64_t q       = limb.GetModulus().ConvertToInt();
+        uint64_t q0      = first.GetModulus().ConvertToInt();
+        for (usint j = 0; j < limb.GetLength(); j++) {
+            uint64_t v  = limb[j].ConvertToInt();
+            uint64_t v0 = first[j].ConvertToInt();
+            int64_t k   = (v > q / 2) ? -static_cast<int64_t>(q - v) : static_cast<int64_t>(v);
+            int64_t k0  = (v0 > q0 / 2) ? -static_cast<int64_t>(q0 - v0) : static_cast<int64_t>(v0);
+            ASSERT_EQ(k0, k) << msg << " Failure: limb " << i << " index " << j;
+            ASSERT_LE(std::abs(k), bound) << msg << " Failure: limb " << i << " index " << j;
+        }
+    }
+}
+
+template <typename Element>
+void DCRT_sampled_limbs(const std::string& msg) {
+    usint order     = 2048;
+    usint nBits     = 50;
+    usint towersize = 4;
+
+    std::shared_ptr<ILDCRTParams<typename Element::Integer>> ildcrtparams =
+        GenerateDCRTParams<typename Element::Integer>(order, towersize, nBits);
+
+    typename Element::DggType dgg(3.19);
+    typename Element::TugType tug;
+
+    CheckSampledLimbs(Element(dgg, ildcrtparams, Format::COEFFICIENT), 64, msg + " Gaussian");
+    CheckSampledLimbs(Element(tug, ildcrtparams, Format::COEFFICIENT), 1, msg + " ternary");
+    CheckSampledLimbs(Element(tug, ildcrtparams, Format::COEFFICIENT, 16), 1, msg + " sparse ternary");
+
+    Element evaluation(dgg, ildcrtparams, Format::EVALUATION);
+    EXPECT_EQ(Format::EVALUATION, evaluation.GetFormat()) << msg << " Failure: format";
+    evaluation.SetFormat(Format::COEFFICIENT);
+    CheckSampledLimbs(evaluation, 64, msg + " Gaussian in evaluation format");
+}
+
+TEST(UTDCRTPoly, DCRT_sampled_limbs) {
+    RUN_BIG_DCRTPOLYS(DCRT_sampled_limbs, "DCRT DCRT_sampled_limbs");
+}
+
 // only need to try this with one
 void testDCRTPolyConstructorNegative(std::vector<NativePoly>& towers) {
     DCRTPoly expectException(towers);
@@ -33,8 +33,10 @@
   This code exercises the random number distribution generator libraries of the OpenFHE lattice encryption library.
  */
 
+#include <array>
 #include <iostream>
 #include <thread>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -653,3 +655,43 @@ TEST(UTDistrGen, ThreadSafetyInGetPRNG) {
     RUN_ALL_BACKENDS(ThreadSafetyInGetPRNG, "Thread safety in getPRNG")
 }
 #endif
+
+TEST(UTDistrGen, Blake2EngineStreams) {
+    std::array<PRNG::result_type, 16> seed{};
+    seed[0] = 1;
+
+    PRNG engine(seed);
+    PRNG stream0(seed, 0, 0);
+    PRNG stream1(seed, 0, 1);
+
+    bool same = true;
+    for (uint32_t i = 0; i < 64; i++) {
+        auto sample = engine();
+        EXPECT_EQ(sample, stream0()) << "sub-stream 0 differs from the engine without sub-streams";
+        same &= (sample == stream1());
+    }
+    EXPECT_FALSE(same) << "sub-stream 1 repeats sub-stream 0";
+}
+
+void PRNGSamplesHelper(std::vector<uint32_t>* samples) {
+    PRNG& engine = PseudoRandomNumberGenerator::GetPRNG();
+    for (auto& sample : *samples)
+        sample = engine();
+}
+
+TEST(UTDistrGen, DistinctPRNGStreamsPerThread) {
+    constexpr size_t numThreads = 4;
+    std::vector<std::vector<uint32_t>> samples(numThreads + 1, std::vector<uint32_t>(16));
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < numThreads; i++)
+        threads.emplace_back(PRNGSamplesHelper, &samples[i]);
+    for (auto& t : threads)
+        t.join();
+    PRNGSamplesHelper(&samples[numThreads]);
+
+    for (size_t i = 0; i < samples.size(); i++) {
+        for (size_t j = i + 1; j < samples.size(); j++)
+            EXPECT_NE(samples[i], samples[j]) << "threads " << i << " and " << j << " share a PRNG stream";
+    }
+}
@@ -0,0 +1,183 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  This file tests the schedulers of parallel loops
+ */
+
+#include "include/gtest/gtest.h"
+
+#include "utils/parallel.h"
+#include "utils/threadpool.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace lbcrypto;
+
+TEST(UTParallel, ThreadPool_runs_every_iteration_once) {
+    ThreadPool pool(4);
+    EXPECT_EQ(pool.GetThreadCount(), 4u);
+
+    for (size_t count : {0, 1, 3, 4, 17, 1000}) {
+        std::vector<std::atomic<uint32_t>> calls(count + 5);
+        pool.ParallelFor(5, count + 5, 4, [&](size_t i) { ++calls[i]; });
+        for (size_t i = 0; i < calls.size(); ++i)
+            EXPECT_EQ(calls[i].load(), i < 5 ? 0u : 1u) << "count " << count << " index " << i;
+    }
+}
+
+TEST(UTParallel, ThreadPool_nested_loops) {
+    ThreadPool pool(4);
+    const size_t outer = 16;
+    const size_t inner = 100;
+
+    std::vector<uint64_t> result(outer * inner);
+    pool.ParallelFor(0, outer, 4, [&](size_t i) {
+        pool.ParallelFor(0, inner, 4, [&](size_t j) {
+            // a third level of loops must not block either
+            std::atomic<uint64_t> sum{0};
+            pool.ParallelFor(0, 8, 4, [&](size_t k) { sum += k; });
+            result[i * inner + j] = i * j + sum;
+        });
+    });
+    for (size_t i = 0; i < outer; ++i) {
+        for (size_t j = 0; j < inner; ++j)
+            EXPECT_EQ(result[i * inner + j], i * j + 28);
+    }
+}
+
+TEST(UTParallel, ThreadPool_rethrows_exceptions) {
+    ThreadPool pool(3);
+    std::atomic<uint32_t> calls{0};
+    auto failing = [&](size_t i) {
+        ++calls;
+        if (i == 7)
+            throw std::runtime_error("iteration 7");
+    };
+    EXPECT_THROW(pool.ParallelFor(0, 100, 3, failing), std::runtime_error);
+    EXPECT_THROW(pool.ParallelFor(0, 100, 1, failing), std::runtime_error);
+
+    // the pool stays usable after a failed loop
+    calls = 0;
+    pool.ParallelFor(0, 100, 3, [&](size_t) { ++calls; });
+    EXPECT_EQ(calls.load(), 100u);
+}
+
+TEST(UTParallel, ParallelFor_schedulers) {
+    ParallelScheduler scheduler = OpenFHEParallelControls.GetScheduler();
+    for (auto s : {ParallelScheduler::OPENMP, ParallelScheduler::THREAD_POOL}) {
+        OpenFHEParallelControls.SetScheduler(s);
+        std::vector<uint64_t> squares(513);
+        ParallelFor(1, squares.size(), [&](size_t i) {
+            std::vector<uint64_t> row(4);
+            ParallelFor(0, row.size(), [&](size_t j) { row[j] = i; });
+            squares[i] = row[0] * row[3];
+        });
+        for (size_t i = 0; i < squares.size(); ++i)
+            EXPECT_EQ(squares[i], i * i);
+    }
+    OpenFHEParallelControls.SetScheduler(scheduler);
+}
+
+TEST(UTParallel, ParallelThreadScope_limits) {
+    EXPECT_EQ(ParallelThreadScope::GetLimit(), 0u);
+    {
+        ParallelThreadScope outer(4);
+        EXPECT_EQ(ParallelThreadScope::GetLimit(), 4u);
+        EXPECT_LE(OpenFHEParallelControls.GetThreadLimit(64), 4);
+        {
+            // an inner scope cannot raise the limit
+            ParallelThreadScope inner(8);
+            EXPECT_EQ(ParallelThreadScope::GetLimit(), 4u);
+            ParallelThreadScope unlimited(0);
+            EXPECT_EQ(ParallelThreadScope::GetLimit(), 4u);
+        }
+        {
+            ParallelThreadScope inner(1);
+            EXPECT_EQ(ParallelThreadScope::GetLimit(), 1u);
+            EXPECT_EQ(OpenFHEParallelControls.GetThreadLimit(64), 1);
+#ifdef PARALLEL
+            EXPECT_EQ(omp_get_max_threads(), 1);
+#endif
+        }
+        EXPECT_EQ(ParallelThreadScope::GetLimit(), 4u);
+    }
+    EXPECT_EQ(ParallelThreadScope::GetLimit(), 0u);
+}
+
+TEST(UTParallel, ParallelThreadScope_limits_concurrency) {
+    ParallelScheduler scheduler = OpenFHEParallelControls.GetScheduler();
+    for (auto s : {ParallelScheduler::OPENMP, ParallelScheduler::THREAD_POOL}) {
+        OpenFHEParallelControls.SetScheduler(s);
+#ifdef PARALLEL
+        // more threads than the limit even on a machine with few cores, so that ignoring the limit is detected
+        int openMPThreads = omp_get_max_threads();
+        omp_set_num_threads(4);
+#endif
+        std::atomic<uint32_t> running{0};
+        std::atomic<uint32_t> maxRunning{0};
+        {
+            ParallelThreadScope scope(2);
+            ParallelFor(0, 32, [&](size_t) {
+                uint32_t current = ++running;
+                uint32_t observed = maxRunning;
+                while (current > observed && !maxRunning.compare_exchange_weak(observed, current)) {
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                --running;
+            });
+        }
+#ifdef PARALLEL
+        omp_set_num_threads(openMPThreads);
+#endif
+        EXPECT_GE(maxRunning.load(), 1u);
+        EXPECT_LE(maxRunning.load(), 2u) << "scheduler " << static_cast<int>(s);
+    }
+    OpenFHEParallelControls.SetScheduler(scheduler);
+}
+
+TEST(UTParallel, ParallelThreadScope_applies_to_pool_tasks) {
+    ParallelScheduler scheduler = OpenFHEParallelControls.GetScheduler();
+    OpenFHEParallelControls.SetScheduler(ParallelScheduler::THREAD_POOL);
+    {
+        ParallelThreadScope scope(2);
+        std::vector<uint32_t> limits(64);
+        ParallelFor(0, limits.size(), [&](size_t i) { limits[i] = ParallelThreadScope::GetLimit(); });
+        for (auto limit : limits)
+            EXPECT_EQ(limit, 2u);
+    }
+    OpenFHEParallelControls.SetScheduler(scheduler);
+}
@@ -43,6 +43,7 @@
 #include "lattice/ilparams.h"
 #include "math/math-hal.h"
 #include "math/distrgen.h"
+#include "math/hal/intnat/transformnat-simd.h"
 #include "math/nbtheory.h"
 #include "random"
 #include "testdefs.h"
@@ -378,3 +379,121 @@ void CRT_CHECK_very_big_ring_precomputed(const std::string& msg) {
 TEST(UTTransform, CRT_CHECK_very_big_ring_precomputed) {
     RUN_BIG_BACKENDS(CRT_CHECK_very_big_ring_precomputed, "CRT_CHECK_very_big_ring_precomputed")
 }
+
+// TEST CASE TO CHECK THAT NTT TABLES FOR A PRIME SHARED BY TWO RING DIMENSIONS
+// ARE KEPT SEPARATELY AND HELD BY THE NATIVE PARAMETERS
+
+TEST(UTTransform, NTT_tables_shared_prime) {
+    const usint cycloOrderBig   = 8192;
+    const usint cycloOrderSmall = 4096;
+
+    NativeInteger modulus   = FirstPrime<NativeInteger>(40, cycloOrderBig);
+    NativeInteger rootBig   = RootOfUnity<NativeInteger>(cycloOrderBig, modulus);
+    NativeInteger rootSmall = rootBig.ModMul(rootBig, modulus);
+    auto paramsBig          = std::make_shared<ILNativeParams>(cycloOrderBig, modulus, rootBig);
+    auto paramsSmall        = std::make_shared<ILNativeParams>(cycloOrderSmall, modulus, rootSmall);
+    const auto& tablesBig   = paramsBig->GetNTTTables();
+    const auto& tablesSmall = paramsSmall->GetNTTTables();
+
+    ASSERT_NE(tablesBig, nullptr);
+    ASSERT_NE(tablesSmall, nullptr);
+    EXPECT_EQ(cycloOrderBig / 2, tablesBig->rootOfUnityReverseTable.GetLength());
+    EXPECT_EQ(cycloOrderSmall / 2, tablesSmall->rootOfUnityReverseTable.GetLength());
+    EXPECT_EQ(tablesBig, ChineseRemainderTransformFTT<NativeVector>::GetTables(rootBig, cycloOrderBig, modulus));
+    EXPECT_EQ(tablesSmall, ChineseRemainderTransformFTT<NativeVector>::GetTables(rootSmall, cycloOrderSmall, modulus));
+
+    // alternating ring dimensions must give the same result as the transforms looking up their tables
+    DiscreteUniformGeneratorImpl<NativeVector> dug;
+    for (int i = 0; i < 2; i++) {
+        for (auto params : {paramsBig, paramsSmall}) {
+            NativePoly poly(dug, params, Format::COEFFICIENT);
+            NativeVector expected(params->GetRingDimension(), modulus);
+            ChineseRemainderTransformFTT<NativeVector>().ForwardTransformToBitReverse(
+                poly.GetValues(), params->GetRootOfUnity(), params->GetCyclotomicOrder(), &expected);
+
+            NativePoly transformed(poly);
+            transformed.SwitchFormat();
+            EXPECT_EQ(expected, transformed.GetValues());
+            transformed.SwitchFormat();
+            EXPECT_EQ(poly, transformed);
+        }
+    }
+
+    // handles held by the parameters stay valid after the cache is reset
+    ChineseRemainderTransformFTT<NativeVector>().Reset();
+    EXPECT_EQ(cycloOrderBig / 2, paramsBig->GetNTTTables()->rootOfUnityReverseTable.GetLength());
+}
+
+TEST(UTTransform, NTT_simd_engines) {
+    const intnat::NTTEngine defaultEngine = intnat::GetNTTEngine();
+    DiscreteUniformGeneratorImpl<NativeVector> dug;
+
+    // moduli below and above the 51-bit limit of the IFMA kernel, and small rings handled by the scalar code
+    for (usint ringDim : {8, 16, 32, 1024, 8192}) {
+        for (usint bits : {30, 50, 52, 60}) {
+            usint cycloOrder      = 2 * ringDim;
+            NativeInteger modulus = FirstPrime<NativeInteger>(bits, cycloOrder);
+            modulus               = PreviousPrime<NativeInteger>(modulus, cycloOrder);
+            NativeInteger root    = RootOfUnity<NativeInteger>(cycloOrder, modulus);
+            auto tables           = ChineseRemainderTransformFTT<NativeVector>::GetTables(root, cycloOrder, modulus);
+
+            dug.SetModulus(modulus);
+            NativeVector input = dug.GenerateVector(ringDim);
+
+            ASSERT_TRUE(intnat::SetNTTEngine(intnat::NTT_SCALAR));
+            NativeVector expected(input);
+            ChineseRemainderTransformFTT<NativeVector>().ForwardTransformToBitReverseInPlace(*tables, &expected);
+
+            for (auto engine : {intnat::NTT_AVX2, intnat::NTT_AVX512, intnat::NTT_AVX512IFMA}) {
+                if (!intnat::SetNTTEngine(engine))
+                    continue;
+                NativeVector result(input);
+                ChineseRemainderTransformFTT<NativeVector>().ForwardTransformToBitReverseInPlace(*tables, &result);
+                EXPECT_EQ(expected, result) << "forward, engine " << engine << ", n = " << ringDim << ", " << bits
+                                            << " bits";
+                ChineseRemainderTransformFTT<NativeVector>().InverseTransformFromBitReverseInPlace(*tables, &result);
+                EXPECT_EQ(input, result) << "inverse, engine " << engine << ", n = " << ringDim << ", " << bits
+                                         << " bits";
+            }
+        }
+    }
+    intnat::SetNTTEngine(defaultEngine);
+}
+
+// The Montgomery butterflies, which the scalar NTT uses when the library is built WITH_MONTGOMERY, have to agree
+// with NTL's butterflies
+TEST(UTTransform, NTT_montgomery) {
+    DiscreteUniformGeneratorImpl<NativeVector> dug;
+    for (usint ringDim : {8, 1024}) {
+        for (usint bits : {30, 50, 60}) {
+            usint cycloOrder      = 2 * ringDim;
+            NativeInteger modulus = FirstPrime<NativeInteger>(bits, cycloOrder);
+            modulus               = PreviousPrime<NativeInteger>(modulus, cycloOrder);
+            NativeInteger root    = RootOfUnity<NativeInteger>(cycloOrder, modulus);
+            auto tables           = ChineseRemainderTransformFTT<NativeVector>::GetTables(root, cycloOrder, modulus);
+
+            NativeVector table(tables->rootOfUnityReverseTable);
+            table.ToMontgomeryEq();
+            NativeVector tableI(tables->rootOfUnityInverseReverseTable);
+            tableI.ToMontgomeryEq();
+            NativeInteger cycloOrderInv = tables->cycloOrderInverse.ToMontgomery(modulus);
+            NativeInteger modulusInv    = modulus.ComputeMontgomeryInverse();
+
+            dug.SetModulus(modulus);
+            NativeVector input = dug.GenerateVector(ringDim);
+            input[0]           = modulus - 1;
+
+            NativeVector expected(input);
+            intnat::NumberTheoreticTransformNat<NativeVector>().ForwardTransformToBitReverseInPlace(
+                tables->rootOfUnityReverseTable, tables->rootOfUnityPreconReverseTable, &expected);
+            NativeVector result(input);
+            intnat::NumberTheoreticTransformNat<NativeVector>().ForwardTransformToBitReverseInPlaceMontgomery(
+                table, modulusInv, &result);
+            EXPECT_EQ(expected, result) << "forward, n = " << ringDim << ", " << bits << " bits";
+
+            intnat::NumberTheoreticTransformNat<NativeVector>().InverseTransformFromBitReverseInPlaceMontgomery(
+                tableI, cycloOrderInv, modulusInv, &result);
+            EXPECT_EQ(input, result) << "inverse, n = " << ringDim << ", " << bits << " bits";
+        }
+    }
+}
@@ -1064,8 +1064,7 @@ std::vector<ConstPlaintext> FHECKKSRNS::EvalLinearTransformPrecompute(
             newA[i] = vecA;
         }
 
-#pragma omp parallel for
-        for (int j = 0; j < gStep; j++) {
+        ParallelFor(0, gStep, [&](int j) {
             int offset = -bStep * j;
             for (int i = 0; i < bStep; i++) {
                 if (bStep * j + i < static_cast<int>(slots)) {
@@ -1079,7 +1078,7 @@ std::vector<ConstPlaintext> FHECKKSRNS::EvalLinearTransformPrecompute(
                         MakeAuxPlaintext(cc, elementParamsPtr, Rotate(vec, offset), 1, towersToDrop, vec.size());
                 }
             }
-        }
+        });
     }
 
     return result;
@@ -1209,8 +1208,7 @@ std::vector<std::vector<ConstPlaintext>> FHECKKSRNS::EvalCoeffsToSlotsPrecompute
 
         if (flagRem) {
             for (int32_t i = 0; i < bRem; i++) {
-#pragma omp parallel for
-                for (int32_t j = 0; j < gRem; j++) {
+                ParallelFor(0, gRem, [&](int32_t j) {
                     if (gRem * i + j != int32_t(numRotationsRem)) {
                         uint32_t rot = ReduceRotation(-gRem * i, slots);
                         for (uint32_t k = 0; k < slots; k++) {
@@ -1221,7 +1219,7 @@ std::vector<std::vector<ConstPlaintext>> FHECKKSRNS::EvalCoeffsToSlotsPrecompute
                         result[stop][gRem * i + j] =
                             MakeAuxPlaintext(cc, paramsVector[0], rotateTemp, 1, level0, rotateTemp.size());
                     }
-                }
+                });
             }
         }
     }
@@ -1263,8 +1261,7 @@ std::vector<std::vector<ConstPlaintext>> FHECKKSRNS::EvalCoeffsToSlotsPrecompute
 
         if (flagRem) {
             for (int32_t i = 0; i < bRem; i++) {
-#pragma omp parallel for
-                for (int32_t j = 0; j < gRem; j++) {
+                ParallelFor(0, gRem, [&](int32_t j) {
                     if (gRem * i + j != int32_t(numRotationsRem)) {
                         uint32_t rot = ReduceRotation(-gRem * i, M / 4);
                         // concatenate the coefficients on their third dimension, which corresponds to the # of slots
@@ -1279,7 +1276,7 @@ std::vector<std::vector<ConstPlaintext>> FHECKKSRNS::EvalCoeffsToSlotsPrecompute
                         result[stop][gRem * i + j] =
                             MakeAuxPlaintext(cc, paramsVector[0], rotateTemp, 1, level0, rotateTemp.size());
                     }
-                }
+                });
             }
         }
     }
@@ -1380,8 +1377,7 @@ std::vector<std::vector<ConstPlaintext>> FHECKKSRNS::EvalSlotsToCoeffsPrecompute
 
         for (int32_t s = 0; s < levelBudget - flagRem; s++) {
             for (int32_t i = 0; i < b; i++) {
-#pragma omp parallel for
-                for (int32_t j = 0; j < g; j++) {
+                ParallelFor(0, g, [&](int32_t j) {
                     if (g * i + j != int32_t(numRotations)) {
                         uint32_t rot = ReduceRotation(-g * i * (1 << (s * layersCollapse)), slots);
                         if ((flagRem == 0) && (s == levelBudget - flagRem - 1)) {
@@ -1395,15 +1391,14 @@ std::vector<std::vector<ConstPlaintext>> FHECKKSRNS::EvalSlotsToCoeffsPrecompute
                         result[s][g * i + j] =
                             MakeAuxPlaintext(cc, paramsVector[s], rotateTemp, 1, level0 + s, rotateTemp.size());
                     }
-                }
+                });
             }
         }
 
         if (flagRem) {
             int32_t s = levelBudget - flagRem;
             for (int32_t i = 0; i < bRem; i++) {
-#pragma omp parallel for
-                for (int32_t j = 0; j < gRem; j++) {
+                ParallelFor(0, gRem, [&](int32_t j) {
                     if (gRem * i + j != int32_t(numRotationsRem)) {
                         uint32_t rot = ReduceRotation(-gRem * i * (1 << (s * layersCollapse)), slots);
                         for (uint32_t k = 0; k < slots; k++) {
@@ -1414,7 +1409,7 @@ std::vector<std::vector<ConstPlaintext>> FHECKKSRNS::EvalSlotsToCoeffsPrecompute
                         result[s][gRem * i + j] =
                             MakeAuxPlaintext(cc, paramsVector[s], rotateTemp, 1, level0 + s, rotateTemp.size());
                     }
-                }
+                });
             }
         }
     }
@@ -1428,8 +1423,7 @@ std::vector<std::vector<ConstPlaintext>> FHECKKSRNS::EvalSlotsToCoeffsPrecompute
 
         for (int32_t s = 0; s < levelBudget - flagRem; s++) {
             for (int32_t i = 0; i < b; i++) {
-#pragma omp parallel for
-                for (int32_t j = 0; j < g; j++) {
+                ParallelFor(0, g, [&](int32_t j) {
                     if (g * i + j != int32_t(numRotations)) {
                         uint32_t rot = ReduceRotation(-g * i * (1 << (s * layersCollapse)), M / 4);
                         // concatenate the coefficients horizontally on their third dimension, which corresponds to the # of slots
@@ -1447,15 +1441,14 @@ std::vector<std::vector<ConstPlaintext>> FHECKKSRNS::EvalSlotsToCoeffsPrecompute
                         result[s][g * i + j] =
                             MakeAuxPlaintext(cc, paramsVector[s], rotateTemp, 1, level0 + s, rotateTemp.size());
                     }
-                }
+                });
             }
         }
 
         if (flagRem) {
             int32_t s = levelBudget - flagRem;
             for (int32_t i = 0; i < bRem; i++) {
-#pragma omp parallel for
-                for (int32_t j = 0; j < gRem; j++) {
+                ParallelFor(0, gRem, [&](int32_t j) {
                     if (gRem * i + j != int32_t(numRotationsRem)) {
                         uint32_t rot = ReduceRotation(-gRem * i * (1 << (s * layersCollapse)), M / 4);
                         // concatenate the coefficients horizontally on their third dimension, which corresponds to the # of slots
@@ -1470,7 +1463,7 @@ std::vector<std::vector<ConstPlaintext>> FHECKKSRNS::EvalSlotsToCoeffsPrecompute
                         result[s][gRem * i + j] =
                             MakeAuxPlaintext(cc, paramsVector[s], rotateTemp, 1, level0 + s, rotateTemp.size());
                     }
-                }
+                });
             }
         }
     }
@@ -1509,10 +1502,7 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalLinearTransform(const std::vector<ConstPlai
     std::vector<Ciphertext<DCRTPoly>> fastRotation(bStep - 1);
 
     // hoisted automorphisms
-#pragma omp parallel for
-    for (uint32_t j = 1; j < bStep; j++) {
-        fastRotation[j - 1] = cc->EvalFastRotationExt(ct, j, digits, true);
-    }
+    ParallelFor(1, bStep, [&](uint32_t j) { fastRotation[j - 1] = cc->EvalFastRotationExt(ct, j, digits, true); });
 
     Ciphertext<DCRTPoly> result;
     DCRTPoly first;
@@ -1642,15 +1632,14 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalCoeffsToSlots(const std::vector<std::vector
         auto digits = cc->EvalFastRotationPrecompute(result);
 
         std::vector<Ciphertext<DCRTPoly>> fastRotation(g);
-#pragma omp parallel for
-        for (int32_t j = 0; j < g; j++) {
+        ParallelFor(0, g, [&](int32_t j) {
             if (rot_in[s][j] != 0) {
                 fastRotation[j] = cc->EvalFastRotationExt(result, rot_in[s][j], digits, true);
             }
             else {
                 fastRotation[j] = cc->KeySwitchExt(result, true);
             }
-        }
+        });
 
         Ciphertext<DCRTPoly> outer;
         DCRTPoly first;
@@ -1704,15 +1693,14 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalCoeffsToSlots(const std::vector<std::vector
         auto digits = cc->EvalFastRotationPrecompute(result);
         std::vector<Ciphertext<DCRTPoly>> fastRotation(gRem);
 
-#pragma omp parallel for
-        for (int32_t j = 0; j < gRem; j++) {
+        ParallelFor(0, gRem, [&](int32_t j) {
             if (rot_in[stop][j] != 0) {
                 fastRotation[j] = cc->EvalFastRotationExt(result, rot_in[stop][j], digits, true);
             }
             else {
                 fastRotation[j] = cc->KeySwitchExt(result, true);
             }
-        }
+        });
 
         Ciphertext<DCRTPoly> outer;
         DCRTPoly first;
@@ -1854,15 +1842,14 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalSlotsToCoeffs(const std::vector<std::vector
         auto digits = cc->EvalFastRotationPrecompute(result);
 
         std::vector<Ciphertext<DCRTPoly>> fastRotation(g);
-#pragma omp parallel for
-        for (int32_t j = 0; j < g; j++) {
+        ParallelFor(0, g, [&](int32_t j) {
             if (rot_in[s][j] != 0) {
                 fastRotation[j] = cc->EvalFastRotationExt(result, rot_in[s][j], digits, true);
             }
             else {
                 fastRotation[j] = cc->KeySwitchExt(result, true);
             }
-        }
+        });
 
         Ciphertext<DCRTPoly> outer;
         DCRTPoly first;
@@ -1918,15 +1905,14 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalSlotsToCoeffs(const std::vector<std::vector
         std::vector<Ciphertext<DCRTPoly>> fastRotation(gRem);
 
         int32_t s = levelBudget - flagRem;
-#pragma omp parallel for
-        for (int32_t j = 0; j < gRem; j++) {
+        ParallelFor(0, gRem, [&](int32_t j) {
             if (rot_in[s][j] != 0) {
                 fastRotation[j] = cc->EvalFastRotationExt(result, rot_in[s][j], digits, true);
             }
             else {
                 fastRotation[j] = cc->KeySwitchExt(result, true);
             }
-        }
+        });
 
         Ciphertext<DCRTPoly> outer;
         DCRTPoly first;
@@ -37,6 +37,9 @@
 #include "UnitTestUtils.h"
 #include "include/gtest/gtest.h"
 
+#include <thread>
+#include <vector>
+
 using namespace lbcrypto;
 
 class UTGENERAL_CRYPTOCONTEXTS : public ::testing::Test {
@@ -114,3 +117,54 @@ TEST_F(UTGENERAL_CRYPTOCONTEXTS, coexisting_ckks_cryptocontexts) {
     EXPECT_TRUE(checkEquality(values, results->GetRealPackedValue()))
         << "static data for the first cryptocontext may be overriden";
 }
+
+TEST_F(UTGENERAL_CRYPTOCONTEXTS, cryptocontexts_with_thread_limits) {
+    std::vector<double> values = {0.5, 0.25, -1.0, 2.0};
+    std::vector<double> squares;
+    for (auto v : values)
+        squares.push_back(v * v);
+
+    std::vector<CryptoContext<DCRTPoly>> contexts;
+    std::vector<PrivateKey<DCRTPoly>> secretKeys;
+    std::vector<Ciphertext<DCRTPoly>> ciphertexts;
+    for (uint32_t depth : {2, 3}) {
+        CCParams<CryptoContextCKKSRNS> parameters;
+        parameters.SetMultiplicativeDepth(depth);
+        parameters.SetScalingModSize(40);
+        parameters.SetRingDim(1 << 12);
+        parameters.SetBatchSize(8);
+        parameters.SetSecurityLevel(HEStd_NotSet);
+
+        CryptoContext<DCRTPoly> cc = GenCryptoContext(parameters);
+        cc->Enable(PKE);
+        cc->Enable(KEYSWITCH);
+        cc->Enable(LEVELEDSHE);
+
+        KeyPair<DCRTPoly> keys = cc->KeyGen();
+        cc->EvalMultKeyGen(keys.secretKey);
+        contexts.push_back(cc);
+        secretKeys.push_back(keys.secretKey);
+        ciphertexts.push_back(cc->Encrypt(keys.publicKey, cc->MakeCKKSPackedPlaintext(values)));
+    }
+
+    // the two contexts evaluate concurrently with different per-call thread budgets; contexts with
+    // equal parameters are shared, so the budget belongs to the calling thread and not to the context
+    auto run = [&](size_t i, uint32_t numThreads, bool* result) {
+        for (int j = 0; j < 4; ++j) {
+            ParallelThreadScope scope(numThreads);
+            auto square = contexts[i]->EvalMult(ciphertexts[i], ciphertexts[i]);
+            Plaintext results;
+            contexts[i]->Decrypt(secretKeys[i], square, &results);
+            results->SetLength(values.size());
+            *result = checkEquality(squares, results->GetRealPackedValue(), 0.0001) && *result;
+        }
+    };
+    bool result0 = true;
+    bool result1 = true;
+    std::thread thread0(run, 0, 1, &result0);
+    std::thread thread1(run, 1, 0, &result1);
+    thread0.join();
+    thread1.join();
+    EXPECT_TRUE(result0) << "calls limited to a single thread";
+    EXPECT_TRUE(result1) << "calls without thread limit";
+}
@@ -37,6 +37,7 @@
 #include "include/gtest/gtest.h"
 #include <iostream>
 #include <sstream>
+#include <thread>
 #include <vector>
 #include <cxxabi.h>
 #include "utils/demangle.h"
@@ -255,3 +256,31 @@ TEST_P(UTGENERAL_ENCRYPT_DECRYPT, ENCRYPT) {
 }
 
 INSTANTIATE_TEST_SUITE_P(UnitTests, UTGENERAL_ENCRYPT_DECRYPT, ::testing::ValuesIn(testCases), testName);
+
+// ciphertexts are encrypted concurrently; every thread samples from its own PRNG stream
+TEST(UTGENERAL_ENCRYPT_DECRYPT_CONCURRENT, ENCRYPT) {
+    setupSignals();
+    CryptoContextFactory<DCRTPoly>::ReleaseAllContexts();
+    CryptoContext<DCRTPoly> cc(UnitTestGenerateContext(testCases[0].params));
+    KeyPair<DCRTPoly> kp = cc->KeyGen();
+
+    constexpr size_t numCiphertexts = 4;
+    std::vector<Plaintext> plaintexts;
+    for (size_t i = 0; i < numCiphertexts; i++)
+        plaintexts.push_back(cc->MakeStringPlaintext("ciphertext " + std::to_string(i)));
+
+    std::vector<Ciphertext<DCRTPoly>> ciphertexts(numCiphertexts);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < numCiphertexts; i++)
+        threads.emplace_back([&, i]() { ciphertexts[i] = cc->Encrypt(kp.publicKey, plaintexts[i]); });
+    for (auto& t : threads)
+        t.join();
+
+    for (size_t i = 0; i < numCiphertexts; i++) {
+        Plaintext result;
+        cc->Decrypt(kp.secretKey, ciphertexts[i], &result);
+        EXPECT_EQ(*plaintexts[i], *result) << "concurrent encrypt/decrypt failed for ciphertext " << i;
+    }
+
+    CryptoContextFactory<DCRTPoly>::ReleaseAllContexts();
+}